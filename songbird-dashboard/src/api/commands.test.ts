@@ -17,6 +17,8 @@ import {
   sendTestAudio,
   sendSetVolume,
   sendUnlock,
+  sendProfile,
+  sendTranscript,
   deleteCommand,
 } from './commands';
 
@@ -139,6 +141,42 @@ describe('sendUnlock', () => {
   });
 });
 
+describe('sendProfile', () => {
+  it('sends a profile command without reset by default', async () => {
+    await sendProfile('sb01');
+    expect(apiPost).toHaveBeenCalledWith('/v1/devices/sb01/commands', {
+      cmd: 'profile',
+      params: { reset: false },
+    });
+  });
+
+  it('sends a profile command that clears the statistics', async () => {
+    await sendProfile('sb01', true);
+    expect(apiPost).toHaveBeenCalledWith('/v1/devices/sb01/commands', {
+      cmd: 'profile',
+      params: { reset: true },
+    });
+  });
+});
+
+describe('sendTranscript', () => {
+  it('sends a transcript command without clear by default', async () => {
+    await sendTranscript('sb01');
+    expect(apiPost).toHaveBeenCalledWith('/v1/devices/sb01/commands', {
+      cmd: 'transcript',
+      params: { clear: false },
+    });
+  });
+
+  it('sends a transcript command that starts a fresh recording', async () => {
+    await sendTranscript('sb01', true);
+    expect(apiPost).toHaveBeenCalledWith('/v1/devices/sb01/commands', {
+      cmd: 'transcript',
+      params: { clear: true },
+    });
+  });
+});
+
 describe('deleteCommand', () => {
   it('calls apiDelete with command ID and device_uid query param', async () => {
     await deleteCommand('cmd-123', 'dev:456');
@@ -104,6 +104,28 @@ export async function sendUnlock(
   return sendCommand(serialNumber, 'unlock', { lock_type: lockType });
 }
 
+/**
+ * Send a profile command (the device dumps its profiling statistics to
+ * serial and acks with the slowest scope; debug firmware only)
+ */
+export async function sendProfile(
+  serialNumber: string,
+  reset: boolean = false
+): Promise<CommandResponse> {
+  return sendCommand(serialNumber, 'profile', { reset });
+}
+
+/**
+ * Send a transcript command (the device dumps its recorded Notecard
+ * transactions to serial and acks with the count; debug firmware only)
+ */
+export async function sendTranscript(
+  serialNumber: string,
+  clear: boolean = false
+): Promise<CommandResponse> {
+  return sendCommand(serialNumber, 'transcript', { clear });
+}
+
 /**
  * Delete a command from history
  */
@@ -13,6 +13,8 @@ import {
   Music,
   Trash2,
   Unlock,
+  Gauge,
+  FileText,
 } from 'lucide-react';
 import { Card, CardContent, CardHeader, CardTitle } from '@/components/ui/card';
 import { Button } from '@/components/ui/button';
@@ -45,6 +47,8 @@ const commandTypeLabels: Record<CommandType, string> = {
   test_audio: 'Test Audio',
   set_volume: 'Set Volume',
   unlock: 'Unlock',
+  profile: 'Profile',
+  transcript: 'Transcript',
 };
 
 const commandTypeIcons: Record<CommandType, React.ReactNode> = {
@@ -54,6 +58,8 @@ const commandTypeIcons: Record<CommandType, React.ReactNode> = {
   test_audio: <Music className="h-4 w-4" />,
   set_volume: <Music className="h-4 w-4" />,
   unlock: <Unlock className="h-4 w-4" />,
+  profile: <Gauge className="h-4 w-4" />,
+  transcript: <FileText className="h-4 w-4" />,
 };
 
 function StatusBadge({ status }: { status: CommandStatus }) {
@@ -22,7 +22,7 @@ export type AlertType =
   | 'motion';
 
 // Command types
-export type CommandType = 'ping' | 'locate' | 'play_melody' | 'test_audio' | 'set_volume' | 'unlock';
+export type CommandType = 'ping' | 'locate' | 'play_melody' | 'test_audio' | 'set_volume' | 'unlock' | 'profile' | 'transcript';
 
 // Command status
 export type CommandStatus = 'queued' | 'sent' | 'ok' | 'error' | 'ignored';
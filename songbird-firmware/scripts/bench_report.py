@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Report the Songbird native microbenchmarks (test/test_bench) as JSON.
+
+Reads the BENCH lines printed by the benchmark run, adds each function's code
+size from the firmware ELF (arm-none-eabi-nm), and writes one JSON document:
+
+    {"benchmarks": [{"name": "envApplyVar", "ns_per_op": 41.2,
+                     "allocs_per_op": 0.0, "iterations": 524288,
+                     "size_bytes": 212}, ...]}
+
+size_bytes is null when no ELF is given or the symbol is not in it (inlined
+or discarded). With --baseline, each function is compared against an earlier
+report and the script exits 1 if any got slower by more than --threshold
+percent, grew in code size, or started allocating.
+
+Usage:
+    pio test -e native_bench -v | python3 scripts/bench_report.py -
+    python3 scripts/bench_report.py bench.log \\
+        --elf .pio/build/blues_cygnet/firmware.elf -o bench.json
+    python3 scripts/bench_report.py bench.log --baseline bench.json --threshold 10
+"""
+import argparse
+import json
+import re
+import subprocess
+import sys
+
+BENCH_LINE = re.compile(r"BENCH (\{.*\})")
+NM_LINE = re.compile(r"^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (.+)$")
+
+
+def parse_bench(text: str) -> list:
+    results = []
+    for match in BENCH_LINE.finditer(text):
+        results.append(json.loads(match.group(1)))
+    return results
+
+
+def load_symbol_sizes(elf: str, nm: str) -> dict:
+    """Map demangled function name (without arguments) to its size in bytes."""
+    output = subprocess.run([nm, "--print-size", "--demangle", elf],
+                            check=True, capture_output=True, text=True).stdout
+    sizes = {}
+    for line in output.splitlines():
+        match = NM_LINE.match(line.strip())
+        if not match:
+            continue
+        name = match.group(2).split("(", 1)[0]
+        sizes[name] = sizes.get(name, 0) + int(match.group(1), 16)
+    return sizes
+
+
+def compare(results: list, baseline: list, threshold: float) -> list:
+    previous = {entry["name"]: entry for entry in baseline}
+    regressions = []
+    for entry in results:
+        old = previous.get(entry["name"])
+        if old is None:
+            continue
+        if old["ns_per_op"] > 0:
+            change = 100.0 * (entry["ns_per_op"] - old["ns_per_op"]) / old["ns_per_op"]
+            if change > threshold:
+                regressions.append("%s: %.2f -> %.2f ns/op (+%.1f%%)"
+                                   % (entry["name"], old["ns_per_op"], entry["ns_per_op"], change))
+        if entry["allocs_per_op"] > old["allocs_per_op"]:
+            regressions.append("%s: allocates %.4f per op (was %.4f)"
+                               % (entry["name"], entry["allocs_per_op"], old["allocs_per_op"]))
+        if entry.get("size_bytes") and old.get("size_bytes") \
+                and entry["size_bytes"] > old["size_bytes"]:
+            regressions.append("%s: %d -> %d bytes"
+                               % (entry["name"], old["size_bytes"], entry["size_bytes"]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report the Songbird native microbenchmarks")
+    parser.add_argument("log", nargs="?", default="-", help="benchmark output, or - for stdin")
+    parser.add_argument("--elf", help="firmware ELF to take code sizes from")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--baseline", help="earlier report to compare against")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed ns/op increase over the baseline, in percent")
+    parser.add_argument("-o", "--output", help="write the report here instead of stdout")
+    args = parser.parse_args()
+
+    if args.log == "-":
+        text = sys.stdin.read()
+    else:
+        with open(args.log) as f:
+            text = f.read()
+
+    results = parse_bench(text)
+    if not results:
+        print("no BENCH lines found", file=sys.stderr)
+        return 2
+
+    sizes = load_symbol_sizes(args.elf, args.nm) if args.elf else {}
+    for entry in results:
+        entry["size_bytes"] = sizes.get(entry["name"])
+
+    report = json.dumps({"benchmarks": results}, indent=2) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report)
+    else:
+        sys.stdout.write(report)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)["benchmarks"]
+        regressions = compare(results, baseline, args.threshold)
+        for line in regressions:
+            print("REGRESSION " + line, file=sys.stderr)
+        if regressions:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
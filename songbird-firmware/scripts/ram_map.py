@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""
+Print the Songbird RAM budget from the firmware's GNU ld map file.
+
+Lists every statically allocated object in RAM with its size, largest first,
+then totals by kind and what is left for the heap:
+
+    kind           bytes  object                         module
+    rtos.stack      4096  notecard                       SongbirdTasks.cpp
+    bss             4096  s_buffer                       SongbirdTranscript.cpp
+    ...
+
+Kernel objects are named by their RTOS_STATIC section (".bss.rtos.<kind>.
+<name>", see SongbirdSync.h) and reported as rtos.stack, rtos.tcb,
+rtos.queue or rtos.sync. Everything else is data or bss, named after its
+-fdata-sections input section. With --min-heap, the script exits 1 if fewer
+than that many bytes remain between the end of .bss and the main stack.
+
+Loaded as a PlatformIO extra_script, it adds -Map to the link and registers
+a "ram_map" target that prints the report for the current environment:
+
+    pio run -e blues_cygnet -t ram_map
+    python3 scripts/ram_map.py .pio/build/blues_cygnet/firmware.map --min-heap 8192
+"""
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+REGION_LINE = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+OUTPUT_SECTION = re.compile(r"^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+))?(?:\s+load address .*)?\s*$")
+INPUT_SECTION = re.compile(r"^ ([^\s*]\S*)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$")
+CONTINUATION = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address .*|\s+(\S.*))?$")
+MIN_STACK = re.compile(r"\b_Min_Stack_Size\s*=\s*(0x[0-9a-fA-F]+|\d+)")
+
+# Output section the STM32 linker scripts use to reserve the minimum
+# heap and main stack; it holds no objects
+HEAP_STACK_SECTION = "._user_heap_stack"
+
+
+def parse_map(text: str, region: str) -> dict:
+    """Collect the RAM region, RAM output sections and their input sections."""
+    lines = text.splitlines()
+    ram = None
+    min_stack = 0
+    outputs = []
+    inputs = []
+
+    in_memory = False
+    in_layout = False
+    pending = None  # (kind, name) waiting for its address line
+    current = None  # Output section the input sections belong to
+
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            in_memory = True
+            continue
+        if line.startswith("Linker script and memory map"):
+            in_memory = False
+            in_layout = True
+            continue
+
+        if in_memory:
+            match = REGION_LINE.match(line)
+            if match and match.group(1) == region:
+                ram = (int(match.group(2), 16), int(match.group(3), 16))
+            continue
+        if not in_layout:
+            continue
+
+        match = MIN_STACK.search(line)
+        if match:
+            min_stack = int(match.group(1), 0)
+            continue
+
+        if pending is not None:
+            kind, name = pending
+            pending = None
+            match = CONTINUATION.match(line)
+            if match:
+                address, size = int(match.group(1), 16), int(match.group(2), 16)
+                if kind == "output":
+                    current = {"name": name, "address": address, "size": size}
+                    outputs.append(current)
+                elif current is not None and match.group(3):
+                    inputs.append((current, name, address, size, match.group(3)))
+                continue
+
+        match = OUTPUT_SECTION.match(line)
+        if match:
+            if match.group(2) is None:
+                pending = ("output", match.group(1))
+            else:
+                current = {"name": match.group(1), "address": int(match.group(2), 16),
+                           "size": int(match.group(3), 16)}
+                outputs.append(current)
+            continue
+
+        match = INPUT_SECTION.match(line)
+        if match and current is not None:
+            if match.group(2) is None:
+                pending = ("input", match.group(1))
+            else:
+                inputs.append((current, match.group(1), int(match.group(2), 16),
+                               int(match.group(3), 16), match.group(4)))
+
+    if ram is None:
+        raise ValueError("memory region %s not found in the map" % region)
+
+    def in_ram(address: int) -> bool:
+        return ram[0] <= address < ram[0] + ram[1]
+
+    ram_outputs = [out for out in outputs if out["size"] > 0 and in_ram(out["address"])]
+    objects = []
+    for out, name, address, size, source in inputs:
+        if size == 0 or not in_ram(address) or out["name"] == HEAP_STACK_SECTION:
+            continue
+        kind, obj = classify(name)
+        objects.append({"kind": kind, "object": obj, "size": size,
+                        "module": module_name(source)})
+
+    return {"ram": ram, "min_stack": min_stack, "outputs": ram_outputs, "objects": objects}
+
+
+def classify(section: str) -> tuple:
+    """Split an input section name into (kind, object)."""
+    if section.startswith(".bss.rtos."):
+        parts = section[len(".bss.rtos."):].split(".", 1)
+        return ("rtos." + parts[0], parts[1] if len(parts) > 1 else "")
+    if section == "COMMON":
+        return ("bss", "")
+    kind, _, obj = section.lstrip(".").partition(".")
+    if kind.startswith("data") or kind.startswith("tdata"):
+        kind = "data"
+    elif kind.startswith("bss") or kind.startswith("tbss"):
+        kind = "bss"
+    return (kind, obj)
+
+
+def module_name(source: str) -> str:
+    name = os.path.basename(source.strip())
+    return name[:-2] if name.endswith(".o") else name
+
+
+def demangle(objects: list, cxxfilt: str) -> None:
+    """Demangle C++ object names in place, when a c++filt is available."""
+    tool = shutil.which(cxxfilt) or shutil.which("c++filt")
+    mangled = [obj for obj in objects if obj["object"].startswith("_Z")]
+    if tool is None or not mangled:
+        return
+    output = subprocess.run([tool], input="\n".join(obj["object"] for obj in mangled),
+                            check=True, capture_output=True, text=True).stdout
+    for obj, name in zip(mangled, output.splitlines()):
+        obj["object"] = name
+
+
+def budget(parsed: dict) -> dict:
+    static = sum(out["size"] for out in parsed["outputs"] if out["name"] != HEAP_STACK_SECTION)
+    ram_size = parsed["ram"][1]
+    return {"ram": ram_size, "static": static, "min_stack": parsed["min_stack"],
+            "heap": ram_size - static - parsed["min_stack"]}
+
+
+def report(parsed: dict, top: int, out) -> dict:
+    objects = sorted(parsed["objects"], key=lambda obj: (-obj["size"], obj["kind"], obj["object"]))
+    shown = objects if top <= 0 else objects[:top]
+
+    out.write("%-12s %7s  %-30s %s\n" % ("kind", "bytes", "object", "module"))
+    for obj in shown:
+        out.write("%-12s %7d  %-30s %s\n" % (obj["kind"], obj["size"],
+                                             obj["object"] or "-", obj["module"]))
+    if len(shown) < len(objects):
+        hidden = objects[len(shown):]
+        out.write("%-12s %7d  (%d more)\n" % ("...", sum(obj["size"] for obj in hidden),
+                                             len(hidden)))
+
+    totals = {}
+    for obj in objects:
+        totals[obj["kind"]] = totals.get(obj["kind"], 0) + obj["size"]
+    out.write("\nBy kind\n")
+    for kind in sorted(totals, key=lambda kind: -totals[kind]):
+        out.write("  %-14s %7d\n" % (kind, totals[kind]))
+
+    result = budget(parsed)
+    ram = result["ram"]
+    out.write("\nBudget (%d bytes of RAM)\n" % ram)
+    out.write("  %-14s %7d  %5.1f%%  (.data, .bss and alignment)\n"
+              % ("static", result["static"], 100.0 * result["static"] / ram))
+    out.write("  %-14s %7d  %5.1f%%  (_Min_Stack_Size)\n"
+              % ("main stack", result["min_stack"], 100.0 * result["min_stack"] / ram))
+    out.write("  %-14s %7d  %5.1f%%\n"
+              % ("heap", result["heap"], 100.0 * result["heap"] / ram))
+    return result
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("map", help="linker map file (firmware.map)")
+    parser.add_argument("--region", default="RAM", help="memory region to report (default RAM)")
+    parser.add_argument("--top", type=int, default=0, help="only list the N largest objects")
+    parser.add_argument("--min-heap", type=int, default=0,
+                        help="exit 1 if fewer bytes than this remain for the heap")
+    parser.add_argument("--cxxfilt", default="arm-none-eabi-c++filt", help="demangler")
+    args = parser.parse_args()
+
+    with open(args.map) as f:
+        parsed = parse_map(f.read(), args.region)
+    demangle(parsed["objects"], args.cxxfilt)
+
+    result = report(parsed, args.top, sys.stdout)
+    if result["heap"] < args.min_heap:
+        print("\nheap %d bytes is below the %d byte minimum" % (result["heap"], args.min_heap),
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+def register_target(env) -> None:
+    """PlatformIO: write a map next to the ELF and add the ram_map target."""
+    map_path = "$BUILD_DIR/${PROGNAME}.map"
+    env.Append(LINKFLAGS=["-Wl,-Map," + map_path])
+    script = os.path.join(env.subst("$PROJECT_DIR"), "scripts", "ram_map.py")
+    env.AddCustomTarget(
+        name="ram_map",
+        dependencies="$BUILD_DIR/${PROGNAME}.elf",
+        actions='"$PYTHONEXE" "%s" "%s"' % (script, map_path),
+        title="RAM Map",
+        description="Print per-object static RAM use and the heap left over",
+    )
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    Import("env")  # noqa: F821 - provided by PlatformIO's SCons environment
+    register_target(env)  # noqa: F821
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""
+Recommend Songbird task stack sizes from static analysis and field data.
+
+Static: the build writes a .su file per translation unit (-fstack-usage) with
+each function's frame size. The call graph comes from the firmware ELF
+(arm-none-eabi-objdump -d, direct bl/b.w calls). The worst case for a task is
+the deepest chain of frames below its entry point, plus the context the port
+saves on the task stack when it is switched out.
+
+Measured: with --health, the stack_free_<task> fields from health.qo bodies
+(one JSON object per line, bare bodies or Notehub events with a "body") give
+the lowest free stack seen in the field. The used stack is then the configured
+size minus that.
+
+The recommendation is the larger of the two plus --margin percent, rounded up
+to 16 words. Static results are a lower bound when the chain reaches an
+indirect call (function pointers, virtual calls) or a function without a .su
+file (precompiled libc): those are listed with the task, and --assume
+NAME=BYTES supplies a frame size for any of them.
+
+    task      entry           size  static  measured  recommended  notes
+    notecard  NotecardTask    4096    1768      1210         2240  indirect, unknown: _vfprintf_r
+
+Usage:
+    pio run -e blues_cygnet -t stack_usage
+    python3 scripts/stack_usage.py .pio/build/blues_cygnet \\
+        --health health.jsonl --assume _vfprintf_r=1200 --check
+"""
+import argparse
+import glob
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+
+SU_LINE = re.compile(r"^(.*?):(\d+):(\d+):(.*)\t(\d+)\t(\S+)$")
+STACK_DEFINE = re.compile(r"^#define\s+STACK_(\w+)\s+(\d+)")
+FUNCTION_HEADER = re.compile(r"^[0-9a-fA-F]+ <(.+)>:$")
+DIRECT_CALL = re.compile(r"\t(?:bl|b\.w|b)\s+[0-9a-fA-F]+ <(.+)>\s*$")
+INDIRECT_CALL = re.compile(r"\t(?:blx\s+r\d+|bx\s+r(?:[0-9]|1[0-2])\b)")
+OFFSET = re.compile(r"\+0x[0-9a-fA-F]+$")
+TEMPLATE_ARGS = re.compile(r"<[^<>]*>")
+
+# Cortex-M4F with FPU state: 26 words stacked by the exception entry plus
+# r4-r11, lr and s16-s31 saved by the FreeRTOS port
+CONTEXT_BYTES = 204
+
+STACK_WORD_BYTES = 4
+ROUND_WORDS = 16
+MIN_WORDS = 64
+
+
+def function_key(name: str) -> str:
+    """Reduce a .su or demangled name to its qualified name.
+
+    .su files spell parameter types as written (uint16_t) and objdump spells
+    them canonically (unsigned short), so only the name is compared;
+    overloads and same-named static functions share the larger frame.
+    """
+    name = name.replace("(anonymous namespace)::", "")
+    while TEMPLATE_ARGS.search(name):
+        name = TEMPLATE_ARGS.sub("", name)
+    name = name.split("(", 1)[0].strip()
+    return name.split(" ")[-1]
+
+
+def load_frames(build_dir: str) -> dict:
+    """Map function key to (frame bytes, dynamic) from every .su file."""
+    frames = {}
+    for path in glob.glob(os.path.join(build_dir, "**", "*.su"), recursive=True):
+        with open(path) as f:
+            for line in f:
+                match = SU_LINE.match(line.rstrip("\n"))
+                if not match:
+                    continue
+                key = function_key(match.group(4))
+                size = int(match.group(5))
+                dynamic = "dynamic" in match.group(6)
+                old = frames.get(key, (0, False))
+                frames[key] = (max(old[0], size), old[1] or dynamic)
+    return frames
+
+
+def load_call_graph(elf: str, objdump: str) -> tuple:
+    """Direct callees and indirect-call flags per function key."""
+    output = subprocess.run([objdump, "-d", "-C", "--no-show-raw-insn", elf],
+                            check=True, capture_output=True, text=True).stdout
+    calls = {}
+    indirect = set()
+    current = None
+    for line in output.splitlines():
+        match = FUNCTION_HEADER.match(line)
+        if match:
+            current = function_key(match.group(1))
+            calls.setdefault(current, set())
+            continue
+        if current is None:
+            continue
+        match = DIRECT_CALL.search(line)
+        if match:
+            target = match.group(1)
+            if OFFSET.search(target):
+                continue  # Branch within a function
+            key = function_key(target)
+            if key != current:
+                calls[current].add(key)
+        elif INDIRECT_CALL.search(line):
+            indirect.add(current)
+    return calls, indirect
+
+
+class Analysis:
+    """Worst-case stack depth below each function, memoized."""
+
+    def __init__(self, frames: dict, calls: dict, indirect: set, assumed: dict):
+        self.frames = frames
+        self.calls = calls
+        self.indirect = indirect
+        self.assumed = assumed
+        self.memo = {}
+        self.active = set()
+
+    def frame(self, key: str) -> int:
+        if key in self.assumed:
+            return self.assumed[key]
+        return self.frames.get(key, (0, False))[0]
+
+    def worst(self, key: str) -> dict:
+        """Deepest chain from key: bytes, path and what made it uncertain."""
+        if key in self.memo:
+            return self.memo[key]
+        if key in self.active:
+            return {"bytes": 0, "path": [key], "notes": {"recursion: " + key}}
+
+        self.active.add(key)
+        notes = set()
+        if key not in self.frames and key not in self.assumed:
+            notes.add("unknown: " + key)
+        elif self.frames.get(key, (0, False))[1]:
+            notes.add("dynamic: " + key)
+        if key in self.indirect:
+            notes.add("indirect")
+
+        deepest = {"bytes": 0, "path": []}
+        for callee in sorted(self.calls.get(key, ())):
+            result = self.worst(callee)
+            notes |= result["notes"]
+            if result["bytes"] > deepest["bytes"]:
+                deepest = result
+        self.active.discard(key)
+
+        result = {"bytes": self.frame(key) + deepest["bytes"],
+                  "path": [key] + deepest["path"], "notes": notes}
+        self.memo[key] = result
+        return result
+
+
+def load_stack_sizes(config: str) -> dict:
+    """STACK_<TASK> defines from SongbirdConfig.h, in bytes."""
+    sizes = {}
+    with open(config) as f:
+        for line in f:
+            match = STACK_DEFINE.match(line)
+            if match:
+                sizes[match.group(1).lower()] = int(match.group(2)) * STACK_WORD_BYTES
+    return sizes
+
+
+def load_stack_free(path: str) -> dict:
+    """Lowest stack_free_<task> per task over all health bodies in the file."""
+    lowest = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            note = json.loads(line)
+            body = note.get("body", note)
+            for field, value in body.items():
+                if field.startswith("stack_free_"):
+                    task = field[len("stack_free_"):]
+                    lowest[task] = min(lowest.get(task, value), value)
+    return lowest
+
+
+def recommend(needed: int, margin: float) -> int:
+    words = math.ceil(needed * (1 + margin / 100.0) / STACK_WORD_BYTES)
+    words = max(MIN_WORDS, math.ceil(words / ROUND_WORDS) * ROUND_WORDS)
+    return words * STACK_WORD_BYTES
+
+
+def entry_name(task: str) -> str:
+    return task.capitalize() + "Task"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("build_dir", help="PlatformIO build directory (.pio/build/<env>)")
+    parser.add_argument("--elf", help="firmware ELF (default <build_dir>/firmware.elf)")
+    parser.add_argument("--config", default=os.path.join(os.path.dirname(__file__), "..", "src",
+                                                         "core", "SongbirdConfig.h"),
+                        help="header with the STACK_* sizes")
+    parser.add_argument("--health", help="health.qo bodies, one JSON object per line")
+    parser.add_argument("--margin", type=float, default=25.0, help="safety margin in percent")
+    parser.add_argument("--assume", action="append", default=[], metavar="NAME=BYTES",
+                        help="frame size for a function without a .su entry")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump", help="objdump to use")
+    parser.add_argument("--paths", action="store_true", help="print each task's deepest chain")
+    parser.add_argument("--check", action="store_true",
+                        help="exit 1 if a configured stack is below its recommendation")
+    args = parser.parse_args()
+
+    assumed = {}
+    for item in args.assume:
+        name, _, size = item.partition("=")
+        assumed[function_key(name)] = int(size)
+
+    frames = load_frames(args.build_dir)
+    if not frames:
+        print("no .su files under %s (build with -fstack-usage)" % args.build_dir, file=sys.stderr)
+        return 2
+    elf = args.elf or os.path.join(args.build_dir, "firmware.elf")
+    calls, indirect = load_call_graph(elf, args.objdump)
+    analysis = Analysis(frames, calls, indirect, assumed)
+    sizes = load_stack_sizes(args.config)
+    stack_free = load_stack_free(args.health) if args.health else {}
+
+    print("%-9s %-14s %5s  %6s  %8s  %11s  %s"
+          % ("task", "entry", "size", "static", "measured", "recommended", "notes"))
+    short = []
+    suggestions = []
+    for task, size in sizes.items():
+        entry = entry_name(task)
+        result = analysis.worst(entry)
+        static = result["bytes"] + CONTEXT_BYTES if entry in frames else None
+        measured = size - stack_free[task] if task in stack_free else None
+
+        needed = max(static or 0, measured or 0)
+        recommended = recommend(needed, args.margin) if needed > 0 else None
+        if recommended is not None and recommended > size:
+            short.append(task)
+        if recommended is not None:
+            suggestions.append((task, recommended))
+
+        notes = sorted(result["notes"]) if static is not None else ["entry not found"]
+        print("%-9s %-14s %5d  %6s  %8s  %11s  %s"
+              % (task, entry, size, "-" if static is None else static,
+                 "-" if measured is None else measured,
+                 "-" if recommended is None else recommended, ", ".join(notes)))
+        if args.paths and static is not None:
+            print("          " + " -> ".join(
+                "%s (%d)" % (key, analysis.frame(key)) for key in result["path"]))
+
+    if suggestions:
+        print("\nSuggested SongbirdConfig.h sizes (words):")
+        for task, recommended in suggestions:
+            words = recommended // STACK_WORD_BYTES
+            print("#define %-19s %-7d // %dB" % ("STACK_" + task.upper(), words, recommended))
+        saved = sum(sizes[task] - recommended for task, recommended in suggestions)
+        if saved >= 0:
+            print("\nFrees %d bytes of RAM over the configured sizes" % saved)
+        else:
+            print("\nNeeds %d more bytes of RAM than the configured sizes" % -saved)
+
+    if args.check and short:
+        print("\nbelow recommendation: %s" % ", ".join(short), file=sys.stderr)
+        return 1
+    return 0
+
+
+def register_target(env) -> None:
+    """PlatformIO: add the stack_usage target (needs -fstack-usage in build_flags)."""
+    project = env.subst("$PROJECT_DIR")
+    objdump = env.subst("$CC").replace("gcc", "objdump")
+    env.AddCustomTarget(
+        name="stack_usage",
+        dependencies="$BUILD_DIR/${PROGNAME}.elf",
+        actions='"$PYTHONEXE" "%s" "$BUILD_DIR" --elf "$BUILD_DIR/${PROGNAME}.elf" '
+                '--config "%s" --objdump "%s"'
+                % (os.path.join(project, "scripts", "stack_usage.py"),
+                   os.path.join(project, "src", "core", "SongbirdConfig.h"), objdump),
+        title="Stack Usage",
+        description="Worst-case task stack depth and recommended STACK_* sizes",
+    )
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    Import("env")  # noqa: F821 - provided by PlatformIO's SCons environment
+    register_target(env)  # noqa: F821
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Decode the Songbird binary trace log (SongbirdTrace) into text.
+
+The firmware streams 17-byte trace frames on the debug UART, interleaved with
+ordinary text output. Event names and format strings are read from
+src/core/SongbirdTrace.h and task names from src/rtos/SongbirdRunStats.cpp,
+so decode with the sources of the firmware build that produced the capture.
+Text that is not part of a frame is passed through unchanged.
+
+Usage:
+    python3 scripts/trace_decode.py capture.bin
+    python3 scripts/trace_decode.py --port /dev/ttyACM0
+    cat capture.bin | python3 scripts/trace_decode.py -
+"""
+import argparse
+import os
+import re
+import sys
+
+FIRMWARE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+TRACE_HEADER = os.path.join(FIRMWARE_DIR, "src", "core", "SongbirdTrace.h")
+RUNSTATS_SOURCE = os.path.join(FIRMWARE_DIR, "src", "rtos", "SongbirdRunStats.cpp")
+
+FRAME_SIZE = 17
+SYNC = b"\xa5\x5a"
+
+# OperatingMode order (SongbirdConfig.h)
+MODES = ["demo", "transit", "storage", "sleep"]
+
+
+def load_events(path: str) -> list:
+    """Read (name, format) pairs from the TRACE_EVENTS list, in ID order."""
+    with open(path) as f:
+        text = f.read()
+    start = text.index("#define TRACE_EVENTS(X)")
+    end = text.index("\n\n", start)
+    pattern = re.compile(r'X\((TRACE_\w+),\s*"((?:[^"\\]|\\.)*)"\)')
+    return pattern.findall(text[start:end])
+
+
+def load_task_names(path: str) -> list:
+    """Read the RunStatsTask slot names (the task byte of each frame)."""
+    with open(path) as f:
+        text = f.read()
+    block = re.search(r"TASK_NAMES\[RUNSTATS_TASK_COUNT\]\s*=\s*\{(.*?)\}", text, re.S)
+    return re.findall(r'"(\w+)"', block.group(1)) if block else []
+
+
+def signed(value: int) -> int:
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def render(fmt: str, args: list) -> str:
+    """Apply the SongbirdTrace.h conversions to the frame arguments."""
+    remaining = list(args)
+
+    def convert(match):
+        spec = match.group(1)
+        if spec == "%":
+            return "%"
+        value = remaining.pop(0) if remaining else 0
+        if spec == "u":
+            return str(value)
+        if spec == "d":
+            return str(signed(value))
+        if spec == "x":
+            return format(value, "x")
+        if spec == "b":
+            return "true" if value else "false"
+        if spec == "h":
+            return "%.2f" % (signed(value) / 100.0)
+        if spec == "m":
+            return MODES[value] if value < len(MODES) else str(value)
+        return match.group(0)
+
+    return re.sub(r"%([udxbhm%])", convert, fmt)
+
+
+def parse_frame(frame: bytes, event_count: int):
+    """Return (event, task, time_us, arg0, arg1), or None if not a valid frame."""
+    if len(frame) != FRAME_SIZE or frame[:2] != SYNC:
+        return None
+    if sum(frame[2:FRAME_SIZE - 1]) & 0xFF != frame[FRAME_SIZE - 1]:
+        return None
+    event, task = frame[2], frame[3]
+    if event >= event_count:
+        return None
+    time_us = int.from_bytes(frame[4:8], "little")
+    arg0 = int.from_bytes(frame[8:12], "little")
+    arg1 = int.from_bytes(frame[12:16], "little")
+    return event, task, time_us, arg0, arg1
+
+
+class Decoder:
+    """Incremental decoder: feed bytes, get text lines back."""
+
+    def __init__(self, events: list, task_names: list):
+        self.events = events
+        self.task_names = task_names
+        self.pending = bytearray()
+        self.text = bytearray()
+
+    def feed(self, data: bytes) -> list:
+        self.pending.extend(data)
+        lines = []
+        while self.pending:
+            index = self.pending.find(SYNC)
+            if index != 0:
+                # Plain text up to the next possible frame
+                take = len(self.pending) if index < 0 else index
+                if index < 0 and self.pending[-1:] == SYNC[:1]:
+                    take -= 1  # keep a trailing sync byte for the next read
+                if take == 0:
+                    break
+                lines.extend(self._text(bytes(self.pending[:take])))
+                del self.pending[:take]
+                continue
+            if len(self.pending) < FRAME_SIZE:
+                break
+            parsed = parse_frame(bytes(self.pending[:FRAME_SIZE]), len(self.events))
+            if parsed is None:
+                lines.extend(self._text(bytes(self.pending[:1])))
+                del self.pending[:1]
+                continue
+            lines.extend(self._flush_text())
+            lines.append(self._format(*parsed))
+            del self.pending[:FRAME_SIZE]
+        return lines
+
+    def finish(self) -> list:
+        lines = self._text(bytes(self.pending))
+        self.pending.clear()
+        return lines + self._flush_text()
+
+    def _text(self, data: bytes) -> list:
+        lines = []
+        for byte in data:
+            if byte == 0x0A:
+                lines.append(self.text.decode("utf-8", "replace").rstrip("\r"))
+                self.text.clear()
+            else:
+                self.text.append(byte)
+        return lines
+
+    def _flush_text(self) -> list:
+        if not self.text.strip():
+            self.text.clear()
+            return []
+        line = self.text.decode("utf-8", "replace").rstrip("\r")
+        self.text.clear()
+        return [line]
+
+    def _format(self, event, task, time_us, arg0, arg1) -> str:
+        name, fmt = self.events[event]
+        task_name = self.task_names[task] if task < len(self.task_names) else str(task)
+        return "%12.6f %-8s %s" % (time_us / 1e6, task_name, render(fmt, [arg0, arg1]))
+
+
+def open_input(args):
+    if args.port:
+        try:
+            import serial
+        except ImportError as e:
+            print(f"Error: Missing dependency - {e}")
+            print("Install with: pip3 install pyserial")
+            sys.exit(1)
+        port = serial.Serial(args.port, args.baud, timeout=0.1)
+        return lambda: port.read(256)
+    if args.capture == "-":
+        stream = sys.stdin.buffer
+    else:
+        stream = open(args.capture, "rb")
+    return lambda: stream.read(4096) or None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the Songbird binary trace log")
+    parser.add_argument("capture", nargs="?", default="-", help="capture file, or - for stdin")
+    parser.add_argument("--port", help="read live from a serial port (needs pyserial)")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--header", default=TRACE_HEADER, help="SongbirdTrace.h to take events from")
+    args = parser.parse_args()
+
+    decoder = Decoder(load_events(args.header), load_task_names(RUNSTATS_SOURCE))
+    read = open_input(args)
+
+    try:
+        while True:
+            data = read()
+            if data is None:
+                break
+            for line in decoder.feed(data):
+                print(line, flush=True)
+    except KeyboardInterrupt:
+        pass
+
+    for line in decoder.finish():
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -10,6 +10,8 @@
  */
 
 #include "SongbirdAudio.h"
+#include "SongbirdTrace.h"
+#include "SongbirdProfile.h"
 #include "SparkFun_Qwiic_Buzzer_Arduino_Library.h"
 
 // =============================================================================
@@ -191,6 +193,8 @@ void audioPlayMelody(const Melody* melody, uint8_t volume) {
         return;
     }
 
+    PROFILE_SCOPE(PROFILE_AUDIO_MELODY);
+
     for (uint8_t i = 0; i < melody->length; i++) {
         audioPlayTone(melody->notes[i], melody->durations[i], volume);
 
@@ -233,10 +237,7 @@ void audioSetEnabled(bool enabled) {
         audioStop();
     }
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] ");
-    DEBUG_SERIAL.println(enabled ? "Enabled" : "Disabled");
-    #endif
+    traceRecord(TRACE_AUDIO_ENABLED, enabled, 0);
 }
 
 bool audioIsEnabled(void) {
@@ -271,10 +272,7 @@ bool audioToggleMute(void) {
         s_audioEnabled = false;
     }
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] Mute toggled: ");
-    DEBUG_SERIAL.println(s_audioEnabled ? "UNMUTED" : "MUTED");
-    #endif
+    traceRecord(TRACE_AUDIO_ENABLED, s_audioEnabled, 0);
 
     return s_audioEnabled;
 }
@@ -282,10 +280,7 @@ bool audioToggleMute(void) {
 void audioSetVolume(uint8_t volume) {
     s_audioVolume = CLAMP(volume, 0, 100);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] Volume: ");
-    DEBUG_SERIAL.println(s_audioVolume);
-    #endif
+    traceRecord(TRACE_AUDIO_VOLUME, s_audioVolume, 0);
 }
 
 uint8_t audioGetVolume(void) {
@@ -295,10 +290,7 @@ uint8_t audioGetVolume(void) {
 void audioSetAlertsOnly(bool alertsOnly) {
     s_alertsOnly = alertsOnly;
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] Alerts only: ");
-    DEBUG_SERIAL.println(alertsOnly ? "Yes" : "No");
-    #endif
+    traceRecord(TRACE_AUDIO_ALERTS_ONLY, alertsOnly, 0);
 }
 
 bool audioIsAlertsOnly(void) {
@@ -319,10 +311,7 @@ bool audioQueueEvent(AudioEventType event) {
         return false;
     }
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] Queueing: ");
-    DEBUG_SERIAL.println(audioGetEventName(event));
-    #endif
+    traceRecord(TRACE_AUDIO_QUEUED, event, 0);
 
     return syncQueueAudio(event);
 }
@@ -351,19 +340,13 @@ bool audioStartLocate(uint16_t durationSec) {
     item.event = AUDIO_EVENT_LOCATE_START;
     item.locateDurationSec = durationSec;
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Audio] Starting locate mode for ");
-    DEBUG_SERIAL.print(durationSec);
-    DEBUG_SERIAL.println(" seconds");
-    #endif
+    traceRecord(TRACE_AUDIO_LOCATE, durationSec, 0);
 
     return syncQueueAudioItem(&item);
 }
 
 bool audioStopLocate(void) {
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Audio] Stopping locate mode");
-    #endif
+    traceRecord(TRACE_AUDIO_LOCATE, 0, 0);
 
     return syncQueueAudio(AUDIO_EVENT_LOCATE_STOP);
 }
@@ -0,0 +1,94 @@
+/**
+ * @file SongbirdCommandTable.cpp
+ * @brief Command and melody name tables
+ *
+ * The lookups from SongbirdCommands that touch no hardware, kept in their
+ * own translation unit so the native tests and benchmarks link the real
+ * tables.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdCommands.h"
+#include <string.h>
+
+// =============================================================================
+// Command Type Names
+// =============================================================================
+
+static const char* const COMMAND_NAMES[] = {
+    "ping",
+    "locate",
+    "play_melody",
+    "test_audio",
+    "set_volume",
+    "unlock",
+    "profile",
+    "transcript",
+    "unknown"
+};
+
+// =============================================================================
+// Melody Name Mapping
+// =============================================================================
+
+typedef struct {
+    const char* name;
+    AudioEventType event;
+} MelodyMapping;
+
+static const MelodyMapping MELODY_MAPPINGS[] = {
+    {"connected", AUDIO_EVENT_CONNECTED},
+    {"power_on", AUDIO_EVENT_POWER_ON},
+    {"alert", AUDIO_EVENT_TEMP_ALERT},
+    {"ping", AUDIO_EVENT_PING},
+    {"error", AUDIO_EVENT_ERROR},
+    {"low_battery", AUDIO_EVENT_LOW_BATTERY},
+    {"gps_lock", AUDIO_EVENT_GPS_LOCK},
+    {"sleep", AUDIO_EVENT_SLEEP},
+    {NULL, AUDIO_EVENT_ERROR}  // Terminator
+};
+
+// =============================================================================
+// Type Parsing
+// =============================================================================
+
+CommandType commandsParseType(const char* name) {
+    if (name == NULL) {
+        return CMD_UNKNOWN;
+    }
+
+    for (int i = 0; i < CMD_UNKNOWN; i++) {
+        if (strcmp(name, COMMAND_NAMES[i]) == 0) {
+            return (CommandType)i;
+        }
+    }
+
+    return CMD_UNKNOWN;
+}
+
+const char* commandsGetTypeName(CommandType type) {
+    if (type <= CMD_UNKNOWN) {
+        return COMMAND_NAMES[type];
+    }
+    return COMMAND_NAMES[CMD_UNKNOWN];
+}
+
+// =============================================================================
+// Melody Lookup
+// =============================================================================
+
+AudioEventType commandsGetMelodyEvent(const char* name) {
+    if (name == NULL) {
+        return AUDIO_EVENT_ERROR;
+    }
+
+    for (const MelodyMapping* m = MELODY_MAPPINGS; m->name != NULL; m++) {
+        if (strcmp(name, m->name) == 0) {
+            return m->event;
+        }
+    }
+
+    return AUDIO_EVENT_ERROR;
+}
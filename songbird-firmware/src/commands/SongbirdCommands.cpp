@@ -10,41 +10,8 @@
 #include "SongbirdAudio.h"
 #include "SongbirdSync.h"
 #include "SongbirdState.h"
-
-// =============================================================================
-// Command Type Names
-// =============================================================================
-
-static const char* const COMMAND_NAMES[] = {
-    "ping",
-    "locate",
-    "play_melody",
-    "test_audio",
-    "set_volume",
-    "unlock",
-    "unknown"
-};
-
-// =============================================================================
-// Melody Name Mapping
-// =============================================================================
-
-typedef struct {
-    const char* name;
-    AudioEventType event;
-} MelodyMapping;
-
-static const MelodyMapping MELODY_MAPPINGS[] = {
-    {"connected", AUDIO_EVENT_CONNECTED},
-    {"power_on", AUDIO_EVENT_POWER_ON},
-    {"alert", AUDIO_EVENT_TEMP_ALERT},
-    {"ping", AUDIO_EVENT_PING},
-    {"error", AUDIO_EVENT_ERROR},
-    {"low_battery", AUDIO_EVENT_LOW_BATTERY},
-    {"gps_lock", AUDIO_EVENT_GPS_LOCK},
-    {"sleep", AUDIO_EVENT_SLEEP},
-    {NULL, AUDIO_EVENT_ERROR}  // Terminator
-};
+#include "SongbirdProfile.h"
+#include "SongbirdTranscript.h"
 
 // =============================================================================
 // Command Execution
@@ -92,6 +59,14 @@ bool commandsExecute(const Command* cmd, const SongbirdConfig* config, CommandAc
             commandsHandleUnlock(cmd, config, ack);
             break;
 
+        case CMD_PROFILE:
+            commandsHandleProfile(cmd, config, ack);
+            break;
+
+        case CMD_TRANSCRIPT:
+            commandsHandleTranscript(cmd, config, ack);
+            break;
+
         default:
             ack->status = CMD_STATUS_ERROR;
             strncpy(ack->message, "Unknown command", sizeof(ack->message) - 1);
@@ -101,31 +76,6 @@ bool commandsExecute(const Command* cmd, const SongbirdConfig* config, CommandAc
     return true;
 }
 
-// =============================================================================
-// Type Parsing
-// =============================================================================
-
-CommandType commandsParseType(const char* name) {
-    if (name == NULL) {
-        return CMD_UNKNOWN;
-    }
-
-    for (int i = 0; i < CMD_UNKNOWN; i++) {
-        if (strcmp(name, COMMAND_NAMES[i]) == 0) {
-            return (CommandType)i;
-        }
-    }
-
-    return CMD_UNKNOWN;
-}
-
-const char* commandsGetTypeName(CommandType type) {
-    if (type <= CMD_UNKNOWN) {
-        return COMMAND_NAMES[type];
-    }
-    return COMMAND_NAMES[CMD_UNKNOWN];
-}
-
 // =============================================================================
 // Individual Command Handlers
 // =============================================================================
@@ -307,20 +257,59 @@ void commandsHandleUnlock(const Command* cmd, const SongbirdConfig* config, Comm
     }
 }
 
-// =============================================================================
-// Melody Lookup
-// =============================================================================
+void commandsHandleProfile(const Command* cmd, const SongbirdConfig* config, CommandAck* ack) {
+    (void)config;  // Unused
 
-AudioEventType commandsGetMelodyEvent(const char* name) {
-    if (name == NULL) {
-        return AUDIO_EVENT_ERROR;
+    #ifdef PROFILE_MODE
+    profileDump();
+
+    ProfileScopeId slowest = profileSlowest();
+    if (slowest < PROFILE_SCOPE_COUNT) {
+        ProfileStats stats;
+        profileGet(slowest, &stats);
+        snprintf(ack->message, sizeof(ack->message), "Slowest: %s max %lu us",
+                 profileScopeName(slowest),
+                 (unsigned long)profileTicksToUs(stats.maxTicks, profileTicksPerSecond()));
+    } else {
+        strncpy(ack->message, "No scopes recorded", sizeof(ack->message) - 1);
     }
+    ack->status = CMD_STATUS_OK;
 
-    for (const MelodyMapping* m = MELODY_MAPPINGS; m->name != NULL; m++) {
-        if (strcmp(name, m->name) == 0) {
-            return m->event;
-        }
+    if (cmd->params.profile.reset) {
+        profileReset();
+    }
+    #else
+    (void)cmd;
+    ack->status = CMD_STATUS_IGNORED;
+    strncpy(ack->message, "Profiling not built", sizeof(ack->message) - 1);
+    #endif
+}
+
+void commandsHandleTranscript(const Command* cmd, const SongbirdConfig* config, CommandAck* ack) {
+    (void)config;  // Unused
+
+    #ifdef TRANSCRIPT_MODE
+    transcriptDump();
+
+    // The ring is only touched with the I2C mutex held
+    if (!syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        ack->status = CMD_STATUS_ERROR;
+        strncpy(ack->message, "I2C busy", sizeof(ack->message) - 1);
+        return;
+    }
+    uint16_t count = transcriptCount();
+    uint32_t dropped = transcriptGetDropped();
+    if (cmd->params.transcript.clear) {
+        transcriptInit();
     }
+    syncReleaseI2C();
 
-    return AUDIO_EVENT_ERROR;
+    snprintf(ack->message, sizeof(ack->message), "%u requests, %lu dropped",
+             (unsigned)count, (unsigned long)dropped);
+    ack->status = CMD_STATUS_OK;
+    #else
+    (void)cmd;
+    ack->status = CMD_STATUS_IGNORED;
+    strncpy(ack->message, "Transcript not built", sizeof(ack->message) - 1);
+    #endif
 }
@@ -13,7 +13,6 @@
 
 #include <Arduino.h>
 #include "SongbirdConfig.h"
-#include "SongbirdSync.h"  // For AudioEventType
 
 // =============================================================================
 // Command Module Interface
@@ -118,6 +117,31 @@ void commandsHandleSetVolume(const Command* cmd, const SongbirdConfig* config, C
  */
 void commandsHandleUnlock(const Command* cmd, const SongbirdConfig* config, CommandAck* ack);
 
+/**
+ * @brief Handle profile command
+ *
+ * Writes the profiling statistics to the debug serial port and reports the
+ * slowest scope in the ack. Ignored unless built with PROFILE_MODE.
+ *
+ * @param cmd Command with optional reset parameter
+ * @param config Current configuration
+ * @param ack Acknowledgment to fill
+ */
+void commandsHandleProfile(const Command* cmd, const SongbirdConfig* config, CommandAck* ack);
+
+/**
+ * @brief Handle transcript command
+ *
+ * Writes the recorded Notecard transactions to the debug serial port as
+ * NCT lines and reports the count in the ack. Ignored unless built with
+ * TRANSCRIPT_MODE.
+ *
+ * @param cmd Command with optional clear parameter
+ * @param config Current configuration
+ * @param ack Acknowledgment to fill
+ */
+void commandsHandleTranscript(const Command* cmd, const SongbirdConfig* config, CommandAck* ack);
+
 // =============================================================================
 // Melody Name Lookup
 // =============================================================================
@@ -9,47 +9,8 @@
 #include "SongbirdEnv.h"
 #include "SongbirdNotecard.h"
 #include "SongbirdState.h"
-
-// =============================================================================
-// Initialization
-// =============================================================================
-
-void envInitDefaults(SongbirdConfig* config) {
-    if (config == NULL) {
-        return;
-    }
-
-    config->mode = DEFAULT_MODE;
-    config->gpsIntervalMin = DEFAULT_GPS_INTERVAL_MIN;
-    config->syncIntervalMin = DEFAULT_SYNC_INTERVAL_MIN;
-    config->heartbeatHours = DEFAULT_HEARTBEAT_HOURS;
-
-    config->tempAlertHighC = DEFAULT_TEMP_ALERT_HIGH_C;
-    config->tempAlertLowC = DEFAULT_TEMP_ALERT_LOW_C;
-    config->humidityAlertHigh = DEFAULT_HUMIDITY_ALERT_HIGH;
-    config->humidityAlertLow = DEFAULT_HUMIDITY_ALERT_LOW;
-    config->pressureAlertDelta = DEFAULT_PRESSURE_ALERT_DELTA;
-    config->voltageAlertLow = DEFAULT_VOLTAGE_ALERT_LOW;
-
-    config->motionSensitivity = DEFAULT_MOTION_SENSITIVITY;
-    config->motionWakeEnabled = DEFAULT_MOTION_WAKE_ENABLED;
-
-    config->audioEnabled = DEFAULT_AUDIO_ENABLED;
-    config->audioVolume = DEFAULT_AUDIO_VOLUME;
-    config->audioAlertsOnly = DEFAULT_AUDIO_ALERTS_ONLY;
-
-    config->cmdWakeEnabled = DEFAULT_CMD_WAKE_ENABLED;
-    config->cmdAckEnabled = DEFAULT_CMD_ACK_ENABLED;
-    config->locateDurationSec = DEFAULT_LOCATE_DURATION_SEC;
-
-    config->ledEnabled = DEFAULT_LED_ENABLED;
-    config->debugMode = DEFAULT_DEBUG_MODE;
-
-    // GPS Power Management
-    config->gpsPowerSaveEnabled = DEFAULT_GPS_POWER_SAVE_ENABLED;
-    config->gpsSignalTimeoutMin = DEFAULT_GPS_SIGNAL_TIMEOUT_MIN;
-    config->gpsRetryIntervalMin = DEFAULT_GPS_RETRY_INTERVAL_MIN;
-}
+#include "SongbirdTrace.h"
+#include "SongbirdProfile.h"
 
 // =============================================================================
 // Environment Variable Fetching
@@ -60,153 +21,26 @@ bool envFetchConfig(SongbirdConfig* config) {
         return false;
     }
 
+    PROFILE_SCOPE(PROFILE_ENV_FETCH);
+
     char buffer[32];
     bool anySuccess = false;
 
-    // Mode - only apply if not transit locked or demo locked
-    if (notecardEnvGet(ENV_MODE, buffer, sizeof(buffer))) {
-        if (stateIsTransitLocked()) {
-            #ifdef DEBUG_MODE
-            DEBUG_SERIAL.println("[Env] Mode change blocked - transit lock active");
-            #endif
-        } else if (stateIsDemoLocked()) {
-            #ifdef DEBUG_MODE
-            DEBUG_SERIAL.println("[Env] Mode change blocked - demo lock active");
-            #endif
-        } else {
-            config->mode = envParseMode(buffer);
-            anySuccess = true;
+    const char* name;
+    for (uint8_t i = 0; (name = envVarName(i)) != NULL; i++) {
+        if (!notecardEnvGet(name, buffer, sizeof(buffer))) {
+            continue;
         }
-    }
-
-    // Timing
-    int32_t intVal;
-    intVal = notecardEnvGetInt(ENV_GPS_INTERVAL_MIN, -1);
-    if (intVal >= 0) {
-        config->gpsIntervalMin = CLAMP(intVal, 1, 1440);
-        anySuccess = true;
-    }
-
-    intVal = notecardEnvGetInt(ENV_SYNC_INTERVAL_MIN, -1);
-    if (intVal >= 0) {
-        config->syncIntervalMin = CLAMP(intVal, 1, 1440);
-        anySuccess = true;
-    }
-
-    intVal = notecardEnvGetInt(ENV_HEARTBEAT_HOURS, -1);
-    if (intVal >= 0) {
-        config->heartbeatHours = CLAMP(intVal, 1, 168);
-        anySuccess = true;
-    }
-
-    // Alert thresholds
-    float floatVal;
-    floatVal = notecardEnvGetFloat(ENV_TEMP_ALERT_HIGH_C, NAN);
-    if (!isnan(floatVal)) {
-        config->tempAlertHighC = CLAMP(floatVal, -40.0f, 85.0f);
-        anySuccess = true;
-    }
-
-    floatVal = notecardEnvGetFloat(ENV_TEMP_ALERT_LOW_C, NAN);
-    if (!isnan(floatVal)) {
-        config->tempAlertLowC = CLAMP(floatVal, -40.0f, 85.0f);
-        anySuccess = true;
-    }
-
-    floatVal = notecardEnvGetFloat(ENV_HUMIDITY_ALERT_HIGH, NAN);
-    if (!isnan(floatVal)) {
-        config->humidityAlertHigh = CLAMP(floatVal, 0.0f, 100.0f);
-        anySuccess = true;
-    }
-
-    floatVal = notecardEnvGetFloat(ENV_HUMIDITY_ALERT_LOW, NAN);
-    if (!isnan(floatVal)) {
-        config->humidityAlertLow = CLAMP(floatVal, 0.0f, 100.0f);
-        anySuccess = true;
-    }
-
-    floatVal = notecardEnvGetFloat(ENV_PRESSURE_ALERT_DELTA, NAN);
-    if (!isnan(floatVal)) {
-        config->pressureAlertDelta = CLAMP(floatVal, 1.0f, 100.0f);
-        anySuccess = true;
-    }
 
-    floatVal = notecardEnvGetFloat(ENV_VOLTAGE_ALERT_LOW, NAN);
-    if (!isnan(floatVal)) {
-        config->voltageAlertLow = CLAMP(floatVal, 3.3f, 4.2f);
-        anySuccess = true;
-    }
-
-    // Motion
-    if (notecardEnvGet(ENV_MOTION_SENSITIVITY, buffer, sizeof(buffer))) {
-        config->motionSensitivity = envParseSensitivity(buffer);
-        anySuccess = true;
-    }
-
-    // Boolean values - only update if explicitly set
-    if (notecardEnvGet(ENV_MOTION_WAKE_ENABLED, buffer, sizeof(buffer))) {
-        config->motionWakeEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_AUDIO_ENABLED, buffer, sizeof(buffer))) {
-        config->audioEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    intVal = notecardEnvGetInt(ENV_AUDIO_VOLUME, -1);
-    if (intVal >= 0) {
-        config->audioVolume = CLAMP(intVal, 0, 100);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_AUDIO_ALERTS_ONLY, buffer, sizeof(buffer))) {
-        config->audioAlertsOnly = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_CMD_WAKE_ENABLED, buffer, sizeof(buffer))) {
-        config->cmdWakeEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_CMD_ACK_ENABLED, buffer, sizeof(buffer))) {
-        config->cmdAckEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    intVal = notecardEnvGetInt(ENV_LOCATE_DURATION_SEC, -1);
-    if (intVal >= 0) {
-        config->locateDurationSec = CLAMP(intVal, 5, 300);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_LED_ENABLED, buffer, sizeof(buffer))) {
-        config->ledEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    if (notecardEnvGet(ENV_DEBUG_MODE, buffer, sizeof(buffer))) {
-        config->debugMode = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    // GPS Power Management
-    if (notecardEnvGet(ENV_GPS_POWER_SAVE_ENABLED, buffer, sizeof(buffer))) {
-        config->gpsPowerSaveEnabled = (strcmp(buffer, "true") == 0 || strcmp(buffer, "1") == 0);
-        anySuccess = true;
-    }
-
-    intVal = notecardEnvGetInt(ENV_GPS_SIGNAL_TIMEOUT_MIN, -1);
-    if (intVal >= 0) {
-        config->gpsSignalTimeoutMin = CLAMP(intVal, 10, 30);  // 10-30 minutes
-        anySuccess = true;
-    }
+        // Mode - only apply if not transit locked or demo locked
+        if (strcmp(name, ENV_MODE) == 0 && (stateIsTransitLocked() || stateIsDemoLocked())) {
+            traceRecord(TRACE_ENV_MODE_BLOCKED, stateIsTransitLocked(), stateIsDemoLocked());
+            continue;
+        }
 
-    intVal = notecardEnvGetInt(ENV_GPS_RETRY_INTERVAL_MIN, -1);
-    if (intVal >= 0) {
-        config->gpsRetryIntervalMin = CLAMP(intVal, 5, 120);  // 5-120 minutes
-        anySuccess = true;
+        if (envApplyVar(config, name, buffer)) {
+            anySuccess = true;
+        }
     }
 
     return anySuccess;
@@ -216,211 +50,6 @@ bool envCheckModified(void) {
     return notecardEnvModified();
 }
 
-// =============================================================================
-// Configuration Comparison
-// =============================================================================
-
-bool envConfigChanged(const SongbirdConfig* a, const SongbirdConfig* b) {
-    if (a == NULL || b == NULL) {
-        return true;
-    }
-
-    // Compare all fields
-    if (a->mode != b->mode) return true;
-    if (a->gpsIntervalMin != b->gpsIntervalMin) return true;
-    if (a->syncIntervalMin != b->syncIntervalMin) return true;
-    if (a->heartbeatHours != b->heartbeatHours) return true;
-
-    if (a->tempAlertHighC != b->tempAlertHighC) return true;
-    if (a->tempAlertLowC != b->tempAlertLowC) return true;
-    if (a->humidityAlertHigh != b->humidityAlertHigh) return true;
-    if (a->humidityAlertLow != b->humidityAlertLow) return true;
-    if (a->pressureAlertDelta != b->pressureAlertDelta) return true;
-    if (a->voltageAlertLow != b->voltageAlertLow) return true;
-
-    if (a->motionSensitivity != b->motionSensitivity) return true;
-    if (a->motionWakeEnabled != b->motionWakeEnabled) return true;
-
-    if (a->audioEnabled != b->audioEnabled) return true;
-    if (a->audioVolume != b->audioVolume) return true;
-    if (a->audioAlertsOnly != b->audioAlertsOnly) return true;
-
-    if (a->cmdWakeEnabled != b->cmdWakeEnabled) return true;
-    if (a->cmdAckEnabled != b->cmdAckEnabled) return true;
-    if (a->locateDurationSec != b->locateDurationSec) return true;
-
-    if (a->ledEnabled != b->ledEnabled) return true;
-    if (a->debugMode != b->debugMode) return true;
-
-    // GPS Power Management
-    if (a->gpsPowerSaveEnabled != b->gpsPowerSaveEnabled) return true;
-    if (a->gpsSignalTimeoutMin != b->gpsSignalTimeoutMin) return true;
-    if (a->gpsRetryIntervalMin != b->gpsRetryIntervalMin) return true;
-
-    return false;
-}
-
-// =============================================================================
-// Mode Presets
-// =============================================================================
-
-void envApplyModePreset(SongbirdConfig* config, OperatingMode mode) {
-    if (config == NULL) {
-        return;
-    }
-
-    config->mode = mode;
-
-    switch (mode) {
-        case MODE_DEMO:
-            config->gpsIntervalMin = 1;
-            config->syncIntervalMin = 1;  // Continuous sync
-            config->motionSensitivity = MOTION_SENSITIVITY_HIGH;
-            break;
-
-        case MODE_TRANSIT:
-            config->gpsIntervalMin = 5;
-            config->syncIntervalMin = 15;
-            config->motionSensitivity = MOTION_SENSITIVITY_MEDIUM;
-            break;
-
-        case MODE_STORAGE:
-            config->gpsIntervalMin = 60;
-            config->syncIntervalMin = 60;
-            config->motionSensitivity = MOTION_SENSITIVITY_LOW;
-            break;
-
-        case MODE_SLEEP:
-            config->gpsIntervalMin = 0;  // Disabled
-            config->syncIntervalMin = 0;  // On motion only
-            config->motionSensitivity = MOTION_SENSITIVITY_MEDIUM;
-            config->motionWakeEnabled = true;
-            break;
-    }
-}
-
-// =============================================================================
-// Interval Calculations
-// =============================================================================
-
-uint32_t envGetSensorIntervalMs(const SongbirdConfig* config) {
-    if (config == NULL) {
-        return SENSOR_INTERVAL_DEMO_MS;
-    }
-
-    switch (config->mode) {
-        case MODE_DEMO:
-            return SENSOR_INTERVAL_DEMO_MS;
-        case MODE_TRANSIT:
-            return SENSOR_INTERVAL_TRANSIT_MS;
-        case MODE_STORAGE:
-            return SENSOR_INTERVAL_STORAGE_MS;
-        case MODE_SLEEP:
-            return SENSOR_INTERVAL_SLEEP_MS;
-        default:
-            return SENSOR_INTERVAL_DEMO_MS;
-    }
-}
-
-uint32_t envGetCommandPollIntervalMs(const SongbirdConfig* config) {
-    if (config == NULL) {
-        return COMMAND_POLL_DEMO_MS;
-    }
-
-    switch (config->mode) {
-        case MODE_DEMO:
-            return COMMAND_POLL_DEMO_MS;
-        case MODE_TRANSIT:
-            return COMMAND_POLL_TRANSIT_MS;
-        case MODE_STORAGE:
-            return COMMAND_POLL_STORAGE_MS;
-        case MODE_SLEEP:
-            return COMMAND_POLL_SLEEP_MS;
-        default:
-            return COMMAND_POLL_DEMO_MS;
-    }
-}
-
-uint32_t envGetSyncIntervalMs(const SongbirdConfig* config) {
-    if (config == NULL) {
-        return MINUTES_TO_MS(DEFAULT_SYNC_INTERVAL_MIN);
-    }
-
-    return MINUTES_TO_MS(config->syncIntervalMin);
-}
-
-uint32_t envGetSleepDurationSec(const SongbirdConfig* config) {
-    if (config == NULL) {
-        return 0;
-    }
-
-    switch (config->mode) {
-        case MODE_DEMO:
-            return 0;  // No sleep in demo mode
-        case MODE_TRANSIT:
-            return config->gpsIntervalMin * 60;
-        case MODE_STORAGE:
-            return config->gpsIntervalMin * 60;
-        case MODE_SLEEP:
-            return 0;  // Wake on motion only
-        default:
-            return 0;
-    }
-}
-
-// =============================================================================
-// String Parsing
-// =============================================================================
-
-OperatingMode envParseMode(const char* str) {
-    if (str == NULL) {
-        return DEFAULT_MODE;
-    }
-
-    if (strcmp(str, "demo") == 0) {
-        return MODE_DEMO;
-    } else if (strcmp(str, "transit") == 0) {
-        return MODE_TRANSIT;
-    } else if (strcmp(str, "storage") == 0) {
-        return MODE_STORAGE;
-    } else if (strcmp(str, "sleep") == 0) {
-        return MODE_SLEEP;
-    }
-
-    return DEFAULT_MODE;
-}
-
-const char* envGetModeName(OperatingMode mode) {
-    switch (mode) {
-        case MODE_DEMO:
-            return "demo";
-        case MODE_TRANSIT:
-            return "transit";
-        case MODE_STORAGE:
-            return "storage";
-        case MODE_SLEEP:
-            return "sleep";
-        default:
-            return "unknown";
-    }
-}
-
-MotionSensitivity envParseSensitivity(const char* str) {
-    if (str == NULL) {
-        return DEFAULT_MOTION_SENSITIVITY;
-    }
-
-    if (strcmp(str, "low") == 0) {
-        return MOTION_SENSITIVITY_LOW;
-    } else if (strcmp(str, "medium") == 0) {
-        return MOTION_SENSITIVITY_MEDIUM;
-    } else if (strcmp(str, "high") == 0) {
-        return MOTION_SENSITIVITY_HIGH;
-    }
-
-    return DEFAULT_MOTION_SENSITIVITY;
-}
-
 // =============================================================================
 // Debug Logging
 // =============================================================================
@@ -475,188 +104,78 @@ void envLogConfig(const SongbirdConfig* config) {
     DEBUG_SERIAL.println(config->cmdWakeEnabled ? "Yes" : "No");
     DEBUG_SERIAL.print("  Debug: ");
     DEBUG_SERIAL.println(config->debugMode ? "Yes" : "No");
+    DEBUG_SERIAL.print("  Power Policy: ");
+    if (config->powerPolicyEnabled) {
+        DEBUG_SERIAL.print(config->powerPolicyFullV);
+        DEBUG_SERIAL.print(" - ");
+        DEBUG_SERIAL.print(config->powerPolicyLowV);
+        DEBUG_SERIAL.print(" V, max x");
+        DEBUG_SERIAL.println(config->powerPolicyMaxScale);
+    } else {
+        DEBUG_SERIAL.println("OFF");
+    }
     #else
     (void)config;
     #endif
 }
 
-// Helper to get sensitivity name
-static const char* getSensitivityName(MotionSensitivity sensitivity) {
-    switch (sensitivity) {
-        case MOTION_SENSITIVITY_LOW:    return "low";
-        case MOTION_SENSITIVITY_MEDIUM: return "medium";
-        case MOTION_SENSITIVITY_HIGH:   return "high";
-        default:                        return "unknown";
-    }
-}
+// Trace a field that differs, as raw values or as hundredths (%h)
+#define TRACE_CHANGED(event, field) do { \
+    if (oldConfig->field != newConfig->field) { \
+        traceRecord(event, (uint32_t)oldConfig->field, (uint32_t)newConfig->field); \
+    } \
+} while (0)
+#define TRACE_CHANGED_CENTI(event, field) do { \
+    if (oldConfig->field != newConfig->field) { \
+        traceRecord(event, traceCenti(oldConfig->field), traceCenti(newConfig->field)); \
+    } \
+} while (0)
 
 void envLogConfigChanges(const SongbirdConfig* oldConfig, const SongbirdConfig* newConfig) {
     if (oldConfig == NULL || newConfig == NULL) {
         return;
     }
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Env] Configuration changed from Notehub:");
-
-    // Mode
-    if (oldConfig->mode != newConfig->mode) {
-        DEBUG_SERIAL.print("  mode: ");
-        DEBUG_SERIAL.print(envGetModeName(oldConfig->mode));
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(envGetModeName(newConfig->mode));
-    }
-
-    // Timing
-    if (oldConfig->gpsIntervalMin != newConfig->gpsIntervalMin) {
-        DEBUG_SERIAL.print("  gps_interval_min: ");
-        DEBUG_SERIAL.print(oldConfig->gpsIntervalMin);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->gpsIntervalMin);
-    }
-    if (oldConfig->syncIntervalMin != newConfig->syncIntervalMin) {
-        DEBUG_SERIAL.print("  sync_interval_min: ");
-        DEBUG_SERIAL.print(oldConfig->syncIntervalMin);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->syncIntervalMin);
-    }
-    if (oldConfig->heartbeatHours != newConfig->heartbeatHours) {
-        DEBUG_SERIAL.print("  heartbeat_hours: ");
-        DEBUG_SERIAL.print(oldConfig->heartbeatHours);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->heartbeatHours);
-    }
-
-    // Temperature alerts
-    if (oldConfig->tempAlertHighC != newConfig->tempAlertHighC) {
-        DEBUG_SERIAL.print("  temp_alert_high_c: ");
-        DEBUG_SERIAL.print(oldConfig->tempAlertHighC);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->tempAlertHighC);
-    }
-    if (oldConfig->tempAlertLowC != newConfig->tempAlertLowC) {
-        DEBUG_SERIAL.print("  temp_alert_low_c: ");
-        DEBUG_SERIAL.print(oldConfig->tempAlertLowC);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->tempAlertLowC);
-    }
+    // Mode and timing
+    TRACE_CHANGED(TRACE_ENV_MODE, mode);
+    TRACE_CHANGED(TRACE_ENV_GPS_INTERVAL, gpsIntervalMin);
+    TRACE_CHANGED(TRACE_ENV_SYNC_INTERVAL, syncIntervalMin);
+    TRACE_CHANGED(TRACE_ENV_HEARTBEAT, heartbeatHours);
 
-    // Humidity alerts
-    if (oldConfig->humidityAlertHigh != newConfig->humidityAlertHigh) {
-        DEBUG_SERIAL.print("  humidity_alert_high: ");
-        DEBUG_SERIAL.print(oldConfig->humidityAlertHigh);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->humidityAlertHigh);
-    }
-    if (oldConfig->humidityAlertLow != newConfig->humidityAlertLow) {
-        DEBUG_SERIAL.print("  humidity_alert_low: ");
-        DEBUG_SERIAL.print(oldConfig->humidityAlertLow);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->humidityAlertLow);
-    }
-
-    // Pressure and voltage alerts
-    if (oldConfig->pressureAlertDelta != newConfig->pressureAlertDelta) {
-        DEBUG_SERIAL.print("  pressure_alert_delta: ");
-        DEBUG_SERIAL.print(oldConfig->pressureAlertDelta);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->pressureAlertDelta);
-    }
-    if (oldConfig->voltageAlertLow != newConfig->voltageAlertLow) {
-        DEBUG_SERIAL.print("  voltage_alert_low: ");
-        DEBUG_SERIAL.print(oldConfig->voltageAlertLow);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->voltageAlertLow);
-    }
+    // Alert thresholds
+    TRACE_CHANGED_CENTI(TRACE_ENV_TEMP_HIGH, tempAlertHighC);
+    TRACE_CHANGED_CENTI(TRACE_ENV_TEMP_LOW, tempAlertLowC);
+    TRACE_CHANGED_CENTI(TRACE_ENV_HUMIDITY_HIGH, humidityAlertHigh);
+    TRACE_CHANGED_CENTI(TRACE_ENV_HUMIDITY_LOW, humidityAlertLow);
+    TRACE_CHANGED_CENTI(TRACE_ENV_PRESSURE_DELTA, pressureAlertDelta);
+    TRACE_CHANGED_CENTI(TRACE_ENV_VOLTAGE_LOW, voltageAlertLow);
 
     // Motion
-    if (oldConfig->motionSensitivity != newConfig->motionSensitivity) {
-        DEBUG_SERIAL.print("  motion_sensitivity: ");
-        DEBUG_SERIAL.print(getSensitivityName(oldConfig->motionSensitivity));
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(getSensitivityName(newConfig->motionSensitivity));
-    }
-    if (oldConfig->motionWakeEnabled != newConfig->motionWakeEnabled) {
-        DEBUG_SERIAL.print("  motion_wake_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->motionWakeEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->motionWakeEnabled ? "true" : "false");
-    }
+    TRACE_CHANGED(TRACE_ENV_MOTION_SENSITIVITY, motionSensitivity);
+    TRACE_CHANGED(TRACE_ENV_MOTION_WAKE, motionWakeEnabled);
 
     // Audio
-    if (oldConfig->audioEnabled != newConfig->audioEnabled) {
-        DEBUG_SERIAL.print("  audio_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->audioEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->audioEnabled ? "true" : "false");
-    }
-    if (oldConfig->audioVolume != newConfig->audioVolume) {
-        DEBUG_SERIAL.print("  audio_volume: ");
-        DEBUG_SERIAL.print(oldConfig->audioVolume);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->audioVolume);
-    }
-    if (oldConfig->audioAlertsOnly != newConfig->audioAlertsOnly) {
-        DEBUG_SERIAL.print("  audio_alerts_only: ");
-        DEBUG_SERIAL.print(oldConfig->audioAlertsOnly ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->audioAlertsOnly ? "true" : "false");
-    }
+    TRACE_CHANGED(TRACE_ENV_AUDIO_ENABLED, audioEnabled);
+    TRACE_CHANGED(TRACE_ENV_AUDIO_VOLUME, audioVolume);
+    TRACE_CHANGED(TRACE_ENV_AUDIO_ALERTS_ONLY, audioAlertsOnly);
 
     // Commands
-    if (oldConfig->cmdWakeEnabled != newConfig->cmdWakeEnabled) {
-        DEBUG_SERIAL.print("  cmd_wake_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->cmdWakeEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->cmdWakeEnabled ? "true" : "false");
-    }
-    if (oldConfig->cmdAckEnabled != newConfig->cmdAckEnabled) {
-        DEBUG_SERIAL.print("  cmd_ack_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->cmdAckEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->cmdAckEnabled ? "true" : "false");
-    }
-    if (oldConfig->locateDurationSec != newConfig->locateDurationSec) {
-        DEBUG_SERIAL.print("  locate_duration_sec: ");
-        DEBUG_SERIAL.print(oldConfig->locateDurationSec);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->locateDurationSec);
-    }
+    TRACE_CHANGED(TRACE_ENV_CMD_WAKE, cmdWakeEnabled);
+    TRACE_CHANGED(TRACE_ENV_CMD_ACK, cmdAckEnabled);
+    TRACE_CHANGED(TRACE_ENV_LOCATE_DURATION, locateDurationSec);
 
     // Misc
-    if (oldConfig->ledEnabled != newConfig->ledEnabled) {
-        DEBUG_SERIAL.print("  led_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->ledEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->ledEnabled ? "true" : "false");
-    }
-    if (oldConfig->debugMode != newConfig->debugMode) {
-        DEBUG_SERIAL.print("  debug_mode: ");
-        DEBUG_SERIAL.print(oldConfig->debugMode ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->debugMode ? "true" : "false");
-    }
+    TRACE_CHANGED(TRACE_ENV_LED, ledEnabled);
+    TRACE_CHANGED(TRACE_ENV_DEBUG, debugMode);
 
     // GPS Power Management
-    if (oldConfig->gpsPowerSaveEnabled != newConfig->gpsPowerSaveEnabled) {
-        DEBUG_SERIAL.print("  gps_power_save_enabled: ");
-        DEBUG_SERIAL.print(oldConfig->gpsPowerSaveEnabled ? "true" : "false");
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->gpsPowerSaveEnabled ? "true" : "false");
-    }
-    if (oldConfig->gpsSignalTimeoutMin != newConfig->gpsSignalTimeoutMin) {
-        DEBUG_SERIAL.print("  gps_signal_timeout_min: ");
-        DEBUG_SERIAL.print(oldConfig->gpsSignalTimeoutMin);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->gpsSignalTimeoutMin);
-    }
-    if (oldConfig->gpsRetryIntervalMin != newConfig->gpsRetryIntervalMin) {
-        DEBUG_SERIAL.print("  gps_retry_interval_min: ");
-        DEBUG_SERIAL.print(oldConfig->gpsRetryIntervalMin);
-        DEBUG_SERIAL.print(" -> ");
-        DEBUG_SERIAL.println(newConfig->gpsRetryIntervalMin);
-    }
-    #else
-    (void)oldConfig;
-    (void)newConfig;
-    #endif
+    TRACE_CHANGED(TRACE_ENV_GPS_POWER_SAVE, gpsPowerSaveEnabled);
+    TRACE_CHANGED(TRACE_ENV_GPS_SIGNAL_TIMEOUT, gpsSignalTimeoutMin);
+    TRACE_CHANGED(TRACE_ENV_GPS_RETRY, gpsRetryIntervalMin);
+
+    // Battery-Aware Duty Cycling
+    TRACE_CHANGED(TRACE_ENV_POWER_POLICY, powerPolicyEnabled);
+    TRACE_CHANGED_CENTI(TRACE_ENV_POWER_FULL_V, powerPolicyFullV);
+    TRACE_CHANGED_CENTI(TRACE_ENV_POWER_LOW_V, powerPolicyLowV);
+    TRACE_CHANGED(TRACE_ENV_POWER_MAX_SCALE, powerPolicyMaxScale);
 }
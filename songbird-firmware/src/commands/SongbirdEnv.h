@@ -45,6 +45,12 @@
 #define ENV_GPS_SIGNAL_TIMEOUT_MIN  "gps_signal_timeout_min"
 #define ENV_GPS_RETRY_INTERVAL_MIN  "gps_retry_interval_min"
 
+// Battery-Aware Duty Cycling
+#define ENV_POWER_POLICY_ENABLED    "power_policy_enabled"
+#define ENV_POWER_POLICY_FULL_V     "power_policy_full_v"
+#define ENV_POWER_POLICY_LOW_V      "power_policy_low_v"
+#define ENV_POWER_POLICY_MAX_SCALE  "power_policy_max_scale"
+
 // =============================================================================
 // Environment Module Interface
 // =============================================================================
@@ -76,6 +82,27 @@ bool envFetchConfig(SongbirdConfig* config);
  */
 bool envCheckModified(void);
 
+/**
+ * @brief Get the name of an environment variable
+ *
+ * @param index Variable index, in fetch order
+ * @return Variable name, or NULL past the last one
+ */
+const char* envVarName(uint8_t index);
+
+/**
+ * @brief Parse one environment variable into the configuration
+ *
+ * Numbers are clamped to the variable's range; negative integers are
+ * ignored.
+ *
+ * @param config Configuration to update
+ * @param name Variable name
+ * @param value Variable value as text
+ * @return true if the value was applied
+ */
+bool envApplyVar(SongbirdConfig* config, const char* name, const char* value);
+
 /**
  * @brief Compare two configurations for differences
  *
@@ -112,6 +139,33 @@ uint32_t envGetSensorIntervalMs(const SongbirdConfig* config);
  */
 uint32_t envGetCommandPollIntervalMs(const SongbirdConfig* config);
 
+/**
+ * @brief Get env.modified poll interval for current mode (ms)
+ *
+ * ENV_SAFETY_POLL_MS where an ATTN_EVENT_ENV announces changes (demo and
+ * sleep), a short poll where nothing does (transit and storage).
+ *
+ * @param config Current configuration
+ * @return Interval in milliseconds
+ */
+uint32_t envGetEnvPollIntervalMs(const SongbirdConfig* config);
+
+/**
+ * @brief Get Notecard status snapshot refresh interval for current mode (ms)
+ *
+ * @param config Current configuration
+ * @return Interval in milliseconds
+ */
+uint32_t envGetStatusPollIntervalMs(const SongbirdConfig* config);
+
+/**
+ * @brief Get BME280 measurement profile for current mode
+ *
+ * @param config Current configuration
+ * @return Profile (static storage, never NULL)
+ */
+const SensorProfile* envGetSensorProfile(const SongbirdConfig* config);
+
 /**
  * @brief Get sync interval for current mode (ms)
  *
@@ -162,8 +216,9 @@ void envLogConfig(const SongbirdConfig* config);
 /**
  * @brief Log specific configuration changes between old and new config
  *
- * Compares two configurations and logs each field that changed.
- * Always logs to serial so changes are visible during demos.
+ * Compares two configurations and records a TRACE_ENV_* event with the old
+ * and new value of each field that changed. The trace log is always on, so
+ * changes are visible during demos in release builds too.
  *
  * @param oldConfig Previous configuration
  * @param newConfig New configuration
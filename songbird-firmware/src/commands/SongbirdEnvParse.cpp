@@ -0,0 +1,482 @@
+/**
+ * @file SongbirdEnvParse.cpp
+ * @brief Environment variable parsing, defaults, intervals and comparison
+ *
+ * The parts of SongbirdEnv that touch no hardware: defaults, the table of
+ * env vars with their parsing and limits, mode presets, the per-mode
+ * intervals and sensor profiles, and the config comparison. Kept in their
+ * own translation unit so the native tests and benchmarks link the real
+ * code.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdEnv.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void envInitDefaults(SongbirdConfig* config) {
+    if (config == NULL) {
+        return;
+    }
+
+    config->mode = DEFAULT_MODE;
+    config->gpsIntervalMin = DEFAULT_GPS_INTERVAL_MIN;
+    config->syncIntervalMin = DEFAULT_SYNC_INTERVAL_MIN;
+    config->heartbeatHours = DEFAULT_HEARTBEAT_HOURS;
+
+    config->tempAlertHighC = DEFAULT_TEMP_ALERT_HIGH_C;
+    config->tempAlertLowC = DEFAULT_TEMP_ALERT_LOW_C;
+    config->humidityAlertHigh = DEFAULT_HUMIDITY_ALERT_HIGH;
+    config->humidityAlertLow = DEFAULT_HUMIDITY_ALERT_LOW;
+    config->pressureAlertDelta = DEFAULT_PRESSURE_ALERT_DELTA;
+    config->voltageAlertLow = DEFAULT_VOLTAGE_ALERT_LOW;
+
+    config->motionSensitivity = DEFAULT_MOTION_SENSITIVITY;
+    config->motionWakeEnabled = DEFAULT_MOTION_WAKE_ENABLED;
+
+    config->audioEnabled = DEFAULT_AUDIO_ENABLED;
+    config->audioVolume = DEFAULT_AUDIO_VOLUME;
+    config->audioAlertsOnly = DEFAULT_AUDIO_ALERTS_ONLY;
+
+    config->cmdWakeEnabled = DEFAULT_CMD_WAKE_ENABLED;
+    config->cmdAckEnabled = DEFAULT_CMD_ACK_ENABLED;
+    config->locateDurationSec = DEFAULT_LOCATE_DURATION_SEC;
+
+    config->ledEnabled = DEFAULT_LED_ENABLED;
+    config->debugMode = DEFAULT_DEBUG_MODE;
+
+    // GPS Power Management
+    config->gpsPowerSaveEnabled = DEFAULT_GPS_POWER_SAVE_ENABLED;
+    config->gpsSignalTimeoutMin = DEFAULT_GPS_SIGNAL_TIMEOUT_MIN;
+    config->gpsRetryIntervalMin = DEFAULT_GPS_RETRY_INTERVAL_MIN;
+
+    // Battery-Aware Duty Cycling
+    config->powerPolicyEnabled = DEFAULT_POWER_POLICY_ENABLED;
+    config->powerPolicyFullV = DEFAULT_POWER_POLICY_FULL_V;
+    config->powerPolicyLowV = DEFAULT_POWER_POLICY_LOW_V;
+    config->powerPolicyMaxScale = DEFAULT_POWER_POLICY_MAX_SCALE;
+}
+
+// =============================================================================
+// Environment Variable Table
+// =============================================================================
+
+typedef enum {
+    ENV_VAR_MODE = 0,       // OperatingMode by name
+    ENV_VAR_SENSITIVITY,    // MotionSensitivity by name
+    ENV_VAR_BOOL,           // "true" or "1"
+    ENV_VAR_U8,             // Integer, negative values ignored
+    ENV_VAR_U16,            // Integer, negative values ignored
+    ENV_VAR_FLOAT           // Number
+} EnvVarKind;
+
+typedef struct {
+    const char* name;
+    uint8_t kind;           // EnvVarKind
+    uint8_t offset;         // Field in SongbirdConfig
+    float low;              // Clamp range (numeric kinds)
+    float high;
+} EnvVar;
+
+static_assert(sizeof(SongbirdConfig) <= 255, "Env var field offsets are one byte");
+
+#define ENV_FIELD(field) ((uint8_t)offsetof(SongbirdConfig, field))
+
+// In fetch order
+static const EnvVar ENV_VARS[] = {
+    {ENV_MODE,                   ENV_VAR_MODE,        ENV_FIELD(mode),                0, 0},
+
+    // Timing
+    {ENV_GPS_INTERVAL_MIN,       ENV_VAR_U16,         ENV_FIELD(gpsIntervalMin),      1, 1440},
+    {ENV_SYNC_INTERVAL_MIN,      ENV_VAR_U16,         ENV_FIELD(syncIntervalMin),     1, 1440},
+    {ENV_HEARTBEAT_HOURS,        ENV_VAR_U16,         ENV_FIELD(heartbeatHours),      1, 168},
+
+    // Alert thresholds
+    {ENV_TEMP_ALERT_HIGH_C,      ENV_VAR_FLOAT,       ENV_FIELD(tempAlertHighC),      -40.0f, 85.0f},
+    {ENV_TEMP_ALERT_LOW_C,       ENV_VAR_FLOAT,       ENV_FIELD(tempAlertLowC),       -40.0f, 85.0f},
+    {ENV_HUMIDITY_ALERT_HIGH,    ENV_VAR_FLOAT,       ENV_FIELD(humidityAlertHigh),   0.0f, 100.0f},
+    {ENV_HUMIDITY_ALERT_LOW,     ENV_VAR_FLOAT,       ENV_FIELD(humidityAlertLow),    0.0f, 100.0f},
+    {ENV_PRESSURE_ALERT_DELTA,   ENV_VAR_FLOAT,       ENV_FIELD(pressureAlertDelta),  1.0f, 100.0f},
+    {ENV_VOLTAGE_ALERT_LOW,      ENV_VAR_FLOAT,       ENV_FIELD(voltageAlertLow),     3.3f, 4.2f},
+
+    // Motion
+    {ENV_MOTION_SENSITIVITY,     ENV_VAR_SENSITIVITY, ENV_FIELD(motionSensitivity),   0, 0},
+    {ENV_MOTION_WAKE_ENABLED,    ENV_VAR_BOOL,        ENV_FIELD(motionWakeEnabled),   0, 0},
+
+    // Audio
+    {ENV_AUDIO_ENABLED,          ENV_VAR_BOOL,        ENV_FIELD(audioEnabled),        0, 0},
+    {ENV_AUDIO_VOLUME,           ENV_VAR_U8,          ENV_FIELD(audioVolume),         0, 100},
+    {ENV_AUDIO_ALERTS_ONLY,      ENV_VAR_BOOL,        ENV_FIELD(audioAlertsOnly),     0, 0},
+
+    // Command & Control
+    {ENV_CMD_WAKE_ENABLED,       ENV_VAR_BOOL,        ENV_FIELD(cmdWakeEnabled),      0, 0},
+    {ENV_CMD_ACK_ENABLED,        ENV_VAR_BOOL,        ENV_FIELD(cmdAckEnabled),       0, 0},
+    {ENV_LOCATE_DURATION_SEC,    ENV_VAR_U16,         ENV_FIELD(locateDurationSec),   5, 300},
+
+    // Debug
+    {ENV_LED_ENABLED,            ENV_VAR_BOOL,        ENV_FIELD(ledEnabled),          0, 0},
+    {ENV_DEBUG_MODE,             ENV_VAR_BOOL,        ENV_FIELD(debugMode),           0, 0},
+
+    // GPS Power Management
+    {ENV_GPS_POWER_SAVE_ENABLED, ENV_VAR_BOOL,        ENV_FIELD(gpsPowerSaveEnabled), 0, 0},
+    {ENV_GPS_SIGNAL_TIMEOUT_MIN, ENV_VAR_U8,          ENV_FIELD(gpsSignalTimeoutMin), 10, 30},
+    {ENV_GPS_RETRY_INTERVAL_MIN, ENV_VAR_U8,          ENV_FIELD(gpsRetryIntervalMin), 5, 120},
+
+    // Battery-Aware Duty Cycling
+    {ENV_POWER_POLICY_ENABLED,   ENV_VAR_BOOL,        ENV_FIELD(powerPolicyEnabled),  0, 0},
+    {ENV_POWER_POLICY_FULL_V,    ENV_VAR_FLOAT,       ENV_FIELD(powerPolicyFullV),    3.3f, 4.2f},
+    {ENV_POWER_POLICY_LOW_V,     ENV_VAR_FLOAT,       ENV_FIELD(powerPolicyLowV),     3.0f, 4.0f},
+    {ENV_POWER_POLICY_MAX_SCALE, ENV_VAR_U8,          ENV_FIELD(powerPolicyMaxScale), 1, 10},
+};
+
+#define ENV_VAR_COUNT (sizeof(ENV_VARS) / sizeof(ENV_VARS[0]))
+
+const char* envVarName(uint8_t index) {
+    if (index >= ENV_VAR_COUNT) {
+        return NULL;
+    }
+    return ENV_VARS[index].name;
+}
+
+bool envApplyVar(SongbirdConfig* config, const char* name, const char* value) {
+    if (config == NULL || name == NULL || value == NULL) {
+        return false;
+    }
+
+    const EnvVar* var = NULL;
+    for (uint8_t i = 0; i < ENV_VAR_COUNT; i++) {
+        if (strcmp(name, ENV_VARS[i].name) == 0) {
+            var = &ENV_VARS[i];
+            break;
+        }
+    }
+    if (var == NULL) {
+        return false;
+    }
+
+    uint8_t* field = (uint8_t*)config + var->offset;
+    switch (var->kind) {
+        case ENV_VAR_MODE:
+            *(OperatingMode*)field = envParseMode(value);
+            return true;
+
+        case ENV_VAR_SENSITIVITY:
+            *(MotionSensitivity*)field = envParseSensitivity(value);
+            return true;
+
+        case ENV_VAR_BOOL:
+            *(bool*)field = (strcmp(value, "true") == 0 || strcmp(value, "1") == 0);
+            return true;
+
+        case ENV_VAR_U8:
+        case ENV_VAR_U16: {
+            int32_t intVal = atoi(value);
+            if (intVal < 0) {
+                return false;
+            }
+            intVal = CLAMP(intVal, (int32_t)var->low, (int32_t)var->high);
+            if (var->kind == ENV_VAR_U8) {
+                *(uint8_t*)field = (uint8_t)intVal;
+            } else {
+                *(uint16_t*)field = (uint16_t)intVal;
+            }
+            return true;
+        }
+
+        case ENV_VAR_FLOAT: {
+            float floatVal = (float)atof(value);
+            if (isnan(floatVal)) {
+                return false;
+            }
+            *(float*)field = CLAMP(floatVal, var->low, var->high);
+            return true;
+        }
+    }
+    return false;
+}
+
+// =============================================================================
+// Configuration Comparison
+// =============================================================================
+
+bool envConfigChanged(const SongbirdConfig* a, const SongbirdConfig* b) {
+    if (a == NULL || b == NULL) {
+        return true;
+    }
+
+    // Compare all fields
+    if (a->mode != b->mode) return true;
+    if (a->gpsIntervalMin != b->gpsIntervalMin) return true;
+    if (a->syncIntervalMin != b->syncIntervalMin) return true;
+    if (a->heartbeatHours != b->heartbeatHours) return true;
+
+    if (a->tempAlertHighC != b->tempAlertHighC) return true;
+    if (a->tempAlertLowC != b->tempAlertLowC) return true;
+    if (a->humidityAlertHigh != b->humidityAlertHigh) return true;
+    if (a->humidityAlertLow != b->humidityAlertLow) return true;
+    if (a->pressureAlertDelta != b->pressureAlertDelta) return true;
+    if (a->voltageAlertLow != b->voltageAlertLow) return true;
+
+    if (a->motionSensitivity != b->motionSensitivity) return true;
+    if (a->motionWakeEnabled != b->motionWakeEnabled) return true;
+
+    if (a->audioEnabled != b->audioEnabled) return true;
+    if (a->audioVolume != b->audioVolume) return true;
+    if (a->audioAlertsOnly != b->audioAlertsOnly) return true;
+
+    if (a->cmdWakeEnabled != b->cmdWakeEnabled) return true;
+    if (a->cmdAckEnabled != b->cmdAckEnabled) return true;
+    if (a->locateDurationSec != b->locateDurationSec) return true;
+
+    if (a->ledEnabled != b->ledEnabled) return true;
+    if (a->debugMode != b->debugMode) return true;
+
+    // GPS Power Management
+    if (a->gpsPowerSaveEnabled != b->gpsPowerSaveEnabled) return true;
+    if (a->gpsSignalTimeoutMin != b->gpsSignalTimeoutMin) return true;
+    if (a->gpsRetryIntervalMin != b->gpsRetryIntervalMin) return true;
+
+    // Battery-Aware Duty Cycling
+    if (a->powerPolicyEnabled != b->powerPolicyEnabled) return true;
+    if (a->powerPolicyFullV != b->powerPolicyFullV) return true;
+    if (a->powerPolicyLowV != b->powerPolicyLowV) return true;
+    if (a->powerPolicyMaxScale != b->powerPolicyMaxScale) return true;
+
+    return false;
+}
+
+// =============================================================================
+// Mode Presets
+// =============================================================================
+
+void envApplyModePreset(SongbirdConfig* config, OperatingMode mode) {
+    if (config == NULL) {
+        return;
+    }
+
+    config->mode = mode;
+
+    switch (mode) {
+        case MODE_DEMO:
+            config->gpsIntervalMin = 1;
+            config->syncIntervalMin = 1;  // Continuous sync
+            config->motionSensitivity = MOTION_SENSITIVITY_HIGH;
+            break;
+
+        case MODE_TRANSIT:
+            config->gpsIntervalMin = 5;
+            config->syncIntervalMin = 15;
+            config->motionSensitivity = MOTION_SENSITIVITY_MEDIUM;
+            break;
+
+        case MODE_STORAGE:
+            config->gpsIntervalMin = 60;
+            config->syncIntervalMin = 60;
+            config->motionSensitivity = MOTION_SENSITIVITY_LOW;
+            break;
+
+        case MODE_SLEEP:
+            config->gpsIntervalMin = 0;  // Disabled
+            config->syncIntervalMin = 0;  // On motion only
+            config->motionSensitivity = MOTION_SENSITIVITY_MEDIUM;
+            config->motionWakeEnabled = true;
+            break;
+    }
+}
+
+// =============================================================================
+// Interval Calculations
+// =============================================================================
+
+uint32_t envGetSensorIntervalMs(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return SENSOR_INTERVAL_DEMO_MS;
+    }
+
+    switch (config->mode) {
+        case MODE_DEMO:
+            return SENSOR_INTERVAL_DEMO_MS;
+        case MODE_TRANSIT:
+            return SENSOR_INTERVAL_TRANSIT_MS;
+        case MODE_STORAGE:
+            return SENSOR_INTERVAL_STORAGE_MS;
+        case MODE_SLEEP:
+            return SENSOR_INTERVAL_SLEEP_MS;
+        default:
+            return SENSOR_INTERVAL_DEMO_MS;
+    }
+}
+
+uint32_t envGetCommandPollIntervalMs(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return COMMAND_POLL_DEMO_MS;
+    }
+
+    switch (config->mode) {
+        case MODE_DEMO:
+            return COMMAND_POLL_DEMO_MS;
+        case MODE_TRANSIT:
+            return COMMAND_POLL_TRANSIT_MS;
+        case MODE_STORAGE:
+            return COMMAND_POLL_STORAGE_MS;
+        case MODE_SLEEP:
+            return COMMAND_POLL_SLEEP_MS;
+        default:
+            return COMMAND_POLL_DEMO_MS;
+    }
+}
+
+uint32_t envGetEnvPollIntervalMs(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return ENV_SAFETY_POLL_MS;
+    }
+
+    switch (config->mode) {
+        case MODE_TRANSIT:
+            return ENV_POLL_TRANSIT_MS;
+        case MODE_STORAGE:
+            return ENV_POLL_STORAGE_MS;
+        case MODE_DEMO:
+        case MODE_SLEEP:
+        default:
+            return ENV_SAFETY_POLL_MS;
+    }
+}
+
+uint32_t envGetStatusPollIntervalMs(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return STATUS_POLL_DEMO_MS;
+    }
+
+    switch (config->mode) {
+        case MODE_DEMO:
+            return STATUS_POLL_DEMO_MS;
+        case MODE_TRANSIT:
+            return STATUS_POLL_TRANSIT_MS;
+        case MODE_STORAGE:
+        case MODE_SLEEP:
+            return STATUS_POLL_IDLE_MS;
+        default:
+            return STATUS_POLL_DEMO_MS;
+    }
+}
+
+// BME280 profiles. Demo free-runs so a reading never waits on a conversion,
+// with a light IIR filter to smooth the 0.5 s samples. Transit and sleep take
+// the cheapest forced reading. Storage oversamples pressure for a low-noise
+// reading every 5 minutes; the IIR filter stays off in forced modes because
+// it would smooth across readings minutes apart and delay alerts.
+static const SensorProfile SENSOR_PROFILE_DEMO = {
+    1, 4, 1,    // Oversampling T/P/H
+    4,          // IIR coefficient
+    true,       // Normal mode
+    500         // Standby (ms)
+};
+static const SensorProfile SENSOR_PROFILE_TRANSIT = { 1, 1, 1, 0, false, 0 };
+static const SensorProfile SENSOR_PROFILE_STORAGE = { 1, 4, 1, 0, false, 0 };
+
+const SensorProfile* envGetSensorProfile(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return &SENSOR_PROFILE_DEMO;
+    }
+
+    switch (config->mode) {
+        case MODE_DEMO:
+            return &SENSOR_PROFILE_DEMO;
+        case MODE_TRANSIT:
+        case MODE_SLEEP:
+            return &SENSOR_PROFILE_TRANSIT;
+        case MODE_STORAGE:
+            return &SENSOR_PROFILE_STORAGE;
+        default:
+            return &SENSOR_PROFILE_DEMO;
+    }
+}
+
+uint32_t envGetSyncIntervalMs(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return MINUTES_TO_MS(DEFAULT_SYNC_INTERVAL_MIN);
+    }
+
+    return MINUTES_TO_MS(config->syncIntervalMin);
+}
+
+uint32_t envGetSleepDurationSec(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return 0;
+    }
+
+    switch (config->mode) {
+        case MODE_DEMO:
+            return 0;  // No sleep in demo mode
+        case MODE_TRANSIT:
+            return config->gpsIntervalMin * 60;
+        case MODE_STORAGE:
+            return config->gpsIntervalMin * 60;
+        case MODE_SLEEP:
+            return 0;  // Wake on motion only
+        default:
+            return 0;
+    }
+}
+
+// =============================================================================
+// String Parsing
+// =============================================================================
+
+OperatingMode envParseMode(const char* str) {
+    if (str == NULL) {
+        return DEFAULT_MODE;
+    }
+
+    if (strcmp(str, "demo") == 0) {
+        return MODE_DEMO;
+    } else if (strcmp(str, "transit") == 0) {
+        return MODE_TRANSIT;
+    } else if (strcmp(str, "storage") == 0) {
+        return MODE_STORAGE;
+    } else if (strcmp(str, "sleep") == 0) {
+        return MODE_SLEEP;
+    }
+
+    return DEFAULT_MODE;
+}
+
+const char* envGetModeName(OperatingMode mode) {
+    switch (mode) {
+        case MODE_DEMO:
+            return "demo";
+        case MODE_TRANSIT:
+            return "transit";
+        case MODE_STORAGE:
+            return "storage";
+        case MODE_SLEEP:
+            return "sleep";
+        default:
+            return "unknown";
+    }
+}
+
+MotionSensitivity envParseSensitivity(const char* str) {
+    if (str == NULL) {
+        return DEFAULT_MOTION_SENSITIVITY;
+    }
+
+    if (strcmp(str, "low") == 0) {
+        return MOTION_SENSITIVITY_LOW;
+    } else if (strcmp(str, "medium") == 0) {
+        return MOTION_SENSITIVITY_MEDIUM;
+    } else if (strcmp(str, "high") == 0) {
+        return MOTION_SENSITIVITY_HIGH;
+    }
+
+    return DEFAULT_MOTION_SENSITIVITY;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file SongbirdAlertEngine.cpp
+ * @brief Streaming sensor alert engine implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdAlertEngine.h"
+#include <string.h>
+#include <math.h>
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static const uint8_t PERSIST_MASK = (uint8_t)((1u << ALERT_PERSIST_WINDOW) - 1);
+
+static_assert(ALERT_PERSIST_WINDOW <= 8, "Persistence history is one byte per alert");
+static_assert(ALERT_PERSIST_COUNT <= ALERT_PERSIST_WINDOW, "N must not exceed M");
+
+static uint8_t countBits(uint8_t value) {
+    uint8_t count = 0;
+    while (value) {
+        value &= (uint8_t)(value - 1);
+        count++;
+    }
+    return count;
+}
+
+static uint8_t flagIndex(uint8_t flag) {
+    uint8_t index = 0;
+    while (flag > 1) {
+        flag >>= 1;
+        index++;
+    }
+    return index;
+}
+
+static void recordCondition(AlertEngineState* engine, uint8_t flag, bool raise, bool clear) {
+    uint8_t i = flagIndex(flag);
+    engine->raiseHistory[i] = (uint8_t)((engine->raiseHistory[i] << 1) | (raise ? 1 : 0));
+    engine->clearHistory[i] = (uint8_t)((engine->clearHistory[i] << 1) | (clear ? 1 : 0));
+}
+
+static bool persisted(uint8_t history) {
+    return countBits(history & PERSIST_MASK) >= ALERT_PERSIST_COUNT;
+}
+
+static float median3(float a, float b, float c) {
+    if (a > b) {
+        float t = a;
+        a = b;
+        b = t;
+    }
+    // a <= b: the median is whichever of a, b, c lies between the others
+    if (c >= b) return b;
+    if (c <= a) return a;
+    return c;
+}
+
+// Median of the last three raw samples; passes samples through until
+// two are held
+static float prefilter(float* recent, uint8_t count, float sample) {
+    float out = (count >= 2) ? median3(recent[0], recent[1], sample) : sample;
+    recent[0] = recent[1];
+    recent[1] = sample;
+    return out;
+}
+
+static float smooth(float current, float sample) {
+    return current + ALERT_EWMA_ALPHA * (sample - current);
+}
+
+// Pressure in 0.1 hPa; 0 is reserved for "no sample in this slot"
+static uint16_t encodePressure(float hPa) {
+    float scaled = hPa * 10.0f + 0.5f;
+    if (scaled < 1.0f) return 1;
+    if (scaled > 65535.0f) return 65535;
+    return (uint16_t)scaled;
+}
+
+// Record smoothed pressure and return the change over the tendency window
+static float updateTendency(AlertEngineState* engine, float pressure, uint32_t nowSec) {
+    if (nowSec == 0) {
+        return NAN;
+    }
+
+    uint32_t slot = nowSec / ALERT_TENDENCY_SLOT_SEC;
+    if (engine->tendencySlot == 0 || slot < engine->tendencySlot ||
+        slot - engine->tendencySlot >= ALERT_TENDENCY_SLOTS) {
+        // No usable history (first sample, clock stepped back, or long gap)
+        memset(engine->tendency, 0, sizeof(engine->tendency));
+    } else {
+        // Slots skipped since the last sample have no reading
+        for (uint32_t s = engine->tendencySlot + 1; s < slot; s++) {
+            engine->tendency[s % ALERT_TENDENCY_SLOTS] = 0;
+        }
+    }
+
+    // The newest sample in a slot represents it
+    engine->tendencySlot = slot;
+    uint16_t current = encodePressure(pressure);
+    engine->tendency[slot % ALERT_TENDENCY_SLOTS] = current;
+
+    // Oldest slot in the ring is exactly one window back
+    uint16_t past = engine->tendency[(slot + 1) % ALERT_TENDENCY_SLOTS];
+    if (past == 0) {
+        return NAN;
+    }
+    return ((int32_t)current - (int32_t)past) / 10.0f;
+}
+
+// =============================================================================
+// Alert Engine
+// =============================================================================
+
+void alertEngineReset(AlertEngineState* engine) {
+    if (engine == NULL) {
+        return;
+    }
+
+    memset(engine, 0, sizeof(AlertEngineState));
+    engine->temperature = NAN;
+    engine->humidity = NAN;
+    engine->pressure = NAN;
+    engine->tempRate = NAN;
+}
+
+bool alertEngineUpdate(AlertEngineState* engine, const SensorData* data,
+                       const SongbirdConfig* config, uint32_t nowSec,
+                       uint8_t activeAlerts, AlertEvaluation* eval) {
+    if (engine == NULL || data == NULL || config == NULL || eval == NULL || !data->valid) {
+        return false;
+    }
+
+    memset(eval, 0, sizeof(AlertEvaluation));
+
+    // A long gap or a clock step restarts smoothing so stale history does
+    // not drag the new readings
+    uint32_t dt = 0;
+    if (nowSec != 0 && engine->lastSampleSec != 0) {
+        if (nowSec < engine->lastSampleSec ||
+            nowSec - engine->lastSampleSec > ALERT_MAX_GAP_SEC) {
+            engine->smoothed = false;
+        } else {
+            dt = nowSec - engine->lastSampleSec;
+        }
+    }
+    if (nowSec == 0) {
+        engine->rateValid = false;
+    }
+
+    // Spike rejection
+    if (!engine->smoothed) {
+        engine->recentCount = 0;
+    }
+    float temperature = prefilter(engine->recentTemp, engine->recentCount, data->temperature);
+    float humidity = prefilter(engine->recentHumidity, engine->recentCount, data->humidity);
+    float pressure = prefilter(engine->recentPressure, engine->recentCount, data->pressure);
+    if (engine->recentCount < 2) {
+        engine->recentCount++;
+    }
+
+    // EWMA smoothing
+    float previousTemp = engine->temperature;
+    bool hadPrevious = engine->smoothed;
+    if (!engine->smoothed) {
+        engine->temperature = temperature;
+        engine->humidity = humidity;
+        engine->pressure = pressure;
+        engine->smoothed = true;
+        engine->rateValid = false;
+    } else {
+        engine->temperature = smooth(engine->temperature, temperature);
+        engine->humidity = smooth(engine->humidity, humidity);
+        engine->pressure = smooth(engine->pressure, pressure);
+    }
+
+    // Temperature slope of the smoothed signal, smoothed again
+    if (hadPrevious && dt > 0) {
+        float rate = (engine->temperature - previousTemp) * 3600.0f / (float)dt;
+        engine->tempRate = engine->rateValid ? smooth(engine->tempRate, rate) : rate;
+        engine->rateValid = true;
+    }
+    engine->lastSampleSec = nowSec;
+
+    float tendency = updateTendency(engine, engine->pressure, nowSec);
+    float rate = engine->rateValid ? engine->tempRate : NAN;
+
+    // Level thresholds on smoothed values, with hysteresis for clearing
+    float t = engine->temperature;
+    float h = engine->humidity;
+    recordCondition(engine, ALERT_FLAG_TEMP_HIGH, t > config->tempAlertHighC,
+                    t < config->tempAlertHighC - ALERT_HYSTERESIS_TEMP_C);
+    recordCondition(engine, ALERT_FLAG_TEMP_LOW, t < config->tempAlertLowC,
+                    t > config->tempAlertLowC + ALERT_HYSTERESIS_TEMP_C);
+    recordCondition(engine, ALERT_FLAG_HUMIDITY_HIGH, h > config->humidityAlertHigh,
+                    h < config->humidityAlertHigh - ALERT_HYSTERESIS_HUMIDITY);
+    recordCondition(engine, ALERT_FLAG_HUMIDITY_LOW, h < config->humidityAlertLow,
+                    h > config->humidityAlertLow + ALERT_HYSTERESIS_HUMIDITY);
+
+    // Barometric tendency (no evidence either way until the window fills)
+    bool tendencyKnown = !isnan(tendency);
+    recordCondition(engine, ALERT_FLAG_PRESSURE_DELTA,
+                    tendencyKnown && fabsf(tendency) > config->pressureAlertDelta,
+                    tendencyKnown &&
+                    fabsf(tendency) < config->pressureAlertDelta - ALERT_HYSTERESIS_PRESSURE_HPA);
+
+    // Temperature rate of change
+    bool rateKnown = !isnan(rate);
+    recordCondition(engine, ALERT_FLAG_TEMP_RATE,
+                    rateKnown && fabsf(rate) > ALERT_TEMP_RATE_C_PER_HOUR,
+                    rateKnown && fabsf(rate) < ALERT_TEMP_RATE_C_PER_HOUR / 2.0f);
+
+    // Battery on the raw reading; a failed read is not a sample
+    if (data->voltage > 0.0f) {
+        recordCondition(engine, ALERT_FLAG_LOW_BATTERY,
+                        data->voltage < config->voltageAlertLow,
+                        data->voltage > config->voltageAlertLow + ALERT_HYSTERESIS_VOLTAGE);
+    }
+
+    // N-of-M persistence
+    static const uint8_t ENGINE_FLAGS = ALERT_FLAG_TEMP_HIGH | ALERT_FLAG_TEMP_LOW |
+                                        ALERT_FLAG_HUMIDITY_HIGH | ALERT_FLAG_HUMIDITY_LOW |
+                                        ALERT_FLAG_PRESSURE_DELTA | ALERT_FLAG_LOW_BATTERY |
+                                        ALERT_FLAG_TEMP_RATE;
+    for (uint8_t i = 0; i < ALERT_FLAG_BITS; i++) {
+        uint8_t flag = (uint8_t)(1u << i);
+        if (!(ENGINE_FLAGS & flag)) {
+            continue;
+        }
+        if (!(activeAlerts & flag) && persisted(engine->raiseHistory[i])) {
+            eval->raised |= flag;
+        } else if ((activeAlerts & flag) && persisted(engine->clearHistory[i])) {
+            eval->cleared |= flag;
+        }
+    }
+
+    eval->temperature = engine->temperature;
+    eval->humidity = engine->humidity;
+    eval->pressure = engine->pressure;
+    eval->tempRate = rate;
+    eval->pressureTendency = tendency;
+
+    return true;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file SongbirdAlertEngine.h
+ * @brief Streaming sensor alert engine for Songbird
+ *
+ * Turns the stream of sensor readings into alert transitions:
+ *
+ * - Temperature, humidity and pressure pass a median-of-3 prefilter, which
+ *   removes isolated spikes outright, and are then smoothed with an EWMA
+ *   before thresholds are applied.
+ * - Each alert keeps a bit history of the last ALERT_PERSIST_WINDOW samples
+ *   and is raised (or cleared, past the hysteresis band) only when
+ *   ALERT_PERSIST_COUNT of them agree.
+ * - The temperature rate-of-change alert uses the slope of the smoothed
+ *   temperature, itself smoothed, in C per hour.
+ * - The pressure alert uses the barometric tendency: the change in smoothed
+ *   pressure over ALERT_TENDENCY_WINDOW_SEC, from a history kept at
+ *   ALERT_TENDENCY_SLOT_SEC resolution. It no longer depends on the sample
+ *   interval and catches slow drops that never move much between readings.
+ *
+ * Rate and tendency need a wall clock; while the time is unknown (0) only
+ * the level thresholds are evaluated. The engine state is small enough to
+ * persist in SongbirdState across deep sleep.
+ *
+ * Pure logic (no hardware access) so it can be unit tested on the host.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_ALERT_ENGINE_H
+#define SONGBIRD_ALERT_ENGINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// Tendency history: one slot per ALERT_TENDENCY_SLOT_SEC, plus the current one
+#define ALERT_TENDENCY_SLOTS    (ALERT_TENDENCY_WINDOW_SEC / ALERT_TENDENCY_SLOT_SEC + 1)
+
+// One history byte per alert flag bit
+#define ALERT_FLAG_BITS         8
+
+// =============================================================================
+// Data Structures
+// =============================================================================
+
+// Persistent engine state (saved in SongbirdState)
+typedef struct {
+    float temperature;                          // Smoothed temperature (C)
+    float humidity;                             // Smoothed humidity (%)
+    float pressure;                             // Smoothed pressure (hPa)
+    float tempRate;                             // Smoothed temperature slope (C/hour)
+    float recentTemp[2];                        // Last two raw samples (median prefilter)
+    float recentHumidity[2];
+    float recentPressure[2];
+    uint8_t recentCount;                        // Raw samples held (0-2)
+    uint32_t lastSampleSec;                     // Wall clock of last sample (0 = unknown)
+    bool smoothed;                              // EWMA seeded
+    bool rateValid;                             // tempRate seeded
+    uint8_t raiseHistory[ALERT_FLAG_BITS];      // Bit n: raise condition n samples ago
+    uint8_t clearHistory[ALERT_FLAG_BITS];      // Bit n: clear condition n samples ago
+    uint32_t tendencySlot;                      // Slot number of newest entry (0 = empty)
+    uint16_t tendency[ALERT_TENDENCY_SLOTS];    // Pressure per slot (0.1 hPa, 0 = missing)
+} AlertEngineState;
+
+// Result of one update
+typedef struct {
+    uint8_t raised;                 // Alerts newly raised (ALERT_FLAG_*)
+    uint8_t cleared;                // Active alerts now cleared (ALERT_FLAG_*)
+    float temperature;              // Smoothed values the thresholds were applied to
+    float humidity;
+    float pressure;
+    float tempRate;                 // C/hour, NAN if unknown
+    float pressureTendency;         // hPa over the tendency window, NAN if unknown
+} AlertEvaluation;
+
+// =============================================================================
+// Alert Engine Interface
+// =============================================================================
+
+/**
+ * @brief Reset engine state (no history)
+ *
+ * @param engine Engine state
+ */
+void alertEngineReset(AlertEngineState* engine);
+
+/**
+ * @brief Feed one reading and evaluate all alerts
+ *
+ * Low battery uses the raw voltage; a voltage of 0 (read failed) leaves the
+ * battery history unchanged. Motion is not handled here.
+ *
+ * @param engine Engine state
+ * @param data Sensor reading (ignored unless valid)
+ * @param config Thresholds
+ * @param nowSec Wall clock in seconds (0 if unknown)
+ * @param activeAlerts Currently active alerts (ALERT_FLAG_*)
+ * @param eval Output transitions and derived values
+ * @return true if the reading was used
+ */
+bool alertEngineUpdate(AlertEngineState* engine, const SensorData* data,
+                       const SongbirdConfig* config, uint32_t nowSec,
+                       uint8_t activeAlerts, AlertEvaluation* eval);
+
+#endif // SONGBIRD_ALERT_ENGINE_H
@@ -0,0 +1,168 @@
+/**
+ * @file SongbirdBootProfile.cpp
+ * @brief Boot-time profile implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdBootProfile.h"
+#include <string.h>
+
+#ifndef NATIVE_TEST
+#include <Arduino.h>
+#endif
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+static const char* const STAGE_NAMES[BOOT_STAGE_COUNT] = {
+#define BOOT_STAGE_NAME(id, name) name,
+    BOOT_STAGES(BOOT_STAGE_NAME)
+#undef BOOT_STAGE_NAME
+};
+
+// Zeroed at reset, so setup() can mark stages before any init call
+static BootProfile s_profile;
+
+// =============================================================================
+// Profile Calculations
+// =============================================================================
+
+static uint16_t msToCs(uint32_t ms) {
+    uint32_t cs = (ms + 9) / 10;
+    return (uint16_t)CLAMP(cs, (uint32_t)1, (uint32_t)UINT16_MAX);
+}
+
+void bootProfileMarkAt(BootProfile* profile, BootStage stage, uint32_t nowMs) {
+    if (profile == NULL || stage >= BOOT_STAGE_COUNT) {
+        return;
+    }
+
+    uint32_t bit = 1UL << stage;
+    if (__atomic_load_n(&profile->reached, __ATOMIC_ACQUIRE) & bit) {
+        return;
+    }
+
+    // Each stage is marked by one task, so the time is written before the
+    // bit publishes it
+    profile->markMs[stage] = nowMs;
+    __atomic_fetch_or(&profile->reached, bit, __ATOMIC_RELEASE);
+}
+
+void bootProfileSetFlags(BootProfile* profile, uint8_t flags) {
+    if (profile == NULL) {
+        return;
+    }
+    __atomic_fetch_or(&profile->flags, flags, __ATOMIC_RELAXED);
+}
+
+bool bootProfileElapsedMs(const BootProfile* profile, BootStage stage, uint32_t* ms) {
+    if (profile == NULL || stage >= BOOT_STAGE_COUNT || ms == NULL) {
+        return false;
+    }
+    if (!(__atomic_load_n(&profile->reached, __ATOMIC_ACQUIRE) & (1UL << stage))) {
+        return false;
+    }
+    *ms = profile->markMs[stage];
+    return true;
+}
+
+bool bootProfileStageMs(const BootProfile* profile, BootStage stage, uint32_t* ms) {
+    uint32_t end = 0;
+    if (!bootProfileElapsedMs(profile, stage, &end)) {
+        return false;
+    }
+
+    uint32_t start = 0;
+    for (int8_t i = (int8_t)stage - 1; i >= 0; i--) {
+        if (bootProfileElapsedMs(profile, (BootStage)i, &start)) {
+            break;
+        }
+    }
+
+    // A stage marked from another task can finish before an earlier one
+    *ms = (end > start) ? end - start : 0;
+    return true;
+}
+
+void bootProfileCompact(const BootProfile* profile, BootProfileRecord* record) {
+    if (profile == NULL || record == NULL) {
+        return;
+    }
+
+    memset(record, 0, sizeof(BootProfileRecord));
+    record->flags = profile->flags;
+
+    uint32_t ms = 0;
+    if (bootProfileElapsedMs(profile, BOOT_STAGE_TASKS, &ms)) {
+        record->tasksCs = msToCs(ms);
+    }
+    if (bootProfileElapsedMs(profile, BOOT_STAGE_ENV, &ms)) {
+        record->readyCs = msToCs(ms);
+    }
+    if (bootProfileElapsedMs(profile, BOOT_STAGE_FIRST_NOTE, &ms)) {
+        record->firstNoteCs = msToCs(ms);
+    }
+
+    uint32_t slowest = 0;
+    for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) {
+        if (bootProfileStageMs(profile, (BootStage)i, &ms) && ms > slowest) {
+            slowest = ms;
+            record->slowestStage = i;
+            record->slowestCs = msToCs(ms);
+        }
+    }
+}
+
+void bootProfileHistoryAdd(BootProfileHistory* history, const BootProfileRecord* record) {
+    if (history == NULL || record == NULL) {
+        return;
+    }
+
+    if (history->next >= BOOT_PROFILE_HISTORY) {
+        history->next = 0;
+    }
+    history->records[history->next] = *record;
+    history->next = (history->next + 1) % BOOT_PROFILE_HISTORY;
+    if (history->count < BOOT_PROFILE_HISTORY) {
+        history->count++;
+    }
+}
+
+uint32_t bootProfileHistoryMaxFirstNoteMs(const BootProfileHistory* history) {
+    if (history == NULL) {
+        return 0;
+    }
+
+    uint16_t longest = 0;
+    uint8_t count = MIN(history->count, (uint8_t)BOOT_PROFILE_HISTORY);
+    for (uint8_t i = 0; i < count; i++) {
+        longest = MAX(longest, history->records[i].firstNoteCs);
+    }
+    return (uint32_t)longest * 10;
+}
+
+const char* bootStageName(BootStage stage) {
+    if (stage < BOOT_STAGE_COUNT) {
+        return STAGE_NAMES[stage];
+    }
+    return "unknown";
+}
+
+// =============================================================================
+// This Boot
+// =============================================================================
+
+const BootProfile* bootProfileGet(void) {
+    return &s_profile;
+}
+
+void bootProfileFlag(uint8_t flags) {
+    bootProfileSetFlags(&s_profile, flags);
+}
+
+void bootProfileMark(BootStage stage) {
+    bootProfileMarkAt(&s_profile, stage, millis());
+}
@@ -0,0 +1,195 @@
+/**
+ * @file SongbirdBootProfile.h
+ * @brief Boot-time profile for Songbird
+ *
+ * Timestamps the end of each boot stage, from reset through setup(), the
+ * MainTask startup sequence and the first note handed to the Notecard.
+ * A stage lasts from the end of the previous stage that was reached, so
+ * stages a boot skips (configure on a warm boot, the connection wait on a
+ * scheduled wake) fold into the next one.
+ *
+ * The first health.qo note of each boot carries the full profile, and the
+ * first track.qo note of each boot carries boot_flags and boot_total_ms, so
+ * a wake that sends no health.qo still reports its boot time. A compact
+ * record of each boot is kept in the persistent state (the last
+ * BOOT_PROFILE_HISTORY boots) so the report can compare this wake against
+ * the previous ones.
+ *
+ * The profile calculations are pure so they can be tested on the host.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_BOOT_PROFILE_H
+#define SONGBIRD_BOOT_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Boot Stages
+// =============================================================================
+
+// X(id, name) in boot order - name is the health.qo field boot_<name>_ms
+#define BOOT_STAGES(X) \
+    X(BOOT_STAGE_CORE,          "core")         /* Reset to setup() */ \
+    X(BOOT_STAGE_I2C,           "i2c")          /* Serial, GPIO, power monitor, I2C settle */ \
+    X(BOOT_STAGE_AUDIO,         "audio")        /* audioInit() with retry */ \
+    X(BOOT_STAGE_SENSORS,       "sensors")      /* sensorsInit() with retry */ \
+    X(BOOT_STAGE_NOTECARD,      "notecard")     /* 400 kHz switch, notecardInit() */ \
+    X(BOOT_STAGE_STATE,         "state")        /* stateRestore() */ \
+    X(BOOT_STAGE_BOOT_LOOP,     "boot_loop")    /* Brownout boot-loop check and hold */ \
+    X(BOOT_STAGE_SYNC,          "sync")         /* syncInit(), spilled note requeue */ \
+    X(BOOT_STAGE_TASKS,         "tasks")        /* Task creation, scheduler start */ \
+    X(BOOT_STAGE_CONFIGURE,     "configure")    /* notecardConfigure(), templates (cold boot) */ \
+    X(BOOT_STAGE_CONNECT,       "connect")      /* Notehub connection wait */ \
+    X(BOOT_STAGE_ENV,           "env")          /* Env var fetch; system ready */ \
+    X(BOOT_STAGE_FIRST_NOTE,    "first_note")   /* First note handed to the Notecard */
+
+typedef enum {
+#define BOOT_STAGE_ENUM(id, name) id,
+    BOOT_STAGES(BOOT_STAGE_ENUM)
+#undef BOOT_STAGE_ENUM
+    BOOT_STAGE_COUNT
+} BootStage;
+
+// Boot flags
+#define BOOT_FLAG_WARM          0x01    // State restored from the sleep payload
+#define BOOT_FLAG_SLEEP_WAKE    0x02    // Scheduled wake from the deep sleep cycle
+#define BOOT_FLAG_CONNECTED     0x04    // Notehub connection wait succeeded
+
+// =============================================================================
+// Profile Structures
+// =============================================================================
+
+// This boot (RAM only)
+typedef struct {
+    uint32_t markMs[BOOT_STAGE_COUNT];  // millis() at the end of each stage
+    uint32_t reached;                   // Bit per stage that was marked
+    uint8_t flags;                      // BOOT_FLAG_*
+} BootProfile;
+
+// One past boot in the persistent state. Times are in 10 ms units since
+// reset, saturating at 65535; 0 means the point was not reached.
+typedef struct {
+    uint8_t flags;              // BOOT_FLAG_*
+    uint8_t slowestStage;       // Longest BootStage
+    uint16_t tasksCs;           // Scheduler start
+    uint16_t readyCs;           // MainTask startup done (env stage)
+    uint16_t firstNoteCs;       // First note handed to the Notecard
+    uint16_t slowestCs;         // Duration of slowestStage
+} BootProfileRecord;
+
+typedef struct {
+    BootProfileRecord records[BOOT_PROFILE_HISTORY];
+    uint8_t count;              // Valid records
+    uint8_t next;               // Slot for the next record
+} BootProfileHistory;
+
+// =============================================================================
+// Profile Calculations (pure)
+// =============================================================================
+
+/**
+ * @brief Mark the end of a stage
+ *
+ * Only the first mark of a stage counts. Safe to call from several tasks
+ * for different stages.
+ *
+ * @param profile Profile to update
+ * @param stage Stage that just finished
+ * @param nowMs millis() now
+ */
+void bootProfileMarkAt(BootProfile* profile, BootStage stage, uint32_t nowMs);
+
+/**
+ * @brief Set boot flags
+ *
+ * @param profile Profile to update
+ * @param flags BOOT_FLAG_* bits to set
+ */
+void bootProfileSetFlags(BootProfile* profile, uint8_t flags);
+
+/**
+ * @brief Get the time from reset to the end of a stage
+ *
+ * @param profile Profile
+ * @param stage Stage
+ * @param ms Output milliseconds since reset
+ * @return true if the stage was reached
+ */
+bool bootProfileElapsedMs(const BootProfile* profile, BootStage stage, uint32_t* ms);
+
+/**
+ * @brief Get the duration of a stage
+ *
+ * Measured from the end of the latest earlier stage that was reached
+ * (from reset for the first one).
+ *
+ * @param profile Profile
+ * @param stage Stage
+ * @param ms Output duration in milliseconds
+ * @return true if the stage was reached
+ */
+bool bootProfileStageMs(const BootProfile* profile, BootStage stage, uint32_t* ms);
+
+/**
+ * @brief Reduce a profile to its persistent record
+ *
+ * @param profile Profile
+ * @param record Output record
+ */
+void bootProfileCompact(const BootProfile* profile, BootProfileRecord* record);
+
+/**
+ * @brief Add a record to the history, replacing the oldest when full
+ *
+ * @param history History to update
+ * @param record Record to add
+ */
+void bootProfileHistoryAdd(BootProfileHistory* history, const BootProfileRecord* record);
+
+/**
+ * @brief Get the longest time to first note in the history
+ *
+ * @param history History
+ * @return Milliseconds, or 0 if no record reached the first note
+ */
+uint32_t bootProfileHistoryMaxFirstNoteMs(const BootProfileHistory* history);
+
+/**
+ * @brief Get the name of a stage
+ *
+ * @param stage Stage
+ * @return Stage name, or "unknown"
+ */
+const char* bootStageName(BootStage stage);
+
+// =============================================================================
+// This Boot
+// =============================================================================
+
+/**
+ * @brief Get this boot's profile
+ *
+ * @return Profile (never NULL)
+ */
+const BootProfile* bootProfileGet(void);
+
+/**
+ * @brief Set boot flags on this boot's profile
+ *
+ * @param flags BOOT_FLAG_* bits to set
+ */
+void bootProfileFlag(uint8_t flags);
+
+/**
+ * @brief Mark the end of a stage of this boot
+ *
+ * @param stage Stage that just finished
+ */
+void bootProfileMark(BootStage stage);
+
+#endif // SONGBIRD_BOOT_PROFILE_H
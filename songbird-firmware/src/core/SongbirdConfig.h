@@ -78,12 +78,14 @@ extern HardwareSerial serialDebug;
 
 // Task Priorities (higher number = higher priority)
 // Range: 0 to (configMAX_PRIORITIES - 1) = 0 to 4
-#define PRIORITY_ENV        1   // Lowest - config changes are not time-critical
+#define PRIORITY_TRACE      0   // Idle - trace log drains only when nothing else runs
+#define PRIORITY_ENV        1   // Low - config changes are not time-critical
 #define PRIORITY_MAIN       2   // Normal - orchestration
 #define PRIORITY_SENSOR     2   // Normal - periodic reads
 #define PRIORITY_AUDIO      3   // Above normal - responsive audio
 #define PRIORITY_COMMAND    3   // Above normal - responsive commands
 #define PRIORITY_NOTECARD   4   // Highest - time-sensitive sync operations
+#define PRIORITY_JOBS       2   // Normal - sensor, command and env jobs (JOBS_MODE)
 
 // Task Stack Sizes (in words, not bytes - multiply by 4 for bytes)
 #define STACK_MAIN          512     // 2KB
@@ -92,11 +94,16 @@ extern HardwareSerial serialDebug;
 #define STACK_COMMAND       512     // 2KB
 #define STACK_NOTECARD      1024    // 4KB (Notecard library needs more)
 #define STACK_ENV           512     // 2KB
+#define STACK_TRACE         128     // 512B
+#define STACK_JOBS          512     // 2KB (replaces sensor, command and env with JOBS_MODE)
 
 // Queue Sizes
 #define AUDIO_QUEUE_SIZE    8       // Audio events pending
-#define NOTE_QUEUE_SIZE     16      // Outbound notes pending
+#define NOTE_QUEUE_SIZE     16      // Outbound notes pending (all classes)
+#define NOTE_PRIORITY_COUNT 4       // Outbound note classes (alert, ack, track, health)
+#define NOTE_SPILL_SIZE     512     // Bytes of packed overflow notes (SongbirdNoteSpill.h)
 #define CONFIG_QUEUE_SIZE   4       // Config updates pending
+#define TIMER_QUEUE_SIZE    4       // Job timers on JobsTask (SongbirdJobs.h)
 
 // =============================================================================
 // Operating Modes
@@ -142,6 +149,7 @@ typedef enum {
 #define ALERT_TYPE_PRESSURE_DELTA   "pressure_change"
 #define ALERT_TYPE_LOW_BATTERY      "low_battery"
 #define ALERT_TYPE_MOTION           "motion"
+#define ALERT_TYPE_TEMP_RATE        "temp_rate"
 
 // Alert bitmask for tracking which alerts have been sent
 #define ALERT_FLAG_TEMP_HIGH        (1 << 0)
@@ -151,6 +159,7 @@ typedef enum {
 #define ALERT_FLAG_PRESSURE_DELTA   (1 << 4)
 #define ALERT_FLAG_LOW_BATTERY      (1 << 5)
 #define ALERT_FLAG_MOTION           (1 << 6)
+#define ALERT_FLAG_TEMP_RATE        (1 << 7)
 
 // =============================================================================
 // Notefile Names
@@ -161,6 +170,7 @@ typedef enum {
 #define NOTEFILE_COMMAND    "command.qi"    // Inbound commands
 #define NOTEFILE_CMD_ACK    "command_ack.qo" // Outbound command acknowledgments
 #define NOTEFILE_HEALTH     "health.qo"     // Outbound device health
+#define NOTEFILE_SPILL      "spill.dbx"     // Local-only: notes spilled at shutdown
 
 // =============================================================================
 // Default Configuration Values
@@ -171,12 +181,20 @@ typedef enum {
 #define DEFAULT_SYNC_INTERVAL_MIN       15
 #define DEFAULT_HEARTBEAT_HOURS         24
 
+// Notecard cadence (SongbirdCadence). Transit syncs every sync_interval_min
+// and fixes GPS every gps_interval_min; storage never syncs more often than
+// STORAGE_SYNC_FLOOR_MIN. Demo stays continuous regardless of the config.
+#define DEMO_OUTBOUND_MIN               1
+#define DEMO_INBOUND_MIN                1440    // sync:true handles immediate
+#define DEMO_CONTINUOUS_DURATION_MIN    15
+#define STORAGE_SYNC_FLOOR_MIN          60
+
 // Alert thresholds
 #define DEFAULT_TEMP_ALERT_HIGH_C       35.0f
 #define DEFAULT_TEMP_ALERT_LOW_C        0.0f
 #define DEFAULT_HUMIDITY_ALERT_HIGH     80.0f
 #define DEFAULT_HUMIDITY_ALERT_LOW      20.0f
-#define DEFAULT_PRESSURE_ALERT_DELTA    10.0f   // hPa change
+#define DEFAULT_PRESSURE_ALERT_DELTA    10.0f   // hPa change over 3 hours
 #define DEFAULT_VOLTAGE_ALERT_LOW       3.4f    // Volts
 
 // Motion
@@ -203,6 +221,34 @@ typedef enum {
 #define DEFAULT_GPS_SIGNAL_TIMEOUT_MIN  15      // Minutes to wait for GPS signal before disabling
 #define DEFAULT_GPS_RETRY_INTERVAL_MIN  30      // Minutes between GPS retry attempts
 
+// Battery-Aware Duty Cycling
+// Sensor, command poll and sync intervals are stretched linearly from 1x at
+// FULL_V to MAX_SCALE at LOW_V. USB power always runs at the mode presets.
+#define DEFAULT_POWER_POLICY_ENABLED    true
+#define DEFAULT_POWER_POLICY_FULL_V     3.9f    // Volts - at/above: mode preset intervals
+#define DEFAULT_POWER_POLICY_LOW_V      3.5f    // Volts - at/below: maximum stretch
+#define DEFAULT_POWER_POLICY_MAX_SCALE  4       // Maximum interval multiplier
+#define POWER_POLICY_SCALE_STEP_PCT     25      // Scale quantization (percent)
+#define POWER_POLICY_HYSTERESIS_V       0.05f   // Volts past a step boundary before moving
+#define SYNC_SCALE_RETRY_MS             60000   // Retry interval for a failed scale hub.set
+
+// Alert Engine
+// Thresholds apply to EWMA-smoothed readings, and an alert is raised (or
+// cleared) only when N of the last M samples agree.
+#define ALERT_PERSIST_WINDOW            5       // M: recent samples considered
+#define ALERT_PERSIST_COUNT             3       // N: samples that must agree
+#define ALERT_EWMA_ALPHA                0.3f    // Weight of the newest sample
+#define ALERT_MAX_GAP_SEC               3600    // Longer gaps restart smoothing and rate
+#define ALERT_TEMP_RATE_C_PER_HOUR      10.0f   // Temperature rate-of-change alert
+#define ALERT_TENDENCY_SLOT_SEC         900     // Pressure history resolution (15 min)
+#define ALERT_TENDENCY_WINDOW_SEC       10800   // Barometric tendency window (3 hours)
+
+// Clear thresholds sit this far back from the trigger thresholds
+#define ALERT_HYSTERESIS_TEMP_C         2.0f
+#define ALERT_HYSTERESIS_HUMIDITY       5.0f
+#define ALERT_HYSTERESIS_PRESSURE_HPA   1.0f
+#define ALERT_HYSTERESIS_VOLTAGE        0.1f
+
 // =============================================================================
 // Brownout / PVD Power Management
 // =============================================================================
@@ -220,7 +266,7 @@ typedef enum {
 
 // Safe shutdown: time budget for note queue drain during PVD shutdown
 #define PVD_SHUTDOWN_NOTE_TIMEOUT_MS 4000  // ms total deadline for draining notes
-#define PVD_QUEUE_DRAIN_LIMIT        3      // Max queued notes to flush before forced sleep
+#define PVD_QUEUE_DRAIN_LIMIT        3      // Max queued notes to flush before the rest are spilled
 
 // =============================================================================
 // Task Intervals (milliseconds)
@@ -238,11 +284,24 @@ typedef enum {
 #define COMMAND_POLL_STORAGE_MS         60000   // 60 seconds
 #define COMMAND_POLL_SLEEP_MS           0       // Disabled (wake handles)
 
-// Environment variable polling
-#define ENV_POLL_INTERVAL_MS            30000   // 30 seconds
-
-// Notecard sync check interval
-#define SYNC_CHECK_INTERVAL_MS          5000    // 5 seconds
+// Environment variable polling. In demo mode a completed sync seen by
+// NotecardTask, and in sleep mode the env wake, post ATTN_EVENT_ENV, so the
+// poll only catches changes that arrive without one. Transit and storage
+// sync on a timer with no ATTN source, so they poll at their command rate.
+#define ENV_SAFETY_POLL_MS              300000  // 5 minutes
+#define ENV_POLL_TRANSIT_MS             30000   // 30 seconds
+#define ENV_POLL_STORAGE_MS             60000   // 60 seconds
+
+// Notecard status snapshot refresh per mode (NotecardTask). Demo checks the
+// sync state, transit polls GPS; storage/sleep only track connectivity.
+#define STATUS_POLL_DEMO_MS             5000    // 5 seconds
+#define STATUS_POLL_TRANSIT_MS          15000   // 15 seconds (GPS samples every 60s)
+#define STATUS_POLL_IDLE_MS             60000   // 1 minute (storage, sleep)
+#define STATUS_CONNECTION_POLL_MS       60000   // hub.status at most once a minute
+
+// Notehub connection wait backoff (notecardWaitConnection)
+#define CONNECT_POLL_MIN_MS             1000    // First hub.status retry
+#define CONNECT_POLL_MAX_MS             8000    // Backoff cap
 
 // Main task loop interval
 #define MAIN_LOOP_INTERVAL_MS           100     // 100ms
@@ -250,6 +309,26 @@ typedef enum {
 // Periodic health check interval (MainTask)
 #define HEALTH_CHECK_INTERVAL_MS        60000   // Health check every 1 minute
 
+// health.qo metrics report (MainTask, SongbirdMetrics). Sent every
+// heartbeat_hours, or early when the metrics change significantly.
+#define METRICS_ERROR_DELTA             10      // New sensor/Notecard/I2C errors
+#define METRICS_HEAP_LOW_BYTES          2048    // Free heap low-water alarm
+#define METRICS_MIN_REPORT_SEC          900     // Minimum spacing of change reports
+
+// Boot profiles kept in the persistent state (SongbirdBootProfile)
+#define BOOT_PROFILE_HISTORY            4
+
+// Alert latency histograms (SongbirdLatency): 2 buckets per power of two,
+// the last one collecting everything from 49152 ms up
+#define LATENCY_BUCKETS                 32
+
+// Telemetry cache freshness (SongbirdTelemetry). A sample younger than the
+// TTL is shared by every task instead of re-reading the Notecard.
+#define TELEMETRY_VOLTAGE_TTL_MS        10000   // card.voltage
+#define TELEMETRY_MOTION_TTL_MS         2000    // card.motion
+#define TELEMETRY_TIME_TTL_MS           3600000 // card.time re-anchor
+#define TELEMETRY_TIME_RETRY_MS         60000   // card.time retry while unknown
+
 // Sensor polling wait used when in sleep mode (sensors disabled, wake-on-motion)
 #define SLEEP_MODE_SENSOR_WAIT_MS       60000   // Sensor polling interval in sleep mode
 
@@ -258,11 +337,33 @@ typedef enum {
 // =============================================================================
 
 #define I2C_MUTEX_TIMEOUT_MS            1000    // 1 second
+#define NOTE_SEND_RETRY_MS              5000    // Pause after a note could not be sent
 #define NOTECARD_RESPONSE_TIMEOUT_MS    10000   // 10 seconds
 #define GPS_FIX_TIMEOUT_MS              120000  // 2 minutes
 #define NOTEHUB_CONNECT_TIMEOUT_MS      30000   // 30 seconds
 #define SLEEP_COORDINATION_TIMEOUT_MS   5000    // 5 seconds
 
+// =============================================================================
+// Deep Sleep Cycle (Storage / Sleep Modes)
+// =============================================================================
+
+// After a report cycle completes in storage or sleep mode, MainTask saves
+// state into the card.attn payload and the Notecard cuts host power until the
+// sleep timer, motion, an inbound command or an env var change wakes it.
+#define SLEEP_CYCLE_COLD_BOOT_AWAKE_MS  120000  // Stay awake 2 min after power-on
+#define SLEEP_CYCLE_RETRY_MS            60000   // Back-off after a failed sleep attempt
+#define SLEEP_CYCLE_MIN_SEC             60      // Shortest timed sleep worth a reboot
+#define NOTECARD_SLEEP_PAYLOAD_MAX      256     // Bytes preserved across the power cut
+
+// Notecard ATTN events. ATTN drives the host enable line, so it reports events
+// as the wake reason after a sleep; while awake NotecardTask raises the inbound
+// events when it sees a sync complete. SongbirdSync hands each to its task.
+#define ATTN_EVENT_TIMER                (1 << 0)    // Sleep timer expired
+#define ATTN_EVENT_MOTION               (1 << 1)    // Accelerometer motion
+#define ATTN_EVENT_COMMAND              (1 << 2)    // command.qi changed -> CommandTask
+#define ATTN_EVENT_ENV                  (1 << 3)    // Env vars changed -> EnvTask
+#define ATTN_EVENTS_INBOUND             (ATTN_EVENT_COMMAND | ATTN_EVENT_ENV)
+
 // =============================================================================
 // Audio Configuration
 // =============================================================================
@@ -270,6 +371,7 @@ typedef enum {
 #define BUZZER_DEFAULT_FREQUENCY        4000    // 4kHz resonant frequency
 #define LOCATE_PAUSE_MS                 850     // Pause between locate beeps
 #define TONE_GAP_MS                     50      // Gap between melody notes
+#define AUDIO_IDLE_WAIT_MS              1000    // AudioTask queue wait when idle
 
 // =============================================================================
 // Configuration Structure
@@ -314,6 +416,12 @@ typedef struct {
     bool gpsPowerSaveEnabled;       // Actively manage GPS power based on signal
     uint8_t gpsSignalTimeoutMin;    // Minutes to wait for GPS signal before disabling
     uint8_t gpsRetryIntervalMin;    // Minutes between GPS retry attempts
+
+    // Battery-Aware Duty Cycling
+    bool powerPolicyEnabled;        // Stretch intervals as battery voltage falls
+    float powerPolicyFullV;         // Voltage at/above which presets apply
+    float powerPolicyLowV;          // Voltage at/below which maximum stretch applies
+    uint8_t powerPolicyMaxScale;    // Maximum interval multiplier
 } SongbirdConfig;
 
 // =============================================================================
@@ -330,16 +438,75 @@ typedef struct {
     uint32_t timestamp;     // Unix timestamp
 } SensorData;
 
+// BME280 measurement settings, selected per operating mode (envGetSensorProfile)
+typedef struct {
+    uint8_t tempOversampling;       // 0 (skipped), 1, 2, 4, 8 or 16
+    uint8_t pressureOversampling;   // 0 (skipped), 1, 2, 4, 8 or 16
+    uint8_t humidityOversampling;   // 0 (skipped), 1, 2, 4, 8 or 16
+    uint8_t filterCoefficient;      // IIR filter: 0 (off), 2, 4, 8 or 16
+    bool continuous;                // Normal (free-running) mode instead of forced
+    uint16_t standbyMs;             // Normal mode standby between conversions
+} SensorProfile;
+
+// Notecard hub.set and card.location.mode parameters (cadenceCompute)
+typedef struct {
+    const char* hubMode;            // "continuous", "periodic" or "minimum"
+    bool hubSync;                   // Sync immediately on change (continuous only)
+    uint32_t outboundMin;           // 0 = not set
+    uint32_t inboundMin;            // 0 = not set
+    uint32_t durationMin;           // Continuous session length, 0 = not set
+    uint32_t gpsSeconds;            // Periodic GPS interval, 0 = GPS off
+    uint16_t scalePct;              // Power policy scale the sync intervals carry
+} NotecardCadence;
+
 // =============================================================================
 // Alert Structure
 // =============================================================================
 
+// All alert transitions from one sensor cycle, sent as a single alert.qo
+// note. The cloud expands each raised bit into its ALERT_TYPE_* alert.
 typedef struct {
-    const char* type;       // Alert type string
-    float value;            // Measured value that triggered alert
-    float threshold;        // Threshold that was exceeded
-    char message[64];       // Human-readable message
-} Alert;
+    uint8_t raised;             // Alerts raised this cycle (ALERT_FLAG_*)
+    uint8_t cleared;            // Alerts cleared this cycle (ALERT_FLAG_*)
+    float temperature;          // Smoothed values the thresholds were applied to
+    float humidity;
+    float pressure;
+    float voltage;              // Raw battery voltage
+    float tempRate;             // C/hour (NAN if unknown)
+    float pressureTendency;     // hPa over 3 hours (NAN if unknown)
+    // Thresholds of the alerts raised this cycle (NAN if not raised)
+    float tempThreshold;        // High or low limit, whichever was crossed
+    float humidityThreshold;    // High or low limit, whichever was crossed
+    float pressureThreshold;    // 3 hour tendency limit (hPa)
+    float voltageThreshold;     // Low battery limit
+    float tempRateThreshold;    // C/hour
+    uint32_t timestamp;         // Unix timestamp of the reading (0 if unknown)
+} AlertNote;
+
+// =============================================================================
+// Audio Event Types
+// =============================================================================
+
+// Events AudioTask plays (melodies in SongbirdMelodies.h, by index)
+typedef enum {
+    AUDIO_EVENT_POWER_ON = 0,
+    AUDIO_EVENT_CONNECTED,
+    AUDIO_EVENT_GPS_LOCK,
+    AUDIO_EVENT_TEMP_ALERT,
+    AUDIO_EVENT_HUMIDITY_ALERT,
+    AUDIO_EVENT_LOW_BATTERY,
+    AUDIO_EVENT_SLEEP,
+    AUDIO_EVENT_ERROR,
+    AUDIO_EVENT_PING,
+    AUDIO_EVENT_LOCATE_START,
+    AUDIO_EVENT_LOCATE_STOP,
+    AUDIO_EVENT_CUSTOM_TONE,
+    AUDIO_EVENT_TRANSIT_LOCK_ON,
+    AUDIO_EVENT_TRANSIT_LOCK_OFF,
+    AUDIO_EVENT_DEMO_LOCK_ON,
+    AUDIO_EVENT_DEMO_LOCK_OFF,
+    AUDIO_EVENT_COUNT
+} AudioEventType;
 
 // =============================================================================
 // Command Structures
@@ -352,6 +519,8 @@ typedef enum {
     CMD_TEST_AUDIO,
     CMD_SET_VOLUME,
     CMD_UNLOCK,
+    CMD_PROFILE,
+    CMD_TRANSCRIPT,
     CMD_UNKNOWN
 } CommandType;
 
@@ -375,6 +544,12 @@ typedef struct {
         struct {
             uint8_t lockType;   // 0=transit, 1=demo, 2=all
         } unlock;
+        struct {
+            bool reset;         // Clear the statistics after reporting
+        } profile;
+        struct {
+            bool clear;         // Clear the transcript after dumping
+        } transcript;
     } params;
 } Command;
 
@@ -392,19 +567,119 @@ typedef struct {
     uint32_t executedAt;
 } CommandAck;
 
+// =============================================================================
+// Run-Time Statistics Structure
+// =============================================================================
+
+// Per-task statistics slots. Each Songbird task is tagged with its slot via
+// vTaskSetTaskNumber(); untagged tasks (e.g. the timer service) land in OTHER.
+typedef enum {
+    RUNSTATS_TASK_OTHER = 0,
+    RUNSTATS_TASK_MAIN,
+    RUNSTATS_TASK_SENSOR,
+    RUNSTATS_TASK_AUDIO,
+    RUNSTATS_TASK_COMMAND,
+    RUNSTATS_TASK_NOTECARD,
+    RUNSTATS_TASK_ENV,
+    RUNSTATS_TASK_JOBS,         // JobsTask (JOBS_MODE only)
+    RUNSTATS_TASK_IDLE,
+    RUNSTATS_TASK_COUNT
+} RunStatsTask;
+
+// CPU load, scheduling and I2C contention over one report window
+typedef struct {
+    uint32_t windowMs;                              // Length of the window
+    uint16_t cpuPermille;                           // Non-idle share of the window
+    uint16_t loadPermille[RUNSTATS_TASK_COUNT];     // Share of the window per task
+    uint32_t wakes[RUNSTATS_TASK_COUNT];            // Times each task was switched in
+    uint32_t i2cAcquires;                           // syncAcquireI2C() calls
+    uint32_t i2cWaitMs;                             // Total time blocked on g_i2cMutex
+    uint32_t i2cWaitMaxMs;                          // Longest single wait
+    uint16_t stackFreeMin[RUNSTATS_TASK_COUNT];     // Lowest free stack since boot, bytes
+                                                    // (RUNSTATS_STACK_UNKNOWN if no task)
+} RunStatsReport;
+
+// stackFreeMin for a slot with no task
+#define RUNSTATS_STACK_UNKNOWN  0xFFFF
+
+// =============================================================================
+// Alert Latency Structure
+// =============================================================================
+
+// Stages of an outbound alert, from the sensor sample to note.add done
+typedef enum {
+    LATENCY_STAGE_QUEUE = 0,    // Sample to NotecardTask dequeue
+    LATENCY_STAGE_I2C,          // Dequeue to I2C bus acquired
+    LATENCY_STAGE_ADD,          // note.add request and response
+    LATENCY_STAGE_TOTAL,        // Sample to note.add done
+    LATENCY_STAGE_COUNT
+} LatencyStage;
+
+// Alert latency percentiles over one report window (ms, saturating)
+typedef struct {
+    uint16_t count;                             // Alerts measured
+    uint16_t p50Ms[LATENCY_STAGE_COUNT];
+    uint16_t p99Ms[LATENCY_STAGE_COUNT];
+} LatencyReport;
+
+// =============================================================================
+// Metrics Structure
+// =============================================================================
+
+// Event counters since boot (SongbirdMetrics)
+typedef enum {
+    METRIC_SENSOR_ERRORS = 0,
+    METRIC_NOTECARD_ERRORS,
+    METRIC_I2C_TIMEOUTS,        // syncAcquireI2C() timeouts
+    METRIC_NOTES_SENT,
+    METRIC_NOTES_LOST,          // Neither queued nor spilled
+    METRIC_COUNTER_COUNT
+} MetricCounter;
+
+// High-water marks since boot
+typedef enum {
+    METRIC_PEAK_NOTE_QUEUE = 0, // Outbound notes queued
+    METRIC_PEAK_NOTE_SPILL,     // Outbound notes spilled
+    METRIC_PEAK_AUDIO_QUEUE,    // Audio events queued
+    METRIC_PEAK_COUNT
+} MetricPeak;
+
+// Why a health.qo report was sent
+typedef enum {
+    METRICS_TRIGGER_NONE = 0,
+    METRICS_TRIGGER_HEARTBEAT,  // heartbeat_hours elapsed
+    METRICS_TRIGGER_CHANGE      // Significant change since the last report
+} MetricsTrigger;
+
+typedef struct {
+    uint32_t counters[METRIC_COUNTER_COUNT];
+    uint32_t peaks[METRIC_PEAK_COUNT];
+    uint32_t heapFreeMin;       // Lowest free heap sampled (UINT32_MAX if never)
+} MetricsSnapshot;
+
 // =============================================================================
 // Health Data Structure
 // =============================================================================
 
 typedef struct {
     char firmwareVersion[16];
+    MetricsTrigger trigger;
     uint32_t uptimeSec;
     uint32_t bootCount;
     uint32_t lastGpsFixSec;
-    uint8_t sensorErrors;
-    uint8_t notecardErrors;
+    MetricsSnapshot metrics;
+    RunStatsReport runStats;
+    uint32_t noteDrops[NOTE_PRIORITY_COUNT];    // Outbound notes lost since boot (not queued or spilled), by class
+    LatencyReport alertLatency;                 // Alert latency since the last report
+    bool bootProfile;       // Add this boot's profile (first report of the boot)
 } HealthData;
 
+// A health.qo that MainTask found due. The note queue carries only this;
+// NotecardTask builds the HealthData when it sends the note.
+typedef struct {
+    MetricsTrigger trigger;
+} HealthRequest;
+
 // =============================================================================
 // Helper Macros
 // =============================================================================
@@ -447,4 +722,9 @@ inline T songbirdClamp(T x, T low, T high) {
 // Convert hours to seconds
 #define HOURS_TO_SEC(h) ((h) * 3600UL)
 
+// Check whether a millis() deadline has been reached. Compares by signed
+// difference, so it stays correct across the 49.7 day millis() wrap for
+// deadlines less than 24.8 days away.
+#define MS_REACHED(now, deadline) ((int32_t)((uint32_t)(now) - (uint32_t)(deadline)) >= 0)
+
 #endif // SONGBIRD_CONFIG_H
@@ -0,0 +1,92 @@
+/**
+ * @file SongbirdGpsPower.cpp
+ * @brief GPS signal-timeout power management implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdGpsPower.h"
+#include <stddef.h>
+#include <string.h>
+
+// =============================================================================
+// GPS Power Management
+// =============================================================================
+
+GpsPowerAction gpsPowerUpdate(GpsPowerState* gps, const SongbirdConfig* config,
+                              const GpsPowerInputs* inputs, uint32_t nowMs) {
+    if (gps == NULL || config == NULL || inputs == NULL) {
+        return GPS_POWER_NONE;
+    }
+
+    GpsPowerAction action = GPS_POWER_NONE;
+
+    if (gps->saving) {
+        // GPS is disabled - check if it's time to retry
+        uint32_t retryIntervalMs = MINUTES_TO_MS(config->gpsRetryIntervalMin);
+        if (nowMs - gps->lastRetryMs >= retryIntervalMs) {
+            action = GPS_POWER_RETRY;
+        }
+    } else if (inputs->signal || inputs->lock) {
+        // Signal or lock - stop timing
+        if (gps->activeStartMs != 0) {
+            gps->activeStartMs = 0;
+            action = GPS_POWER_SIGNAL;
+        }
+    } else if (inputs->active && gps->activeStartMs == 0) {
+        // Active without signal - start timing. Also covers a signal lost
+        // after power-up (e.g. driving into a garage), not just power-up.
+        gps->activeStartMs = (nowMs != 0) ? nowMs : 1;
+        action = GPS_POWER_TIMING;
+    } else if (inputs->active) {
+        // Active without signal for too long - disable
+        uint32_t timeoutMs = MINUTES_TO_MS(config->gpsSignalTimeoutMin);
+        if (nowMs - gps->activeStartMs >= timeoutMs) {
+            action = GPS_POWER_DISABLE;
+        }
+    } else if (!inputs->active && gps->wasActive && gps->activeStartMs != 0) {
+        // Went inactive while timing - reset
+        gps->activeStartMs = 0;
+        action = GPS_POWER_INACTIVE;
+    }
+
+    gps->wasActive = inputs->active;
+    return action;
+}
+
+void gpsPowerApplied(GpsPowerState* gps, GpsPowerAction action, uint32_t nowMs) {
+    if (gps == NULL) {
+        return;
+    }
+
+    if (action == GPS_POWER_DISABLE || action == GPS_POWER_RETRY) {
+        gps->saving = (action == GPS_POWER_DISABLE);
+        gps->activeStartMs = 0;
+        gps->lastRetryMs = nowMs;
+    }
+}
+
+bool gpsPowerModeChanged(GpsPowerState* gps, OperatingMode oldMode, OperatingMode newMode) {
+    if (gps == NULL || oldMode == newMode ||
+        (oldMode != MODE_TRANSIT && newMode != MODE_TRANSIT)) {
+        return false;
+    }
+
+    memset(gps, 0, sizeof(GpsPowerState));
+    return true;
+}
+
+bool gpsPowerIsEnabled(const GpsPowerState* gps, OperatingMode mode) {
+    if (mode != MODE_TRANSIT) {
+        return false;
+    }
+    return gps == NULL || !gps->saving;
+}
+
+uint32_t gpsPowerFixAgeSec(uint32_t fixEpoch, uint32_t nowEpoch) {
+    if (fixEpoch == 0 || nowEpoch < fixEpoch) {
+        return 0;
+    }
+    return nowEpoch - fixEpoch;
+}
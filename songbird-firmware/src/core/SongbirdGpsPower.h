@@ -0,0 +1,126 @@
+/**
+ * @file SongbirdGpsPower.h
+ * @brief GPS signal-timeout power management for Songbird
+ *
+ * In transit mode with gps_power_save_enabled, GPS is turned off when it
+ * has been active for gps_signal_timeout_min without a signal or fix, and
+ * turned back on every gps_retry_interval_min to try again. The timeout
+ * runs whenever GPS is active without a signal, including after a signal
+ * is lost mid-search.
+ *
+ * All times are millis() and compared by unsigned difference, so the state
+ * machine keeps working across the 49.7 day millis() wrap. A start time of
+ * 0 means "not timing"; a start that lands exactly on 0 is stored as 1.
+ *
+ * Pure logic (no hardware access) so it can be unit tested on the host.
+ * NotecardTask loads the state from SongbirdState, performs the returned
+ * action and stores the state back.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_GPS_POWER_H
+#define SONGBIRD_GPS_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Data Structures
+// =============================================================================
+
+// Power management state (fields persisted in SongbirdState)
+typedef struct {
+    bool saving;                // GPS is disabled by the signal timeout
+    bool wasActive;             // GPS was active at the previous check
+    uint32_t activeStartMs;     // millis() when active without signal (0 = not timing)
+    uint32_t lastRetryMs;       // millis() of the last disable or re-enable
+} GpsPowerState;
+
+// GPS status from card.location
+typedef struct {
+    bool active;                // GPS receiver powered and searching
+    bool signal;                // Satellites in view
+    bool lock;                  // Position fix
+} GpsPowerInputs;
+
+// Outcome of one check
+typedef enum {
+    GPS_POWER_NONE = 0,
+    GPS_POWER_TIMING,           // Active without signal, timeout started
+    GPS_POWER_SIGNAL,           // Signal acquired, timeout cleared
+    GPS_POWER_INACTIVE,         // Went inactive while timing, timeout cleared
+    GPS_POWER_DISABLE,          // Timed out: turn GPS off
+    GPS_POWER_RETRY             // Retry interval elapsed: turn GPS back on
+} GpsPowerAction;
+
+// =============================================================================
+// GPS Power Interface
+// =============================================================================
+
+/**
+ * @brief Evaluate one GPS status check
+ *
+ * Updates the timing state. For GPS_POWER_DISABLE and GPS_POWER_RETRY the
+ * caller performs the Notecard request and calls gpsPowerApplied() if it
+ * succeeded; otherwise the action is returned again at the next check.
+ *
+ * @param gps State
+ * @param config Timeout and retry intervals
+ * @param inputs Current GPS status
+ * @param nowMs millis()
+ * @return What changed, or what the caller should do
+ */
+GpsPowerAction gpsPowerUpdate(GpsPowerState* gps, const SongbirdConfig* config,
+                              const GpsPowerInputs* inputs, uint32_t nowMs);
+
+/**
+ * @brief Record that a disable or retry request succeeded
+ *
+ * @param gps State
+ * @param action GPS_POWER_DISABLE or GPS_POWER_RETRY
+ * @param nowMs millis()
+ */
+void gpsPowerApplied(GpsPowerState* gps, GpsPowerAction action, uint32_t nowMs);
+
+/**
+ * @brief Reset the state for an operating mode change
+ *
+ * notecardConfigure() sets card.location.mode for the new mode, so the
+ * timeout and retry restart whenever transit mode is entered or left.
+ *
+ * @param gps State
+ * @param oldMode Mode before the change
+ * @param newMode Mode after the change
+ * @return true if the state was reset
+ */
+bool gpsPowerModeChanged(GpsPowerState* gps, OperatingMode oldMode, OperatingMode newMode);
+
+/**
+ * @brief Check whether card.location.mode is on for a persisted state
+ *
+ * A warm boot skips notecardConfigureGPS(), and the Notecard keeps the mode
+ * it had before the sleep: periodic in transit mode unless the signal
+ * timeout turned GPS off, off in every other mode.
+ *
+ * @param gps Persisted state
+ * @param mode Persisted operating mode
+ * @return true if GPS is on
+ */
+bool gpsPowerIsEnabled(const GpsPowerState* gps, OperatingMode mode);
+
+/**
+ * @brief Age of the last GPS fix for health.qo
+ *
+ * Wall clock on both sides, so the age stays right across a deep sleep,
+ * where millis() starts again from zero.
+ *
+ * @param fixEpoch Persisted fix time (0 = no fix yet)
+ * @param nowEpoch Current time (0 if unknown)
+ * @return Seconds since the fix, 0 if either time is unknown
+ */
+uint32_t gpsPowerFixAgeSec(uint32_t fixEpoch, uint32_t nowEpoch);
+
+#endif // SONGBIRD_GPS_POWER_H
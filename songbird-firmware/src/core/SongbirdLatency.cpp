@@ -0,0 +1,180 @@
+/**
+ * @file SongbirdLatency.cpp
+ * @brief End-to-end alert latency tracking implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdLatency.h"
+#include <string.h>
+
+#ifndef NATIVE_TEST
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#endif
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+static const char* const STAGE_NAMES[LATENCY_STAGE_COUNT] = {
+    "queue",
+    "i2c",
+    "add",
+    "total"
+};
+
+// Alerts delivered since the last health report
+static LatencyHistograms s_alerts;
+
+// =============================================================================
+// Histograms
+// =============================================================================
+
+uint32_t latencyAgeMs(uint32_t createdMs, uint32_t nowMs) {
+    if (createdMs == 0) {
+        return LATENCY_UNKNOWN;
+    }
+    return nowMs - createdMs;
+}
+
+uint8_t latencyBucket(uint32_t ms) {
+    if (ms < 2) {
+        return (uint8_t)ms;
+    }
+
+    uint8_t octave = (uint8_t)(31 - __builtin_clz(ms));
+    uint8_t half = (uint8_t)((ms >> (octave - 1)) & 1);
+    uint32_t bucket = 2 * (uint32_t)octave + half;
+    return (uint8_t)MIN(bucket, (uint32_t)(LATENCY_BUCKETS - 1));
+}
+
+uint32_t latencyBucketMaxMs(uint8_t bucket) {
+    if (bucket < 2) {
+        return bucket;
+    }
+    if (bucket >= LATENCY_BUCKETS - 1) {
+        return UINT32_MAX;
+    }
+
+    uint8_t octave = bucket / 2;
+    uint32_t width = 1UL << (octave - 1);
+    uint32_t low = (2UL + (bucket & 1)) * width;
+    return low + width - 1;
+}
+
+void latencyHistogramAdd(LatencyHistogram* histogram, uint32_t ms) {
+    if (histogram == NULL) {
+        return;
+    }
+
+    uint16_t* count = &histogram->counts[latencyBucket(ms)];
+    if (*count < UINT16_MAX) {
+        (*count)++;
+    }
+    histogram->maxMs = MAX(histogram->maxMs, ms);
+}
+
+uint32_t latencyHistogramCount(const LatencyHistogram* histogram) {
+    if (histogram == NULL) {
+        return 0;
+    }
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+        total += histogram->counts[i];
+    }
+    return total;
+}
+
+uint32_t latencyHistogramPercentile(const LatencyHistogram* histogram, uint16_t permille) {
+    uint32_t total = latencyHistogramCount(histogram);
+    if (total == 0) {
+        return 0;
+    }
+
+    // Smallest bucket with at least permille of the samples at or below it
+    uint32_t rank = (total * MIN(permille, (uint16_t)1000) + 999) / 1000;
+    rank = MAX(rank, (uint32_t)1);
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += histogram->counts[i];
+        if (seen >= rank) {
+            return MIN(latencyBucketMaxMs(i), histogram->maxMs);
+        }
+    }
+    return histogram->maxMs;
+}
+
+bool latencyHistogramsRecord(LatencyHistograms* histograms, const NoteLatencyStamps* stamps) {
+    if (histograms == NULL || stamps == NULL || stamps->createdMs == 0) {
+        return false;
+    }
+
+    // Unsigned differences stay correct across a millis() wrap
+    LatencyHistogram* stages = histograms->stages;
+    latencyHistogramAdd(&stages[LATENCY_STAGE_QUEUE], stamps->dequeuedMs - stamps->createdMs);
+    latencyHistogramAdd(&stages[LATENCY_STAGE_I2C], stamps->acquiredMs - stamps->dequeuedMs);
+    latencyHistogramAdd(&stages[LATENCY_STAGE_ADD], stamps->addedMs - stamps->acquiredMs);
+    latencyHistogramAdd(&stages[LATENCY_STAGE_TOTAL], stamps->addedMs - stamps->createdMs);
+    return true;
+}
+
+void latencySummarize(const LatencyHistograms* histograms, LatencyReport* report) {
+    if (histograms == NULL || report == NULL) {
+        return;
+    }
+
+    memset(report, 0, sizeof(LatencyReport));
+    uint32_t count = latencyHistogramCount(&histograms->stages[LATENCY_STAGE_TOTAL]);
+    report->count = (uint16_t)MIN(count, (uint32_t)UINT16_MAX);
+
+    for (uint8_t i = 0; i < LATENCY_STAGE_COUNT; i++) {
+        const LatencyHistogram* histogram = &histograms->stages[i];
+        report->p50Ms[i] = (uint16_t)MIN(latencyHistogramPercentile(histogram, 500),
+                                         (uint32_t)UINT16_MAX);
+        report->p99Ms[i] = (uint16_t)MIN(latencyHistogramPercentile(histogram, 990),
+                                         (uint32_t)UINT16_MAX);
+    }
+}
+
+const char* latencyStageName(LatencyStage stage) {
+    if (stage < LATENCY_STAGE_COUNT) {
+        return STAGE_NAMES[stage];
+    }
+    return "unknown";
+}
+
+// =============================================================================
+// Alert Latency
+// =============================================================================
+
+// NotecardTask records, MainTask takes the report; both are task context
+#ifdef NATIVE_TEST
+#define LATENCY_LOCK()      ((void)0)
+#define LATENCY_UNLOCK()    ((void)0)
+#else
+#define LATENCY_LOCK()      taskENTER_CRITICAL()
+#define LATENCY_UNLOCK()    taskEXIT_CRITICAL()
+#endif
+
+void latencyRecordAlert(const NoteLatencyStamps* stamps) {
+    LATENCY_LOCK();
+    latencyHistogramsRecord(&s_alerts, stamps);
+    LATENCY_UNLOCK();
+}
+
+void latencyPeekReport(LatencyReport* report) {
+    LATENCY_LOCK();
+    latencySummarize(&s_alerts, report);
+    LATENCY_UNLOCK();
+}
+
+void latencyTakeReport(LatencyReport* report) {
+    LATENCY_LOCK();
+    latencySummarize(&s_alerts, report);
+    memset(&s_alerts, 0, sizeof(s_alerts));
+    LATENCY_UNLOCK();
+}
@@ -0,0 +1,170 @@
+/**
+ * @file SongbirdLatency.h
+ * @brief End-to-end alert latency tracking for Songbird
+ *
+ * Every outbound note carries the millis() it was created at (for alerts,
+ * the sensor sample that raised them). NotecardTask stamps each alert again
+ * when it is dequeued, when the I2C bus is acquired and when note.add
+ * returns, and the per-stage latencies go into log-scale histograms:
+ *
+ *   queue  sample -> dequeue         (alert engine, queue wait)
+ *   i2c    dequeue -> bus acquired   (contention with other tasks)
+ *   add    bus acquired -> note.add  (Notecard request and response)
+ *   total  sample -> note.add done
+ *
+ * Each health.qo report carries the p50/p99 of each stage since the
+ * previous report, and each alert note its own sample-to-note.add latency.
+ * Notes replayed from the spill have no creation time and are not measured.
+ *
+ * The histograms are pure so they can be tested on the host.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_LATENCY_H
+#define SONGBIRD_LATENCY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// Latency not known (note created before this boot)
+#define LATENCY_UNKNOWN     UINT32_MAX
+
+// =============================================================================
+// Latency Structures
+// =============================================================================
+
+// millis() at each point of one note's trip (createdMs 0 = unknown)
+typedef struct {
+    uint32_t createdMs;
+    uint32_t dequeuedMs;
+    uint32_t acquiredMs;
+    uint32_t addedMs;
+} NoteLatencyStamps;
+
+// Bucket b < 2 holds b ms; above that each power of two is split in two
+// halves: bucket 2k holds [2^k, 1.5 * 2^k), bucket 2k+1 [1.5 * 2^k, 2^(k+1))
+typedef struct {
+    uint16_t counts[LATENCY_BUCKETS];   // Saturating
+    uint32_t maxMs;
+} LatencyHistogram;
+
+typedef struct {
+    LatencyHistogram stages[LATENCY_STAGE_COUNT];
+} LatencyHistograms;
+
+// =============================================================================
+// Histograms (pure)
+// =============================================================================
+
+/**
+ * @brief Get the age of a note
+ *
+ * @param createdMs The note's creation stamp (0 = unknown)
+ * @param nowMs millis() now
+ * @return Milliseconds since creation, or LATENCY_UNKNOWN
+ */
+uint32_t latencyAgeMs(uint32_t createdMs, uint32_t nowMs);
+
+/**
+ * @brief Get the bucket a latency falls into
+ *
+ * @param ms Latency in milliseconds
+ * @return Bucket index (the last bucket for anything out of range)
+ */
+uint8_t latencyBucket(uint32_t ms);
+
+/**
+ * @brief Get the largest latency a bucket holds
+ *
+ * @param bucket Bucket index
+ * @return Upper edge in milliseconds (inclusive)
+ */
+uint32_t latencyBucketMaxMs(uint8_t bucket);
+
+/**
+ * @brief Add a latency to a histogram
+ *
+ * @param histogram Histogram to update
+ * @param ms Latency in milliseconds
+ */
+void latencyHistogramAdd(LatencyHistogram* histogram, uint32_t ms);
+
+/**
+ * @brief Get the number of latencies in a histogram
+ *
+ * @param histogram Histogram
+ * @return Sample count
+ */
+uint32_t latencyHistogramCount(const LatencyHistogram* histogram);
+
+/**
+ * @brief Get a percentile of a histogram
+ *
+ * Reports the upper edge of the bucket holding the percentile, capped at
+ * the largest latency seen, so the result never understates it.
+ *
+ * @param histogram Histogram
+ * @param permille Percentile in tenths of a percent (500 = p50, 990 = p99)
+ * @return Latency in milliseconds, or 0 if the histogram is empty
+ */
+uint32_t latencyHistogramPercentile(const LatencyHistogram* histogram, uint16_t permille);
+
+/**
+ * @brief Add one note's stage latencies to the histograms
+ *
+ * @param histograms Histograms to update
+ * @param stamps The note's stamps
+ * @return false if the note's creation time is unknown (nothing recorded)
+ */
+bool latencyHistogramsRecord(LatencyHistograms* histograms, const NoteLatencyStamps* stamps);
+
+/**
+ * @brief Summarize the histograms for a health report
+ *
+ * @param histograms Histograms
+ * @param report Output percentiles
+ */
+void latencySummarize(const LatencyHistograms* histograms, LatencyReport* report);
+
+/**
+ * @brief Get the name of a stage
+ *
+ * @param stage Stage
+ * @return Stage name, or "unknown"
+ */
+const char* latencyStageName(LatencyStage stage);
+
+// =============================================================================
+// Alert Latency
+// =============================================================================
+
+/**
+ * @brief Record a delivered alert's stamps
+ *
+ * Called by NotecardTask after note.add succeeds.
+ *
+ * @param stamps The alert's stamps
+ */
+void latencyRecordAlert(const NoteLatencyStamps* stamps);
+
+/**
+ * @brief Summarize the alerts since the last latencyTakeReport()
+ *
+ * Leaves the window open, so a health.qo that fails to send reports the
+ * same alerts on its retry.
+ *
+ * @param report Output percentiles
+ */
+void latencyPeekReport(LatencyReport* report);
+
+/**
+ * @brief Summarize the alerts since the last call and start a new window
+ *
+ * @param report Output percentiles (NULL to start a new window only)
+ */
+void latencyTakeReport(LatencyReport* report);
+
+#endif // SONGBIRD_LATENCY_H
@@ -0,0 +1,139 @@
+/**
+ * @file SongbirdMetrics.cpp
+ * @brief Always-on device metrics implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdMetrics.h"
+#include <string.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+static uint32_t s_counters[METRIC_COUNTER_COUNT];
+static uint32_t s_peaks[METRIC_PEAK_COUNT];
+static uint32_t s_heapFreeMin = UINT32_MAX;
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void metricsInit(void) {
+    for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        __atomic_store_n(&s_counters[i], 0, __ATOMIC_RELAXED);
+    }
+    for (uint8_t i = 0; i < METRIC_PEAK_COUNT; i++) {
+        __atomic_store_n(&s_peaks[i], 0, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&s_heapFreeMin, UINT32_MAX, __ATOMIC_RELAXED);
+}
+
+void metricsIncrement(MetricCounter counter) {
+    if (counter < METRIC_COUNTER_COUNT) {
+        __atomic_fetch_add(&s_counters[counter], 1, __ATOMIC_RELAXED);
+    }
+}
+
+uint32_t metricsGet(MetricCounter counter) {
+    if (counter >= METRIC_COUNTER_COUNT) {
+        return 0;
+    }
+    return __atomic_load_n(&s_counters[counter], __ATOMIC_RELAXED);
+}
+
+void metricsReset(MetricCounter counter) {
+    if (counter < METRIC_COUNTER_COUNT) {
+        __atomic_store_n(&s_counters[counter], 0, __ATOMIC_RELAXED);
+    }
+}
+
+void metricsRecordPeak(MetricPeak peak, uint32_t value) {
+    if (peak >= METRIC_PEAK_COUNT) {
+        return;
+    }
+
+    // Retry only if another task raised the mark in between
+    uint32_t seen = __atomic_load_n(&s_peaks[peak], __ATOMIC_RELAXED);
+    while (value > seen &&
+           !__atomic_compare_exchange_n(&s_peaks[peak], &seen, value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+void metricsRecordHeapFree(uint32_t freeBytes) {
+    uint32_t seen = __atomic_load_n(&s_heapFreeMin, __ATOMIC_RELAXED);
+    while (freeBytes < seen &&
+           !__atomic_compare_exchange_n(&s_heapFreeMin, &seen, freeBytes, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+void metricsSnapshot(MetricsSnapshot* snapshot) {
+    if (snapshot == NULL) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        snapshot->counters[i] = __atomic_load_n(&s_counters[i], __ATOMIC_RELAXED);
+    }
+    for (uint8_t i = 0; i < METRIC_PEAK_COUNT; i++) {
+        snapshot->peaks[i] = __atomic_load_n(&s_peaks[i], __ATOMIC_RELAXED);
+    }
+    snapshot->heapFreeMin = __atomic_load_n(&s_heapFreeMin, __ATOMIC_RELAXED);
+}
+
+// =============================================================================
+// Reporting
+// =============================================================================
+
+// Events since the last report; a counter below its reported value was
+// cleared by metricsReset() since, so all of it is new
+static uint32_t counterDelta(const MetricsSnapshot* reported,
+                             const MetricsSnapshot* current,
+                             MetricCounter counter) {
+    uint32_t now = current->counters[counter];
+    uint32_t then = reported->counters[counter];
+    return (now >= then) ? now - then : now;
+}
+
+MetricsTrigger metricsReportDue(const MetricsSnapshot* reported,
+                                const MetricsSnapshot* current,
+                                uint32_t sinceReportSec,
+                                uint32_t heartbeatSec) {
+    if (reported == NULL || current == NULL) {
+        return METRICS_TRIGGER_NONE;
+    }
+
+    if (sinceReportSec >= heartbeatSec) {
+        return METRICS_TRIGGER_HEARTBEAT;
+    }
+    if (sinceReportSec < METRICS_MIN_REPORT_SEC) {
+        return METRICS_TRIGGER_NONE;
+    }
+
+    uint32_t newErrors = counterDelta(reported, current, METRIC_SENSOR_ERRORS) +
+                         counterDelta(reported, current, METRIC_NOTECARD_ERRORS) +
+                         counterDelta(reported, current, METRIC_I2C_TIMEOUTS);
+    if (newErrors >= METRICS_ERROR_DELTA) {
+        return METRICS_TRIGGER_CHANGE;
+    }
+
+    if (current->counters[METRIC_NOTES_LOST] != reported->counters[METRIC_NOTES_LOST]) {
+        return METRICS_TRIGGER_CHANGE;
+    }
+
+    if (current->heapFreeMin < METRICS_HEAP_LOW_BYTES &&
+        reported->heapFreeMin >= METRICS_HEAP_LOW_BYTES) {
+        return METRICS_TRIGGER_CHANGE;
+    }
+
+    if (current->peaks[METRIC_PEAK_NOTE_QUEUE] >= NOTE_QUEUE_SIZE &&
+        reported->peaks[METRIC_PEAK_NOTE_QUEUE] < NOTE_QUEUE_SIZE) {
+        return METRICS_TRIGGER_CHANGE;
+    }
+
+    return METRICS_TRIGGER_NONE;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file SongbirdMetrics.h
+ * @brief Always-on device metrics for Songbird
+ *
+ * Event counters (sensor, Notecard and I2C errors, notes sent and lost),
+ * high-water marks (note queue, spill and audio queue depth) and the free
+ * heap low-water mark, accumulated since boot. Updates are single lock-free
+ * atomic operations (LDREX/STREX on the Cortex-M4), safe from any task and
+ * cheap enough for release builds.
+ *
+ * MainTask snapshots the metrics into a templated health.qo note every
+ * heartbeat_hours, or early when metricsReportDue() sees a significant
+ * change since the last report.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_METRICS_H
+#define SONGBIRD_METRICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+/**
+ * @brief Clear all metrics
+ *
+ * Called once at boot, before any task runs.
+ */
+void metricsInit(void);
+
+/**
+ * @brief Count one event
+ *
+ * @param counter Counter to increment
+ */
+void metricsIncrement(MetricCounter counter);
+
+/**
+ * @brief Get a counter
+ *
+ * @param counter Counter to read
+ * @return Events since boot (or since metricsReset())
+ */
+uint32_t metricsGet(MetricCounter counter);
+
+/**
+ * @brief Clear a single counter
+ *
+ * @param counter Counter to clear
+ */
+void metricsReset(MetricCounter counter);
+
+/**
+ * @brief Raise a high-water mark
+ *
+ * @param peak High-water mark to update
+ * @param value Current level
+ */
+void metricsRecordPeak(MetricPeak peak, uint32_t value);
+
+/**
+ * @brief Lower the free heap low-water mark
+ *
+ * @param freeBytes Current free heap
+ */
+void metricsRecordHeapFree(uint32_t freeBytes);
+
+/**
+ * @brief Copy all metrics
+ *
+ * Each value is read atomically; the set as a whole is not a single
+ * instant, which is fine for reporting.
+ *
+ * @param snapshot Output
+ */
+void metricsSnapshot(MetricsSnapshot* snapshot);
+
+// =============================================================================
+// Reporting (pure)
+// =============================================================================
+
+/**
+ * @brief Decide whether a health report is due
+ *
+ * Due on the heartbeat, or on a significant change since the last report:
+ * METRICS_ERROR_DELTA new errors, any lost note, the heap dropping below
+ * METRICS_HEAP_LOW_BYTES or the note queue filling for the first time.
+ * Change reports are at least METRICS_MIN_REPORT_SEC apart.
+ *
+ * @param reported Metrics at the last report (or at boot)
+ * @param current Current metrics
+ * @param sinceReportSec Seconds since the last report
+ * @param heartbeatSec Heartbeat interval in seconds
+ * @return Trigger, or METRICS_TRIGGER_NONE if no report is due
+ */
+MetricsTrigger metricsReportDue(const MetricsSnapshot* reported,
+                                const MetricsSnapshot* current,
+                                uint32_t sinceReportSec,
+                                uint32_t heartbeatSec);
+
+#endif // SONGBIRD_METRICS_H
@@ -0,0 +1,112 @@
+/**
+ * @file SongbirdPowerPolicy.cpp
+ * @brief Battery-aware duty cycling policy implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdPowerPolicy.h"
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+// Scale currently in effect. Written by SensorTask, read by every task that
+// computes an interval. A 16-bit aligned store is atomic on Cortex-M4.
+static volatile uint16_t s_scalePct = 100;
+
+// =============================================================================
+// Policy Calculation
+// =============================================================================
+
+void powerPolicyReset(void) {
+    s_scalePct = 100;
+}
+
+void powerPolicyRestore(uint16_t scalePct) {
+    s_scalePct = scalePct < 100 ? 100 : scalePct;
+}
+
+uint16_t powerPolicyComputeScale(const SongbirdConfig* config, float voltage, bool usbPowered) {
+    if (config == NULL || !config->powerPolicyEnabled || usbPowered) {
+        return 100;
+    }
+
+    uint16_t maxPct = (uint16_t)config->powerPolicyMaxScale * 100;
+    if (maxPct <= 100) {
+        return 100;
+    }
+
+    float fullV = config->powerPolicyFullV;
+    float lowV = config->powerPolicyLowV;
+
+    // Misconfigured knees degrade to a single step at lowV
+    if (fullV <= lowV) {
+        return (voltage <= lowV) ? maxPct : 100;
+    }
+    if (voltage >= fullV) {
+        return 100;
+    }
+    if (voltage <= lowV) {
+        return maxPct;
+    }
+
+    // Linear between the knees, then round to the nearest step
+    float fraction = (fullV - voltage) / (fullV - lowV);
+    float pct = 100.0f + fraction * (float)(maxPct - 100);
+    uint16_t steps = (uint16_t)((pct + POWER_POLICY_SCALE_STEP_PCT / 2.0f) /
+                                POWER_POLICY_SCALE_STEP_PCT);
+    uint16_t quantized = steps * POWER_POLICY_SCALE_STEP_PCT;
+
+    return CLAMP(quantized, 100, maxPct);
+}
+
+uint16_t powerPolicyNextScale(const SongbirdConfig* config, float voltage,
+                              bool usbPowered, uint16_t currentPct) {
+    uint16_t target = powerPolicyComputeScale(config, voltage, usbPowered);
+
+    // USB power and unchanged steps apply immediately
+    if (usbPowered || target == currentPct) {
+        return target;
+    }
+
+    // Only leave the current step if the reading is still on the other side
+    // of the boundary after backing off by the hysteresis band.
+    if (target > currentPct) {
+        // Voltage falling - require it to be HYSTERESIS below the knee
+        uint16_t guarded = powerPolicyComputeScale(config,
+                                                   voltage + POWER_POLICY_HYSTERESIS_V, false);
+        return (guarded > currentPct) ? guarded : currentPct;
+    }
+
+    // Voltage rising (charger connected, warmer battery)
+    uint16_t guarded = powerPolicyComputeScale(config,
+                                               voltage - POWER_POLICY_HYSTERESIS_V, false);
+    return (guarded < currentPct) ? guarded : currentPct;
+}
+
+bool powerPolicyUpdate(const SongbirdConfig* config, float voltage, bool usbPowered) {
+    // 0 V means card.voltage failed - keep the current scale
+    if (voltage <= 0.0f && !usbPowered) {
+        return false;
+    }
+
+    uint16_t current = s_scalePct;
+    uint16_t next = powerPolicyNextScale(config, voltage, usbPowered, current);
+    if (next == current) {
+        return false;
+    }
+
+    s_scalePct = next;
+    return true;
+}
+
+uint16_t powerPolicyGetScalePercent(void) {
+    return s_scalePct;
+}
+
+uint32_t powerPolicyScaleInterval(uint32_t base) {
+    uint64_t scaled = ((uint64_t)base * s_scalePct) / 100;
+    return (scaled > UINT32_MAX) ? UINT32_MAX : (uint32_t)scaled;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file SongbirdPowerPolicy.h
+ * @brief Battery-aware duty cycling policy for Songbird
+ *
+ * Stretches the sensor, command poll and sync intervals progressively as
+ * the battery voltage falls, and relaxes them back to the mode presets when
+ * the device is USB powered.
+ *
+ * Curve (per config, all values tunable from Notehub env vars):
+ *
+ *   scale
+ *   max  |__________
+ *        |          \
+ *        |           \
+ *   1x   |            \__________
+ *        +-----+------+----------> voltage
+ *            lowV   fullV
+ *
+ * The scale factor is quantized to POWER_POLICY_SCALE_STEP_PCT and only
+ * changes when the voltage moves POWER_POLICY_HYSTERESIS_V past the point
+ * that selected the current step, so a noisy reading near a boundary does
+ * not cause the Notecard hub settings to be rewritten every cycle.
+ *
+ * Pure logic (no hardware access) so it can be unit tested on the host.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_POWER_POLICY_H
+#define SONGBIRD_POWER_POLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Power Policy Interface
+// =============================================================================
+
+/**
+ * @brief Reset the policy to the unscaled (100%) state
+ */
+void powerPolicyReset(void);
+
+/**
+ * @brief Resume at a previously applied scale
+ *
+ * Called after a warm boot with the scale persisted in SongbirdState, so the
+ * first voltage reading moves on from the step the Notecard already carries
+ * instead of from 100%.
+ *
+ * @param scalePct Scale in percent; values below 100 restore 100
+ */
+void powerPolicyRestore(uint16_t scalePct);
+
+/**
+ * @brief Compute the quantized interval scale for a voltage reading
+ *
+ * @param config Current configuration (curve parameters)
+ * @param voltage Battery voltage in volts
+ * @param usbPowered true if the device is running from USB power
+ * @return Interval scale in percent (100 = mode preset interval)
+ */
+uint16_t powerPolicyComputeScale(const SongbirdConfig* config, float voltage, bool usbPowered);
+
+/**
+ * @brief Compute the next scale step, applying hysteresis
+ *
+ * @param config Current configuration (curve parameters)
+ * @param voltage Battery voltage in volts
+ * @param usbPowered true if the device is running from USB power
+ * @param currentPct Scale currently in effect (percent)
+ * @return Scale to use from now on (percent)
+ */
+uint16_t powerPolicyNextScale(const SongbirdConfig* config, float voltage,
+                              bool usbPowered, uint16_t currentPct);
+
+/**
+ * @brief Feed a new voltage observation into the policy
+ *
+ * Called by SensorTask after each card.voltage reading. Readings of 0 V
+ * (request failed) are ignored and leave the current scale unchanged.
+ *
+ * @param config Current configuration (curve parameters)
+ * @param voltage Battery voltage in volts
+ * @param usbPowered true if the device is running from USB power
+ * @return true if the scale in effect changed
+ */
+bool powerPolicyUpdate(const SongbirdConfig* config, float voltage, bool usbPowered);
+
+/**
+ * @brief Get the scale currently in effect
+ *
+ * @return Interval scale in percent (100 = mode preset interval)
+ */
+uint16_t powerPolicyGetScalePercent(void);
+
+/**
+ * @brief Scale a base interval by the scale currently in effect
+ *
+ * Works with any time unit (ms, seconds, minutes). A base of 0 (disabled)
+ * stays 0. Saturates at UINT32_MAX.
+ *
+ * @param base Mode preset interval
+ * @return Stretched interval in the same unit
+ */
+uint32_t powerPolicyScaleInterval(uint32_t base);
+
+#endif // SONGBIRD_POWER_POLICY_H
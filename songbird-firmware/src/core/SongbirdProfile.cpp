@@ -0,0 +1,178 @@
+/**
+ * @file SongbirdProfile.cpp
+ * @brief Scoped execution-time profiling implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdProfile.h"
+
+#ifdef PROFILE_MODE
+
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+static const char* const SCOPE_NAMES[PROFILE_SCOPE_COUNT] = {
+#define PROFILE_SCOPE_NAME(id, name) name,
+    PROFILE_SCOPES(PROFILE_SCOPE_NAME)
+#undef PROFILE_SCOPE_NAME
+};
+
+static ProfileStats s_stats[PROFILE_SCOPE_COUNT];
+
+// Short critical section around the stats (per platform, below)
+static uint32_t profileLock(void);
+static void profileUnlock(uint32_t saved);
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+void profileReset(void) {
+    uint32_t saved = profileLock();
+    memset(s_stats, 0, sizeof(s_stats));
+    profileUnlock(saved);
+}
+
+void profileRecord(ProfileScopeId id, uint32_t ticks) {
+    if (id >= PROFILE_SCOPE_COUNT) {
+        return;
+    }
+
+    uint32_t saved = profileLock();
+    ProfileStats* stats = &s_stats[id];
+    if (stats->count == 0 || ticks < stats->minTicks) {
+        stats->minTicks = ticks;
+    }
+    if (ticks > stats->maxTicks) {
+        stats->maxTicks = ticks;
+    }
+    stats->totalTicks += ticks;
+    stats->count++;
+    profileUnlock(saved);
+}
+
+bool profileGet(ProfileScopeId id, ProfileStats* stats) {
+    if (id >= PROFILE_SCOPE_COUNT || stats == NULL) {
+        return false;
+    }
+
+    uint32_t saved = profileLock();
+    *stats = s_stats[id];
+    profileUnlock(saved);
+    return true;
+}
+
+const char* profileScopeName(ProfileScopeId id) {
+    if (id < PROFILE_SCOPE_COUNT) {
+        return SCOPE_NAMES[id];
+    }
+    return "unknown";
+}
+
+uint32_t profileTicksToUs(uint64_t ticks, uint32_t ticksPerSecond) {
+    if (ticksPerSecond == 0) {
+        return 0;
+    }
+    return (uint32_t)((ticks * 1000000ULL) / ticksPerSecond);
+}
+
+size_t profileFormat(ProfileScopeId id, char* buffer, size_t size) {
+    ProfileStats stats;
+    if (buffer == NULL || size == 0 || !profileGet(id, &stats)) {
+        return 0;
+    }
+
+    uint32_t hz = profileTicksPerSecond();
+    uint64_t avg = stats.count > 0 ? stats.totalTicks / stats.count : 0;
+    int written = snprintf(buffer, size, "%s n=%lu avg=%lu min=%lu max=%lu us",
+                           SCOPE_NAMES[id],
+                           (unsigned long)stats.count,
+                           (unsigned long)profileTicksToUs(avg, hz),
+                           (unsigned long)profileTicksToUs(stats.minTicks, hz),
+                           (unsigned long)profileTicksToUs(stats.maxTicks, hz));
+    if (written < 0) {
+        return 0;
+    }
+    return (size_t)written < size ? (size_t)written : size - 1;
+}
+
+ProfileScopeId profileSlowest(void) {
+    ProfileScopeId slowest = PROFILE_SCOPE_COUNT;
+    uint32_t longest = 0;
+
+    for (uint8_t i = 0; i < PROFILE_SCOPE_COUNT; i++) {
+        ProfileStats stats;
+        profileGet((ProfileScopeId)i, &stats);
+        if (stats.count > 0 && (slowest == PROFILE_SCOPE_COUNT || stats.maxTicks > longest)) {
+            slowest = (ProfileScopeId)i;
+            longest = stats.maxTicks;
+        }
+    }
+    return slowest;
+}
+
+#ifdef NATIVE_TEST
+
+// =============================================================================
+// Host Platform
+// =============================================================================
+
+static uint32_t profileLock(void) {
+    return 0;
+}
+
+static void profileUnlock(uint32_t saved) {
+    (void)saved;
+}
+
+void profileInit(void) {
+    profileReset();
+}
+
+void profileDump(void) {}
+
+#else
+
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Target Platform
+// =============================================================================
+
+// Masks interrupts up to the FreeRTOS syscall priority; usable before the
+// scheduler starts and from the scope destructors in any task
+static uint32_t profileLock(void) {
+    return (uint32_t)taskENTER_CRITICAL_FROM_ISR();
+}
+
+static void profileUnlock(uint32_t saved) {
+    taskEXIT_CRITICAL_FROM_ISR((UBaseType_t)saved);
+}
+
+void profileInit(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    profileReset();
+}
+
+void profileDump(void) {
+    char line[64];
+    for (uint8_t i = 0; i < PROFILE_SCOPE_COUNT; i++) {
+        if (profileFormat((ProfileScopeId)i, line, sizeof(line)) > 0) {
+            DEBUG_SERIAL.print("[Profile] ");
+            DEBUG_SERIAL.println(line);
+        }
+    }
+}
+
+#endif // NATIVE_TEST
+
+#endif // PROFILE_MODE
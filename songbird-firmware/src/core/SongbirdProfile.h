@@ -0,0 +1,208 @@
+/**
+ * @file SongbirdProfile.h
+ * @brief Scoped execution-time profiling for Songbird
+ *
+ * PROFILE_SCOPE(id) times the rest of the enclosing block and folds the
+ * duration into fixed per-scope statistics (count, total, min, max). Scope
+ * IDs come from the PROFILE_SCOPES list below, so there is no registration
+ * and no allocation.
+ *
+ * On target the time base is the Cortex-M4 DWT cycle counter (one tick per
+ * core clock, wraps every ~53 s at 80 MHz, which bounds a single scope). In
+ * NATIVE_TEST builds it is std::chrono::steady_clock in nanoseconds.
+ *
+ * Profiling is built only with PROFILE_MODE defined (the debug and native
+ * environments). Without it PROFILE_SCOPE expands to nothing and the
+ * module has no code or data.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_PROFILE_H
+#define SONGBIRD_PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// =============================================================================
+// Profiled Scopes
+// =============================================================================
+
+// X(id, name) - name is used in dumps and the profile command ack
+#define PROFILE_SCOPES(X) \
+    X(PROFILE_SENSORS_READ,         "sensors_read") \
+    X(PROFILE_NC_SEND_TRACK,        "nc_send_track") \
+    X(PROFILE_AUDIO_MELODY,         "audio_melody") \
+    X(PROFILE_ENV_FETCH,            "env_fetch")
+
+typedef enum {
+#define PROFILE_SCOPE_ENUM(id, name) id,
+    PROFILE_SCOPES(PROFILE_SCOPE_ENUM)
+#undef PROFILE_SCOPE_ENUM
+    PROFILE_SCOPE_COUNT
+} ProfileScopeId;
+
+#ifdef PROFILE_MODE
+
+#ifdef NATIVE_TEST
+#include <chrono>
+#else
+#include <stm32l4xx_hal.h>
+#endif
+
+// =============================================================================
+// Statistics Structure
+// =============================================================================
+
+typedef struct {
+    uint32_t count;         // Completed scopes
+    uint32_t minTicks;      // Shortest (0 if count == 0)
+    uint32_t maxTicks;      // Longest
+    uint64_t totalTicks;    // Sum of all durations
+} ProfileStats;
+
+// =============================================================================
+// Time Base
+// =============================================================================
+
+/**
+ * @brief Read the profiling clock
+ *
+ * @return Current tick count (wraps; use unsigned differences)
+ */
+static inline uint32_t profileNow(void) {
+#ifdef NATIVE_TEST
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief Get the profiling clock frequency
+ *
+ * @return Ticks per second
+ */
+static inline uint32_t profileTicksPerSecond(void) {
+#ifdef NATIVE_TEST
+    return 1000000000UL;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+/**
+ * @brief Clear all statistics and start the cycle counter
+ *
+ * Enables the DWT counter without resetting it, so it can run before the
+ * scheduler starts the run-time statistics counter on the same hardware.
+ */
+void profileInit(void);
+
+/**
+ * @brief Clear all statistics
+ */
+void profileReset(void);
+
+/**
+ * @brief Fold one scope duration into its statistics
+ *
+ * Safe to call from any task; a scope ID may be used by several tasks.
+ *
+ * @param id Scope ID
+ * @param ticks Duration in profiling clock ticks
+ */
+void profileRecord(ProfileScopeId id, uint32_t ticks);
+
+/**
+ * @brief Copy the statistics for one scope
+ *
+ * @param id Scope ID
+ * @param stats Output statistics
+ * @return true if id is valid
+ */
+bool profileGet(ProfileScopeId id, ProfileStats* stats);
+
+/**
+ * @brief Get the name of a scope
+ *
+ * @param id Scope ID
+ * @return Scope name, or "unknown"
+ */
+const char* profileScopeName(ProfileScopeId id);
+
+/**
+ * @brief Convert ticks to microseconds
+ *
+ * @param ticks Duration in profiling clock ticks
+ * @param ticksPerSecond Profiling clock frequency
+ * @return Duration in microseconds
+ */
+uint32_t profileTicksToUs(uint64_t ticks, uint32_t ticksPerSecond);
+
+/**
+ * @brief Format one scope as a single line
+ *
+ * "sensors_read n=12 avg=1520 min=1490 max=1710 us"
+ *
+ * @param id Scope ID
+ * @param buffer Output buffer
+ * @param size Buffer size
+ * @return Characters written (excluding the terminator), or 0 on error
+ */
+size_t profileFormat(ProfileScopeId id, char* buffer, size_t size);
+
+/**
+ * @brief Find the scope with the longest single duration
+ *
+ * @return Scope ID, or PROFILE_SCOPE_COUNT if nothing was recorded
+ */
+ProfileScopeId profileSlowest(void);
+
+/**
+ * @brief Write one line per scope to DEBUG_SERIAL (target only)
+ */
+void profileDump(void);
+
+// =============================================================================
+// Scoped Timer
+// =============================================================================
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileScopeId id) : m_id(id), m_start(profileNow()) {}
+    ~ProfileScope() { profileRecord(m_id, profileNow() - m_start); }
+
+private:
+    ProfileScope(const ProfileScope&);
+    ProfileScope& operator=(const ProfileScope&);
+
+    ProfileScopeId m_id;
+    uint32_t m_start;
+};
+
+#define PROFILE_CONCAT_(a, b)   a##b
+#define PROFILE_CONCAT(a, b)    PROFILE_CONCAT_(a, b)
+
+/**
+ * @brief Time the rest of the enclosing block as scope `id`
+ */
+#define PROFILE_SCOPE(id)   ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(id)
+
+#else // PROFILE_MODE
+
+#define PROFILE_SCOPE(id)   ((void)0)
+
+static inline void profileInit(void) {}
+static inline void profileReset(void) {}
+static inline void profileDump(void) {}
+
+#endif // PROFILE_MODE
+
+#endif // SONGBIRD_PROFILE_H
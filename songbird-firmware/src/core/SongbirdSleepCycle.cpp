@@ -0,0 +1,60 @@
+/**
+ * @file SongbirdSleepCycle.cpp
+ * @brief Deep sleep cycle decisions implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdSleepCycle.h"
+#include "SongbirdEnv.h"
+#include "SongbirdPowerPolicy.h"
+#include <stddef.h>
+
+// =============================================================================
+// Sleep Cycle
+// =============================================================================
+
+bool sleepCycleDue(const SleepCycleInputs* inputs) {
+    if (inputs == NULL) {
+        return false;
+    }
+
+    if (inputs->mode != MODE_STORAGE && inputs->mode != MODE_SLEEP) {
+        return false;
+    }
+
+    // Never sleep in the middle of a button gesture or a PVD shutdown
+    if (inputs->busy) {
+        return false;
+    }
+
+    // After power-on, stay up long enough for env vars to arrive and for
+    // the user to press the button
+    if (!inputs->warmBoot && inputs->nowMs < SLEEP_CYCLE_COLD_BOOT_AWAKE_MS) {
+        return false;
+    }
+
+    if (inputs->lastAttemptMs != 0 &&
+        (inputs->nowMs - inputs->lastAttemptMs) < SLEEP_CYCLE_RETRY_MS) {
+        return false;
+    }
+
+    return (inputs->eventBits & CYCLE_BITS_ALL) == CYCLE_BITS_ALL &&
+           inputs->notesPending == 0;
+}
+
+uint32_t sleepCycleDurationSec(const SongbirdConfig* config, uint32_t sinceReportSec) {
+    uint32_t heartbeatSec = HOURS_TO_SEC(config->heartbeatHours);
+    uint32_t untilHeartbeat = (sinceReportSec < heartbeatSec) ? heartbeatSec - sinceReportSec
+                                                              : heartbeatSec;
+    uint32_t seconds = powerPolicyScaleInterval(envGetSleepDurationSec(config));
+    if (seconds == 0 || seconds > untilHeartbeat) {
+        seconds = untilHeartbeat;
+    }
+    return MAX(seconds, (uint32_t)SLEEP_CYCLE_MIN_SEC);
+}
+
+uint32_t sleepCycleAttemptFailed(uint32_t nowMs) {
+    return nowMs != 0 ? nowMs : 1;
+}
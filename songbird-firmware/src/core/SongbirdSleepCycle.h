@@ -0,0 +1,84 @@
+/**
+ * @file SongbirdSleepCycle.h
+ * @brief Deep sleep cycle decisions for Songbird
+ *
+ * Storage and sleep modes power the host down between report cycles. Each
+ * worker task sets its report-cycle bit in the sleep event group once its
+ * work for the wake period is done; MainTask requests sleep once all bits
+ * are set and NotecardTask has drained the note queue, and clears them
+ * after a failed attempt so the next try waits for a fresh cycle.
+ *
+ * Pure logic (no RTOS calls) so it can be unit tested on the host. MainTask
+ * passes in a snapshot of the event group bits.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_SLEEP_CYCLE_H
+#define SONGBIRD_SLEEP_CYCLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Report-Cycle Bits
+// =============================================================================
+
+// Report-cycle bits in g_sleepEvent: set by each task once it has done its
+// work for this wake period. Bits 0-5 are the sleep bits (SongbirdSync.h).
+#define CYCLE_BIT_SENSOR    (1 << 6)
+#define CYCLE_BIT_COMMAND   (1 << 7)
+#define CYCLE_BITS_ALL      (CYCLE_BIT_SENSOR | CYCLE_BIT_COMMAND)
+
+// =============================================================================
+// Data Structures
+// =============================================================================
+
+// Snapshot MainTask takes each loop
+typedef struct {
+    OperatingMode mode;         // Current operating mode
+    bool warmBoot;              // This boot was a wake from a previous sleep
+    bool busy;                  // Button gesture or PVD shutdown in progress
+    uint32_t nowMs;             // millis()
+    uint32_t lastAttemptMs;     // millis() of the last failed sleep (0 = none)
+    uint32_t eventBits;         // g_sleepEvent bits
+    uint32_t notesPending;      // Queued and spilled outbound notes
+} SleepCycleInputs;
+
+// =============================================================================
+// Sleep Cycle Interface
+// =============================================================================
+
+/**
+ * @brief Check whether MainTask should schedule a deep sleep now
+ *
+ * @param inputs Snapshot of the conditions
+ * @return true if all conditions for sleep are met
+ */
+bool sleepCycleDue(const SleepCycleInputs* inputs);
+
+/**
+ * @brief Get the timer wake for the next deep sleep (seconds)
+ *
+ * Uses the mode's sleep duration stretched by the battery-aware power
+ * policy, cut short to wake when the next heartbeat health.qo is due. Sleep
+ * mode has no timer of its own, so it wakes for the heartbeat to pick up
+ * commands and env changes if motion never comes.
+ *
+ * @param config Current configuration
+ * @param sinceReportSec Seconds since the last health.qo
+ * @return Seconds to sleep, at least SLEEP_CYCLE_MIN_SEC
+ */
+uint32_t sleepCycleDurationSec(const SongbirdConfig* config, uint32_t sinceReportSec);
+
+/**
+ * @brief Timestamp a failed sleep attempt for the retry back-off
+ *
+ * @param nowMs millis()
+ * @return Value for SleepCycleInputs.lastAttemptMs (never 0)
+ */
+uint32_t sleepCycleAttemptFailed(uint32_t nowMs);
+
+#endif // SONGBIRD_SLEEP_CYCLE_H
@@ -8,6 +8,7 @@
 
 #include "SongbirdState.h"
 #include "SongbirdNotecard.h"
+#include "SongbirdTrace.h"
 #include <string.h>
 #include <STM32FreeRTOS.h>
 
@@ -16,29 +17,13 @@
 // =============================================================================
 
 static SongbirdState s_state;
+
+// The whole structure travels in the card.attn sleep payload
+static_assert(sizeof(SongbirdState) <= NOTECARD_SLEEP_PAYLOAD_MAX,
+              "SongbirdState exceeds the Notecard sleep payload limit");
 static bool s_warmBoot = false;
 static uint32_t s_bootStartTime = 0;
-
-// =============================================================================
-// CRC32 Implementation (simple polynomial)
-// =============================================================================
-
-static uint32_t crc32(const uint8_t* data, size_t length) {
-    uint32_t crc = 0xFFFFFFFF;
-
-    for (size_t i = 0; i < length; i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ 0xEDB88320;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-
-    return ~crc;
-}
+static bool s_bootProfileSaved = false;
 
 // =============================================================================
 // Initialization
@@ -51,8 +36,7 @@ void stateInit(void) {
     s_state.version = STATE_VERSION;
     s_state.bootCount = 1;
     s_state.lastSyncTime = 0;
-    s_state.lastGpsFixTime = 0;
-    s_state.lastPressure = NAN;
+    s_state.lastGpsFixEpoch = 0;
     s_state.currentMode = MODE_DEMO;
     s_state.alertsSent = 0;
     s_state.motionSinceLastReport = false;
@@ -75,6 +59,16 @@ void stateInit(void) {
     strncpy(s_state.lastShutdownReason, "unknown", sizeof(s_state.lastShutdownReason) - 1);
     s_state.lastShutdownReason[sizeof(s_state.lastShutdownReason) - 1] = '\0';
 
+    // Alert engine
+    alertEngineReset(&s_state.alertEngine);
+
+    // Health reporting
+    s_state.lastHealthEpoch = 0;
+    memset(&s_state.bootProfiles, 0, sizeof(s_state.bootProfiles));
+
+    // Battery-aware duty cycling (v9)
+    s_state.appliedSyncScale = 100;
+
     s_bootStartTime = millis();
     s_warmBoot = false;
 
@@ -159,26 +153,30 @@ bool stateRestore(void) {
 }
 
 bool stateSave(void) {
+    return stateSaveAndSleep(0, false, false);
+}
+
+bool stateSaveAndSleep(uint32_t sleepSeconds, bool wakeOnMotion, bool wakeOnCommand) {
     // Prepare for sleep
     statePrepareForSleep();
 
     // Calculate checksum
     s_state.checksum = stateCalculateChecksum(&s_state);
 
-    // Save to Notecard payload
-    // Note: This is a simplified version - actual implementation would
-    // use notecardConfigureSleep with the payload
+    // Save to Notecard payload; the same card.attn request arms the sleep
     bool success = notecardConfigureSleep(
-        0,      // Sleep duration handled elsewhere
-        false,  // Motion wake handled elsewhere
-        false,  // Command wake handled elsewhere
+        sleepSeconds,
+        wakeOnMotion,
+        wakeOnCommand,
         (const uint8_t*)&s_state,
         sizeof(s_state)
     );
 
     #ifdef DEBUG_MODE
     if (success) {
-        DEBUG_SERIAL.println("[State] Saved to Notecard payload");
+        DEBUG_SERIAL.print("[State] Saved to Notecard payload, sleeping ");
+        DEBUG_SERIAL.print(sleepSeconds);
+        DEBUG_SERIAL.println("s");
     } else {
         DEBUG_SERIAL.println("[State] Failed to save");
     }
@@ -207,15 +205,18 @@ void stateUpdateSyncTime(void) {
     taskEXIT_CRITICAL();
 }
 
-void stateUpdateGpsFixTime(void) {
+void stateSetLastGpsFix(uint32_t epoch) {
     taskENTER_CRITICAL();
-    s_state.lastGpsFixTime = millis();
+    s_state.lastGpsFixEpoch = epoch;
     taskEXIT_CRITICAL();
 }
 
-void stateUpdateLastPressure(float pressure) {
+void stateSetAlertEngine(const AlertEngineState* engine) {
+    if (engine == NULL) {
+        return;
+    }
     taskENTER_CRITICAL();
-    s_state.lastPressure = pressure;
+    memcpy(&s_state.alertEngine, engine, sizeof(AlertEngineState));
     taskEXIT_CRITICAL();
 }
 
@@ -268,6 +269,25 @@ void statePrepareForSleep(void) {
     uint32_t currentUptime = (millis() - s_bootStartTime) / 1000;
     s_state.uptimeAtSleep = millis();
     s_state.totalUptimeSec += currentUptime;
+
+    // Start a new session so an abandoned sleep attempt is not counted twice
+    s_bootStartTime += currentUptime * 1000;
+
+    if (!s_bootProfileSaved) {
+        BootProfileRecord record;
+        bootProfileCompact(bootProfileGet(), &record);
+        bootProfileHistoryAdd(&s_state.bootProfiles, &record);
+        s_bootProfileSaved = true;
+    }
+}
+
+void stateGetBootProfiles(BootProfileHistory* history) {
+    if (history == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    memcpy(history, &s_state.bootProfiles, sizeof(BootProfileHistory));
+    taskEXIT_CRITICAL();
 }
 
 uint32_t stateGetTotalUptimeSec(void) {
@@ -283,11 +303,13 @@ uint32_t stateGetBootCount(void) {
     return count;
 }
 
-float stateGetLastPressure(void) {
+void stateGetAlertEngine(AlertEngineState* engine) {
+    if (engine == NULL) {
+        return;
+    }
     taskENTER_CRITICAL();
-    float pressure = s_state.lastPressure;
+    memcpy(engine, &s_state.alertEngine, sizeof(AlertEngineState));
     taskEXIT_CRITICAL();
-    return pressure;
 }
 
 void stateSetTransitLock(bool locked, OperatingMode previousMode) {
@@ -343,16 +365,37 @@ void stateUpdateLockLED(void) {
     // Note: LED is active-high (GPIO HIGH = LED on)
     digitalWrite(LOCK_LED_PIN, lockActive ? HIGH : LOW);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[State] Lock LED: ");
-    DEBUG_SERIAL.println(lockActive ? "ON" : "OFF");
-    #endif
+    traceRecord(TRACE_STATE_LOCK_LED, lockActive, 0);
 }
 
 // =============================================================================
 // GPS Power Management
 // =============================================================================
 
+void stateGetGpsPower(GpsPowerState* gps) {
+    if (gps == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    gps->saving = s_state.gpsPowerSaving;
+    gps->wasActive = s_state.gpsWasActive;
+    gps->activeStartMs = s_state.gpsActiveStartTime;
+    gps->lastRetryMs = s_state.lastGpsRetryTime;
+    taskEXIT_CRITICAL();
+}
+
+void stateSetGpsPower(const GpsPowerState* gps) {
+    if (gps == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    s_state.gpsPowerSaving = gps->saving;
+    s_state.gpsWasActive = gps->wasActive;
+    s_state.gpsActiveStartTime = gps->activeStartMs;
+    s_state.lastGpsRetryTime = gps->lastRetryMs;
+    taskEXIT_CRITICAL();
+}
+
 void stateSetGpsPowerSaving(bool enabled) {
     taskENTER_CRITICAL();
     s_state.gpsPowerSaving = enabled;
@@ -366,6 +409,32 @@ bool stateIsGpsPowerSaving(void) {
     return saving;
 }
 
+void stateSetLastHealthEpoch(uint32_t epoch) {
+    taskENTER_CRITICAL();
+    s_state.lastHealthEpoch = epoch;
+    taskEXIT_CRITICAL();
+}
+
+uint32_t stateGetLastHealthEpoch(void) {
+    taskENTER_CRITICAL();
+    uint32_t epoch = s_state.lastHealthEpoch;
+    taskEXIT_CRITICAL();
+    return epoch;
+}
+
+void stateSetAppliedSyncScale(uint16_t scalePct) {
+    taskENTER_CRITICAL();
+    s_state.appliedSyncScale = scalePct;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t stateGetAppliedSyncScale(void) {
+    taskENTER_CRITICAL();
+    uint16_t scalePct = s_state.appliedSyncScale;
+    taskEXIT_CRITICAL();
+    return scalePct;
+}
+
 void stateSetLastGpsRetryTime(uint32_t time) {
     taskENTER_CRITICAL();
     s_state.lastGpsRetryTime = time;
@@ -405,36 +474,6 @@ uint32_t stateGetGpsActiveStartTime(void) {
     return t;
 }
 
-// =============================================================================
-// Checksum
-// =============================================================================
-
-uint32_t stateCalculateChecksum(const SongbirdState* state) {
-    if (state == NULL) { return 0; }
-    // Copy into a zeroed buffer to normalize padding bytes between struct fields.
-    // Without this, two logically identical states can produce different CRC values
-    // because the compiler inserts padding bytes (e.g., between bool and uint32_t
-    // fields) whose values are undefined and can vary across memset vs memcpy paths.
-    // NOTE: This changes the CRC algorithm behaviour relative to any checksum
-    // computed before this fix.  Devices upgrading from older firmware will fail
-    // the checksum check on the first boot and perform a clean state reset —
-    // this is expected and correct (STATE_VERSION was also bumped for the same reason).
-    SongbirdState normalized;
-    memset(&normalized, 0, sizeof(normalized));
-    memcpy(&normalized, state, sizeof(normalized));
-    size_t checksumOffset = offsetof(SongbirdState, checksum);
-    return crc32((const uint8_t*)&normalized, checksumOffset);
-}
-
-bool stateValidateChecksum(const SongbirdState* state) {
-    if (state == NULL) {
-        return false;
-    }
-
-    uint32_t calculated = stateCalculateChecksum(state);
-    return calculated == state->checksum;
-}
-
 // =============================================================================
 // Brownout / Power Management
 // =============================================================================
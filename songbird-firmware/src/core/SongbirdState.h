@@ -14,6 +14,9 @@
 
 #include <Arduino.h>
 #include "SongbirdConfig.h"
+#include "SongbirdAlertEngine.h"
+#include "SongbirdBootProfile.h"
+#include "SongbirdGpsPower.h"
 
 // =============================================================================
 // State Structure
@@ -27,7 +30,12 @@
 //   - stateCalculateChecksum() now normalises padding before computing CRC,
 //     so checksums computed by older firmware are no longer valid.
 // These changes require a clean state reset on first boot after upgrade.
-#define STATE_VERSION 5
+// STATE_VERSION 6: lastPressure replaced by the alert engine history.
+// STATE_VERSION 7: lastHealthEpoch for the health.qo heartbeat across sleeps.
+// STATE_VERSION 8: bootProfiles, compact profiles of the last few boots.
+// STATE_VERSION 9: appliedSyncScale, the power policy step in the Notecard's hub.set.
+// STATE_VERSION 10: lastGpsFixEpoch replaces lastGpsFixTime (uptime ms, wrong after a wake).
+#define STATE_VERSION 10
 
 /**
  * @brief Persistent state structure
@@ -40,8 +48,7 @@ typedef struct {
     uint8_t version;            // Structure version
     uint32_t bootCount;         // Number of boot cycles
     uint32_t lastSyncTime;      // Last successful sync (uptime ms)
-    uint32_t lastGpsFixTime;    // Last GPS fix (uptime ms)
-    float lastPressure;         // Previous pressure reading (for delta alerts)
+    uint32_t lastGpsFixEpoch;   // Last GPS fix (Unix time, 0 = none)
     OperatingMode currentMode;  // Current operating mode
     uint8_t alertsSent;         // Bitmask of active alerts
     bool motionSinceLastReport; // Motion detected since last track note
@@ -63,6 +70,18 @@ typedef struct {
     uint8_t consecutiveBrownouts;   // Number of back-to-back brownout resets
     char lastShutdownReason[16];    // "pvd", "brownout", "normal", "unknown"
 
+    // Alert engine smoothing, persistence and pressure history (v6)
+    AlertEngineState alertEngine;
+
+    // Health reporting (v7)
+    uint32_t lastHealthEpoch;   // Unix time of the last health.qo (0 = never)
+
+    // Boot profiling (v8)
+    BootProfileHistory bootProfiles;
+
+    // Battery-aware duty cycling (v9)
+    uint16_t appliedSyncScale;  // Power policy scale of the last successful hub.set (percent)
+
     uint32_t checksum;          // CRC32 checksum
 } SongbirdState;
 
@@ -96,12 +115,25 @@ bool stateRestore(void);
 /**
  * @brief Save state to Notecard payload for sleep
  *
- * Caller must hold I2C mutex.
+ * Equivalent to stateSaveAndSleep(0, false, false). Caller must hold I2C mutex.
  *
  * @return true if state saved successfully
  */
 bool stateSave(void);
 
+/**
+ * @brief Save state to the Notecard payload and arm a timed sleep
+ *
+ * Once the card.attn request succeeds the Notecard cuts host power; a true
+ * return means power should drop within moments. Caller must hold I2C mutex.
+ *
+ * @param sleepSeconds Seconds until timer wake (0 for no timer wake)
+ * @param wakeOnMotion Wake on accelerometer motion
+ * @param wakeOnCommand Wake when a note arrives in command.qi
+ * @return true if state saved and sleep armed
+ */
+bool stateSaveAndSleep(uint32_t sleepSeconds, bool wakeOnMotion, bool wakeOnCommand);
+
 /**
  * @brief Check if this is a warm boot (state was restored)
  *
@@ -120,16 +152,18 @@ void stateIncrementBootCount(void);
 void stateUpdateSyncTime(void);
 
 /**
- * @brief Update last GPS fix time
+ * @brief Record the time of the last GPS fix
+ *
+ * @param epoch card.location fix time (Unix time)
  */
-void stateUpdateGpsFixTime(void);
+void stateSetLastGpsFix(uint32_t epoch);
 
 /**
- * @brief Update last pressure reading
+ * @brief Store alert engine state
  *
- * @param pressure Pressure in hPa
+ * @param engine Engine state to persist
  */
-void stateUpdateLastPressure(float pressure);
+void stateSetAlertEngine(const AlertEngineState* engine);
 
 /**
  * @brief Set current operating mode
@@ -178,10 +212,21 @@ bool stateGetAndClearMotion(void);
 /**
  * @brief Prepare state for sleep
  *
- * Updates uptime counters before sleep.
+ * Updates uptime counters and adds this boot's profile to the history
+ * before sleep. Safe to call again if a sleep attempt is abandoned - time
+ * and the profile are only counted once.
  */
 void statePrepareForSleep(void);
 
+/**
+ * @brief Get a copy of the boot profile history
+ *
+ * Holds the previous boots; this boot is added when state is saved.
+ *
+ * @param history Output history
+ */
+void stateGetBootProfiles(BootProfileHistory* history);
+
 /**
  * @brief Get total uptime in seconds
  *
@@ -199,11 +244,11 @@ uint32_t stateGetTotalUptimeSec(void);
 uint32_t stateGetBootCount(void);
 
 /**
- * @brief Get last pressure reading
+ * @brief Get a copy of the alert engine state
  *
- * @return Pressure in hPa, or NAN if none
+ * @param engine Output engine state
  */
-float stateGetLastPressure(void);
+void stateGetAlertEngine(AlertEngineState* engine);
 
 /**
  * @brief Set transit lock state
@@ -264,6 +309,20 @@ void stateUpdateLockLED(void);
 // GPS Power Management
 // =============================================================================
 
+/**
+ * @brief Load the GPS power management state
+ *
+ * @param gps Output
+ */
+void stateGetGpsPower(GpsPowerState* gps);
+
+/**
+ * @brief Store the GPS power management state
+ *
+ * @param gps State to persist
+ */
+void stateSetGpsPower(const GpsPowerState* gps);
+
 /**
  * @brief Set GPS power saving state
  *
@@ -278,6 +337,36 @@ void stateSetGpsPowerSaving(bool enabled);
  */
 bool stateIsGpsPowerSaving(void);
 
+/**
+ * @brief Record when the last health.qo report was queued
+ *
+ * @param epoch Unix timestamp of the report
+ */
+void stateSetLastHealthEpoch(uint32_t epoch);
+
+/**
+ * @brief Get when the last health.qo report was queued
+ *
+ * @return Unix timestamp, or 0 if never (or the time was unknown)
+ */
+uint32_t stateGetLastHealthEpoch(void);
+
+/**
+ * @brief Record the power policy scale the Notecard's hub.set now carries
+ *
+ * Called by notecardConfigureHub() after the request succeeds.
+ *
+ * @param scalePct Scale in percent (100 = mode preset intervals)
+ */
+void stateSetAppliedSyncScale(uint16_t scalePct);
+
+/**
+ * @brief Get the power policy scale the Notecard's hub.set carries
+ *
+ * @return Scale in percent
+ */
+uint16_t stateGetAppliedSyncScale(void);
+
 /**
  * @brief Set last GPS retry time
  *
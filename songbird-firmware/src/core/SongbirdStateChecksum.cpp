@@ -0,0 +1,66 @@
+/**
+ * @file SongbirdStateChecksum.cpp
+ * @brief Persistent state checksum
+ *
+ * The CRC32 over SongbirdState, kept apart from the Notecard payload I/O in
+ * SongbirdState.cpp so the native tests and benchmarks link the real
+ * checksum.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdState.h"
+#include <stddef.h>
+#include <string.h>
+
+// =============================================================================
+// CRC32 Implementation (simple polynomial)
+// =============================================================================
+
+static uint32_t crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            if (crc & 1) {
+                crc = (crc >> 1) ^ 0xEDB88320;
+            } else {
+                crc >>= 1;
+            }
+        }
+    }
+
+    return ~crc;
+}
+
+// =============================================================================
+// Checksum
+// =============================================================================
+
+uint32_t stateCalculateChecksum(const SongbirdState* state) {
+    if (state == NULL) { return 0; }
+    // Copy into a zeroed buffer to normalize padding bytes between struct fields.
+    // Without this, two logically identical states can produce different CRC values
+    // because the compiler inserts padding bytes (e.g., between bool and uint32_t
+    // fields) whose values are undefined and can vary across memset vs memcpy paths.
+    // NOTE: This changes the CRC algorithm behaviour relative to any checksum
+    // computed before this fix.  Devices upgrading from older firmware will fail
+    // the checksum check on the first boot and perform a clean state reset —
+    // this is expected and correct (STATE_VERSION was also bumped for the same reason).
+    SongbirdState normalized;
+    memset(&normalized, 0, sizeof(normalized));
+    memcpy(&normalized, state, sizeof(normalized));
+    size_t checksumOffset = offsetof(SongbirdState, checksum);
+    return crc32((const uint8_t*)&normalized, checksumOffset);
+}
+
+bool stateValidateChecksum(const SongbirdState* state) {
+    if (state == NULL) {
+        return false;
+    }
+
+    uint32_t calculated = stateCalculateChecksum(state);
+    return calculated == state->checksum;
+}
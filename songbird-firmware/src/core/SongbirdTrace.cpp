@@ -0,0 +1,180 @@
+/**
+ * @file SongbirdTrace.cpp
+ * @brief Binary trace log implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdTrace.h"
+#include <string.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+// Writers reserve s_head with a CAS, fill the slot, then publish it by
+// storing its tag; the drain reads slots in order up to the first untagged
+// one and frees them by advancing s_tail. The tag store, the s_tail store
+// and the loads that pair with them are sequentially consistent, so either
+// tracePending() sees the new tag or the writer sees s_tail at its slot.
+static TraceRecord s_ring[TRACE_RING_SIZE];
+static uint32_t s_head = 0;
+static uint32_t s_tail = 0;
+static uint32_t s_dropped = 0;
+
+// Drain-side only
+static uint32_t s_droppedReported = 0;
+static uint32_t s_lastTimeUs = 0;
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void traceInit(void) {
+    memset(s_ring, 0, sizeof(s_ring));
+    __atomic_store_n(&s_head, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_tail, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_dropped, 0, __ATOMIC_RELAXED);
+    s_droppedReported = 0;
+    s_lastTimeUs = 0;
+}
+
+bool traceRecordAt(uint32_t timeUs, uint8_t task, TraceEvent event,
+                   uint32_t arg0, uint32_t arg1, bool* wakeDrain) {
+    if (wakeDrain) *wakeDrain = false;
+
+    uint32_t head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+    do {
+        if (head - __atomic_load_n(&s_tail, __ATOMIC_ACQUIRE) >= TRACE_RING_SIZE) {
+            __atomic_fetch_add(&s_dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&s_head, &head, head + 1, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    TraceRecord* record = &s_ring[head & (TRACE_RING_SIZE - 1)];
+    record->event = (uint8_t)event;
+    record->task = task;
+    record->timeUs = timeUs;
+    record->arg0 = arg0;
+    record->arg1 = arg1;
+    __atomic_store_n(&record->tag, (uint16_t)(head + 1), __ATOMIC_SEQ_CST);
+
+    // Earlier slots still unread: whoever commits the one the drain stops
+    // at wakes it, and it reads on through this one
+    if (wakeDrain) {
+        *wakeDrain = __atomic_load_n(&s_tail, __ATOMIC_SEQ_CST) == head;
+    }
+    return true;
+}
+
+uint32_t traceGetDropped(void) {
+    return __atomic_load_n(&s_dropped, __ATOMIC_RELAXED);
+}
+
+// =============================================================================
+// Draining
+// =============================================================================
+
+static void putU32(uint8_t* out, uint32_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+}
+
+void traceEncodeFrame(const TraceRecord* record, uint8_t* frame) {
+    if (record == NULL || frame == NULL) {
+        return;
+    }
+
+    frame[0] = TRACE_FRAME_SYNC0;
+    frame[1] = TRACE_FRAME_SYNC1;
+    frame[2] = record->event;
+    frame[3] = record->task;
+    putU32(&frame[4], record->timeUs);
+    putU32(&frame[8], record->arg0);
+    putU32(&frame[12], record->arg1);
+
+    uint8_t sum = 0;
+    for (uint8_t i = 2; i < TRACE_FRAME_SIZE - 1; i++) {
+        sum += frame[i];
+    }
+    frame[TRACE_FRAME_SIZE - 1] = sum;
+}
+
+size_t traceDrain(uint8_t* buffer, size_t size) {
+    if (buffer == NULL) {
+        return 0;
+    }
+
+    size_t used = 0;
+
+    uint32_t dropped = __atomic_load_n(&s_dropped, __ATOMIC_RELAXED);
+    if (dropped != s_droppedReported && size >= TRACE_FRAME_SIZE) {
+        TraceRecord lost;
+        memset(&lost, 0, sizeof(lost));
+        lost.event = TRACE_DROPPED;
+        lost.task = RUNSTATS_TASK_OTHER;
+        lost.timeUs = s_lastTimeUs;
+        lost.arg0 = dropped - s_droppedReported;
+        traceEncodeFrame(&lost, buffer);
+        used = TRACE_FRAME_SIZE;
+        s_droppedReported = dropped;
+    }
+
+    uint32_t tail = __atomic_load_n(&s_tail, __ATOMIC_RELAXED);
+    while (size - used >= TRACE_FRAME_SIZE) {
+        TraceRecord* record = &s_ring[tail & (TRACE_RING_SIZE - 1)];
+        if (__atomic_load_n(&record->tag, __ATOMIC_ACQUIRE) != (uint16_t)(tail + 1)) {
+            break;  // Empty, or a writer has reserved the slot but not finished
+        }
+
+        traceEncodeFrame(record, &buffer[used]);
+        used += TRACE_FRAME_SIZE;
+        s_lastTimeUs = record->timeUs;
+        tail++;
+    }
+
+    // Free the slots only after they have been copied
+    __atomic_store_n(&s_tail, tail, __ATOMIC_SEQ_CST);
+    return used;
+}
+
+bool tracePending(void) {
+    if (__atomic_load_n(&s_dropped, __ATOMIC_RELAXED) != s_droppedReported) {
+        return true;
+    }
+
+    uint32_t tail = __atomic_load_n(&s_tail, __ATOMIC_RELAXED);
+    const TraceRecord* record = &s_ring[tail & (TRACE_RING_SIZE - 1)];
+    return __atomic_load_n(&record->tag, __ATOMIC_SEQ_CST) == (uint16_t)(tail + 1);
+}
+
+#if !defined(NATIVE_TEST) && !defined(TRACE_DISABLED)
+
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include "SongbirdTasks.h"
+
+// =============================================================================
+// Timestamped Recording
+// =============================================================================
+
+void traceRecord(TraceEvent event, uint32_t arg0, uint32_t arg1) {
+    bool running = xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+    uint8_t task = RUNSTATS_TASK_OTHER;
+    if (running) {
+        task = (uint8_t)uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle());
+    }
+
+    // Before the scheduler starts TraceTask drains whatever is there anyway
+    bool wakeDrain;
+    if (traceRecordAt(micros(), task, event, arg0, arg1, &wakeDrain) &&
+        wakeDrain && running && g_traceTaskHandle != NULL) {
+        xTaskNotifyGive(g_traceTaskHandle);
+    }
+}
+
+#endif // !NATIVE_TEST && !TRACE_DISABLED
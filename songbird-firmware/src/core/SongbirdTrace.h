@@ -0,0 +1,261 @@
+/**
+ * @file SongbirdTrace.h
+ * @brief Binary trace log for Songbird
+ *
+ * Tasks record an event ID, a microsecond timestamp, the recording task and
+ * two 32-bit arguments into a lock-free ring; nothing is formatted on the
+ * device. TraceTask, at the lowest priority, drains the ring as 17-byte
+ * frames to the debug UART only when the UART has room, so recording never
+ * blocks and stays enabled in release builds. TraceTask sleeps on a task
+ * notification while the ring is empty; the writer that fills a slot the
+ * drain has caught up with gives it. When the ring is full new records are
+ * dropped and counted, and the drain reports the count as a TRACE_DROPPED
+ * record.
+ *
+ * Building with TRACE_DISABLED turns traceRecord() into a no-op and leaves
+ * TraceTask out.
+ *
+ * The format strings in TRACE_EVENTS are never compiled into the firmware:
+ * scripts/trace_decode.py reads them from this header and turns the frames
+ * back into text. Frames may be interleaved with ordinary text output, which
+ * the decoder passes through.
+ *
+ * Frame (little-endian):
+ *   0xA5 0x5A | event u8 | task u8 | time_us u32 | arg0 u32 | arg1 u32 | sum u8
+ * where sum is the low byte of the sum of the 14 bytes after the sync word.
+ *
+ * Decoder conversions: %u unsigned, %d signed, %x hex, %b boolean,
+ * %h signed hundredths (traceCenti()), %m operating mode.
+ *
+ * The ring and frame encoder are pure so they can be tested on the host;
+ * traceRecord() is excluded from NATIVE_TEST builds.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_TRACE_H
+#define SONGBIRD_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Events
+// =============================================================================
+
+// Event IDs follow the order of this list; decode a capture with the header
+// from the firmware build that produced it.
+#define TRACE_EVENTS(X) \
+    X(TRACE_DROPPED,                "trace: %u records dropped") \
+    /* Notecard */ \
+    X(TRACE_NC_ERROR,               "notecard: request failed (line %u)") \
+    X(TRACE_NC_HUB_SET,             "notecard: hub.set for mode %m, outbound %u min") \
+    X(TRACE_NC_GPS_MODE,            "notecard: GPS periodic %u s (0 = off)") \
+    X(TRACE_NC_TRACKING,            "notecard: location tracking %b") \
+    X(TRACE_NC_TRACK_SENT,          "notecard: track note sent") \
+    X(TRACE_NC_ALERT_SENT,          "notecard: alert note sent, raised 0x%x cleared 0x%x") \
+    X(TRACE_NC_COMMAND,             "notecard: command type %u received") \
+    X(TRACE_NC_GPS_STATUS,          "notecard: GPS active %b, signal %b") \
+    X(TRACE_NC_GPS_OFF,             "notecard: GPS disabled for power saving") \
+    X(TRACE_NC_GPS_ON,              "notecard: GPS re-enabled for transit, periodic %u s") \
+    X(TRACE_NC_SLEEP_FAILED,        "notecard: sleep failed, still running") \
+    X(TRACE_NC_MOJO,                "notecard: Mojo power monitoring %b") \
+    X(TRACE_NC_HEALTH_SENT,         "notecard: health report sent (change %b), CPU %u permille") \
+    /* Note queue */ \
+    X(TRACE_NOTE_OVERFLOW,          "sync: note queue full, spilled %b, older note displaced %b") \
+    X(TRACE_NOTE_RETRY,             "notecard: note type %u not sent, kept for retry %b") \
+    /* Sensors */ \
+    X(TRACE_SENSOR_READING,         "sensor: T=%h C H=%h %%") \
+    X(TRACE_SENSOR_PRESSURE,        "sensor: P=%h hPa") \
+    X(TRACE_SENSOR_ERROR,           "sensor: error (line %u)") \
+    X(TRACE_SENSOR_USB_POWER,       "sensor: USB powered %b") \
+    X(TRACE_SENSOR_POWER_SCALE,     "sensor: power policy interval scale %u%%") \
+    /* Audio and state */ \
+    X(TRACE_AUDIO_QUEUED,           "audio: event %u queued") \
+    X(TRACE_AUDIO_ENABLED,          "audio: enabled %b") \
+    X(TRACE_AUDIO_ALERTS_ONLY,      "audio: alerts only %b") \
+    X(TRACE_AUDIO_VOLUME,           "audio: volume %u") \
+    X(TRACE_AUDIO_LOCATE,           "audio: locate %u s (0 = stop)") \
+    X(TRACE_STATE_LOCK_LED,         "state: lock LED %b") \
+    /* MainTask */ \
+    X(TRACE_MAIN_WAKE,              "main: woke from sleep, ATTN events 0x%x (1 timer, 2 motion, 4 command, 8 env)") \
+    X(TRACE_MAIN_HEALTH,            "main: health report due (change %b)") \
+    X(TRACE_MAIN_MODE_TRACK,        "main: immediate track note for mode %m, queued %b") \
+    X(TRACE_MAIN_CONFIG_UPDATE,     "main: config update, mode %m") \
+    X(TRACE_MAIN_GPS_RESET,         "main: GPS power state reset for mode change") \
+    X(TRACE_MAIN_CLICKS,            "main: button clicks %u") \
+    X(TRACE_MAIN_MUTE,              "main: triple-click, toggling mute") \
+    X(TRACE_MAIN_DEMO_LOCK,         "main: demo lock %b (saved or restored mode %m)") \
+    X(TRACE_MAIN_TRANSIT_LOCK,      "main: transit lock %b (saved or restored mode %m)") \
+    X(TRACE_MAIN_LOCK_REJECTED,     "main: lock rejected, demo locked %b, transit locked %b") \
+    X(TRACE_MAIN_STATUS,            "main: Notecard connected %b, GPS lock %b") \
+    X(TRACE_MAIN_SLEEP_REQUEST,     "main: report cycle complete, requesting sleep") \
+    /* NotecardTask GPS power management */ \
+    X(TRACE_GPS_RETRY,              "gps: retry after %u min, re-enabling") \
+    X(TRACE_GPS_TIMEOUT_START,      "gps: active without signal, timeout started") \
+    X(TRACE_GPS_SIGNAL,             "gps: signal acquired, timeout cleared") \
+    X(TRACE_GPS_TIMEOUT,            "gps: %u min without signal, disabling") \
+    X(TRACE_GPS_INACTIVE,           "gps: inactive, timeout reset") \
+    /* Env vars */ \
+    X(TRACE_ENV_MODE_BLOCKED,       "env: mode change blocked, transit lock %b demo lock %b") \
+    /* Env var changes (old -> new) */ \
+    X(TRACE_ENV_MODE,               "env: mode %m -> %m") \
+    X(TRACE_ENV_GPS_INTERVAL,       "env: gps_interval_min %u -> %u") \
+    X(TRACE_ENV_SYNC_INTERVAL,      "env: sync_interval_min %u -> %u") \
+    X(TRACE_ENV_HEARTBEAT,          "env: heartbeat_hours %u -> %u") \
+    X(TRACE_ENV_TEMP_HIGH,          "env: temp_alert_high_c %h -> %h") \
+    X(TRACE_ENV_TEMP_LOW,           "env: temp_alert_low_c %h -> %h") \
+    X(TRACE_ENV_HUMIDITY_HIGH,      "env: humidity_alert_high %h -> %h") \
+    X(TRACE_ENV_HUMIDITY_LOW,       "env: humidity_alert_low %h -> %h") \
+    X(TRACE_ENV_PRESSURE_DELTA,     "env: pressure_alert_delta %h -> %h") \
+    X(TRACE_ENV_VOLTAGE_LOW,        "env: voltage_alert_low %h -> %h") \
+    X(TRACE_ENV_MOTION_SENSITIVITY, "env: motion_sensitivity %u -> %u") \
+    X(TRACE_ENV_MOTION_WAKE,        "env: motion_wake_enabled %b -> %b") \
+    X(TRACE_ENV_AUDIO_ENABLED,      "env: audio_enabled %b -> %b") \
+    X(TRACE_ENV_AUDIO_VOLUME,       "env: audio_volume %u -> %u") \
+    X(TRACE_ENV_AUDIO_ALERTS_ONLY,  "env: audio_alerts_only %b -> %b") \
+    X(TRACE_ENV_CMD_WAKE,           "env: cmd_wake_enabled %b -> %b") \
+    X(TRACE_ENV_CMD_ACK,            "env: cmd_ack_enabled %b -> %b") \
+    X(TRACE_ENV_LOCATE_DURATION,    "env: locate_duration_sec %u -> %u") \
+    X(TRACE_ENV_LED,                "env: led_enabled %b -> %b") \
+    X(TRACE_ENV_DEBUG,              "env: debug_mode %b -> %b") \
+    X(TRACE_ENV_GPS_POWER_SAVE,     "env: gps_power_save_enabled %b -> %b") \
+    X(TRACE_ENV_GPS_SIGNAL_TIMEOUT, "env: gps_signal_timeout_min %u -> %u") \
+    X(TRACE_ENV_GPS_RETRY,          "env: gps_retry_interval_min %u -> %u") \
+    X(TRACE_ENV_POWER_POLICY,       "env: power_policy_enabled %b -> %b") \
+    X(TRACE_ENV_POWER_FULL_V,       "env: power_policy_full_v %h -> %h") \
+    X(TRACE_ENV_POWER_LOW_V,        "env: power_policy_low_v %h -> %h") \
+    X(TRACE_ENV_POWER_MAX_SCALE,    "env: power_policy_max_scale %u -> %u")
+
+#define TRACE_EVENT_ENUM(name, format) name,
+
+typedef enum {
+    TRACE_EVENTS(TRACE_EVENT_ENUM)
+    TRACE_EVENT_COUNT
+} TraceEvent;
+
+#undef TRACE_EVENT_ENUM
+
+// =============================================================================
+// Ring and Frame Sizes
+// =============================================================================
+
+#define TRACE_RING_SIZE         128     // Records (power of two, 16 bytes each)
+#define TRACE_FRAME_SIZE        17      // Bytes per encoded frame
+#define TRACE_FRAME_SYNC0       0xA5
+#define TRACE_FRAME_SYNC1       0x5A
+#define TRACE_DRAIN_INTERVAL_MS 20      // TraceTask retry period while the UART is full
+#define TRACE_DRAIN_BUFFER_SIZE (TRACE_FRAME_SIZE * 3)  // Fits the 64-byte UART TX buffer
+
+typedef struct {
+    uint16_t tag;       // Commit marker: low 16 bits of (ring index + 1)
+    uint8_t event;      // TraceEvent
+    uint8_t task;       // RunStatsTask slot of the recording task
+    uint32_t timeUs;    // micros() when recorded
+    uint32_t arg0;
+    uint32_t arg1;
+} TraceRecord;
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+/**
+ * @brief Clear the ring and the drop count
+ *
+ * Called once at boot, before any task runs.
+ */
+void traceInit(void);
+
+/**
+ * @brief Record an event with an explicit timestamp and task
+ *
+ * Lock-free and safe from any task or interrupt. Never blocks.
+ *
+ * @param timeUs Timestamp in microseconds
+ * @param task RunStatsTask slot of the caller
+ * @param event Event ID
+ * @param arg0 First argument
+ * @param arg1 Second argument
+ * @param wakeDrain Output: true if the drain had caught up with this slot
+ *                  and may be waiting for it (may be NULL)
+ * @return false if the ring was full and the record was dropped
+ */
+bool traceRecordAt(uint32_t timeUs, uint8_t task, TraceEvent event,
+                   uint32_t arg0, uint32_t arg1, bool* wakeDrain);
+
+#if defined(TRACE_DISABLED)
+static inline void traceRecord(TraceEvent event, uint32_t arg0, uint32_t arg1) {
+    (void)event; (void)arg0; (void)arg1;
+}
+#elif !defined(NATIVE_TEST)
+/**
+ * @brief Record an event stamped with micros() and the calling task
+ *
+ * Wakes TraceTask if it was waiting for the ring to fill. Task context
+ * (or before the scheduler starts) only.
+ *
+ * @param event Event ID
+ * @param arg0 First argument
+ * @param arg1 Second argument
+ */
+void traceRecord(TraceEvent event, uint32_t arg0, uint32_t arg1);
+#endif
+
+/**
+ * @brief Convert a value to signed hundredths for a %h argument
+ *
+ * @param value Value to record
+ * @return Hundredths, as the raw 32-bit argument
+ */
+static inline uint32_t traceCenti(float value) {
+    return (uint32_t)(int32_t)(value * 100.0f + (value < 0 ? -0.5f : 0.5f));
+}
+
+/**
+ * @brief Get the number of records dropped since boot
+ *
+ * @return Records dropped because the ring was full
+ */
+uint32_t traceGetDropped(void);
+
+// =============================================================================
+// Draining (single consumer)
+// =============================================================================
+
+/**
+ * @brief Encode committed records as frames
+ *
+ * Stops at the first record still being written, or when the next frame
+ * would not fit. A TRACE_DROPPED frame is emitted first when records have
+ * been dropped since the last one. Only TraceTask may call this.
+ *
+ * @param buffer Output buffer
+ * @param size Buffer size in bytes
+ * @return Bytes written (a multiple of TRACE_FRAME_SIZE)
+ */
+size_t traceDrain(uint8_t* buffer, size_t size);
+
+/**
+ * @brief Check whether the next drain has anything to write
+ *
+ * TraceTask calls this after a drain that ended the ring, and waits for a
+ * notification only if it returns false. A writer that commits after this
+ * check sees the drain caught up and gives the notification.
+ *
+ * @return true if a committed record or a drop report is waiting
+ */
+bool tracePending(void);
+
+/**
+ * @brief Encode one record as a frame
+ *
+ * @param record Record to encode
+ * @param frame Output, TRACE_FRAME_SIZE bytes
+ */
+void traceEncodeFrame(const TraceRecord* record, uint8_t* frame);
+
+#endif // SONGBIRD_TRACE_H
@@ -21,7 +21,7 @@
  * - Passive piezo buzzer on PA8
  *
  * Architecture:
- * - FreeRTOS with 6 tasks
+ * - FreeRTOS with 7 tasks
  * - Queue-based inter-task communication
  * - Mutex-protected I2C and configuration access
  *
@@ -36,6 +36,7 @@
 // Songbird modules
 #include "SongbirdConfig.h"
 #include "SongbirdPower.h"
+#include "SongbirdPowerPolicy.h"
 
 // =============================================================================
 // Serial Configuration (STLink VCP)
@@ -53,12 +54,19 @@ HardwareSerial serialDebug(PIN_VCP_RX, PIN_VCP_TX);
 #include "SongbirdCommands.h"
 #include "SongbirdState.h"
 #include "SongbirdTasks.h"
+#include "SongbirdMetrics.h"
+#include "SongbirdTrace.h"
+#include "SongbirdProfile.h"
+#include "SongbirdBootProfile.h"
+#include "SongbirdTranscript.h"
 
 // =============================================================================
 // Setup
 // =============================================================================
 
 void setup() {
+    bootProfileMark(BOOT_STAGE_CORE);
+
     // Initialize serial for debugging via STLink VCP
     DEBUG_SERIAL.begin(SERIAL_BAUD);
 
@@ -84,6 +92,15 @@ void setup() {
     pinMode(LED_PIN, OUTPUT);
     digitalWrite(LED_PIN, HIGH);  // LED on during init
 
+    // Metrics count, the trace log records and profiling scopes time from
+    // here; modules below record into them
+    metricsInit();
+    traceInit();
+    profileInit();
+    #ifdef TRANSCRIPT_MODE
+    transcriptInit();
+    #endif
+
     // Initialize power monitoring FIRST:
     //   - Reads and clears RCC->CSR reset flags (must happen before anything else clears them)
     //   - Enables PVD early-warning interrupt (~2.9V threshold)
@@ -103,6 +120,7 @@ void setup() {
 
     // Small delay to allow I2C peripherals to stabilize after power-on
     delay(50);
+    bootProfileMark(BOOT_STAGE_I2C);
 
     // Initialize audio system with retry (before RTOS)
     if (!audioInit()) {
@@ -111,6 +129,7 @@ void setup() {
         audioInit();  // Second attempt
     }
     DEBUG_SERIAL.println("[Init] Audio initialized");
+    bootProfileMark(BOOT_STAGE_AUDIO);
 
     // Initialize sensors with retry (before RTOS)
     if (!sensorsInit()) {
@@ -119,6 +138,7 @@ void setup() {
         sensorsInit();  // Second attempt
     }
     DEBUG_SERIAL.println("[Init] Sensors initialized");
+    bootProfileMark(BOOT_STAGE_SENSORS);
 
     // Switch to fast mode now that peripherals are initialized
     Wire.setClock(400000);  // 400kHz for normal operation
@@ -133,6 +153,7 @@ void setup() {
     } else {
         DEBUG_SERIAL.println("[Init] Notecard initialized");
     }
+    bootProfileMark(BOOT_STAGE_NOTECARD);
 
     // Attempt to restore persistent state so boot-loop counter is available.
     // This is a lightweight pre-check; MainTask will do a full restore later.
@@ -140,7 +161,17 @@ void setup() {
     bool preRestored = stateRestore();
     if (!preRestored) {
         stateInit();
+    } else {
+        bootProfileFlag(BOOT_FLAG_WARM);
+        // Resume at the scale the Notecard's hub.set already carries
+        powerPolicyRestore(stateGetAppliedSyncScale());
+
+        // Nor is card.location.mode sent again: poll GPS only if it is on
+        GpsPowerState gps;
+        stateGetGpsPower(&gps);
+        notecardRestoreGpsEnabled(gpsPowerIsEnabled(&gps, stateGet()->currentMode));
     }
+    bootProfileMark(BOOT_STAGE_STATE);
 
     // Record boot timestamp and update boot cause in state
     stateRecordBootTimestamp();
@@ -150,6 +181,7 @@ void setup() {
     // If triggered, this blocks for BOOT_LOOP_HOLD_SEC to allow battery recovery.
     bool bootLoopDetected = powerCheckAndHandleBootLoop();
     (void)bootLoopDetected;  // handled internally; flag is informational
+    bootProfileMark(BOOT_STAGE_BOOT_LOOP);
 
     DEBUG_SERIAL.print("[Init] Boot cause: ");
     DEBUG_SERIAL.println(powerGetBootCauseString());
@@ -183,6 +215,19 @@ void setup() {
     }
     DEBUG_SERIAL.println("[Init] Sync primitives initialized");
 
+    // Requeue notes spilled to Notecard flash by the last PVD shutdown.
+    // NotecardTask sends them once the live queue is empty.
+    {
+        uint8_t spill[NOTE_SPILL_SIZE];
+        size_t spillLength = notecardLoadNoteSpill(spill, sizeof(spill));
+        if (spillLength > 0) {
+            uint16_t restored = syncImportSpill(spill, spillLength);
+            DEBUG_SERIAL.print("[Init] Restored spilled notes: ");
+            DEBUG_SERIAL.println(restored);
+        }
+    }
+    bootProfileMark(BOOT_STAGE_SYNC);
+
     // Create FreeRTOS tasks
     if (!tasksCreate()) {
         DEBUG_SERIAL.println("[Init] ERROR: Task creation failed!");
@@ -199,6 +244,7 @@ void setup() {
 
     DEBUG_SERIAL.println("[Init] Starting FreeRTOS scheduler...");
     DEBUG_SERIAL.println();
+    bootProfileMark(BOOT_STAGE_TASKS);
 
     // Start FreeRTOS scheduler
     // This function does not return
@@ -0,0 +1,115 @@
+/**
+ * @file SongbirdCadence.cpp
+ * @brief Notecard sync and GPS cadence implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdCadence.h"
+#include "SongbirdPowerPolicy.h"
+#include <string.h>
+
+// =============================================================================
+// Cadence Calculation
+// =============================================================================
+
+void cadenceCompute(const SongbirdConfig* config, NotecardCadence* cadence) {
+    if (cadence == NULL) {
+        return;
+    }
+
+    memset(cadence, 0, sizeof(NotecardCadence));
+    cadence->scalePct = powerPolicyGetScalePercent();
+
+    OperatingMode mode = config ? config->mode : DEFAULT_MODE;
+    uint32_t syncMin = config ? config->syncIntervalMin : DEFAULT_SYNC_INTERVAL_MIN;
+    uint32_t gpsMin = config ? config->gpsIntervalMin : DEFAULT_GPS_INTERVAL_MIN;
+
+    switch (mode) {
+        case MODE_DEMO:
+            // Notes sync as they are added; sync_interval_min does not apply
+            cadence->hubMode = "continuous";
+            cadence->hubSync = true;
+            cadence->outboundMin = powerPolicyScaleInterval(DEMO_OUTBOUND_MIN);
+            cadence->inboundMin = DEMO_INBOUND_MIN;
+            cadence->durationMin = DEMO_CONTINUOUS_DURATION_MIN;
+            break;
+        case MODE_TRANSIT:
+            cadence->hubMode = "periodic";
+            cadence->outboundMin = powerPolicyScaleInterval(syncMin);
+            cadence->inboundMin = powerPolicyScaleInterval(syncMin);
+            // GPS on for track resolution; triangulation covers the other modes
+            cadence->gpsSeconds = gpsMin * 60;
+            break;
+        case MODE_STORAGE:
+            if (syncMin < STORAGE_SYNC_FLOOR_MIN) {
+                syncMin = STORAGE_SYNC_FLOOR_MIN;
+            }
+            cadence->hubMode = "periodic";
+            cadence->outboundMin = powerPolicyScaleInterval(syncMin);
+            cadence->inboundMin = powerPolicyScaleInterval(syncMin);
+            break;
+        case MODE_SLEEP:
+        default:
+            cadence->hubMode = "minimum";
+            break;
+    }
+}
+
+bool cadenceHubChanged(const NotecardCadence* a, const NotecardCadence* b) {
+    if (a == NULL || b == NULL) {
+        return true;
+    }
+
+    return strcmp(a->hubMode, b->hubMode) != 0 ||
+           a->hubSync != b->hubSync ||
+           a->outboundMin != b->outboundMin ||
+           a->inboundMin != b->inboundMin ||
+           a->durationMin != b->durationMin;
+}
+
+bool cadenceGpsChanged(const NotecardCadence* a, const NotecardCadence* b) {
+    if (a == NULL || b == NULL) {
+        return true;
+    }
+
+    return a->gpsSeconds != b->gpsSeconds;
+}
+
+// =============================================================================
+// Request Parameters
+// =============================================================================
+
+void cadenceAddHubSet(J* req, const NotecardCadence* cadence) {
+    if (req == NULL || cadence == NULL) {
+        return;
+    }
+
+    JAddStringToObject(req, "mode", cadence->hubMode);
+    if (cadence->hubSync) {
+        JAddBoolToObject(req, "sync", true);
+    }
+    if (cadence->outboundMin > 0) {
+        JAddNumberToObject(req, "outbound", cadence->outboundMin);
+    }
+    if (cadence->inboundMin > 0) {
+        JAddNumberToObject(req, "inbound", cadence->inboundMin);
+    }
+    if (cadence->durationMin > 0) {
+        JAddNumberToObject(req, "duration", cadence->durationMin);
+    }
+}
+
+void cadenceAddLocationMode(J* req, const NotecardCadence* cadence) {
+    if (req == NULL || cadence == NULL) {
+        return;
+    }
+
+    if (cadence->gpsSeconds > 0) {
+        JAddStringToObject(req, "mode", "periodic");
+        JAddNumberToObject(req, "seconds", cadence->gpsSeconds);
+    } else {
+        JAddStringToObject(req, "mode", "off");
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file SongbirdCadence.h
+ * @brief Notecard sync and GPS cadence for Songbird
+ *
+ * Derives the hub.set and card.location.mode parameters from the effective
+ * configuration: the operating mode picks the connection mode, and the
+ * sync_interval_min and gps_interval_min env vars set the radio and GPS duty
+ * cycle. Sync intervals are stretched by the battery-aware power policy.
+ *
+ * Pure logic (no Notecard I/O); SongbirdNotecard sends the requests, and the
+ * native tests fill requests against a J stand-in.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_CADENCE_H
+#define SONGBIRD_CADENCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <Notecard.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Cadence Calculation
+// =============================================================================
+
+/**
+ * @brief Compute the Notecard cadence for a configuration
+ *
+ * Applies the power policy scale currently in effect to the sync intervals.
+ *
+ * @param config Effective configuration (mode and intervals)
+ * @param cadence Output
+ */
+void cadenceCompute(const SongbirdConfig* config, NotecardCadence* cadence);
+
+/**
+ * @brief Check whether two cadences need different hub.set requests
+ */
+bool cadenceHubChanged(const NotecardCadence* a, const NotecardCadence* b);
+
+/**
+ * @brief Check whether two cadences need different card.location.mode requests
+ */
+bool cadenceGpsChanged(const NotecardCadence* a, const NotecardCadence* b);
+
+// =============================================================================
+// Request Parameters
+// =============================================================================
+
+/**
+ * @brief Add the cadence fields to a hub.set request
+ *
+ * @param req hub.set request
+ * @param cadence Cadence to apply
+ */
+void cadenceAddHubSet(J* req, const NotecardCadence* cadence);
+
+/**
+ * @brief Add the cadence fields to a card.location.mode request
+ *
+ * @param req card.location.mode request
+ * @param cadence Cadence to apply
+ */
+void cadenceAddLocationMode(J* req, const NotecardCadence* cadence);
+
+#endif // SONGBIRD_CADENCE_H
@@ -8,8 +8,18 @@
 
 #include "SongbirdNotecard.h"
 #include "SongbirdState.h"
+#include "SongbirdPowerPolicy.h"
+#include "SongbirdCadence.h"
+#include "SongbirdMetrics.h"
+#include "SongbirdRunStats.h"
+#include "SongbirdTrace.h"
+#include "SongbirdProfile.h"
+#include "SongbirdBootProfile.h"
+#include "SongbirdLatency.h"
+#include "SongbirdTranscript.h"
 #include <Wire.h>
 #include <STM32FreeRTOS.h>
+#include <math.h>
 
 // =============================================================================
 // Module State
@@ -17,14 +27,70 @@
 
 static Notecard s_notecard;
 static bool s_initialized = false;
-static uint32_t s_errorCount = 0;
 static uint32_t s_lastEnvModCount = 0;
 
+// Status snapshot published to other tasks (see notecardRefreshStatus)
+static NotecardStatus s_status;
+
+// Wake reason (ATTN_EVENT_*) latched by notecardGetSleepPayload() at boot
+static uint8_t s_wakeEvents = 0;
+
+// Base64 scratch for the sleep payload and note spill (kept off the task
+// stacks; both are only used with the I2C mutex held)
+#define NOTECARD_PAYLOAD_MAX \
+    (NOTECARD_SLEEP_PAYLOAD_MAX > NOTE_SPILL_SIZE ? NOTECARD_SLEEP_PAYLOAD_MAX : NOTE_SPILL_SIZE)
+static char s_payloadB64[((NOTECARD_PAYLOAD_MAX + 2) / 3) * 4 + 1];
+
+// health.qo field suffixes per NotePriority class
+static const char* const HEALTH_NOTE_CLASSES[NOTE_PRIORITY_COUNT] = {
+    "alert",
+    "ack",
+    "track",
+    "health"
+};
+
 // =============================================================================
 // Helper Macros
 // =============================================================================
 
-#define NC_ERROR() do { s_errorCount++; } while(0)
+// Count the failure and trace the request that failed
+#define NC_ERROR() do { \
+    metricsIncrement(METRIC_NOTECARD_ERRORS); \
+    traceRecord(TRACE_NC_ERROR, __LINE__, 0); \
+} while (0)
+
+// =============================================================================
+// Transactions
+// =============================================================================
+
+/**
+ * @brief Send a request and wait for the response
+ *
+ * Every request goes through here. With TRANSCRIPT_MODE the request and
+ * response JSON and the latency are recorded for the "transcript" command;
+ * serializing them costs two short-lived note-c heap allocations each.
+ *
+ * @param req Request (consumed)
+ * @return Response, or NULL if the Notecard did not respond
+ */
+static J* ncTransaction(J* req) {
+    #ifdef TRANSCRIPT_MODE
+    char* reqJson = JPrintUnformatted(req);
+    uint32_t atMs = millis();
+    uint32_t startUs = micros();
+
+    J* rsp = s_notecard.requestAndResponse(req);
+
+    uint32_t latencyUs = micros() - startUs;
+    char* rspJson = (rsp != NULL) ? JPrintUnformatted(rsp) : NULL;
+    transcriptRecord(atMs, latencyUs, reqJson, rspJson);
+    if (reqJson != NULL) JFree(reqJson);
+    if (rspJson != NULL) JFree(rspJson);
+    return rsp;
+    #else
+    return s_notecard.requestAndResponse(req);
+    #endif
+}
 
 // =============================================================================
 // Initialization
@@ -35,7 +101,7 @@ bool notecardInit(void) {
 
     // Verify Notecard is responding
     J* req = s_notecard.newRequest("card.version");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
     if (rsp == NULL) {
         #ifdef DEBUG_MODE
@@ -62,7 +128,12 @@ bool notecardInit(void) {
 
     s_notecard.deleteResponse(rsp);
     s_initialized = true;
-    s_errorCount = 0;
+    metricsReset(METRIC_NOTECARD_ERRORS);
+
+    // GPS mode is unknown until notecardConfigureGPS() runs on a cold boot,
+    // so keep polling card.location until it says otherwise. A warm boot
+    // restores it from the persisted state (notecardRestoreGpsEnabled).
+    s_status.gpsEnabled = true;
 
     return true;
 }
@@ -79,54 +150,17 @@ Notecard* notecardGetInstance(void) {
 // Configuration
 // =============================================================================
 
-bool notecardConfigure(OperatingMode mode) {
-    if (!s_initialized) {
+bool notecardConfigure(const SongbirdConfig* config) {
+    if (!s_initialized || config == NULL) {
         return false;
     }
 
-    // Configure hub.set
-    J* req = s_notecard.newRequest("hub.set");
-    JAddStringToObject(req, "product", PRODUCT_UID);
+    OperatingMode mode = config->mode;
 
-    // Set mode based on operating mode
-    switch (mode) {
-        case MODE_DEMO:
-            JAddStringToObject(req, "mode", "continuous");
-            JAddBoolToObject(req, "sync", true);  // Immediate sync
-            JAddNumberToObject(req, "outbound", 1);  // 1 minute
-            JAddNumberToObject(req, "inbound", 1440);  // 24 hours (sync:true handles immediate)
-            JAddNumberToObject(req, "duration", 15);
-            break;
-        case MODE_TRANSIT:
-            JAddStringToObject(req, "mode", "periodic");
-            JAddNumberToObject(req, "outbound", 10);  // 10 minutes
-            JAddNumberToObject(req, "inbound", DEFAULT_SYNC_INTERVAL_MIN);
-            break;
-        case MODE_STORAGE:
-            JAddStringToObject(req, "mode", "periodic");
-            JAddNumberToObject(req, "outbound", 60);
-            JAddNumberToObject(req, "inbound", 60);
-            break;
-        case MODE_SLEEP:
-            JAddStringToObject(req, "mode", "minimum");
-            break;
-    }
-
-    J* rsp = s_notecard.requestAndResponse(req);
-    if (rsp == NULL || s_notecard.responseError(rsp)) {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[Notecard] hub.set failed");
-        #endif
-        if (rsp) s_notecard.deleteResponse(rsp);
-        NC_ERROR();
+    // Configure hub.set
+    if (!notecardConfigureHub(config)) {
         return false;
     }
-    s_notecard.deleteResponse(rsp);
-
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] Configured for mode ");
-    DEBUG_SERIAL.println(mode);
-    #endif
 
     // Configure Mojo power monitoring (periodic readings)
     // Mojo is automatically detected if connected before Notecard power-on
@@ -168,7 +202,7 @@ bool notecardConfigure(OperatingMode mode) {
     }
 
     // Configure GPS mode based on operating mode
-    if (!notecardConfigureGPS(mode)) {
+    if (!notecardConfigureGPS(config)) {
         #ifdef DEBUG_MODE
         DEBUG_SERIAL.println("[Notecard] Warning: GPS configuration failed");
         #endif
@@ -186,6 +220,35 @@ bool notecardConfigure(OperatingMode mode) {
     return true;
 }
 
+bool notecardConfigureHub(const SongbirdConfig* config) {
+    if (!s_initialized || config == NULL) {
+        return false;
+    }
+
+    NotecardCadence cadence;
+    cadenceCompute(config, &cadence);
+
+    J* req = s_notecard.newRequest("hub.set");
+    JAddStringToObject(req, "product", PRODUCT_UID);
+    cadenceAddHubSet(req, &cadence);
+
+    J* rsp = ncTransaction(req);
+    if (rsp == NULL || s_notecard.responseError(rsp)) {
+        if (rsp) s_notecard.deleteResponse(rsp);
+        NC_ERROR();
+        return false;
+    }
+    s_notecard.deleteResponse(rsp);
+
+    // The Notecard keeps hub.set across host sleep, so remember which power
+    // policy step it now carries alongside the rest of the persisted state
+    stateSetAppliedSyncScale(cadence.scalePct);
+
+    traceRecord(TRACE_NC_HUB_SET, config->mode, cadence.outboundMin);
+
+    return true;
+}
+
 bool notecardSetupTemplates(void) {
     if (!s_initialized) {
         return false;
@@ -209,9 +272,11 @@ bool notecardSetupTemplates(void) {
         JAddStringToObject(body, "mode", "xxxxxxxxxxxx");  // 12 char max
         JAddBoolToObject(body, "transit_locked", TBOOL);
         JAddBoolToObject(body, "demo_locked", TBOOL);
+        JAddNumberToObject(body, "boot_flags", TUINT8);
+        JAddNumberToObject(body, "boot_total_ms", TUINT32);
         JAddItemToObject(req, "body", body);
 
-        J* rsp = s_notecard.requestAndResponse(req);
+        J* rsp = ncTransaction(req);
         if (rsp == NULL || s_notecard.responseError(rsp)) {
             #ifdef DEBUG_MODE
             DEBUG_SERIAL.print("[Notecard] track.qo template failed: ");
@@ -236,15 +301,24 @@ bool notecardSetupTemplates(void) {
         JAddNumberToObject(req, "port", 11);
 
         J* body = JCreateObject();
-        JAddStringToObject(body, "type", "xxxxxxxxxxxxxxxx");  // 16 char max
-        JAddNumberToObject(body, "value", TFLOAT32);
-        JAddNumberToObject(body, "threshold", TFLOAT32);
+        JAddNumberToObject(body, "raised", TUINT8);
+        JAddNumberToObject(body, "cleared", TUINT8);
+        JAddNumberToObject(body, "temp", TFLOAT32);
+        JAddNumberToObject(body, "humidity", TFLOAT32);
+        JAddNumberToObject(body, "pressure", TFLOAT32);
+        JAddNumberToObject(body, "voltage", TFLOAT32);
+        JAddNumberToObject(body, "temp_rate", TFLOAT32);
+        JAddNumberToObject(body, "pressure_delta", TFLOAT32);
+        JAddNumberToObject(body, "temp_th", TFLOAT32);
+        JAddNumberToObject(body, "humidity_th", TFLOAT32);
+        JAddNumberToObject(body, "pressure_delta_th", TFLOAT32);
+        JAddNumberToObject(body, "voltage_th", TFLOAT32);
+        JAddNumberToObject(body, "temp_rate_th", TFLOAT32);
+        JAddNumberToObject(body, "latency_ms", TUINT32);
         JAddNumberToObject(body, "_time", TINT32);
-        // 64 char placeholder for message
-        JAddStringToObject(body, "message", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
         JAddItemToObject(req, "body", body);
 
-        J* rsp = s_notecard.requestAndResponse(req);
+        J* rsp = ncTransaction(req);
         if (rsp == NULL || s_notecard.responseError(rsp)) {
             #ifdef DEBUG_MODE
             DEBUG_SERIAL.print("[Notecard] alert.qo template failed: ");
@@ -278,7 +352,7 @@ bool notecardSetupTemplates(void) {
         JAddNumberToObject(body, "_time", TINT32);
         JAddItemToObject(req, "body", body);
 
-        J* rsp = s_notecard.requestAndResponse(req);
+        J* rsp = ncTransaction(req);
         if (rsp == NULL || s_notecard.responseError(rsp)) {
             #ifdef DEBUG_MODE
             DEBUG_SERIAL.print("[Notecard] command_ack.qo template failed: ");
@@ -295,6 +369,86 @@ bool notecardSetupTemplates(void) {
         if (rsp) s_notecard.deleteResponse(rsp);
     }
 
+    // Template for health.qo (arrays are flattened into one field per entry)
+    {
+        J* req = s_notecard.newRequest("note.template");
+        JAddStringToObject(req, "file", NOTEFILE_HEALTH);
+        JAddStringToObject(req, "format", "compact");
+        JAddNumberToObject(req, "port", 13);
+
+        J* body = JCreateObject();
+        JAddStringToObject(body, "firmware", "xxxxxxxxxxxxxxx");   // 15 char max
+        JAddStringToObject(body, "trigger", "xxxxxxxxx");          // 9 char max
+        JAddNumberToObject(body, "uptime_sec", TUINT32);
+        JAddNumberToObject(body, "boot_count", TUINT32);
+        JAddNumberToObject(body, "last_gps_fix_sec", TUINT32);
+        JAddNumberToObject(body, "sensor_errors", TUINT32);
+        JAddNumberToObject(body, "notecard_errors", TUINT32);
+        JAddNumberToObject(body, "i2c_timeouts", TUINT32);
+        JAddNumberToObject(body, "notes_sent", TUINT32);
+        JAddNumberToObject(body, "notes_lost", TUINT32);
+        for (uint8_t i = 0; i < NOTE_PRIORITY_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "lost_%s", HEALTH_NOTE_CLASSES[i]);
+            JAddNumberToObject(body, field, TUINT32);
+        }
+        JAddNumberToObject(body, "peak_queue", TUINT8);
+        JAddNumberToObject(body, "peak_spill", TUINT16);
+        JAddNumberToObject(body, "peak_audio", TUINT8);
+        JAddNumberToObject(body, "heap_min", TUINT32);
+        JAddNumberToObject(body, "window_sec", TUINT32);
+        JAddNumberToObject(body, "cpu_pm", TUINT16);
+        for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "load_%s", runStatsTaskName((RunStatsTask)i));
+            JAddNumberToObject(body, field, TUINT16);
+            snprintf(field, sizeof(field), "wakes_%s", runStatsTaskName((RunStatsTask)i));
+            JAddNumberToObject(body, field, TUINT32);
+            snprintf(field, sizeof(field), "stack_free_%s", runStatsTaskName((RunStatsTask)i));
+            JAddNumberToObject(body, field, TUINT16);
+        }
+        JAddNumberToObject(body, "i2c_acq", TUINT32);
+        JAddNumberToObject(body, "i2c_wait_ms", TUINT32);
+        JAddNumberToObject(body, "i2c_wait_max_ms", TUINT32);
+        // Boot profile (first report of each boot)
+        JAddNumberToObject(body, "boot_flags", TUINT8);
+        for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "boot_%s_ms", bootStageName((BootStage)i));
+            JAddNumberToObject(body, field, TUINT16);
+        }
+        JAddNumberToObject(body, "boot_total_ms", TUINT32);
+        JAddNumberToObject(body, "boot_prev_max_ms", TUINT32);
+        JAddNumberToObject(body, "alerts_timed", TUINT16);
+        for (uint8_t i = 0; i < LATENCY_STAGE_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "alert_%s_p50_ms", latencyStageName((LatencyStage)i));
+            JAddNumberToObject(body, field, TUINT16);
+            snprintf(field, sizeof(field), "alert_%s_p99_ms", latencyStageName((LatencyStage)i));
+            JAddNumberToObject(body, field, TUINT16);
+        }
+        // Shutdown note (notecardSendShutdownNote)
+        JAddStringToObject(body, "shutdown", "xxxxxxxxxxxxxxx");   // 15 char max
+        JAddNumberToObject(body, "voltage", TFLOAT32);
+        JAddItemToObject(req, "body", body);
+
+        J* rsp = ncTransaction(req);
+        if (rsp == NULL || s_notecard.responseError(rsp)) {
+            #ifdef DEBUG_MODE
+            DEBUG_SERIAL.print("[Notecard] health.qo template failed: ");
+            if (rsp) {
+                const char* err = JGetString(rsp, "err");
+                DEBUG_SERIAL.println(err ? err : "unknown error");
+            } else {
+                DEBUG_SERIAL.println("no response");
+            }
+            #endif
+            success = false;
+            NC_ERROR();
+        }
+        if (rsp) s_notecard.deleteResponse(rsp);
+    }
+
     #ifdef DEBUG_MODE
     DEBUG_SERIAL.println(success ? "[Notecard] Templates configured" : "[Notecard] Template setup failed");
     #endif
@@ -312,27 +466,42 @@ bool notecardIsConnected(void) {
     }
 
     J* req = s_notecard.newRequest("hub.status");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
     if (rsp == NULL) {
         NC_ERROR();
         return false;
     }
 
-    bool connected = JGetBool(rsp, "connected");
+    bool connected = notecardParseConnected(rsp);
     s_notecard.deleteResponse(rsp);
 
+    // Every hub.status result feeds the published snapshot
+    taskENTER_CRITICAL();
+    s_status.connected = connected;
+    s_status.connectedAtMs = millis();
+    taskEXIT_CRITICAL();
+
     return connected;
 }
 
 bool notecardWaitConnection(uint32_t timeoutMs) {
     uint32_t start = millis();
+    uint32_t backoffMs = CONNECT_POLL_MIN_MS;
 
     while ((millis() - start) < timeoutMs) {
         if (notecardIsConnected()) {
             return true;
         }
-        vTaskDelay(pdMS_TO_TICKS(1000));
+
+        // Registration usually takes tens of seconds; back off rather than
+        // hammering hub.status once a second, but never past the deadline
+        uint32_t elapsed = millis() - start;
+        if (elapsed >= timeoutMs) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(MIN(backoffMs, timeoutMs - elapsed)));
+        backoffMs = MIN(backoffMs * 2, (uint32_t)CONNECT_POLL_MAX_MS);
     }
 
     return false;
@@ -344,7 +513,7 @@ bool notecardSync(void) {
     }
 
     J* req = s_notecard.newRequest("hub.sync");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
@@ -356,35 +525,117 @@ bool notecardSync(void) {
     return true;
 }
 
+/**
+ * @brief Issue hub.sync.status
+ *
+ * @param lastSyncTime Output: completion time of the last sync (0 = none yet)
+ * @return true if a sync is requested or in progress
+ */
+static bool querySyncStatus(uint32_t* lastSyncTime) {
+    J* req = s_notecard.newRequest("hub.sync.status");
+    J* rsp = ncTransaction(req);
+
+    if (rsp == NULL) {
+        return false;
+    }
+
+    bool syncing = notecardParseSyncStatus(rsp, lastSyncTime);
+    s_notecard.deleteResponse(rsp);
+    return syncing;
+}
+
 bool notecardIsSyncing(void) {
     if (!s_initialized) {
         return false;
     }
 
-    J* req = s_notecard.newRequest("hub.sync.status");
-    J* rsp = s_notecard.requestAndResponse(req);
+    return querySyncStatus(NULL);
+}
 
-    if (rsp == NULL) {
+// =============================================================================
+// Status Snapshot
+// =============================================================================
+
+bool notecardRefreshStatus(bool wantSync, bool wantConnection) {
+    if (!s_initialized) {
         return false;
     }
 
-    // Check if sync is requested or in progress
-    const char* status = JGetString(rsp, "status");
-    bool syncing = (status != NULL && strlen(status) > 0);
+    bool ok = true;
 
-    s_notecard.deleteResponse(rsp);
-    return syncing;
+    // Start from the current snapshot so fields not refreshed keep their value
+    NotecardStatus next;
+    notecardGetStatus(&next);
+
+    // card.location only while GPS is on - it is pure overhead when "off"
+    next.gpsValid = false;
+    next.gpsLock = false;
+    next.gpsActive = false;
+    next.gpsSignal = false;
+    if (next.gpsEnabled) {
+        next.gpsValid = notecardGetGPSStatus(&next.gpsLock, &next.lat, &next.lon,
+                                             &next.gpsTime, &next.gpsActive,
+                                             &next.gpsSignal);
+        ok = ok && next.gpsValid;
+    }
+
+    if (wantSync) {
+        next.syncing = querySyncStatus(&next.lastSyncTime);
+    }
+
+    if (wantConnection) {
+        // notecardIsConnected() publishes straight into s_status
+        next.connected = notecardIsConnected();
+        next.connectedAtMs = millis();
+    }
+
+    next.updatedAtMs = millis();
+
+    taskENTER_CRITICAL();
+    next.gpsEnabled = s_status.gpsEnabled;  // May have changed during the requests
+    s_status = next;
+    taskEXIT_CRITICAL();
+
+    return ok;
+}
+
+void notecardGetStatus(NotecardStatus* status) {
+    if (status == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    *status = s_status;
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Record the card.location.mode last applied to the Notecard
+ */
+static void setGpsEnabled(bool enabled) {
+    taskENTER_CRITICAL();
+    s_status.gpsEnabled = enabled;
+    if (!enabled) {
+        s_status.gpsValid = false;
+    }
+    taskEXIT_CRITICAL();
+}
+
+void notecardRestoreGpsEnabled(bool enabled) {
+    setGpsEnabled(enabled);
 }
 
 // =============================================================================
 // Note Operations
 // =============================================================================
 
-bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forceSync) {
+bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forceSync,
+                           bool bootRecord) {
     if (!s_initialized || data == NULL) {
         return false;
     }
 
+    PROFILE_SCOPE(PROFILE_NC_SEND_TRACK);
+
     J* req = s_notecard.newRequest("note.add");
     JAddStringToObject(req, "file", NOTEFILE_TRACK);
     // Immediate sync in demo mode or when forced (e.g., mode changes)
@@ -394,6 +645,10 @@ bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forc
     JAddNumberToObject(body, "temp", data->temperature);
     JAddNumberToObject(body, "humidity", data->humidity);
     JAddNumberToObject(body, "pressure", data->pressure);
+    // Time of the reading, which may be older than the note (spill replay)
+    if (data->timestamp != 0) {
+        JAddNumberToObject(body, "_time", data->timestamp);
+    }
     JAddBoolToObject(body, "motion", data->motion);
 
     const char* modeStr = "unknown";
@@ -413,9 +668,19 @@ bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forc
     if (stateIsGpsPowerSaving()) {
         JAddBoolToObject(body, "gps_power_saving", true);
     }
+    // Compact boot profile, so every wake reports how long it took even when
+    // no health.qo is due
+    if (bootRecord) {
+        const BootProfile* boot = bootProfileGet();
+        JAddNumberToObject(body, "boot_flags", boot->flags);
+        uint32_t totalMs;
+        if (bootProfileElapsedMs(boot, BOOT_STAGE_FIRST_NOTE, &totalMs)) {
+            JAddNumberToObject(body, "boot_total_ms", totalMs);
+        }
+    }
     JAddItemToObject(req, "body", body);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -424,30 +689,62 @@ bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forc
 
     s_notecard.deleteResponse(rsp);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Notecard] Track note sent");
-    #endif
+    traceRecord(TRACE_NC_TRACK_SENT, 0, 0);
 
     return true;
 }
 
-bool notecardSendAlertNote(const Alert* alert) {
+bool notecardSendAlertNote(const AlertNote* alert, bool sync, uint32_t latencyMs) {
     if (!s_initialized || alert == NULL) {
         return false;
     }
 
     J* req = s_notecard.newRequest("note.add");
     JAddStringToObject(req, "file", NOTEFILE_ALERT);
-    JAddBoolToObject(req, "sync", true);  // Always sync alerts immediately
+    if (sync) {
+        JAddBoolToObject(req, "sync", true);
+    }
 
     J* body = JCreateObject();
-    JAddStringToObject(body, "type", alert->type);
-    JAddNumberToObject(body, "value", alert->value);
-    JAddNumberToObject(body, "threshold", alert->threshold);
-    JAddStringToObject(body, "message", alert->message);
+    JAddNumberToObject(body, "raised", alert->raised);
+    JAddNumberToObject(body, "cleared", alert->cleared);
+    JAddNumberToObject(body, "temp", alert->temperature);
+    JAddNumberToObject(body, "humidity", alert->humidity);
+    JAddNumberToObject(body, "pressure", alert->pressure);
+    JAddNumberToObject(body, "voltage", alert->voltage);
+    // Rate and tendency are omitted while unknown
+    if (!isnan(alert->tempRate)) {
+        JAddNumberToObject(body, "temp_rate", alert->tempRate);
+    }
+    if (!isnan(alert->pressureTendency)) {
+        JAddNumberToObject(body, "pressure_delta", alert->pressureTendency);
+    }
+    // Thresholds only for the alerts this note raises
+    if (!isnan(alert->tempThreshold)) {
+        JAddNumberToObject(body, "temp_th", alert->tempThreshold);
+    }
+    if (!isnan(alert->humidityThreshold)) {
+        JAddNumberToObject(body, "humidity_th", alert->humidityThreshold);
+    }
+    if (!isnan(alert->pressureThreshold)) {
+        JAddNumberToObject(body, "pressure_delta_th", alert->pressureThreshold);
+    }
+    if (!isnan(alert->voltageThreshold)) {
+        JAddNumberToObject(body, "voltage_th", alert->voltageThreshold);
+    }
+    if (!isnan(alert->tempRateThreshold)) {
+        JAddNumberToObject(body, "temp_rate_th", alert->tempRateThreshold);
+    }
+    // Device-side latency: sample to this note.add
+    if (latencyMs != LATENCY_UNKNOWN) {
+        JAddNumberToObject(body, "latency_ms", latencyMs);
+    }
+    if (alert->timestamp != 0) {
+        JAddNumberToObject(body, "_time", alert->timestamp);
+    }
     JAddItemToObject(req, "body", body);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -456,10 +753,7 @@ bool notecardSendAlertNote(const Alert* alert) {
 
     s_notecard.deleteResponse(rsp);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] Alert note sent: ");
-    DEBUG_SERIAL.println(alert->type);
-    #endif
+    traceRecord(TRACE_NC_ALERT_SENT, alert->raised, alert->cleared);
 
     return true;
 }
@@ -484,6 +778,8 @@ bool notecardSendCommandAck(const CommandAck* ack) {
         case CMD_TEST_AUDIO: cmdStr = "test_audio"; break;
         case CMD_SET_VOLUME: cmdStr = "set_volume"; break;
         case CMD_UNLOCK: cmdStr = "unlock"; break;
+        case CMD_PROFILE: cmdStr = "profile"; break;
+        case CMD_TRANSCRIPT: cmdStr = "transcript"; break;
         default: break;
     }
     JAddStringToObject(body, "cmd", cmdStr);
@@ -499,7 +795,7 @@ bool notecardSendCommandAck(const CommandAck* ack) {
     JAddNumberToObject(body, "executed_at", ack->executedAt);
     JAddItemToObject(req, "body", body);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -520,14 +816,93 @@ bool notecardSendHealthNote(const HealthData* health) {
 
     J* body = JCreateObject();
     JAddStringToObject(body, "firmware", health->firmwareVersion);
+    JAddStringToObject(body, "trigger",
+                       health->trigger == METRICS_TRIGGER_CHANGE ? "change" : "heartbeat");
     JAddNumberToObject(body, "uptime_sec", health->uptimeSec);
     JAddNumberToObject(body, "boot_count", health->bootCount);
     JAddNumberToObject(body, "last_gps_fix_sec", health->lastGpsFixSec);
-    JAddNumberToObject(body, "sensor_errors", health->sensorErrors);
-    JAddNumberToObject(body, "notecard_errors", health->notecardErrors);
+
+    // Metrics since boot
+    const MetricsSnapshot* metrics = &health->metrics;
+    JAddNumberToObject(body, "sensor_errors", metrics->counters[METRIC_SENSOR_ERRORS]);
+    JAddNumberToObject(body, "notecard_errors", metrics->counters[METRIC_NOTECARD_ERRORS]);
+    JAddNumberToObject(body, "i2c_timeouts", metrics->counters[METRIC_I2C_TIMEOUTS]);
+    JAddNumberToObject(body, "notes_sent", metrics->counters[METRIC_NOTES_SENT]);
+    JAddNumberToObject(body, "notes_lost", metrics->counters[METRIC_NOTES_LOST]);
+    for (uint8_t i = 0; i < NOTE_PRIORITY_COUNT; i++) {
+        char field[24];
+        snprintf(field, sizeof(field), "lost_%s", HEALTH_NOTE_CLASSES[i]);
+        JAddNumberToObject(body, field, health->noteDrops[i]);
+    }
+    JAddNumberToObject(body, "peak_queue", metrics->peaks[METRIC_PEAK_NOTE_QUEUE]);
+    JAddNumberToObject(body, "peak_spill", metrics->peaks[METRIC_PEAK_NOTE_SPILL]);
+    JAddNumberToObject(body, "peak_audio", metrics->peaks[METRIC_PEAK_AUDIO_QUEUE]);
+    if (metrics->heapFreeMin != UINT32_MAX) {
+        JAddNumberToObject(body, "heap_min", metrics->heapFreeMin);
+    }
+
+    // Run-time statistics for the window since the last report
+    const RunStatsReport* stats = &health->runStats;
+    if (stats->windowMs > 0) {
+        JAddNumberToObject(body, "window_sec", stats->windowMs / 1000);
+        JAddNumberToObject(body, "cpu_pm", stats->cpuPermille);
+        for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "load_%s", runStatsTaskName((RunStatsTask)i));
+            JAddNumberToObject(body, field, stats->loadPermille[i]);
+            snprintf(field, sizeof(field), "wakes_%s", runStatsTaskName((RunStatsTask)i));
+            JAddNumberToObject(body, field, stats->wakes[i]);
+            if (stats->stackFreeMin[i] != RUNSTATS_STACK_UNKNOWN) {
+                snprintf(field, sizeof(field), "stack_free_%s", runStatsTaskName((RunStatsTask)i));
+                JAddNumberToObject(body, field, stats->stackFreeMin[i]);
+            }
+        }
+        JAddNumberToObject(body, "i2c_acq", stats->i2cAcquires);
+        JAddNumberToObject(body, "i2c_wait_ms", stats->i2cWaitMs);
+        JAddNumberToObject(body, "i2c_wait_max_ms", stats->i2cWaitMaxMs);
+    }
+
+    // Alert latency percentiles per stage over the same window
+    const LatencyReport* latency = &health->alertLatency;
+    if (latency->count > 0) {
+        JAddNumberToObject(body, "alerts_timed", latency->count);
+        for (uint8_t i = 0; i < LATENCY_STAGE_COUNT; i++) {
+            char field[24];
+            snprintf(field, sizeof(field), "alert_%s_p50_ms", latencyStageName((LatencyStage)i));
+            JAddNumberToObject(body, field, latency->p50Ms[i]);
+            snprintf(field, sizeof(field), "alert_%s_p99_ms", latencyStageName((LatencyStage)i));
+            JAddNumberToObject(body, field, latency->p99Ms[i]);
+        }
+    }
+
+    // This boot's stage durations and time to first note, and the slowest
+    // first note of the previous boots for comparison
+    if (health->bootProfile) {
+        const BootProfile* boot = bootProfileGet();
+        JAddNumberToObject(body, "boot_flags", boot->flags);
+        for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++) {
+            uint32_t ms = 0;
+            if (bootProfileStageMs(boot, (BootStage)i, &ms)) {
+                char field[24];
+                snprintf(field, sizeof(field), "boot_%s_ms", bootStageName((BootStage)i));
+                JAddNumberToObject(body, field, MIN(ms, (uint32_t)UINT16_MAX));
+            }
+        }
+        uint32_t totalMs = 0;
+        if (bootProfileElapsedMs(boot, BOOT_STAGE_FIRST_NOTE, &totalMs)) {
+            JAddNumberToObject(body, "boot_total_ms", totalMs);
+        }
+
+        BootProfileHistory history;
+        stateGetBootProfiles(&history);
+        uint32_t prevMaxMs = bootProfileHistoryMaxFirstNoteMs(&history);
+        if (prevMaxMs > 0) {
+            JAddNumberToObject(body, "boot_prev_max_ms", prevMaxMs);
+        }
+    }
     JAddItemToObject(req, "body", body);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -555,7 +930,7 @@ bool notecardSendShutdownNote(float voltage, const char* reason) {
     JAddNumberToObject(body, "uptime_sec", (uint32_t)(millis() / 1000));
     JAddItemToObject(req, "body", body);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -586,7 +961,7 @@ bool notecardGetCommand(Command* cmd) {
     JAddStringToObject(req, "file", NOTEFILE_COMMAND);
     JAddBoolToObject(req, "delete", true);  // Delete after reading
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL) {
         return false;
     }
@@ -668,15 +1043,24 @@ bool notecardGetCommand(Command* cmd) {
                     // "all" or anything else stays at 2
                 }
             }
+        } else if (strcmp(cmdStr, "profile") == 0) {
+            cmd->type = CMD_PROFILE;
+            J* params = JGetObject(body, "params");
+            if (params) {
+                cmd->params.profile.reset = JGetBool(params, "reset");
+            }
+        } else if (strcmp(cmdStr, "transcript") == 0) {
+            cmd->type = CMD_TRANSCRIPT;
+            J* params = JGetObject(body, "params");
+            if (params) {
+                cmd->params.transcript.clear = JGetBool(params, "clear");
+            }
         }
     }
 
     s_notecard.deleteResponse(rsp);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] Command received: ");
-    DEBUG_SERIAL.println(cmdStr ? cmdStr : "unknown");
-    #endif
+    traceRecord(TRACE_NC_COMMAND, cmd->type, 0);
 
     return true;
 }
@@ -693,7 +1077,7 @@ float notecardGetVoltage(bool* usbPowered) {
 
     J* req = s_notecard.newRequest("card.voltage");
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         if (usbPowered) *usbPowered = false;
@@ -713,6 +1097,27 @@ float notecardGetVoltage(bool* usbPowered) {
     return voltage;
 }
 
+uint32_t notecardGetTime(void) {
+    if (!s_initialized) {
+        return 0;
+    }
+
+    J* rsp = ncTransaction(s_notecard.newRequest("card.time"));
+    if (rsp == NULL) {
+        NC_ERROR();
+        return 0;
+    }
+
+    // An error here means the time is not set yet (no sync since power-on)
+    uint32_t epoch = 0;
+    if (!s_notecard.responseError(rsp)) {
+        epoch = (uint32_t)JGetInt(rsp, "time");
+    }
+
+    s_notecard.deleteResponse(rsp);
+    return epoch;
+}
+
 bool notecardConfigureVoltage(void) {
     if (!s_initialized) {
         return false;
@@ -737,7 +1142,7 @@ bool notecardConfigureVoltage(void) {
     // This ensures low battery warnings reach the cloud right away
     JAddBoolToObject(req, "sync", true);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         #ifdef DEBUG_MODE
         DEBUG_SERIAL.println("[Notecard] card.voltage config failed");
@@ -784,21 +1189,17 @@ bool notecardConfigureMojo(bool enabled, OperatingMode mode) {
         JAddNumberToObject(req, "minutes", 720);  // 12 hours for max reading time
     }
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[Notecard] card.power config failed");
-        #endif
         if (rsp) s_notecard.deleteResponse(rsp);
+        NC_ERROR();
         return false;
     }
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] Mojo power monitoring ");
-    DEBUG_SERIAL.println(enabled ? "enabled" : "disabled");
-    #endif
-
     s_notecard.deleteResponse(rsp);
+
+    traceRecord(TRACE_NC_MOJO, enabled, 0);
+
     return true;
 }
 
@@ -808,7 +1209,7 @@ bool notecardGetMotion(void) {
     }
 
     J* req = s_notecard.newRequest("card.motion");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
@@ -843,7 +1244,7 @@ bool notecardSetMotionSensitivity(MotionSensitivity sensitivity) {
     }
     JAddNumberToObject(req, "sensitivity", threshold);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -860,7 +1261,7 @@ bool notecardGetSerial(char* buffer, size_t bufferSize) {
     }
 
     J* req = s_notecard.newRequest("card.version");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
@@ -883,34 +1284,20 @@ bool notecardGetSerial(char* buffer, size_t bufferSize) {
 // GPS/Location
 // =============================================================================
 
-bool notecardConfigureGPS(OperatingMode mode) {
-    if (!s_initialized) {
+bool notecardConfigureGPS(const SongbirdConfig* config) {
+    if (!s_initialized || config == NULL) {
         return false;
     }
 
-    J* req = s_notecard.newRequest("card.location.mode");
+    // Periodic GPS in transit every gps_interval_min; off elsewhere, where
+    // triangulation provides sufficient location
+    NotecardCadence cadence;
+    cadenceCompute(config, &cadence);
 
-    switch (mode) {
-        case MODE_DEMO:
-            // GPS off in demo - rely on triangulation only
-            JAddStringToObject(req, "mode", "off");
-            break;
-        case MODE_TRANSIT:
-            // GPS enabled for tracking - 60 second interval for good track resolution
-            JAddStringToObject(req, "mode", "periodic");
-            JAddNumberToObject(req, "seconds", 60);
-            break;
-        case MODE_STORAGE:
-            // GPS off in storage - triangulation provides sufficient location
-            JAddStringToObject(req, "mode", "off");
-            break;
-        case MODE_SLEEP:
-            // GPS off when sleeping
-            JAddStringToObject(req, "mode", "off");
-            break;
-    }
+    J* req = s_notecard.newRequest("card.location.mode");
+    cadenceAddLocationMode(req, &cadence);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -918,11 +1305,9 @@ bool notecardConfigureGPS(OperatingMode mode) {
     }
 
     s_notecard.deleteResponse(rsp);
+    setGpsEnabled(cadence.gpsSeconds > 0);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] GPS mode configured for ");
-    DEBUG_SERIAL.println(mode == MODE_TRANSIT ? "transit (periodic 60s)" : "off");
-    #endif
+    traceRecord(TRACE_NC_GPS_MODE, cadence.gpsSeconds, 0);
 
     return true;
 }
@@ -947,11 +1332,8 @@ bool notecardConfigureTracking(OperatingMode mode) {
         JAddBoolToObject(req, "stop", true);
     }
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[Notecard] card.location.track failed");
-        #endif
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
         return false;
@@ -959,10 +1341,7 @@ bool notecardConfigureTracking(OperatingMode mode) {
 
     s_notecard.deleteResponse(rsp);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.print("[Notecard] Location tracking ");
-    DEBUG_SERIAL.println(mode == MODE_TRANSIT ? "enabled" : "disabled");
-    #endif
+    traceRecord(TRACE_NC_TRACKING, mode == MODE_TRANSIT, 0);
 
     return true;
 }
@@ -984,7 +1363,7 @@ bool notecardConfigureTriangulation(void) {
     JAddBoolToObject(req, "set", true);
     JAddBoolToObject(req, "on", true);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         #ifdef DEBUG_MODE
         DEBUG_SERIAL.println("[Notecard] card.triangulate failed");
@@ -1009,42 +1388,26 @@ bool notecardGetGPSStatus(bool* hasLock, double* lat, double* lon, uint32_t* tim
     }
 
     J* req = s_notecard.newRequest("card.location");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
-    if (rsp == NULL || s_notecard.responseError(rsp)) {
-        if (rsp) s_notecard.deleteResponse(rsp);
-        if (hasLock) *hasLock = false;
-        if (isActive) *isActive = false;
-        if (hasSignal) *hasSignal = false;
-        return false;
-    }
+    NotecardStatus location;
+    memset(&location, 0, sizeof(location));
+    bool ok = notecardParseLocation(rsp, &location);
+    if (rsp) s_notecard.deleteResponse(rsp);
 
-    if (hasLock) {
-        *hasLock = JGetNumber(rsp, "lat") != 0 || JGetNumber(rsp, "lon") != 0;
+    if (hasLock) *hasLock = location.gpsLock;
+    if (isActive) *isActive = location.gpsActive;
+    if (hasSignal) *hasSignal = location.gpsSignal;
+    if (!ok) {
+        return false;
     }
-    if (lat) *lat = JGetNumber(rsp, "lat");
-    if (lon) *lon = JGetNumber(rsp, "lon");
-    if (timeSeconds) *timeSeconds = JGetInt(rsp, "time");
 
-    // Check GPS status flags in the status string
-    const char* status = JGetString(rsp, "status");
-    if (isActive) {
-        // GPS is active if {gps-active} is present (not {gps-inactive})
-        *isActive = (status != NULL && strstr(status, "{gps-active}") != NULL);
-    }
-    if (hasSignal) {
-        // GPS has signal if {gps-signal} is present
-        *hasSignal = (status != NULL && strstr(status, "{gps-signal}") != NULL);
-    }
+    if (lat) *lat = location.lat;
+    if (lon) *lon = location.lon;
+    if (timeSeconds) *timeSeconds = location.gpsTime;
 
-    #ifdef DEBUG_MODE
-    if (status) {
-        DEBUG_SERIAL.print("[Notecard] GPS status: ");
-        DEBUG_SERIAL.println(status);
-    }
-    #endif
+    traceRecord(TRACE_NC_GPS_STATUS, location.gpsActive, location.gpsSignal);
 
-    s_notecard.deleteResponse(rsp);
     return true;
 }
 
@@ -1056,49 +1419,47 @@ bool notecardDisableGPS(void) {
     J* req = s_notecard.newRequest("card.location.mode");
     JAddStringToObject(req, "mode", "off");
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[Notecard] Failed to disable GPS");
-        #endif
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
         return false;
     }
 
     s_notecard.deleteResponse(rsp);
+    setGpsEnabled(false);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Notecard] GPS disabled for power saving");
-    #endif
+    traceRecord(TRACE_NC_GPS_OFF, 0, 0);
 
     return true;
 }
 
-bool notecardEnableTransitGPS(void) {
-    if (!s_initialized) {
+bool notecardEnableTransitGPS(const SongbirdConfig* config) {
+    if (!s_initialized || config == NULL) {
         return false;
     }
 
+    SongbirdConfig transit;
+    memcpy(&transit, config, sizeof(SongbirdConfig));
+    transit.mode = MODE_TRANSIT;
+
+    NotecardCadence cadence;
+    cadenceCompute(&transit, &cadence);
+
     J* req = s_notecard.newRequest("card.location.mode");
-    JAddStringToObject(req, "mode", "periodic");
-    JAddNumberToObject(req, "seconds", 60);  // 60-second interval for transit
+    cadenceAddLocationMode(req, &cadence);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[Notecard] Failed to enable transit GPS");
-        #endif
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
         return false;
     }
 
     s_notecard.deleteResponse(rsp);
+    setGpsEnabled(cadence.gpsSeconds > 0);
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Notecard] GPS re-enabled for transit (periodic 60s)");
-    #endif
+    traceRecord(TRACE_NC_GPS_ON, cadence.gpsSeconds, 0);
 
     return true;
 }
@@ -1115,24 +1476,10 @@ bool notecardEnvGet(const char* name, char* buffer, size_t bufferSize) {
     J* req = s_notecard.newRequest("env.get");
     JAddStringToObject(req, "name", name);
 
-    J* rsp = s_notecard.requestAndResponse(req);
-    if (rsp == NULL || s_notecard.responseError(rsp)) {
-        if (rsp) s_notecard.deleteResponse(rsp);
-        return false;
-    }
-
-    const char* value = JGetString(rsp, "text");
-    // Only return true if value exists AND is not empty
-    // Empty string means the env var is not set
-    if (value && value[0] != '\0') {
-        strncpy(buffer, value, bufferSize - 1);
-        buffer[bufferSize - 1] = '\0';
-        s_notecard.deleteResponse(rsp);
-        return true;
-    }
-
-    s_notecard.deleteResponse(rsp);
-    return false;
+    J* rsp = ncTransaction(req);
+    bool found = notecardParseEnvText(rsp, buffer, bufferSize);
+    if (rsp) s_notecard.deleteResponse(rsp);
+    return found;
 }
 
 int32_t notecardEnvGetInt(const char* name, int32_t defaultValue) {
@@ -1165,15 +1512,15 @@ bool notecardEnvModified(void) {
     }
 
     J* req = s_notecard.newRequest("env.modified");
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
 
-    if (rsp == NULL) {
+    uint32_t modCount = 0;
+    bool ok = notecardParseEnvModified(rsp, &modCount);
+    if (rsp) s_notecard.deleteResponse(rsp);
+    if (!ok) {
         return false;
     }
 
-    uint32_t modCount = JGetInt(rsp, "time");
-    s_notecard.deleteResponse(rsp);
-
     if (modCount != s_lastEnvModCount) {
         s_lastEnvModCount = modCount;
         return true;
@@ -1191,14 +1538,15 @@ bool notecardConfigureSleep(uint32_t sleepSeconds,
                             bool wakeOnCommand,
                             const uint8_t* payload,
                             size_t payloadSize) {
-    if (!s_initialized) {
+    if (!s_initialized || payloadSize > NOTECARD_SLEEP_PAYLOAD_MAX) {
         return false;
     }
 
     J* req = s_notecard.newRequest("card.attn");
 
-    // Build mode string
-    String mode = "sleep";
+    // Build mode string. Env changes always wake the host: they are rare,
+    // and a mode change should not wait for the next timer wake.
+    String mode = "sleep,env";
     if (wakeOnMotion) {
         mode += ",motion";
     }
@@ -1219,15 +1567,14 @@ bool notecardConfigureSleep(uint32_t sleepSeconds,
         JAddNumberToObject(req, "seconds", sleepSeconds);
     }
 
-    // Add payload if provided
+    // Add payload if provided. The Notecard keeps it across the power cut
+    // and returns it from card.attn "start":true on the next boot.
     if (payload != NULL && payloadSize > 0) {
-        // Base64 encode the payload
-        // Note: For simplicity, we'd use a proper base64 encoder here
-        // The Notecard library may provide this functionality
-        JAddStringToObject(req, "payload", (const char*)payload);
+        JB64Encode(s_payloadB64, (const char*)payload, (int)payloadSize);
+        JAddStringToObject(req, "payload", s_payloadB64);
     }
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         if (rsp) s_notecard.deleteResponse(rsp);
         NC_ERROR();
@@ -1247,30 +1594,141 @@ void notecardEnterSleep(void) {
     delay(100);
 
     // If we're still running, something went wrong
+    traceRecord(TRACE_NC_SLEEP_FAILED, 0, 0);
+}
+
+uint8_t notecardGetWakeEvents(void) {
+    return s_wakeEvents;
+}
+
+size_t notecardGetSleepPayload(uint8_t* buffer, size_t bufferSize) {
+    s_wakeEvents = 0;
+
+    if (!s_initialized || buffer == NULL || bufferSize == 0) {
+        return 0;
+    }
+
+    // "start":true returns the payload stored by the last sleep request along
+    // with the events that ended it
+    J* req = s_notecard.newRequest("card.attn");
+    JAddBoolToObject(req, "start", true);
+
+    J* rsp = ncTransaction(req);
+    if (rsp == NULL || s_notecard.responseError(rsp)) {
+        if (rsp) s_notecard.deleteResponse(rsp);
+        NC_ERROR();
+        return 0;
+    }
+
+    // Wake reason - "files" lists changed notefiles plus event keywords
+    J* files = JGetArray(rsp, "files");
+    int fileCount = (files != NULL) ? JGetArraySize(files) : 0;
+    for (int i = 0; i < fileCount; i++) {
+        J* item = JGetArrayItem(files, i);
+        const char* name = (item != NULL) ? item->valuestring : NULL;
+        if (name == NULL) {
+            continue;
+        }
+        if (strcmp(name, "timeout") == 0) {
+            s_wakeEvents |= ATTN_EVENT_TIMER;
+        } else if (strcmp(name, "motion") == 0) {
+            s_wakeEvents |= ATTN_EVENT_MOTION;
+        } else if (strcmp(name, NOTEFILE_COMMAND) == 0) {
+            s_wakeEvents |= ATTN_EVENT_COMMAND;
+        } else if (strcmp(name, "env") == 0) {
+            s_wakeEvents |= ATTN_EVENT_ENV;
+        }
+    }
+
+    // Decode the payload
+    size_t size = 0;
+    const char* encoded = JGetString(rsp, "payload");
+    if (encoded != NULL && encoded[0] != '\0' &&
+        JB64DecodeLen(encoded) <= (int)sizeof(s_payloadB64)) {
+        int decodedLen = JB64Decode(s_payloadB64, encoded);
+        if (decodedLen > 0 && (size_t)decodedLen <= bufferSize) {
+            memcpy(buffer, s_payloadB64, decodedLen);
+            size = (size_t)decodedLen;
+        }
+    }
+
+    s_notecard.deleteResponse(rsp);
+    return size;
+}
+
+// =============================================================================
+// Note Spill
+// =============================================================================
+
+bool notecardSaveNoteSpill(const uint8_t* blob, size_t length) {
+    if (!s_initialized || blob == NULL || length == 0 || length > NOTE_SPILL_SIZE) {
+        return false;
+    }
+
+    // One note in a local-only DB file, removed when read back at boot
+    J* req = s_notecard.newRequest("note.add");
+    JAddStringToObject(req, "file", NOTEFILE_SPILL);
+    JAddStringToObject(req, "note", "pending");
+    JB64Encode(s_payloadB64, (const char*)blob, (int)length);
+    JAddStringToObject(req, "payload", s_payloadB64);
+
+    J* rsp = ncTransaction(req);
+    if (rsp == NULL || s_notecard.responseError(rsp)) {
+        if (rsp) s_notecard.deleteResponse(rsp);
+        NC_ERROR();
+        return false;
+    }
+
+    s_notecard.deleteResponse(rsp);
+
     #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[Notecard] Sleep failed - still running");
+    DEBUG_SERIAL.print("[Notecard] Spilled ");
+    DEBUG_SERIAL.print((uint32_t)length);
+    DEBUG_SERIAL.println(" bytes of pending notes");
     #endif
+
+    return true;
 }
 
-void notecardGetWakeReason(bool* timer, bool* motion, bool* command) {
-    // After wake, check what caused the wake
-    // This information is available from the Notecard
+size_t notecardLoadNoteSpill(uint8_t* buffer, size_t bufferSize) {
+    if (!s_initialized || buffer == NULL || bufferSize == 0) {
+        return 0;
+    }
 
-    if (timer) *timer = false;
-    if (motion) *motion = false;
-    if (command) *command = false;
+    // Read and delete in one request so a note is never replayed twice
+    J* req = s_notecard.newRequest("note.get");
+    JAddStringToObject(req, "file", NOTEFILE_SPILL);
+    JAddStringToObject(req, "note", "pending");
+    JAddBoolToObject(req, "delete", true);
 
-    // The wake reason would typically be determined by checking
-    // various Notecard states. For now, assume timer wake if nothing else.
-    if (timer) *timer = true;
-}
+    J* rsp = ncTransaction(req);
+    if (rsp == NULL) {
+        NC_ERROR();
+        return 0;
+    }
+    if (s_notecard.responseError(rsp)) {
+        // Nothing was spilled by the last shutdown
+        const char* err = JGetString(rsp, "err");
+        if (err == NULL || strstr(err, "{note-noexist}") == NULL) {
+            NC_ERROR();
+        }
+        s_notecard.deleteResponse(rsp);
+        return 0;
+    }
 
-size_t notecardGetSleepPayload(uint8_t* buffer, size_t bufferSize) {
-    // Retrieve payload saved before sleep
-    // This would come from card.attn response after wake
+    size_t size = 0;
+    const char* encoded = JGetString(rsp, "payload");
+    if (encoded != NULL && encoded[0] != '\0' &&
+        JB64DecodeLen(encoded) <= (int)sizeof(s_payloadB64)) {
+        int decodedLen = JB64Decode(s_payloadB64, encoded);
+        if (decodedLen > 0 && (size_t)decodedLen <= bufferSize) {
+            memcpy(buffer, s_payloadB64, decodedLen);
+            size = (size_t)decodedLen;
+        }
+    }
 
-    // For now, return 0 indicating no payload
-    return 0;
+    s_notecard.deleteResponse(rsp);
+    return size;
 }
 
 // =============================================================================
@@ -1278,11 +1736,11 @@ size_t notecardGetSleepPayload(uint8_t* buffer, size_t bufferSize) {
 // =============================================================================
 
 uint32_t notecardGetErrorCount(void) {
-    return s_errorCount;
+    return metricsGet(METRIC_NOTECARD_ERRORS);
 }
 
 void notecardResetErrorCount(void) {
-    s_errorCount = 0;
+    metricsReset(METRIC_NOTECARD_ERRORS);
 }
 
 // =============================================================================
@@ -1346,7 +1804,7 @@ bool notecardReportFirmwareVersion(void) {
     JAddBoolToObject(req, "on", true);
     JAddStringToObject(req, "version", versionJson);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         #ifdef DEBUG_MODE
         DEBUG_SERIAL.println("[Notecard] dfu.status failed");
@@ -1378,7 +1836,7 @@ bool notecardEnableODFU(void) {
     JAddStringToObject(req, "mode", DFU_MODE);
     JAddBoolToObject(req, "on", true);
 
-    J* rsp = s_notecard.requestAndResponse(req);
+    J* rsp = ncTransaction(req);
     if (rsp == NULL || s_notecard.responseError(rsp)) {
         #ifdef DEBUG_MODE
         DEBUG_SERIAL.println("[Notecard] card.dfu failed");
@@ -48,10 +48,24 @@ bool notecardIsAvailable(void);
  * Sets up hub.set with product UID, sync mode, and other settings.
  * Caller must hold I2C mutex.
  *
- * @param mode Operating mode (affects sync settings)
+ * @param config Effective configuration (mode, sync and GPS intervals)
  * @return true if configuration successful
  */
-bool notecardConfigure(OperatingMode mode);
+bool notecardConfigure(const SongbirdConfig* config);
+
+/**
+ * @brief Apply hub.set sync settings for the given configuration
+ *
+ * Connection mode follows the operating mode; periodic outbound/inbound
+ * intervals follow sync_interval_min (see cadenceCompute()) and are
+ * stretched by the battery-aware power policy. Called by notecardConfigure()
+ * and again by MainTask when the sync interval or the policy scale changes.
+ * Caller must hold I2C mutex.
+ *
+ * @param config Effective configuration
+ * @return true if hub.set succeeded
+ */
+bool notecardConfigureHub(const SongbirdConfig* config);
 
 /**
  * @brief Set up Note templates for bandwidth optimization
@@ -80,7 +94,8 @@ bool notecardIsConnected(void);
 /**
  * @brief Wait for Notehub connection
  *
- * Blocks until connected or timeout.
+ * Blocks until connected or timeout, polling hub.status with exponential
+ * backoff (CONNECT_POLL_MIN_MS doubling to CONNECT_POLL_MAX_MS).
  * Caller must hold I2C mutex.
  *
  * @param timeoutMs Maximum time to wait
@@ -88,6 +103,54 @@ bool notecardIsConnected(void);
  */
 bool notecardWaitConnection(uint32_t timeoutMs);
 
+// =============================================================================
+// Status Snapshot
+// =============================================================================
+
+/**
+ * @brief Last known Notecard location, sync and connection state
+ *
+ * Refreshed by NotecardTask at a mode-dependent rate; any task may read a
+ * copy with notecardGetStatus() without touching the I2C bus.
+ */
+typedef struct {
+    bool connected;             // hub.status "connected"
+    uint32_t connectedAtMs;     // millis() of last hub.status (0 = never)
+    bool syncing;               // hub.sync.status reports a sync in progress
+    uint32_t lastSyncTime;      // hub.sync.status "time" of the last completed sync
+    bool gpsEnabled;            // card.location.mode is not "off"
+    bool gpsValid;              // GPS fields below are from the last refresh
+    bool gpsLock;               // Location fix available
+    bool gpsActive;             // {gps-active} in card.location status
+    bool gpsSignal;             // {gps-signal} in card.location status
+    double lat;
+    double lon;
+    uint32_t gpsTime;           // card.location "time"
+    uint32_t updatedAtMs;       // millis() of last refresh (0 = never)
+} NotecardStatus;
+
+/**
+ * @brief Refresh the status snapshot with as few requests as possible
+ *
+ * Issues card.location only while GPS is enabled, hub.sync.status only if
+ * requested, and hub.status only if requested.
+ * Caller must hold I2C mutex.
+ *
+ * @param wantSync Refresh the sync state (hub.sync.status)
+ * @param wantConnection Refresh the connection state (hub.status)
+ * @return true if every issued request succeeded
+ */
+bool notecardRefreshStatus(bool wantSync, bool wantConnection);
+
+/**
+ * @brief Get a copy of the latest status snapshot
+ *
+ * Safe to call from any task; does not access the Notecard.
+ *
+ * @param status Output: snapshot copy
+ */
+void notecardGetStatus(NotecardStatus* status);
+
 /**
  * @brief Force an immediate sync with Notehub
  *
@@ -118,19 +181,23 @@ bool notecardIsSyncing(void);
  * @param data Sensor data to include in note
  * @param mode Current operating mode
  * @param forceSync If true, sync immediately regardless of mode (for mode changes)
+ * @param bootRecord If true, add this boot's boot_flags and boot_total_ms
  * @return true if note queued successfully
  */
-bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forceSync = false);
+bool notecardSendTrackNote(const SensorData* data, OperatingMode mode, bool forceSync = false,
+                           bool bootRecord = false);
 
 /**
- * @brief Send an alert note to alert.qo
+ * @brief Send one cycle's alert transitions to alert.qo
  *
  * Caller must hold I2C mutex.
  *
- * @param alert Alert data
+ * @param alert Raised/cleared bitmasks and the values behind them
+ * @param sync Request an immediate sync
+ * @param latencyMs Time since the sample that raised it (LATENCY_UNKNOWN to omit)
  * @return true if note queued successfully
  */
-bool notecardSendAlertNote(const Alert* alert);
+bool notecardSendAlertNote(const AlertNote* alert, bool sync, uint32_t latencyMs);
 
 /**
  * @brief Send a command acknowledgment to command_ack.qo
@@ -194,6 +261,15 @@ bool notecardGetCommand(Command* cmd);
  */
 float notecardGetVoltage(bool* usbPowered);
 
+/**
+ * @brief Get the Notecard's wall clock time
+ *
+ * Caller must hold I2C mutex.
+ *
+ * @return Unix epoch seconds, or 0 if the time is not known yet
+ */
+uint32_t notecardGetTime(void);
+
 /**
  * @brief Configure voltage monitoring for LiPo battery
  *
@@ -261,12 +337,13 @@ bool notecardGetSerial(char* buffer, size_t bufferSize);
 /**
  * @brief Configure GPS mode
  *
+ * Periodic GPS every gps_interval_min in transit mode, off otherwise.
  * Caller must hold I2C mutex.
  *
- * @param mode Operating mode (affects GPS settings)
+ * @param config Effective configuration
  * @return true if configured successfully
  */
-bool notecardConfigureGPS(OperatingMode mode);
+bool notecardConfigureGPS(const SongbirdConfig* config);
 
 /**
  * @brief Configure location tracking
@@ -327,17 +404,28 @@ bool notecardGetGPSStatus(bool* hasLock, double* lat, double* lon, uint32_t* tim
  */
 bool notecardDisableGPS(void);
 
+/**
+ * @brief Record the card.location.mode the Notecard kept across a sleep
+ *
+ * Called after a warm boot, which skips notecardConfigureGPS(), so that
+ * card.location is only polled while GPS is actually on.
+ *
+ * @param enabled true if GPS is on (see gpsPowerIsEnabled())
+ */
+void notecardRestoreGpsEnabled(bool enabled);
+
 /**
  * @brief Re-enable GPS for transit mode tracking
  *
- * Re-enables periodic GPS with 60-second interval for transit tracking.
+ * Re-enables periodic GPS every gps_interval_min for transit tracking.
  * Used after a retry interval when GPS was disabled due to penalty box.
  *
  * Caller must hold I2C mutex.
  *
+ * @param config Effective configuration
  * @return true if GPS enabled successfully
  */
-bool notecardEnableTransitGPS(void);
+bool notecardEnableTransitGPS(const SongbirdConfig* config);
 
 // =============================================================================
 // Environment Variables
@@ -399,13 +487,14 @@ bool notecardEnvModified(void);
 /**
  * @brief Configure ATTN-based sleep
  *
- * Sets up card.attn for sleep with wake on timer, motion, or inbound commands.
- * Caller must hold I2C mutex.
+ * Sets up card.attn for sleep with wake on timer, motion, inbound commands
+ * or env var changes (always). Caller must hold I2C mutex.
  *
  * @param sleepSeconds Seconds to sleep (0 for no timer wake)
  * @param wakeOnMotion Enable motion wake
  * @param wakeOnCommand Enable wake on command.qi note
- * @param payload Optional payload to preserve (base64 encoded)
+ * @param payload Optional binary payload to preserve across the power cut
+ *                (base64 encoded here, at most NOTECARD_SLEEP_PAYLOAD_MAX bytes)
  * @param payloadSize Size of payload
  * @return true if configured successfully
  */
@@ -426,18 +515,18 @@ void notecardEnterSleep(void);
 /**
  * @brief Get wake reason
  *
- * Call after wake to determine why device woke.
- * Caller must hold I2C mutex.
+ * Reports the events latched by notecardGetSleepPayload() during boot.
+ * Always 0 after a cold boot.
  *
- * @param timer Output: true if woke from timer
- * @param motion Output: true if woke from motion
- * @param command Output: true if woke from inbound command
+ * @return ATTN_EVENT_* mask of the events that ended the sleep
  */
-void notecardGetWakeReason(bool* timer, bool* motion, bool* command);
+uint8_t notecardGetWakeEvents(void);
 
 /**
  * @brief Retrieve payload saved before sleep
  *
+ * Issues card.attn "start":true, decodes the stored payload and latches the
+ * wake events for notecardGetWakeEvents(). Call once at boot.
  * Caller must hold I2C mutex.
  *
  * @param buffer Buffer to store payload
@@ -446,6 +535,34 @@ void notecardGetWakeReason(bool* timer, bool* motion, bool* command);
  */
 size_t notecardGetSleepPayload(uint8_t* buffer, size_t bufferSize);
 
+// =============================================================================
+// Note Spill
+// =============================================================================
+
+/**
+ * @brief Persist spilled outbound notes in Notecard flash
+ *
+ * Stores the blob as the payload of a single note in the local-only
+ * NOTEFILE_SPILL database; notecardLoadNoteSpill() deletes it at boot.
+ * Caller must hold I2C mutex.
+ *
+ * @param blob Blob from syncSpillPending()
+ * @param length Blob length (at most NOTE_SPILL_SIZE)
+ * @return true if stored
+ */
+bool notecardSaveNoteSpill(const uint8_t* blob, size_t length);
+
+/**
+ * @brief Retrieve and delete the notes spilled by the last shutdown
+ *
+ * Caller must hold I2C mutex.
+ *
+ * @param buffer Buffer to store the blob
+ * @param bufferSize Size of buffer
+ * @return Blob length, or 0 if nothing was spilled
+ */
+size_t notecardLoadNoteSpill(uint8_t* buffer, size_t bufferSize);
+
 // =============================================================================
 // Error Handling
 // =============================================================================
@@ -517,4 +634,61 @@ bool notecardReportFirmwareVersion(void);
  */
 size_t notecardBuildVersionString(char* buffer, size_t bufferSize);
 
+// =============================================================================
+// Response Parsing (SongbirdNotecardParse.cpp)
+// =============================================================================
+
+// How the firmware reads the status and env responses. Pure (J calls only)
+// so a recorded transcript can be replayed through them on the host; see
+// test/support/NotecardReplay.h. A NULL response is treated as a failed
+// request.
+
+/**
+ * @brief Read a card.location response into the GPS fields of a snapshot
+ *
+ * Sets gpsLock, lat, lon, gpsTime, gpsActive and gpsSignal. On failure
+ * gpsLock, gpsActive and gpsSignal are cleared.
+ *
+ * @param rsp Response
+ * @param status Output
+ * @return false if there was no response or it reported an error
+ */
+bool notecardParseLocation(J* rsp, NotecardStatus* status);
+
+/**
+ * @brief Read a hub.sync.status response
+ *
+ * @param rsp Response
+ * @param lastSyncTime Output: completion time of the last sync (may be NULL)
+ * @return true if a sync is requested or in progress
+ */
+bool notecardParseSyncStatus(J* rsp, uint32_t* lastSyncTime);
+
+/**
+ * @brief Read a hub.status response
+ *
+ * @param rsp Response
+ * @return true if connected to Notehub
+ */
+bool notecardParseConnected(J* rsp);
+
+/**
+ * @brief Read an env.get response for a single variable
+ *
+ * @param rsp Response
+ * @param buffer Output: value
+ * @param bufferSize Buffer size
+ * @return true if the variable is set (non-empty)
+ */
+bool notecardParseEnvText(J* rsp, char* buffer, size_t bufferSize);
+
+/**
+ * @brief Read an env.modified response
+ *
+ * @param rsp Response
+ * @param modCount Output: modification counter
+ * @return false if there was no response
+ */
+bool notecardParseEnvModified(J* rsp, uint32_t* modCount);
+
 #endif // SONGBIRD_NOTECARD_H
@@ -0,0 +1,93 @@
+/**
+ * @file SongbirdNotecardParse.cpp
+ * @brief Notecard response parsing
+ *
+ * The parts of SongbirdNotecard that interpret status and env responses,
+ * kept in their own translation unit so the native transcript replay links
+ * the real code.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdNotecard.h"
+#include <string.h>
+
+// =============================================================================
+// Status Responses
+// =============================================================================
+
+bool notecardParseLocation(J* rsp, NotecardStatus* status) {
+    if (status == NULL) {
+        return false;
+    }
+
+    // NoteResponseError() is a check for "err"
+    if (rsp == NULL || JIsPresent(rsp, "err")) {
+        status->gpsLock = false;
+        status->gpsActive = false;
+        status->gpsSignal = false;
+        return false;
+    }
+
+    status->lat = JGetNumber(rsp, "lat");
+    status->lon = JGetNumber(rsp, "lon");
+    status->gpsLock = status->lat != 0 || status->lon != 0;
+    status->gpsTime = (uint32_t)JGetInt(rsp, "time");
+
+    // GPS is active if {gps-active} is present (not {gps-inactive}), and
+    // has signal if {gps-signal} is present
+    const char* text = JGetString(rsp, "status");
+    status->gpsActive = (text != NULL && strstr(text, "{gps-active}") != NULL);
+    status->gpsSignal = (text != NULL && strstr(text, "{gps-signal}") != NULL);
+
+    return true;
+}
+
+bool notecardParseSyncStatus(J* rsp, uint32_t* lastSyncTime) {
+    if (rsp == NULL) {
+        return false;
+    }
+
+    if (lastSyncTime != NULL) {
+        *lastSyncTime = (uint32_t)JGetInt(rsp, "time");
+    }
+
+    // Check if sync is requested or in progress
+    const char* status = JGetString(rsp, "status");
+    return (status != NULL && strlen(status) > 0);
+}
+
+bool notecardParseConnected(J* rsp) {
+    return rsp != NULL && JGetBool(rsp, "connected");
+}
+
+// =============================================================================
+// Environment Variables
+// =============================================================================
+
+bool notecardParseEnvText(J* rsp, char* buffer, size_t bufferSize) {
+    if (rsp == NULL || JIsPresent(rsp, "err") || buffer == NULL || bufferSize == 0) {
+        return false;
+    }
+
+    const char* value = JGetString(rsp, "text");
+    // Only return true if value exists AND is not empty
+    // Empty string means the env var is not set
+    if (value == NULL || value[0] == '\0') {
+        return false;
+    }
+
+    strncpy(buffer, value, bufferSize - 1);
+    buffer[bufferSize - 1] = '\0';
+    return true;
+}
+
+bool notecardParseEnvModified(J* rsp, uint32_t* modCount) {
+    if (rsp == NULL || modCount == NULL) {
+        return false;
+    }
+
+    *modCount = (uint32_t)JGetInt(rsp, "time");
+    return true;
+}
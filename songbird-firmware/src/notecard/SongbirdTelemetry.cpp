@@ -0,0 +1,104 @@
+/**
+ * @file SongbirdTelemetry.cpp
+ * @brief Cached device telemetry implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdTelemetry.h"
+#include "SongbirdNotecard.h"
+#include "SongbirdState.h"
+
+// =============================================================================
+// Module State (protected by the I2C mutex held by every caller)
+// =============================================================================
+
+static float s_voltage = 0.0f;
+static bool s_usbPowered = false;
+static bool s_voltageValid = false;
+static uint32_t s_voltageSampledAt = 0;
+
+static bool s_motion = false;
+static bool s_motionValid = false;
+static uint32_t s_motionSampledAt = 0;
+
+static uint32_t s_epochAnchor = 0;          // card.time at s_epochAnchoredAt (0 = unknown)
+static uint32_t s_epochAnchoredAt = 0;
+static bool s_epochQueried = false;
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+static bool isFresh(bool valid, uint32_t sampledAt, uint32_t maxAgeMs) {
+    // Unsigned subtraction handles millis() wrap
+    return valid && maxAgeMs > 0 && (millis() - sampledAt) <= maxAgeMs;
+}
+
+// =============================================================================
+// Telemetry Cache
+// =============================================================================
+
+float telemetryGetVoltage(bool* usbPowered, uint32_t maxAgeMs) {
+    if (!isFresh(s_voltageValid, s_voltageSampledAt, maxAgeMs)) {
+        bool usb = false;
+        float voltage = notecardGetVoltage(&usb);
+
+        // 0 V means card.voltage failed - leave the cache for the next caller to retry
+        if (voltage <= 0.0f && !usb) {
+            if (usbPowered) *usbPowered = false;
+            return 0.0f;
+        }
+
+        s_voltage = voltage;
+        s_usbPowered = usb;
+        s_voltageSampledAt = millis();
+        s_voltageValid = true;
+    }
+
+    if (usbPowered) *usbPowered = s_usbPowered;
+    return s_voltage;
+}
+
+bool telemetryGetMotion(uint32_t maxAgeMs) {
+    if (!isFresh(s_motionValid, s_motionSampledAt, maxAgeMs)) {
+        s_motion = notecardGetMotion();
+        s_motionSampledAt = millis();
+        s_motionValid = true;
+
+        // card.motion resets on read - keep the event for the next report
+        if (s_motion) {
+            stateSetMotion(true);
+        }
+    }
+
+    return s_motion;
+}
+
+uint32_t telemetryGetEpoch(void) {
+    uint32_t age = millis() - s_epochAnchoredAt;
+    uint32_t refreshMs = (s_epochAnchor != 0) ? TELEMETRY_TIME_TTL_MS : TELEMETRY_TIME_RETRY_MS;
+
+    if (!s_epochQueried || age > refreshMs) {
+        uint32_t epoch = notecardGetTime();
+        s_epochQueried = true;
+
+        if (epoch != 0) {
+            s_epochAnchor = epoch;
+            s_epochAnchoredAt = millis();
+        } else if (s_epochAnchor != 0) {
+            // Refresh failed - move the old anchor forward and keep extrapolating
+            s_epochAnchor += age / 1000;
+            s_epochAnchoredAt += (age / 1000) * 1000;
+        } else {
+            s_epochAnchoredAt = millis();
+        }
+        age = millis() - s_epochAnchoredAt;
+    }
+
+    if (s_epochAnchor == 0) {
+        return 0;
+    }
+    return s_epochAnchor + age / 1000;
+}
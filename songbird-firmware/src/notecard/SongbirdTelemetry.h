@@ -0,0 +1,69 @@
+/**
+ * @file SongbirdTelemetry.h
+ * @brief Cached device telemetry (card.voltage, card.motion, card.time) for Songbird
+ *
+ * Several tasks need the battery voltage and motion status at nearly the
+ * same time (sensor cycle, mode change note, brownout and PVD shutdown).
+ * This module owns those Notecard reads and serves a cached sample while it
+ * is younger than the caller's maximum age, so one I2C transaction serves
+ * every consumer within the TTL.
+ *
+ * Callers hold the I2C mutex, which also serializes refreshes: a task that
+ * blocks on the mutex behind another task's refresh finds a fresh sample
+ * when it gets the bus instead of issuing a second request.
+ *
+ * card.motion reports motion since the previous request, so a positive
+ * reading is latched into the persisted state (stateSetMotion) before it is
+ * cached. Whoever reads the Notecard first, the next track note still
+ * reports the motion.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_TELEMETRY_H
+#define SONGBIRD_TELEMETRY_H
+
+#include <Arduino.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Telemetry Cache Interface
+// =============================================================================
+
+/**
+ * @brief Get battery voltage and USB power status
+ *
+ * Returns the cached sample if it is at most maxAgeMs old, otherwise issues
+ * card.voltage. Failed reads are not cached. Caller must hold I2C mutex.
+ *
+ * @param usbPowered Output: true if device is USB powered (optional, can be NULL)
+ * @param maxAgeMs Oldest acceptable sample (0 forces a fresh read)
+ * @return Battery voltage in volts, or 0 on error
+ */
+float telemetryGetVoltage(bool* usbPowered, uint32_t maxAgeMs);
+
+/**
+ * @brief Get motion status
+ *
+ * Returns the cached sample if it is at most maxAgeMs old, otherwise issues
+ * card.motion. Positive readings are also latched into the device state.
+ * Caller must hold I2C mutex.
+ *
+ * @param maxAgeMs Oldest acceptable sample (0 forces a fresh read)
+ * @return true if motion was detected in the sample
+ */
+bool telemetryGetMotion(uint32_t maxAgeMs);
+
+/**
+ * @brief Get the wall clock time
+ *
+ * Anchors millis() to card.time once and extrapolates from there, so the
+ * Notecard is only asked again after TELEMETRY_TIME_TTL_MS (or every
+ * TELEMETRY_TIME_RETRY_MS until the time is known). Caller must hold I2C mutex.
+ *
+ * @return Unix epoch seconds, or 0 if the time is not known yet
+ */
+uint32_t telemetryGetEpoch(void);
+
+#endif // SONGBIRD_TELEMETRY_H
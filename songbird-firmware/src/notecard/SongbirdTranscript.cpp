@@ -0,0 +1,287 @@
+/**
+ * @file SongbirdTranscript.cpp
+ * @brief Notecard request/response transcript implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdTranscript.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+// Packed record: seq u32 | at_ms u32 | latency_us u32 | flags u8 |
+// request length u8 | response length u8 | request | response
+#define TRANSCRIPT_HEADER_SIZE  15
+
+static uint8_t s_buffer[TRANSCRIPT_BUFFER_SIZE];
+static uint16_t s_head = 0;         // Write offset
+static uint16_t s_tail = 0;         // Offset of the oldest record
+static uint16_t s_used = 0;         // Bytes held
+static uint16_t s_count = 0;        // Records held
+static uint32_t s_seq = 0;
+static uint32_t s_dropped = 0;
+
+// =============================================================================
+// Ring Helpers
+// =============================================================================
+
+static void ringWrite(const void* data, uint16_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint16_t first = TRANSCRIPT_BUFFER_SIZE - s_head;
+    if (first > length) {
+        first = length;
+    }
+    memcpy(&s_buffer[s_head], bytes, first);
+    memcpy(&s_buffer[0], bytes + first, length - first);
+    s_head = (uint16_t)((s_head + length) % TRANSCRIPT_BUFFER_SIZE);
+    s_used += length;
+}
+
+static void ringRead(uint16_t offset, void* data, uint16_t length) {
+    uint8_t* bytes = (uint8_t*)data;
+    uint16_t first = TRANSCRIPT_BUFFER_SIZE - offset;
+    if (first > length) {
+        first = length;
+    }
+    memcpy(bytes, &s_buffer[offset], first);
+    memcpy(bytes + first, &s_buffer[0], length - first);
+}
+
+static uint16_t recordSize(uint16_t offset) {
+    uint8_t lengths[2];
+    ringRead((uint16_t)((offset + TRANSCRIPT_HEADER_SIZE - 2) % TRANSCRIPT_BUFFER_SIZE),
+             lengths, sizeof(lengths));
+    return (uint16_t)(TRANSCRIPT_HEADER_SIZE + lengths[0] + lengths[1]);
+}
+
+static void dropOldest(void) {
+    uint16_t size = recordSize(s_tail);
+    s_tail = (uint16_t)((s_tail + size) % TRANSCRIPT_BUFFER_SIZE);
+    s_used -= size;
+    s_count--;
+    s_dropped++;
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void transcriptInit(void) {
+    s_head = 0;
+    s_tail = 0;
+    s_used = 0;
+    s_count = 0;
+    s_seq = 0;
+    s_dropped = 0;
+}
+
+void transcriptRecord(uint32_t atMs, uint32_t latencyUs,
+                      const char* request, const char* response) {
+    uint8_t flags = 0;
+
+    size_t requestLen = (request != NULL) ? strlen(request) : 0;
+    if (requestLen > TRANSCRIPT_TEXT_MAX) {
+        requestLen = TRANSCRIPT_TEXT_MAX;
+        flags |= TRANSCRIPT_FLAG_REQUEST_TRUNCATED;
+    }
+
+    size_t responseLen = 0;
+    if (response == NULL) {
+        flags |= TRANSCRIPT_FLAG_NO_RESPONSE;
+    } else {
+        responseLen = strlen(response);
+        if (responseLen > TRANSCRIPT_TEXT_MAX) {
+            responseLen = TRANSCRIPT_TEXT_MAX;
+            flags |= TRANSCRIPT_FLAG_RESPONSE_TRUNCATED;
+        }
+    }
+
+    uint16_t size = (uint16_t)(TRANSCRIPT_HEADER_SIZE + requestLen + responseLen);
+    while (TRANSCRIPT_BUFFER_SIZE - s_used < size) {
+        dropOldest();
+    }
+
+    uint8_t header[TRANSCRIPT_HEADER_SIZE];
+    uint32_t seq = s_seq++;
+    memcpy(&header[0], &seq, 4);
+    memcpy(&header[4], &atMs, 4);
+    memcpy(&header[8], &latencyUs, 4);
+    header[12] = flags;
+    header[13] = (uint8_t)requestLen;
+    header[14] = (uint8_t)responseLen;
+
+    ringWrite(header, sizeof(header));
+    ringWrite(request, (uint16_t)requestLen);
+    ringWrite(response, (uint16_t)responseLen);
+    s_count++;
+}
+
+uint16_t transcriptCount(void) {
+    return s_count;
+}
+
+uint32_t transcriptGetDropped(void) {
+    return s_dropped;
+}
+
+bool transcriptGet(uint16_t index, TranscriptEntry* entry) {
+    if (entry == NULL || index >= s_count) {
+        return false;
+    }
+
+    uint16_t offset = s_tail;
+    for (uint16_t i = 0; i < index; i++) {
+        offset = (uint16_t)((offset + recordSize(offset)) % TRANSCRIPT_BUFFER_SIZE);
+    }
+
+    uint8_t header[TRANSCRIPT_HEADER_SIZE];
+    ringRead(offset, header, sizeof(header));
+    memcpy(&entry->seq, &header[0], 4);
+    memcpy(&entry->atMs, &header[4], 4);
+    memcpy(&entry->latencyUs, &header[8], 4);
+    entry->flags = header[12];
+
+    offset = (uint16_t)((offset + TRANSCRIPT_HEADER_SIZE) % TRANSCRIPT_BUFFER_SIZE);
+    ringRead(offset, entry->request, header[13]);
+    entry->request[header[13]] = '\0';
+
+    offset = (uint16_t)((offset + header[13]) % TRANSCRIPT_BUFFER_SIZE);
+    ringRead(offset, entry->response, header[14]);
+    entry->response[header[14]] = '\0';
+
+    return true;
+}
+
+// =============================================================================
+// Line Format
+// =============================================================================
+
+size_t transcriptFormat(const TranscriptEntry* entry, char* buffer, size_t size) {
+    if (entry == NULL || buffer == NULL || size == 0) {
+        return 0;
+    }
+
+    int written = snprintf(buffer, size, TRANSCRIPT_LINE_PREFIX "%lu\t%lu\t%lu\t%u\t%s\t%s",
+                           (unsigned long)entry->seq, (unsigned long)entry->atMs,
+                           (unsigned long)entry->latencyUs, (unsigned)entry->flags,
+                           entry->request, entry->response);
+    if (written < 0 || (size_t)written >= size) {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return (size_t)written;
+}
+
+/**
+ * @brief Parse one tab-terminated unsigned field
+ *
+ * @param cursor In: field start. Out: start of the next field.
+ * @param value Output
+ * @return false if the field is not a number followed by a tab
+ */
+static bool parseNumberField(const char** cursor, uint32_t* value) {
+    char* end = NULL;
+    unsigned long parsed = strtoul(*cursor, &end, 10);
+    if (end == *cursor || *end != '\t') {
+        return false;
+    }
+    *value = (uint32_t)parsed;
+    *cursor = end + 1;
+    return true;
+}
+
+/**
+ * @brief Copy text up to a tab or line end
+ *
+ * @param cursor In: text start. Out: the terminating character.
+ * @param out Output, TRANSCRIPT_TEXT_MAX + 1 bytes
+ * @return false if the text is too long
+ */
+static bool parseTextField(const char** cursor, char* out) {
+    size_t length = strcspn(*cursor, "\t\r\n");
+    if (length > TRANSCRIPT_TEXT_MAX) {
+        return false;
+    }
+    memcpy(out, *cursor, length);
+    out[length] = '\0';
+    *cursor += length;
+    return true;
+}
+
+bool transcriptParse(const char* line, TranscriptEntry* entry) {
+    if (line == NULL || entry == NULL) {
+        return false;
+    }
+
+    size_t prefixLen = strlen(TRANSCRIPT_LINE_PREFIX);
+    if (strncmp(line, TRANSCRIPT_LINE_PREFIX, prefixLen) != 0) {
+        return false;
+    }
+
+    const char* cursor = line + prefixLen;
+    uint32_t flags = 0;
+    if (!parseNumberField(&cursor, &entry->seq) ||
+        !parseNumberField(&cursor, &entry->atMs) ||
+        !parseNumberField(&cursor, &entry->latencyUs) ||
+        !parseNumberField(&cursor, &flags) || flags > 0xFF) {
+        return false;
+    }
+    entry->flags = (uint8_t)flags;
+
+    if (!parseTextField(&cursor, entry->request) || *cursor != '\t') {
+        return false;
+    }
+    cursor++;
+    if (!parseTextField(&cursor, entry->response)) {
+        return false;
+    }
+
+    return *cursor == '\0' || *cursor == '\r' || *cursor == '\n';
+}
+
+#ifndef NATIVE_TEST
+
+#include <Arduino.h>
+#include "SongbirdConfig.h"
+#include "SongbirdSync.h"
+
+// =============================================================================
+// Debug Dump
+// =============================================================================
+
+// Dump scratch (only the command handler dumps)
+static TranscriptEntry s_dumpEntry;
+static char s_dumpLine[TRANSCRIPT_LINE_MAX];
+
+void transcriptDump(void) {
+    uint32_t droppedAtStart = transcriptGetDropped();
+
+    for (uint32_t i = 0; ; i++) {
+        // Records are only written with the I2C mutex held. Records evicted
+        // since the dump started shift the rest towards index 0.
+        if (!syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+            return;
+        }
+        uint32_t evicted = transcriptGetDropped() - droppedAtStart;
+        if (evicted > i) {
+            i = evicted;  // The record we were at is gone; skip to the oldest
+        }
+        bool found = transcriptGet((uint16_t)(i - evicted), &s_dumpEntry);
+        syncReleaseI2C();
+
+        if (!found) {
+            return;
+        }
+        if (transcriptFormat(&s_dumpEntry, s_dumpLine, sizeof(s_dumpLine)) > 0) {
+            DEBUG_SERIAL.println(s_dumpLine);
+        }
+    }
+}
+
+#endif // NATIVE_TEST
@@ -0,0 +1,136 @@
+/**
+ * @file SongbirdTranscript.h
+ * @brief Notecard request/response transcript for Songbird
+ *
+ * With TRANSCRIPT_MODE, every Notecard transaction is recorded as the
+ * request and response JSON (as note-c serializes them, without the
+ * trailing newline), the millis() it was sent at and its latency in
+ * microseconds. Records are packed into a byte ring; when it is full the
+ * oldest records are dropped. Requests and responses longer than
+ * TRANSCRIPT_TEXT_MAX are truncated and flagged.
+ *
+ * The "transcript" command dumps the ring to the debug serial port, one
+ * line per record:
+ *   NCT<tab>seq<tab>at_ms<tab>latency_us<tab>flags<tab>request<tab>response
+ * Unformatted JSON never contains a literal tab or newline, so the line
+ * splits unambiguously. Gaps in seq are records dropped from the ring.
+ * test/support/NotecardReplay.h loads a capture of these lines and replays
+ * it against the firmware's response handling on the host.
+ *
+ * The ring and the line format are pure so they can be tested on the host;
+ * transcriptDump() is excluded from NATIVE_TEST builds.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_TRANSCRIPT_H
+#define SONGBIRD_TRANSCRIPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// =============================================================================
+// Sizes and Flags
+// =============================================================================
+
+#define TRANSCRIPT_BUFFER_SIZE      4096    // Bytes of record storage
+#define TRANSCRIPT_TEXT_MAX         255     // Request or response bytes kept per record
+#define TRANSCRIPT_LINE_MAX         (TRANSCRIPT_TEXT_MAX * 2 + 48)
+#define TRANSCRIPT_LINE_PREFIX      "NCT\t"
+
+#define TRANSCRIPT_FLAG_REQUEST_TRUNCATED   0x01
+#define TRANSCRIPT_FLAG_RESPONSE_TRUNCATED  0x02
+#define TRANSCRIPT_FLAG_NO_RESPONSE         0x04    // requestAndResponse returned NULL
+
+typedef struct {
+    uint32_t seq;               // Transaction number since boot
+    uint32_t atMs;              // millis() when the request was sent
+    uint32_t latencyUs;         // Request sent to response parsed
+    uint8_t flags;              // TRANSCRIPT_FLAG_*
+    char request[TRANSCRIPT_TEXT_MAX + 1];
+    char response[TRANSCRIPT_TEXT_MAX + 1];
+} TranscriptEntry;
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+/**
+ * @brief Clear the ring, the sequence number and the drop count
+ */
+void transcriptInit(void);
+
+/**
+ * @brief Record one transaction
+ *
+ * Caller must hold the I2C mutex (all Notecard transactions do), so there
+ * is only ever one writer.
+ *
+ * @param atMs millis() when the request was sent
+ * @param latencyUs Request to response, in microseconds
+ * @param request Request JSON (NULL if it could not be serialized)
+ * @param response Response JSON, or NULL if there was no response
+ */
+void transcriptRecord(uint32_t atMs, uint32_t latencyUs,
+                      const char* request, const char* response);
+
+/**
+ * @brief Get the number of records in the ring
+ *
+ * @return Records held, oldest first from index 0
+ */
+uint16_t transcriptCount(void);
+
+/**
+ * @brief Get the number of records dropped since the last clear
+ *
+ * @return Records evicted to make room for newer ones
+ */
+uint32_t transcriptGetDropped(void);
+
+/**
+ * @brief Copy a record out of the ring
+ *
+ * @param index 0 for the oldest record
+ * @param entry Output
+ * @return false if index is past the newest record
+ */
+bool transcriptGet(uint16_t index, TranscriptEntry* entry);
+
+// =============================================================================
+// Line Format
+// =============================================================================
+
+/**
+ * @brief Format a record as an NCT line (no line terminator)
+ *
+ * @param entry Record
+ * @param buffer Output, TRANSCRIPT_LINE_MAX bytes is always enough
+ * @param size Buffer size
+ * @return Characters written, or 0 if the buffer is too small
+ */
+size_t transcriptFormat(const TranscriptEntry* entry, char* buffer, size_t size);
+
+/**
+ * @brief Parse an NCT line
+ *
+ * Accepts a trailing CR and/or LF.
+ *
+ * @param line Line, starting with TRANSCRIPT_LINE_PREFIX
+ * @param entry Output
+ * @return false if the line is not a well-formed NCT line
+ */
+bool transcriptParse(const char* line, TranscriptEntry* entry);
+
+#ifndef NATIVE_TEST
+/**
+ * @brief Write every record to the debug serial port as NCT lines
+ *
+ * Takes the I2C mutex briefly per record, never while printing.
+ */
+void transcriptDump(void);
+#endif
+
+#endif // SONGBIRD_TRANSCRIPT_H
@@ -0,0 +1,59 @@
+/**
+ * @file STM32FreeRTOSConfig_extra.h
+ * @brief Songbird overrides for the STM32duino FreeRTOS configuration
+ *
+ * Picked up automatically by the STM32duino FreeRTOS library's default
+ * FreeRTOSConfig.h when present on the include path. Included from both C
+ * and C++ translation units.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef STM32_FREERTOS_CONFIG_EXTRA_H
+#define STM32_FREERTOS_CONFIG_EXTRA_H
+
+// =============================================================================
+// Memory Allocation
+// =============================================================================
+
+// Tasks, queues and semaphores are created with the *Static APIs (see
+// RTOS_STATIC in SongbirdSync.h), which also makes the idle and timer task
+// memory ours to supply. Dynamic allocation stays available because the
+// heap is shared with the Notecard library's JSON objects.
+#define configSUPPORT_STATIC_ALLOCATION         1
+
+// Check the stack pointer and the guard pattern at the end of the stack on
+// every switch out (vApplicationStackOverflowHook)
+#define configCHECK_FOR_STACK_OVERFLOW          2
+
+// =============================================================================
+// Run-Time Statistics (SongbirdRunStats)
+// =============================================================================
+
+#define configUSE_TRACE_FACILITY                1
+#define configGENERATE_RUN_TIME_STATS           1
+
+#if !defined(__ASSEMBLER__)
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void songbirdRunTimeCounterInit(void);
+uint32_t songbirdRunTimeCounterRead(void);
+void songbirdRunStatsSwitchIn(uint32_t taskNumber);
+#ifdef __cplusplus
+}
+#endif
+#endif // __ASSEMBLER__
+
+// DWT cycle counter, extended and scaled (see SongbirdRunStats.h)
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    songbirdRunTimeCounterInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()            songbirdRunTimeCounterRead()
+
+// Per-task wake counts. Expanded inside tasks.c where pxCurrentTCB is visible;
+// uxTaskNumber holds the RunStatsTask slot set by vTaskSetTaskNumber().
+#define traceTASK_SWITCHED_IN()     songbirdRunStatsSwitchIn((uint32_t)pxCurrentTCB->uxTaskNumber)
+
+#endif // STM32_FREERTOS_CONFIG_EXTRA_H
@@ -0,0 +1,86 @@
+/**
+ * @file SongbirdConfigStore.cpp
+ * @brief Lock-free published configuration implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdConfigStore.h"
+#include <string.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+// Generation g lives in s_buffers[g & 1]; the writer fills the other buffer
+static SongbirdConfig s_buffers[2];
+static uint32_t s_generation = 0;
+
+// =============================================================================
+// Store
+// =============================================================================
+
+void configStoreInit(void) {
+    memset(s_buffers, 0, sizeof(s_buffers));
+    __atomic_store_n(&s_generation, 0, __ATOMIC_RELEASE);
+}
+
+void configStorePublish(const SongbirdConfig* config) {
+    if (config == NULL) {
+        return;
+    }
+
+    uint32_t next = __atomic_load_n(&s_generation, __ATOMIC_RELAXED) + 1;
+    if (next == 0) {
+        next = 2;  // 0 means "never published"; keep the buffer parity
+    }
+
+    memcpy(&s_buffers[next & 1], config, sizeof(SongbirdConfig));
+    __atomic_store_n(&s_generation, next, __ATOMIC_RELEASE);
+}
+
+uint32_t configStoreGeneration(void) {
+    return __atomic_load_n(&s_generation, __ATOMIC_ACQUIRE);
+}
+
+uint32_t configStoreRead(SongbirdConfig* config) {
+    if (config == NULL) {
+        return 0;
+    }
+
+    for (;;) {
+        uint32_t generation = __atomic_load_n(&s_generation, __ATOMIC_ACQUIRE);
+        if (generation == 0) {
+            return 0;
+        }
+
+        memcpy(config, &s_buffers[generation & 1], sizeof(SongbirdConfig));
+
+        // Unchanged generation: the writer has not started on this buffer.
+        // Otherwise the next publication may be overwriting it; retry with
+        // the newer buffer, which the writer is done with.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&s_generation, __ATOMIC_RELAXED) == generation) {
+            return generation;
+        }
+    }
+}
+
+bool configStoreRefresh(SongbirdConfig* config, uint32_t* generation) {
+    if (config == NULL || generation == NULL) {
+        return false;
+    }
+
+    if (configStoreGeneration() == *generation) {
+        return false;
+    }
+
+    uint32_t copied = configStoreRead(config);
+    if (copied == 0) {
+        return false;
+    }
+
+    *generation = copied;
+    return true;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file SongbirdConfigStore.h
+ * @brief Lock-free published configuration for Songbird
+ *
+ * MainTask is the only writer: it keeps its own working copy of the config
+ * and publishes it after every change. Publishing writes the idle one of two
+ * buffers and then bumps a generation counter, so readers never wait on the
+ * writer. A reader copies the buffer selected by the generation and retries
+ * only if the generation moved during the copy; it never spins on a
+ * preempted writer, so a high-priority reader cannot livelock behind a
+ * lower-priority MainTask.
+ *
+ * Readers keep the generation of their last copy and skip the copy entirely
+ * while it is unchanged (configStoreRefresh()).
+ *
+ * Pure data structure (no FreeRTOS calls) so it can be unit tested on the
+ * host.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_CONFIG_STORE_H
+#define SONGBIRD_CONFIG_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+/**
+ * @brief Clear the store (nothing published, generation 0)
+ */
+void configStoreInit(void);
+
+/**
+ * @brief Publish a new configuration
+ *
+ * Single writer only (MainTask).
+ *
+ * @param config Configuration to publish
+ */
+void configStorePublish(const SongbirdConfig* config);
+
+/**
+ * @brief Get the generation of the latest publication
+ *
+ * @return Generation, 0 if nothing has been published
+ */
+uint32_t configStoreGeneration(void);
+
+/**
+ * @brief Copy the latest configuration
+ *
+ * @param config Output (untouched if nothing has been published)
+ * @return Generation of the copy, 0 if nothing has been published
+ */
+uint32_t configStoreRead(SongbirdConfig* config);
+
+/**
+ * @brief Copy the latest configuration if it is newer than the caller's
+ *
+ * @param config Caller's copy, updated in place
+ * @param generation Generation of the caller's copy, updated in place
+ * @return true if the copy was updated
+ */
+bool configStoreRefresh(SongbirdConfig* config, uint32_t* generation);
+
+#endif // SONGBIRD_CONFIG_STORE_H
@@ -0,0 +1,102 @@
+/**
+ * @file SongbirdJobs.cpp
+ * @brief Job schedule implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdJobs.h"
+#include <stddef.h>
+
+// =============================================================================
+// Job Schedule
+// =============================================================================
+
+void jobsInit(JobSchedule* jobs) {
+    if (jobs == NULL) {
+        return;
+    }
+
+    timerQueueInit(&jobs->timers);
+    jobs->sensorDueMs = 0;
+}
+
+void jobsArmAll(JobSchedule* jobs, uint32_t nowMs) {
+    if (jobs == NULL) {
+        return;
+    }
+
+    timerQueueCancel(&jobs->timers, JOB_SENSOR_READ);
+    timerQueueArm(&jobs->timers, JOB_SENSOR_START, nowMs);
+    timerQueueArm(&jobs->timers, JOB_COMMAND, nowMs);
+    timerQueueArm(&jobs->timers, JOB_ENV, nowMs);
+}
+
+void jobsRunNow(JobSchedule* jobs, uint8_t job, uint32_t nowMs) {
+    if (jobs == NULL) {
+        return;
+    }
+
+    timerQueueArm(&jobs->timers, job, nowMs);
+}
+
+bool jobsPopDue(JobSchedule* jobs, uint32_t nowMs, uint8_t* job, uint32_t* deadlineMs) {
+    if (jobs == NULL) {
+        return false;
+    }
+
+    return timerQueuePopDue(&jobs->timers, nowMs, job, deadlineMs);
+}
+
+void jobsFinished(JobSchedule* jobs, uint8_t job, uint32_t deadlineMs,
+                  uint32_t result, uint32_t nowMs) {
+    if (jobs == NULL) {
+        return;
+    }
+
+    switch (job) {
+        case JOB_SENSOR_START:
+            if (result == JOB_SENSOR_OFF) {
+                // Sleep mode - check the mode again later
+                timerQueueArm(&jobs->timers, JOB_SENSOR_START, nowMs + SLEEP_MODE_SENSOR_WAIT_MS);
+            } else {
+                // +1: millis() may be part way through the first millisecond
+                jobs->sensorDueMs = deadlineMs;
+                timerQueueArm(&jobs->timers, JOB_SENSOR_READ,
+                              result > 0 ? nowMs + result + 1 : nowMs);
+            }
+            break;
+
+        case JOB_SENSOR_READ: {
+            uint32_t nextMs = jobs->sensorDueMs + result;
+            if (result == 0) {
+                timerQueueArm(&jobs->timers, JOB_SENSOR_START, nowMs + SLEEP_MODE_SENSOR_WAIT_MS);
+            } else if (MS_REACHED(nowMs, nextMs)) {
+                // Overran the interval - restart the schedule from now
+                timerQueueArm(&jobs->timers, JOB_SENSOR_START, nowMs);
+            } else {
+                // Fixed rate: a period after this reading was due, however
+                // late another job made it start
+                timerQueueArm(&jobs->timers, JOB_SENSOR_START, nextMs);
+            }
+            break;
+        }
+
+        case JOB_COMMAND:
+        case JOB_ENV:
+            timerQueueArm(&jobs->timers, job, nowMs + result);
+            break;
+
+        default:
+            break;
+    }
+}
+
+uint32_t jobsWaitMs(const JobSchedule* jobs, uint32_t nowMs, uint32_t maxMs) {
+    if (jobs == NULL) {
+        return maxMs;
+    }
+
+    return timerQueueWaitMs(&jobs->timers, nowMs, maxMs);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file SongbirdJobs.h
+ * @brief Job schedule for JobsTask (JOBS_MODE)
+ *
+ * With JOBS_MODE, JobsTask runs the sensor, command and env work from one
+ * timer queue in place of their own tasks (see SongbirdTasks.h). This module
+ * owns that queue and the rules for when each job runs next; JobsTask pops
+ * a due job, does its work and hands back what the work returned.
+ *
+ * A reading is two jobs: JOB_SENSOR_START triggers the BME280 conversion
+ * and arms JOB_SENSOR_READ for when it completes, so the other jobs run
+ * during the conversion instead of JobsTask blocking through it.
+ *
+ * Pure logic (no FreeRTOS calls) so it can be unit tested on the host;
+ * only JobsTask touches its schedule, so it needs no locking.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_JOBS_H
+#define SONGBIRD_JOBS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+#include "SongbirdTimerQueue.h"
+
+// =============================================================================
+// Jobs
+// =============================================================================
+
+// Timer ids in the schedule; equal deadlines run in this order
+typedef enum {
+    JOB_SENSOR_START = 0,   // Apply the sensor profile, trigger a conversion
+    JOB_SENSOR_READ,        // Read the conversion, queue notes and alerts
+    JOB_COMMAND,            // Check command.qi
+    JOB_ENV,                // Check env.modified
+    JOB_COUNT
+} JobId;
+
+static_assert(JOB_COUNT <= TIMER_QUEUE_SIZE, "One timer per job");
+
+// JOB_SENSOR_START result when the mode disables sensors
+#define JOB_SENSOR_OFF      UINT32_MAX
+
+typedef struct {
+    TimerQueue timers;          // Next run of each job
+    uint32_t sensorDueMs;       // Deadline of the reading in progress
+} JobSchedule;
+
+// =============================================================================
+// Schedule Interface
+// =============================================================================
+
+/**
+ * @brief Disarm every job
+ *
+ * @param jobs Schedule
+ */
+void jobsInit(JobSchedule* jobs);
+
+/**
+ * @brief Run every job at once (startup and after a cancelled sleep)
+ *
+ * Starts a fresh reading: a conversion triggered before the sleep request
+ * is not read.
+ *
+ * @param jobs Schedule
+ * @param nowMs Current millis()
+ */
+void jobsArmAll(JobSchedule* jobs, uint32_t nowMs);
+
+/**
+ * @brief Bring a job forward to run now (an ATTN event for it arrived)
+ *
+ * @param jobs Schedule
+ * @param job Job id
+ * @param nowMs Current millis()
+ */
+void jobsRunNow(JobSchedule* jobs, uint8_t job, uint32_t nowMs);
+
+/**
+ * @brief Disarm and return the earliest due job
+ *
+ * @param jobs Schedule
+ * @param nowMs Current millis()
+ * @param job Output job id
+ * @param deadlineMs Output: the deadline it was due at
+ * @return true if a job was due, false otherwise
+ */
+bool jobsPopDue(JobSchedule* jobs, uint32_t nowMs, uint8_t* job, uint32_t* deadlineMs);
+
+/**
+ * @brief Arm a finished job's next run, timed the way its own task would
+ *
+ * The result is what the job's work returned:
+ * - JOB_SENSOR_START: milliseconds until the conversion is done, or
+ *   JOB_SENSOR_OFF if the mode disables sensors
+ * - JOB_SENSOR_READ: the reading period, kept at a fixed rate from the
+ *   start's deadline
+ * - JOB_COMMAND, JOB_ENV: milliseconds until the next poll
+ *
+ * @param jobs Schedule
+ * @param job Job id, as popped
+ * @param deadlineMs Deadline it was popped with
+ * @param result Work result (above)
+ * @param nowMs millis() when the work finished
+ */
+void jobsFinished(JobSchedule* jobs, uint8_t job, uint32_t deadlineMs,
+                  uint32_t result, uint32_t nowMs);
+
+/**
+ * @brief Get the time until the earliest job is due
+ *
+ * @param jobs Schedule
+ * @param nowMs Current millis()
+ * @param maxMs Returned when nothing is due sooner
+ * @return 0 if a job is due, otherwise milliseconds to wait (at most maxMs)
+ */
+uint32_t jobsWaitMs(const JobSchedule* jobs, uint32_t nowMs, uint32_t maxMs);
+
+#endif // SONGBIRD_JOBS_H
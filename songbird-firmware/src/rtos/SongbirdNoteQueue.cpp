@@ -0,0 +1,118 @@
+/**
+ * @file SongbirdNoteQueue.cpp
+ * @brief Priority-ordered outbound note queue implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdNoteQueue.h"
+#include <string.h>
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+// Remove the oldest note of a class and return its slot
+static uint8_t takeOldest(NoteQueue* queue, uint8_t priority) {
+    uint8_t slot = queue->order[priority][queue->head[priority]];
+    queue->head[priority] = (uint8_t)((queue->head[priority] + 1) % NOTE_QUEUE_SIZE);
+    queue->length[priority]--;
+    return slot;
+}
+
+// =============================================================================
+// Note Queue
+// =============================================================================
+
+void noteQueueInit(NoteQueue* queue) {
+    if (queue == NULL) {
+        return;
+    }
+
+    memset(queue, 0, sizeof(NoteQueue));
+    for (uint8_t i = 0; i < NOTE_QUEUE_SIZE; i++) {
+        queue->freeSlots[i] = i;
+    }
+    queue->freeCount = NOTE_QUEUE_SIZE;
+}
+
+NotePriority noteQueuePriority(NoteType type) {
+    switch (type) {
+        case NOTE_TYPE_ALERT:   return NOTE_PRIORITY_ALERT;
+        case NOTE_TYPE_CMD_ACK: return NOTE_PRIORITY_CMD_ACK;
+        case NOTE_TYPE_TRACK:   return NOTE_PRIORITY_TRACK;
+        default:                return NOTE_PRIORITY_HEALTH;
+    }
+}
+
+bool noteQueuePush(NoteQueue* queue, const NoteQueueItem* item,
+                   bool* evicted, NoteQueueItem* dropped) {
+    if (evicted != NULL) {
+        *evicted = false;
+    }
+    if (queue == NULL || item == NULL) {
+        return false;
+    }
+
+    uint8_t priority = (uint8_t)noteQueuePriority(item->type);
+    uint8_t slot;
+
+    if (queue->freeCount > 0) {
+        slot = queue->freeSlots[--queue->freeCount];
+    } else {
+        // Full: drop the oldest note of the lowest class that does not
+        // outrank the incoming note
+        int8_t victim = -1;
+        for (int8_t p = NOTE_PRIORITY_COUNT - 1; p >= (int8_t)priority; p--) {
+            if (queue->length[p] > 0) {
+                victim = p;
+                break;
+            }
+        }
+        if (victim < 0) {
+            queue->drops[priority]++;
+            if (dropped != NULL) {
+                memcpy(dropped, item, sizeof(NoteQueueItem));
+            }
+            return false;
+        }
+        slot = takeOldest(queue, (uint8_t)victim);
+        queue->drops[victim]++;
+        if (dropped != NULL) {
+            memcpy(dropped, &queue->items[slot], sizeof(NoteQueueItem));
+        }
+        if (evicted != NULL) {
+            *evicted = true;
+        }
+    }
+
+    memcpy(&queue->items[slot], item, sizeof(NoteQueueItem));
+    uint8_t tail = (uint8_t)((queue->head[priority] + queue->length[priority]) % NOTE_QUEUE_SIZE);
+    queue->order[priority][tail] = slot;
+    queue->length[priority]++;
+    return true;
+}
+
+bool noteQueuePop(NoteQueue* queue, NoteQueueItem* item) {
+    if (queue == NULL || item == NULL) {
+        return false;
+    }
+
+    for (uint8_t p = 0; p < NOTE_PRIORITY_COUNT; p++) {
+        if (queue->length[p] > 0) {
+            uint8_t slot = takeOldest(queue, p);
+            memcpy(item, &queue->items[slot], sizeof(NoteQueueItem));
+            queue->freeSlots[queue->freeCount++] = slot;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t noteQueueCount(const NoteQueue* queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    return NOTE_QUEUE_SIZE - queue->freeCount;
+}
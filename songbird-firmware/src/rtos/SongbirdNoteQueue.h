@@ -0,0 +1,133 @@
+/**
+ * @file SongbirdNoteQueue.h
+ * @brief Priority-ordered outbound note queue for Songbird
+ *
+ * Outbound notes share NOTE_QUEUE_SIZE slots but are delivered by class,
+ * highest priority first and FIFO within a class:
+ *
+ *   alert > command ack > track > health
+ *
+ * so an alert queued behind a backlog of track notes is the next note
+ * NotecardTask sends. When the queue is full the oldest note of the lowest
+ * priority class at or below the incoming note's priority is dropped to make
+ * room; if every queued note outranks the incoming one, the incoming note is
+ * dropped instead. Drops are counted per class.
+ *
+ * Pure data structure (no FreeRTOS calls) so it can be unit tested on the
+ * host; SongbirdSync wraps it with a critical section and a counting
+ * semaphore for blocking receives.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_NOTE_QUEUE_H
+#define SONGBIRD_NOTE_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Queue Item
+// =============================================================================
+
+// Note type for outbound queue
+typedef enum {
+    NOTE_TYPE_TRACK = 0,
+    NOTE_TYPE_ALERT,
+    NOTE_TYPE_CMD_ACK,
+    NOTE_TYPE_HEALTH
+} NoteType;
+
+// Note queue item
+typedef struct {
+    NoteType type;
+    bool forceSync;             // Force immediate sync (e.g., for mode changes)
+    uint32_t createdMs;         // millis() at creation, alerts at the sample (0 = unknown)
+    union {
+        SensorData track;
+        AlertNote alert;
+        CommandAck ack;
+        HealthRequest health;       // Built into HealthData at send time
+    } data;
+} NoteQueueItem;
+
+// Delivery classes, highest priority first
+typedef enum {
+    NOTE_PRIORITY_ALERT = 0,
+    NOTE_PRIORITY_CMD_ACK,
+    NOTE_PRIORITY_TRACK,
+    NOTE_PRIORITY_HEALTH
+} NotePriority;
+
+static_assert(NOTE_PRIORITY_HEALTH + 1 == NOTE_PRIORITY_COUNT,
+              "NOTE_PRIORITY_COUNT must match NotePriority");
+static_assert(NOTE_QUEUE_SIZE <= 255, "Slot indices are one byte");
+static_assert(sizeof(HealthRequest) <= sizeof(CommandAck),
+              "A health request must not set the slot size (HealthData is built at send time)");
+
+// =============================================================================
+// Queue Structure
+// =============================================================================
+
+typedef struct {
+    NoteQueueItem items[NOTE_QUEUE_SIZE];                       // Slot pool
+    uint8_t order[NOTE_PRIORITY_COUNT][NOTE_QUEUE_SIZE];        // Per-class FIFO of slots
+    uint8_t head[NOTE_PRIORITY_COUNT];
+    uint8_t length[NOTE_PRIORITY_COUNT];
+    uint8_t freeSlots[NOTE_QUEUE_SIZE];                         // Stack of unused slots
+    uint8_t freeCount;
+    uint32_t drops[NOTE_PRIORITY_COUNT];                        // Notes dropped per class
+} NoteQueue;
+
+// =============================================================================
+// Queue Interface
+// =============================================================================
+
+/**
+ * @brief Empty the queue and reset drop counters
+ *
+ * @param queue Queue
+ */
+void noteQueueInit(NoteQueue* queue);
+
+/**
+ * @brief Get the delivery class of a note type
+ *
+ * @param type Note type
+ * @return Delivery class
+ */
+NotePriority noteQueuePriority(NoteType type);
+
+/**
+ * @brief Add a note, evicting a lower-priority note if full
+ *
+ * @param queue Queue
+ * @param item Note to copy in
+ * @param evicted Output (optional): true if a queued note was dropped to make room
+ * @param dropped Output (optional): the note that was dropped, either the
+ *                evicted one or the incoming one; untouched if none was
+ * @return true if the note was queued, false if it was dropped
+ */
+bool noteQueuePush(NoteQueue* queue, const NoteQueueItem* item,
+                   bool* evicted, NoteQueueItem* dropped);
+
+/**
+ * @brief Remove the highest priority note
+ *
+ * @param queue Queue
+ * @param item Output note
+ * @return true if a note was removed, false if the queue is empty
+ */
+bool noteQueuePop(NoteQueue* queue, NoteQueueItem* item);
+
+/**
+ * @brief Get the number of queued notes
+ *
+ * @param queue Queue
+ * @return Queued notes across all classes
+ */
+uint32_t noteQueueCount(const NoteQueue* queue);
+
+#endif // SONGBIRD_NOTE_QUEUE_H
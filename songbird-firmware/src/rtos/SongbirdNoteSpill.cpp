@@ -0,0 +1,340 @@
+/**
+ * @file SongbirdNoteSpill.cpp
+ * @brief Dense overflow store for outbound notes implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdNoteSpill.h"
+#include <string.h>
+#include <math.h>
+
+// Record flags
+#define SPILL_FLAG_FORCE_SYNC   (1 << 0)
+#define SPILL_FLAG_MOTION       (1 << 1)
+#define SPILL_FLAG_VALID        (1 << 2)
+
+// Signed fixed-point fields store NAN as this value
+#define SPILL_FIXED_NAN         INT16_MIN
+
+// =============================================================================
+// Encoding Helpers
+// =============================================================================
+
+static void put16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)(value & 0xFF);
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t value) {
+    put16(p, (uint16_t)(value & 0xFFFF));
+    put16(p + 2, (uint16_t)(value >> 16));
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)get16(p) | ((uint32_t)get16(p + 2) << 16);
+}
+
+// Scaled, rounded and clamped; NAN maps to SPILL_FIXED_NAN
+static int16_t packSigned(float value, float scale) {
+    if (isnan(value)) {
+        return SPILL_FIXED_NAN;
+    }
+    float scaled = roundf(value * scale);
+    if (scaled > 32767.0f) return 32767;
+    if (scaled < -32767.0f) return -32767;
+    return (int16_t)scaled;
+}
+
+static float unpackSigned(int16_t value, float scale) {
+    return (value == SPILL_FIXED_NAN) ? NAN : (float)value / scale;
+}
+
+static uint16_t packUnsigned(float value, float scale) {
+    if (isnan(value) || value <= 0.0f) {
+        return 0;
+    }
+    float scaled = roundf(value * scale);
+    return (scaled > 65535.0f) ? 65535 : (uint16_t)scaled;
+}
+
+// Length of the record at p, or 0 if it is malformed or truncated
+static size_t recordLength(const uint8_t* p, size_t available) {
+    if (available < 2) {
+        return 0;
+    }
+
+    size_t length = 0;
+    switch (p[0]) {
+        case NOTE_TYPE_TRACK:
+            length = NOTE_SPILL_TRACK_LEN;
+            break;
+        case NOTE_TYPE_ALERT:
+            length = NOTE_SPILL_ALERT_LEN;
+            break;
+        case NOTE_TYPE_CMD_ACK: {
+            if (available < 9) {
+                return 0;
+            }
+            uint8_t idLen = p[8];
+            if (idLen >= sizeof(((CommandAck*)0)->commandId) || available < 10u + idLen) {
+                return 0;
+            }
+            uint8_t msgLen = p[9 + idLen];
+            if (msgLen >= sizeof(((CommandAck*)0)->message)) {
+                return 0;
+            }
+            length = 10u + idLen + msgLen;
+            break;
+        }
+        default:
+            return 0;
+    }
+    return (length <= available) ? length : 0;
+}
+
+// Encode a note into out; returns the record length, 0 if not spilled
+static size_t encodeRecord(const NoteQueueItem* item, uint8_t* out) {
+    out[0] = (uint8_t)item->type;
+    out[1] = item->forceSync ? SPILL_FLAG_FORCE_SYNC : 0;
+
+    switch (item->type) {
+        case NOTE_TYPE_TRACK: {
+            const SensorData* track = &item->data.track;
+            if (track->motion) out[1] |= SPILL_FLAG_MOTION;
+            if (track->valid) out[1] |= SPILL_FLAG_VALID;
+            put16(out + 2, (uint16_t)packSigned(track->temperature, 100.0f));
+            put16(out + 4, packUnsigned(track->humidity, 100.0f));
+            put16(out + 6, packUnsigned(track->pressure, 10.0f));
+            put32(out + 8, track->timestamp);
+            return NOTE_SPILL_TRACK_LEN;
+        }
+
+        case NOTE_TYPE_ALERT: {
+            const AlertNote* alert = &item->data.alert;
+            out[2] = alert->raised;
+            out[3] = alert->cleared;
+            put16(out + 4, (uint16_t)packSigned(alert->temperature, 100.0f));
+            put16(out + 6, packUnsigned(alert->humidity, 100.0f));
+            put16(out + 8, packUnsigned(alert->pressure, 10.0f));
+            put16(out + 10, packUnsigned(alert->voltage, 1000.0f));
+            put16(out + 12, (uint16_t)packSigned(alert->tempRate, 10.0f));
+            put16(out + 14, (uint16_t)packSigned(alert->pressureTendency, 10.0f));
+            put32(out + 16, alert->timestamp);
+            put16(out + 20, (uint16_t)packSigned(alert->tempThreshold, 100.0f));
+            put16(out + 22, (uint16_t)packSigned(alert->humidityThreshold, 100.0f));
+            put16(out + 24, (uint16_t)packSigned(alert->pressureThreshold, 10.0f));
+            put16(out + 26, (uint16_t)packSigned(alert->voltageThreshold, 1000.0f));
+            put16(out + 28, (uint16_t)packSigned(alert->tempRateThreshold, 10.0f));
+            return NOTE_SPILL_ALERT_LEN;
+        }
+
+        case NOTE_TYPE_CMD_ACK: {
+            const CommandAck* ack = &item->data.ack;
+            size_t idLen = strnlen(ack->commandId, sizeof(ack->commandId) - 1);
+            size_t msgLen = strnlen(ack->message, sizeof(ack->message) - 1);
+            out[2] = (uint8_t)ack->type;
+            out[3] = (uint8_t)ack->status;
+            put32(out + 4, ack->executedAt);
+            out[8] = (uint8_t)idLen;
+            memcpy(out + 9, ack->commandId, idLen);
+            out[9 + idLen] = (uint8_t)msgLen;
+            memcpy(out + 10 + idLen, ack->message, msgLen);
+            return 10 + idLen + msgLen;
+        }
+
+        default:
+            // Health notes are superseded by the next report
+            return 0;
+    }
+}
+
+static void decodeRecord(const uint8_t* p, NoteQueueItem* item) {
+    memset(item, 0, sizeof(NoteQueueItem));
+    item->type = (NoteType)p[0];
+    item->forceSync = (p[1] & SPILL_FLAG_FORCE_SYNC) != 0;
+
+    switch (item->type) {
+        case NOTE_TYPE_TRACK: {
+            SensorData* track = &item->data.track;
+            track->motion = (p[1] & SPILL_FLAG_MOTION) != 0;
+            track->valid = (p[1] & SPILL_FLAG_VALID) != 0;
+            track->temperature = unpackSigned((int16_t)get16(p + 2), 100.0f);
+            track->humidity = get16(p + 4) / 100.0f;
+            track->pressure = get16(p + 6) / 10.0f;
+            track->timestamp = get32(p + 8);
+            break;
+        }
+
+        case NOTE_TYPE_ALERT: {
+            AlertNote* alert = &item->data.alert;
+            alert->raised = p[2];
+            alert->cleared = p[3];
+            alert->temperature = unpackSigned((int16_t)get16(p + 4), 100.0f);
+            alert->humidity = get16(p + 6) / 100.0f;
+            alert->pressure = get16(p + 8) / 10.0f;
+            alert->voltage = get16(p + 10) / 1000.0f;
+            alert->tempRate = unpackSigned((int16_t)get16(p + 12), 10.0f);
+            alert->pressureTendency = unpackSigned((int16_t)get16(p + 14), 10.0f);
+            alert->timestamp = get32(p + 16);
+            alert->tempThreshold = unpackSigned((int16_t)get16(p + 20), 100.0f);
+            alert->humidityThreshold = unpackSigned((int16_t)get16(p + 22), 100.0f);
+            alert->pressureThreshold = unpackSigned((int16_t)get16(p + 24), 10.0f);
+            alert->voltageThreshold = unpackSigned((int16_t)get16(p + 26), 1000.0f);
+            alert->tempRateThreshold = unpackSigned((int16_t)get16(p + 28), 10.0f);
+            break;
+        }
+
+        case NOTE_TYPE_CMD_ACK: {
+            CommandAck* ack = &item->data.ack;
+            uint8_t idLen = p[8];
+            uint8_t msgLen = p[9 + idLen];
+            ack->type = (CommandType)p[2];
+            ack->status = (CommandStatus)p[3];
+            ack->executedAt = get32(p + 4);
+            memcpy(ack->commandId, p + 9, idLen);
+            memcpy(ack->message, p + 10 + idLen, msgLen);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// Move the records to the front of the buffer (after the version byte)
+static void compact(NoteSpill* spill) {
+    if (spill->head > 1) {
+        memmove(&spill->data[1], &spill->data[spill->head], spill->tail - spill->head);
+        spill->tail = (uint16_t)(spill->tail - (spill->head - 1));
+        spill->head = 1;
+    }
+}
+
+static bool appendRecord(NoteSpill* spill, const uint8_t* record, size_t length) {
+    if (spill->tail + length > NOTE_SPILL_SIZE) {
+        compact(spill);
+        if (spill->tail + length > NOTE_SPILL_SIZE) {
+            return false;
+        }
+    }
+    memcpy(&spill->data[spill->tail], record, length);
+    spill->tail = (uint16_t)(spill->tail + length);
+    spill->count++;
+    return true;
+}
+
+// =============================================================================
+// Note Spill
+// =============================================================================
+
+void noteSpillInit(NoteSpill* spill) {
+    if (spill == NULL) {
+        return;
+    }
+
+    memset(spill, 0, sizeof(NoteSpill));
+    spill->data[0] = NOTE_SPILL_VERSION;
+    spill->head = 1;
+    spill->tail = 1;
+}
+
+bool noteSpillPut(NoteSpill* spill, const NoteQueueItem* item) {
+    if (spill == NULL || item == NULL) {
+        return false;
+    }
+
+    uint8_t record[NOTE_SPILL_ACK_MAX_LEN];
+    size_t length = encodeRecord(item, record);
+    if (length == 0) {
+        return false;
+    }
+    return appendRecord(spill, record, length);
+}
+
+bool noteSpillTake(NoteSpill* spill, NoteQueueItem* item) {
+    if (spill == NULL || item == NULL || spill->count == 0) {
+        return false;
+    }
+
+    const uint8_t* record = &spill->data[spill->head];
+    size_t length = recordLength(record, spill->tail - spill->head);
+    if (length == 0) {
+        // Records are validated on the way in; never expected
+        noteSpillInit(spill);
+        return false;
+    }
+
+    decodeRecord(record, item);
+    spill->head = (uint16_t)(spill->head + length);
+    spill->count--;
+    if (spill->count == 0) {
+        spill->head = 1;
+        spill->tail = 1;
+    }
+    return true;
+}
+
+bool noteSpillOffer(NoteQueue* queue, NoteSpill* spill, const NoteQueueItem* item,
+                    NoteOffer* offer) {
+    if (offer == NULL) {
+        return false;
+    }
+    memset(offer, 0, sizeof(NoteOffer));
+    if (queue == NULL || item == NULL) {
+        return false;
+    }
+
+    NoteQueueItem dropped;
+    dropped.type = item->type;
+    offer->queued = noteQueuePush(queue, item, &offer->evicted, &dropped);
+    if (!offer->queued || offer->evicted) {
+        offer->spilled = noteSpillPut(spill, &dropped);
+        offer->lost = !offer->spilled;
+        offer->lostType = dropped.type;
+    }
+    return offer->queued || offer->spilled;
+}
+
+uint16_t noteSpillCount(const NoteSpill* spill) {
+    if (spill == NULL) {
+        return 0;
+    }
+    return spill->count;
+}
+
+const uint8_t* noteSpillBlob(NoteSpill* spill, size_t* length) {
+    if (length != NULL) {
+        *length = 0;
+    }
+    if (spill == NULL || length == NULL || spill->count == 0) {
+        return NULL;
+    }
+
+    compact(spill);
+    *length = spill->tail;
+    return spill->data;
+}
+
+uint16_t noteSpillImport(NoteSpill* spill, const uint8_t* blob, size_t length) {
+    if (spill == NULL || blob == NULL || length < 1 || blob[0] != NOTE_SPILL_VERSION) {
+        return 0;
+    }
+
+    uint16_t imported = 0;
+    size_t offset = 1;
+    while (offset < length) {
+        size_t recordLen = recordLength(&blob[offset], length - offset);
+        if (recordLen == 0 || !appendRecord(spill, &blob[offset], recordLen)) {
+            break;
+        }
+        offset += recordLen;
+        imported++;
+    }
+    return imported;
+}
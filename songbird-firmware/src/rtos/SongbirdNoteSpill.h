@@ -0,0 +1,141 @@
+/**
+ * @file SongbirdNoteSpill.h
+ * @brief Dense overflow store for outbound notes
+ *
+ * Notes that overflow the outbound priority queue, and notes still queued
+ * when the device shuts down, are packed into fixed-point binary records
+ * (12 bytes per track note, 30 per alert instead of a 124 byte queue slot)
+ * in a RAM spill buffer. NotecardTask replays the buffer once the queue is
+ * empty. On PVD shutdown the buffer is written to Notecard flash in a single
+ * request and imported again on the next boot.
+ *
+ * Blob layout: NOTE_SPILL_VERSION, then records back to back. Each record
+ * starts with its NoteType and a flags byte; multi-byte fields are little
+ * endian. Health notes are not spilled: they summarise a window that a new
+ * report supersedes.
+ *
+ * Pure data structure (no FreeRTOS calls) so it can be unit tested on the
+ * host; SongbirdSync guards it with the note queue's critical section.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_NOTE_SPILL_H
+#define SONGBIRD_NOTE_SPILL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "SongbirdConfig.h"
+#include "SongbirdNoteQueue.h"
+
+#define NOTE_SPILL_VERSION      2
+
+// Record sizes
+#define NOTE_SPILL_TRACK_LEN    12
+#define NOTE_SPILL_ALERT_LEN    30
+#define NOTE_SPILL_ACK_MAX_LEN  (10 + sizeof(((CommandAck*)0)->commandId) + sizeof(((CommandAck*)0)->message))
+
+static_assert(NOTE_SPILL_SIZE <= 65535, "Spill offsets are 16 bits");
+
+// =============================================================================
+// Spill Structure
+// =============================================================================
+
+typedef struct {
+    uint8_t data[NOTE_SPILL_SIZE];  // data[0] = NOTE_SPILL_VERSION, then records
+    uint16_t head;                  // Offset of the oldest record
+    uint16_t tail;                  // Offset past the newest record
+    uint16_t count;                 // Records held
+} NoteSpill;
+
+// What noteSpillOffer() did with a note
+typedef struct {
+    bool queued;                    // The note went into the queue
+    bool evicted;                   // A queued note was dropped to make room
+    bool spilled;                   // The dropped note (evicted or incoming) was spilled
+    bool lost;                      // The dropped note was neither queued nor spilled
+    NoteType lostType;              // Its type, valid when lost
+} NoteOffer;
+
+// =============================================================================
+// Spill Interface
+// =============================================================================
+
+/**
+ * @brief Empty the spill buffer
+ *
+ * @param spill Spill buffer
+ */
+void noteSpillInit(NoteSpill* spill);
+
+/**
+ * @brief Encode a note and append it
+ *
+ * @param spill Spill buffer
+ * @param item Note to store
+ * @return true if stored, false if full or the note type is not spilled
+ */
+bool noteSpillPut(NoteSpill* spill, const NoteQueueItem* item);
+
+/**
+ * @brief Remove and decode the oldest note
+ *
+ * Values come back at record precision (0.01 C / %RH, 0.1 hPa, 1 mV).
+ *
+ * @param spill Spill buffer
+ * @param item Output note
+ * @return true if a note was removed, false if empty
+ */
+bool noteSpillTake(NoteSpill* spill, NoteQueueItem* item);
+
+/**
+ * @brief Get the number of spilled notes
+ *
+ * @param spill Spill buffer
+ * @return Records held
+ */
+uint16_t noteSpillCount(const NoteSpill* spill);
+
+/**
+ * @brief Queue a note, spilling whatever the queue drops to make room
+ *
+ * The queue evicts its oldest lower-priority note, or rejects the incoming
+ * one; that note goes to the spill buffer, and is lost only if it does not
+ * fit (or is a health note).
+ *
+ * @param queue Queue
+ * @param spill Spill buffer
+ * @param item Note to queue
+ * @param offer Output: what happened
+ * @return true if the incoming note was queued or spilled
+ */
+bool noteSpillOffer(NoteQueue* queue, NoteSpill* spill, const NoteQueueItem* item,
+                    NoteOffer* offer);
+
+/**
+ * @brief Get the buffer as a blob for persistence
+ *
+ * Compacts the records to the front of the buffer; the pointer is valid
+ * until the spill is modified.
+ *
+ * @param spill Spill buffer
+ * @param length Output blob length
+ * @return Blob, or NULL if there are no records
+ */
+const uint8_t* noteSpillBlob(NoteSpill* spill, size_t* length);
+
+/**
+ * @brief Append the records of a persisted blob
+ *
+ * Stops at the first malformed record or when the buffer is full.
+ *
+ * @param spill Spill buffer
+ * @param blob Blob from noteSpillBlob()
+ * @param length Blob length
+ * @return Number of records imported
+ */
+uint16_t noteSpillImport(NoteSpill* spill, const uint8_t* blob, size_t length);
+
+#endif // SONGBIRD_NOTE_SPILL_H
@@ -0,0 +1,225 @@
+/**
+ * @file SongbirdRunStats.cpp
+ * @brief FreeRTOS run-time statistics implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdRunStats.h"
+#include <string.h>
+
+// =============================================================================
+// Report Computation
+// =============================================================================
+
+static const char* const TASK_NAMES[RUNSTATS_TASK_COUNT] = {
+    "other",
+    "main",
+    "sensor",
+    "audio",
+    "command",
+    "notecard",
+    "env",
+    "jobs",
+    "idle"
+};
+
+static uint32_t countsToMs(uint64_t counts, uint32_t counterHz) {
+    if (counterHz == 0) {
+        return 0;
+    }
+    return (uint32_t)((counts * 1000) / counterHz);
+}
+
+void runStatsWiden(RunStatsWidener* widener, uint32_t totalTime,
+                   const uint32_t runTime[RUNSTATS_TASK_COUNT]) {
+    if (widener == NULL || runTime == NULL) {
+        return;
+    }
+
+    widener->totalTime += (uint32_t)(totalTime - widener->lastTotal);
+    widener->lastTotal = totalTime;
+    for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+        widener->runTime[i] += (uint32_t)(runTime[i] - widener->lastRunTime[i]);
+        widener->lastRunTime[i] = runTime[i];
+    }
+}
+
+void runStatsComputeReport(const RunStatsSample* prev, const RunStatsSample* cur,
+                           uint32_t counterHz, RunStatsReport* report) {
+    if (prev == NULL || cur == NULL || report == NULL) {
+        return;
+    }
+
+    memset(report, 0, sizeof(RunStatsReport));
+
+    uint64_t window = cur->totalTime - prev->totalTime;
+    report->windowMs = countsToMs(window, counterHz);
+
+    for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+        uint64_t ran = cur->runTime[i] - prev->runTime[i];
+        if (window > 0) {
+            uint64_t permille = (ran * 1000 + window / 2) / window;
+            report->loadPermille[i] = (uint16_t)MIN(permille, (uint64_t)1000);
+        }
+        report->wakes[i] = cur->wakes[i] - prev->wakes[i];
+        report->stackFreeMin[i] = cur->stackFreeMin[i];
+    }
+
+    if (window > 0) {
+        report->cpuPermille = 1000 - report->loadPermille[RUNSTATS_TASK_IDLE];
+    }
+
+    report->i2cAcquires = cur->i2cAcquires - prev->i2cAcquires;
+    report->i2cWaitMs = countsToMs(cur->i2cWaitTime - prev->i2cWaitTime, counterHz);
+    report->i2cWaitMaxMs = countsToMs(cur->i2cWaitMax, counterHz);
+}
+
+const char* runStatsTaskName(RunStatsTask task) {
+    if (task < RUNSTATS_TASK_COUNT) {
+        return TASK_NAMES[task];
+    }
+    return "unknown";
+}
+
+#ifndef NATIVE_TEST
+
+#include <Arduino.h>
+#include <STM32FreeRTOS.h>
+#include <stm32l4xx_hal.h>
+
+// =============================================================================
+// Module State
+// =============================================================================
+
+// Software extension of DWT->CYCCNT (only touched inside critical sections)
+static uint64_t s_cycles = 0;
+static uint32_t s_lastCycnt = 0;
+
+// Written from the scheduler (switch-in) and syncAcquireI2C()
+static volatile uint32_t s_wakes[RUNSTATS_TASK_COUNT];
+static volatile uint32_t s_i2cAcquires = 0;
+static volatile uint32_t s_i2cWaitTime = 0;
+static volatile uint32_t s_i2cWaitMax = 0;
+
+// The idle task is created by the scheduler, so it is tagged on first sample
+static bool s_idleTagged = false;
+
+// 64-bit run times (MainTask only: runStatsUpdate() and runStatsCollect())
+static RunStatsWidener s_widener;
+static uint16_t s_stackFreeMin[RUNSTATS_TASK_COUNT];
+
+// =============================================================================
+// Run-Time Counter
+// =============================================================================
+
+extern "C" void songbirdRunTimeCounterInit(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    s_lastCycnt = 0;
+    s_cycles = 0;
+}
+
+extern "C" uint32_t songbirdRunTimeCounterRead(void) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    uint32_t now = DWT->CYCCNT;
+    s_cycles += (uint32_t)(now - s_lastCycnt);
+    s_lastCycnt = now;
+    uint32_t value = (uint32_t)(s_cycles >> RUNSTATS_COUNTER_SHIFT);
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+    return value;
+}
+
+extern "C" void songbirdRunStatsSwitchIn(uint32_t taskNumber) {
+    if (taskNumber < RUNSTATS_TASK_COUNT) {
+        s_wakes[taskNumber]++;
+    }
+}
+
+uint32_t runStatsCounterHz(void) {
+    return SystemCoreClock >> RUNSTATS_COUNTER_SHIFT;
+}
+
+// =============================================================================
+// Collection
+// =============================================================================
+
+void runStatsRecordI2CWait(uint32_t waitTime) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    s_i2cAcquires++;
+    s_i2cWaitTime += waitTime;
+    if (waitTime > s_i2cWaitMax) {
+        s_i2cWaitMax = waitTime;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+}
+
+// Fold the counters into the widener. Callers suspend the scheduler: MainTask
+// widens every hour and NotecardTask samples for each health.qo.
+static void updateSuspended(void) {
+    uint32_t runTime[RUNSTATS_TASK_COUNT] = { 0 };
+    for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+        s_stackFreeMin[i] = RUNSTATS_STACK_UNKNOWN;
+    }
+
+    // Songbird runs a fixed set of tasks; leave headroom for idle and timers
+    TaskStatus_t tasks[RUNSTATS_TASK_COUNT + 2];
+    uint32_t totalTime = 0;
+    UBaseType_t count = uxTaskGetSystemState(tasks, RUNSTATS_TASK_COUNT + 2, &totalTime);
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        UBaseType_t slot = uxTaskGetTaskNumber(tasks[i].xHandle);
+        if (!s_idleTagged && strcmp(tasks[i].pcTaskName, "IDLE") == 0) {
+            vTaskSetTaskNumber(tasks[i].xHandle, RUNSTATS_TASK_IDLE);
+            slot = RUNSTATS_TASK_IDLE;
+            s_idleTagged = true;
+        }
+        if (slot >= RUNSTATS_TASK_COUNT) {
+            slot = RUNSTATS_TASK_OTHER;
+        }
+        // Slots shared by several tasks sum modulo 2^32, which widens the same
+        runTime[slot] += tasks[i].ulRunTimeCounter;
+
+        // Slots shared by several tasks (other) report the tightest one
+        uint32_t stackFree = (uint32_t)tasks[i].usStackHighWaterMark * sizeof(StackType_t);
+        if (stackFree < s_stackFreeMin[slot]) {
+            s_stackFreeMin[slot] = (uint16_t)stackFree;
+        }
+    }
+
+    runStatsWiden(&s_widener, totalTime, runTime);
+}
+
+void runStatsUpdate(void) {
+    vTaskSuspendAll();
+    updateSuspended();
+    xTaskResumeAll();
+}
+
+void runStatsCollect(RunStatsSample* sample) {
+    if (sample == NULL) {
+        return;
+    }
+
+    memset(sample, 0, sizeof(RunStatsSample));
+    vTaskSuspendAll();
+    updateSuspended();
+    sample->totalTime = s_widener.totalTime;
+    memcpy(sample->runTime, s_widener.runTime, sizeof(sample->runTime));
+    memcpy(sample->stackFreeMin, s_stackFreeMin, sizeof(sample->stackFreeMin));
+    xTaskResumeAll();
+
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+        sample->wakes[i] = s_wakes[i];
+    }
+    sample->i2cAcquires = s_i2cAcquires;
+    sample->i2cWaitTime = s_i2cWaitTime;
+    sample->i2cWaitMax = s_i2cWaitMax;
+    s_i2cWaitMax = 0;
+    taskEXIT_CRITICAL();
+}
+
+#endif // NATIVE_TEST
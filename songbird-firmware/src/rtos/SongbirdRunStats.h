@@ -0,0 +1,169 @@
+/**
+ * @file SongbirdRunStats.h
+ * @brief FreeRTOS run-time statistics for Songbird
+ *
+ * Collects per-task CPU time, context switch-in (wake) counts and time spent
+ * blocked on the I2C mutex, and reduces two samples into a RunStatsReport
+ * for the periodic health.qo note.
+ *
+ * The run-time counter is the Cortex-M4 DWT cycle counter extended to 64 bits
+ * in software and scaled down by RUNSTATS_COUNTER_SHIFT, so the 32-bit values
+ * FreeRTOS accumulates wrap only every few hours at 80 MHz. runStatsUpdate()
+ * widens them to 64 bits again; MainTask calls it every
+ * RUNSTATS_UPDATE_INTERVAL_MS, well inside the wrap, so a report window can
+ * be as long as the heartbeat.
+ *
+ * The report computation is pure so it can be tested on the host; the
+ * collection half is excluded from NATIVE_TEST builds.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_RUNSTATS_H
+#define SONGBIRD_RUNSTATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// Cycle counter divider (80 MHz >> 8 = 312.5 kHz, wraps every ~3.8 hours)
+#define RUNSTATS_COUNTER_SHIFT  8
+
+// Widen the 32-bit counters at least this often (runStatsUpdate())
+#define RUNSTATS_UPDATE_INTERVAL_MS (60UL * 60UL * 1000UL)
+
+static_assert(RUNSTATS_UPDATE_INTERVAL_MS / 1000 <
+              (1ULL << (32 + RUNSTATS_COUNTER_SHIFT)) / 80000000ULL,
+              "Run-time counters must be widened before they wrap at 80 MHz");
+
+// =============================================================================
+// Sample Structure
+// =============================================================================
+
+typedef struct {
+    uint64_t totalTime;                         // Run-time counter at sample time
+    uint64_t runTime[RUNSTATS_TASK_COUNT];      // Cumulative run time per slot
+    uint32_t wakes[RUNSTATS_TASK_COUNT];        // Cumulative switch-ins per slot
+    uint32_t i2cAcquires;                       // Cumulative I2C mutex acquisitions
+    uint32_t i2cWaitTime;                       // Cumulative I2C wait (counter units)
+    uint32_t i2cWaitMax;                        // Longest wait since previous sample
+    uint16_t stackFreeMin[RUNSTATS_TASK_COUNT]; // Lowest stack high-water mark in the slot, bytes
+} RunStatsSample;
+
+// 32-bit FreeRTOS counters as last seen, and their 64-bit running totals
+typedef struct {
+    uint32_t lastTotal;
+    uint32_t lastRunTime[RUNSTATS_TASK_COUNT];
+    uint64_t totalTime;
+    uint64_t runTime[RUNSTATS_TASK_COUNT];
+} RunStatsWidener;
+
+// =============================================================================
+// Report Computation (pure)
+// =============================================================================
+
+/**
+ * @brief Fold the current 32-bit counters into 64-bit totals
+ *
+ * Each delta since the previous call is taken modulo 2^32, so the totals
+ * stay exact as long as calls are less than one counter wrap apart.
+ *
+ * @param widener Widening state (zeroed at boot)
+ * @param totalTime Current total run-time counter
+ * @param runTime Current cumulative run time per slot
+ */
+void runStatsWiden(RunStatsWidener* widener, uint32_t totalTime,
+                   const uint32_t runTime[RUNSTATS_TASK_COUNT]);
+
+/**
+ * @brief Reduce two samples into a report for the window between them
+ *
+ * Run times are widened to 64 bits; the remaining counters are unsigned
+ * 32-bit deltas, which are safe across their wrap. Stack
+ * high-water marks are since boot, so they come from the current sample.
+ *
+ * @param prev Sample at the start of the window
+ * @param cur Sample at the end of the window
+ * @param counterHz Run-time counter frequency
+ * @param report Output report
+ */
+void runStatsComputeReport(const RunStatsSample* prev, const RunStatsSample* cur,
+                           uint32_t counterHz, RunStatsReport* report);
+
+/**
+ * @brief Get short name for a statistics slot
+ *
+ * @param task Statistics slot
+ * @return Task name string
+ */
+const char* runStatsTaskName(RunStatsTask task);
+
+// =============================================================================
+// Collection (target only)
+// =============================================================================
+
+/**
+ * @brief Get the run-time counter frequency
+ *
+ * @return Counter ticks per second
+ */
+uint32_t runStatsCounterHz(void);
+
+/**
+ * @brief Record one I2C mutex acquisition attempt
+ *
+ * Called by syncAcquireI2C().
+ *
+ * @param waitTime Time spent blocked (run-time counter units)
+ */
+void runStatsRecordI2CWait(uint32_t waitTime);
+
+/**
+ * @brief Widen the FreeRTOS run-time counters without taking a sample
+ *
+ * Called by MainTask every RUNSTATS_UPDATE_INTERVAL_MS so the 32-bit
+ * counters never wrap twice between samples. Does not reset the
+ * longest-I2C-wait tracker. The scheduler is suspended while it folds
+ * the counters, so another task may call runStatsCollect() at any time.
+ */
+void runStatsUpdate(void);
+
+/**
+ * @brief Take a sample of all statistics
+ *
+ * Uses uxTaskGetSystemState(), which scans each task's stack for its
+ * high-water mark, with the scheduler suspended. Resets the
+ * longest-I2C-wait tracker. Called by NotecardTask for each health.qo.
+ *
+ * @param sample Output sample
+ */
+void runStatsCollect(RunStatsSample* sample);
+
+extern "C" {
+
+/**
+ * @brief Start the run-time counter (portCONFIGURE_TIMER_FOR_RUN_TIME_STATS)
+ */
+void songbirdRunTimeCounterInit(void);
+
+/**
+ * @brief Read the run-time counter (portGET_RUN_TIME_COUNTER_VALUE)
+ *
+ * Safe from task and scheduler context. Must be called at least once per
+ * DWT wrap (~53 s at 80 MHz); every context switch calls it.
+ *
+ * @return Scaled counter value
+ */
+uint32_t songbirdRunTimeCounterRead(void);
+
+/**
+ * @brief Count a context switch into a task (traceTASK_SWITCHED_IN)
+ *
+ * @param taskNumber FreeRTOS task number (RunStatsTask slot)
+ */
+void songbirdRunStatsSwitchIn(uint32_t taskNumber);
+
+}
+
+#endif // SONGBIRD_RUNSTATS_H
@@ -7,20 +7,44 @@
  */
 
 #include "SongbirdSync.h"
+#include "SongbirdRunStats.h"
+#include "SongbirdNoteSpill.h"
+#include "SongbirdConfigStore.h"
+#include "SongbirdMetrics.h"
+#include "SongbirdTrace.h"
+
+#include <stm32l4xx_hal.h>
 
 // =============================================================================
 // Global Synchronization Primitive Handles
 // =============================================================================
 
 SemaphoreHandle_t g_i2cMutex = NULL;
-SemaphoreHandle_t g_configMutex = NULL;
 SemaphoreHandle_t g_stateMutex = NULL;
 QueueHandle_t g_audioQueue = NULL;
-QueueHandle_t g_noteQueue = NULL;
 QueueHandle_t g_configQueue = NULL;
 SemaphoreHandle_t g_syncSemaphore = NULL;
+SemaphoreHandle_t g_noteReady = NULL;
+
+// Outbound notes, guarded by a critical section (copies are short, like
+// the copy xQueueSend makes). Notes the queue drops land in the spill
+// buffer, which NotecardTask drains whenever the queue is empty.
+static NoteQueue s_noteQueue;
+static NoteSpill s_noteSpill;
+static uint32_t s_noteLost[NOTE_PRIORITY_COUNT];   // Neither queued nor spilled
 EventGroupHandle_t g_sleepEvent = NULL;
 
+// Backing storage for the handles above (see RTOS_STATIC)
+static StaticSemaphore_t s_i2cMutexBuffer RTOS_STATIC("sync.i2cMutex");
+static StaticSemaphore_t s_stateMutexBuffer RTOS_STATIC("sync.stateMutex");
+static StaticQueue_t s_audioQueueBuffer RTOS_STATIC("queue.audio");
+static uint8_t s_audioQueueStorage[AUDIO_QUEUE_SIZE * sizeof(AudioQueueItem)] RTOS_STATIC("queue.audioStorage");
+static StaticQueue_t s_configQueueBuffer RTOS_STATIC("queue.config");
+static uint8_t s_configQueueStorage[CONFIG_QUEUE_SIZE * sizeof(SongbirdConfig)] RTOS_STATIC("queue.configStorage");
+static StaticSemaphore_t s_syncSemaphoreBuffer RTOS_STATIC("sync.syncSemaphore");
+static StaticSemaphore_t s_noteReadyBuffer RTOS_STATIC("sync.noteReady");
+static StaticEventGroup_t s_sleepEventBuffer RTOS_STATIC("sync.sleepEvent");
+
 // =============================================================================
 // Global Flags
 // =============================================================================
@@ -34,45 +58,47 @@ volatile bool g_systemReady = false;
 
 bool syncInit(void) {
     // Create mutexes
-    g_i2cMutex = xSemaphoreCreateMutex();
+    g_i2cMutex = xSemaphoreCreateMutexStatic(&s_i2cMutexBuffer);
     if (g_i2cMutex == NULL) {
         return false;
     }
 
-    g_configMutex = xSemaphoreCreateMutex();
-    if (g_configMutex == NULL) {
-        return false;
-    }
-
-    g_stateMutex = xSemaphoreCreateMutex();
+    g_stateMutex = xSemaphoreCreateMutexStatic(&s_stateMutexBuffer);
     if (g_stateMutex == NULL) {
         return false;
     }
 
     // Create queues
-    g_audioQueue = xQueueCreate(AUDIO_QUEUE_SIZE, sizeof(AudioQueueItem));
+    g_audioQueue = xQueueCreateStatic(AUDIO_QUEUE_SIZE, sizeof(AudioQueueItem),
+                                      s_audioQueueStorage, &s_audioQueueBuffer);
     if (g_audioQueue == NULL) {
         return false;
     }
 
-    g_noteQueue = xQueueCreate(NOTE_QUEUE_SIZE, sizeof(NoteQueueItem));
-    if (g_noteQueue == NULL) {
+    noteQueueInit(&s_noteQueue);
+    noteSpillInit(&s_noteSpill);
+    memset(s_noteLost, 0, sizeof(s_noteLost));
+    g_noteReady = xSemaphoreCreateCountingStatic(NOTE_QUEUE_SIZE, 0, &s_noteReadyBuffer);
+    if (g_noteReady == NULL) {
         return false;
     }
 
-    g_configQueue = xQueueCreate(CONFIG_QUEUE_SIZE, sizeof(SongbirdConfig));
+    // Published config replaces a config mutex (MainTask writes, all read)
+    configStoreInit();
+    g_configQueue = xQueueCreateStatic(CONFIG_QUEUE_SIZE, sizeof(SongbirdConfig),
+                                       s_configQueueStorage, &s_configQueueBuffer);
     if (g_configQueue == NULL) {
         return false;
     }
 
     // Create binary semaphore for sync signaling
-    g_syncSemaphore = xSemaphoreCreateBinary();
+    g_syncSemaphore = xSemaphoreCreateBinaryStatic(&s_syncSemaphoreBuffer);
     if (g_syncSemaphore == NULL) {
         return false;
     }
 
     // Create event group for sleep coordination
-    g_sleepEvent = xEventGroupCreate();
+    g_sleepEvent = xEventGroupCreateStatic(&s_sleepEventBuffer);
     if (g_sleepEvent == NULL) {
         return false;
     }
@@ -80,7 +106,6 @@ bool syncInit(void) {
     // Register queues for debugging (optional, but helpful)
     #if configQUEUE_REGISTRY_SIZE > 0
     vQueueAddToRegistry(g_audioQueue, "AudioQ");
-    vQueueAddToRegistry(g_noteQueue, "NoteQ");
     vQueueAddToRegistry(g_configQueue, "ConfigQ");
     #endif
 
@@ -95,29 +120,21 @@ bool syncAcquireI2C(uint32_t timeoutMs) {
     if (g_i2cMutex == NULL) {
         return false;
     }
-    return xSemaphoreTake(g_i2cMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
-}
 
-void syncReleaseI2C(void) {
-    if (g_i2cMutex != NULL) {
-        xSemaphoreGive(g_i2cMutex);
+    // Time spent blocked here is reported as I2C contention in health.qo
+    uint32_t start = songbirdRunTimeCounterRead();
+    bool acquired = xSemaphoreTake(g_i2cMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    runStatsRecordI2CWait(songbirdRunTimeCounterRead() - start);
+    if (!acquired) {
+        metricsIncrement(METRIC_I2C_TIMEOUTS);
     }
-}
 
-// =============================================================================
-// Config Mutex
-// =============================================================================
-
-bool syncAcquireConfig(uint32_t timeoutMs) {
-    if (g_configMutex == NULL) {
-        return false;
-    }
-    return xSemaphoreTake(g_configMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    return acquired;
 }
 
-void syncReleaseConfig(void) {
-    if (g_configMutex != NULL) {
-        xSemaphoreGive(g_configMutex);
+void syncReleaseI2C(void) {
+    if (g_i2cMutex != NULL) {
+        xSemaphoreGive(g_i2cMutex);
     }
 }
 
@@ -137,7 +154,9 @@ bool syncQueueAudioItem(const AudioQueueItem* item) {
         return false;
     }
     // Non-blocking send - don't wait if queue is full
-    return xQueueSend(g_audioQueue, item, 0) == pdTRUE;
+    bool queued = xQueueSend(g_audioQueue, item, 0) == pdTRUE;
+    metricsRecordPeak(METRIC_PEAK_AUDIO_QUEUE, uxQueueMessagesWaiting(g_audioQueue));
+    return queued;
 }
 
 bool syncReceiveAudio(AudioQueueItem* item, uint32_t timeoutMs) {
@@ -153,18 +172,110 @@ bool syncReceiveAudio(AudioQueueItem* item, uint32_t timeoutMs) {
 // =============================================================================
 
 bool syncQueueNote(const NoteQueueItem* item) {
-    if (g_noteQueue == NULL || item == NULL) {
+    if (g_noteReady == NULL || item == NULL) {
         return false;
     }
-    // Non-blocking send
-    return xQueueSend(g_noteQueue, item, 0) == pdTRUE;
+
+    NoteOffer offer;
+    taskENTER_CRITICAL();
+    bool kept = noteSpillOffer(&s_noteQueue, &s_noteSpill, item, &offer);
+    if (offer.lost) {
+        s_noteLost[noteQueuePriority(offer.lostType)]++;
+    }
+    uint32_t queuedCount = noteQueueCount(&s_noteQueue);
+    uint32_t spilledCount = noteSpillCount(&s_noteSpill);
+    taskEXIT_CRITICAL();
+
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, queuedCount);
+    metricsRecordPeak(METRIC_PEAK_NOTE_SPILL, spilledCount);
+    if (offer.lost) {
+        metricsIncrement(METRIC_NOTES_LOST);
+    }
+
+    // An eviction swaps one note for another; the count is unchanged
+    if (offer.queued && !offer.evicted) {
+        xSemaphoreGive(g_noteReady);
+    }
+
+    if (!offer.queued || offer.evicted) {
+        traceRecord(TRACE_NOTE_OVERFLOW, offer.spilled, offer.queued);
+    }
+
+    return kept;
 }
 
 bool syncReceiveNote(NoteQueueItem* item, uint32_t timeoutMs) {
-    if (g_noteQueue == NULL || item == NULL) {
+    if (g_noteReady == NULL || item == NULL) {
+        return false;
+    }
+
+    bool received = false;
+    if (xSemaphoreTake(g_noteReady, 0) == pdTRUE) {
+        taskENTER_CRITICAL();
+        received = noteQueuePop(&s_noteQueue, item);
+        taskEXIT_CRITICAL();
+        return received;
+    }
+
+    // Queue is empty: replay spilled notes before blocking
+    taskENTER_CRITICAL();
+    received = noteSpillTake(&s_noteSpill, item);
+    taskEXIT_CRITICAL();
+    if (received) {
+        return true;
+    }
+
+    if (xSemaphoreTake(g_noteReady, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
         return false;
     }
-    return xQueueReceive(g_noteQueue, item, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+
+    taskENTER_CRITICAL();
+    received = noteQueuePop(&s_noteQueue, item);
+    taskEXIT_CRITICAL();
+    return received;
+}
+
+void syncGetNoteDrops(uint32_t drops[NOTE_PRIORITY_COUNT]) {
+    taskENTER_CRITICAL();
+    memcpy(drops, s_noteLost, sizeof(s_noteLost));
+    taskEXIT_CRITICAL();
+}
+
+size_t syncSpillPending(uint8_t* buffer, size_t size) {
+    if (g_noteReady == NULL || buffer == NULL) {
+        return 0;
+    }
+
+    // Move every queued note into the spill buffer
+    NoteQueueItem item;
+    while (xSemaphoreTake(g_noteReady, 0) == pdTRUE) {
+        taskENTER_CRITICAL();
+        bool lost = noteQueuePop(&s_noteQueue, &item) && !noteSpillPut(&s_noteSpill, &item);
+        if (lost) {
+            s_noteLost[noteQueuePriority(item.type)]++;
+        }
+        taskEXIT_CRITICAL();
+        if (lost) {
+            metricsIncrement(METRIC_NOTES_LOST);
+        }
+    }
+
+    size_t length = 0;
+    taskENTER_CRITICAL();
+    const uint8_t* blob = noteSpillBlob(&s_noteSpill, &length);
+    if (blob == NULL || length > size) {
+        length = 0;
+    } else {
+        memcpy(buffer, blob, length);
+    }
+    taskEXIT_CRITICAL();
+    return length;
+}
+
+uint16_t syncImportSpill(const uint8_t* blob, size_t length) {
+    // No tasks exist yet, and a critical section before the scheduler
+    // starts would leave interrupts masked
+    return noteSpillImport(&s_noteSpill, blob, length);
 }
 
 // =============================================================================
@@ -238,6 +349,129 @@ void syncClearSleepBits(void) {
     }
 }
 
+void syncRequestSleep(void) {
+    // Drop any ready bit left behind by a task that raced the last cancel
+    syncClearSleepBits();
+    g_sleepRequested = true;
+    if (g_sleepEvent != NULL) {
+        xEventGroupSetBits(g_sleepEvent, SLEEP_BIT_REQUEST);
+    }
+}
+
+void syncCancelSleep(void) {
+    g_sleepRequested = false;
+    if (g_sleepEvent != NULL) {
+        xEventGroupClearBits(g_sleepEvent, SLEEP_BIT_REQUEST | SLEEP_BITS_ALL);
+    }
+}
+
+void syncParkForSleep(EventBits_t bit) {
+    syncSetSleepReady(bit);
+
+    // Poll rather than vTaskSuspend() so a cancelled sleep needs no resume
+    // handshake (and cannot race a task that has not suspended yet)
+    while (g_sleepRequested) {
+        vTaskDelay(pdMS_TO_TICKS(MAIN_LOOP_INTERVAL_MS));
+    }
+}
+
+bool syncWaitSleepRequest(uint32_t timeoutMs) {
+    if (g_sleepEvent == NULL) {
+        vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+        return g_sleepRequested;
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(
+        g_sleepEvent,
+        SLEEP_BIT_REQUEST,
+        pdFALSE,    // Leave set - every task needs to see it
+        pdFALSE,
+        pdMS_TO_TICKS(timeoutMs)
+    );
+
+    return (bits & SLEEP_BIT_REQUEST) != 0;
+}
+
+// =============================================================================
+// ATTN Event Dispatch
+// =============================================================================
+
+// ATTN_EVENT_* <-> event group bits for the events a task waits on
+static EventBits_t attnEventsToBits(uint8_t events) {
+    EventBits_t bits = 0;
+    if (events & ATTN_EVENT_COMMAND) bits |= ATTN_BIT_COMMAND;
+    if (events & ATTN_EVENT_ENV) bits |= ATTN_BIT_ENV;
+    return bits;
+}
+
+static uint8_t attnBitsToEvents(EventBits_t bits) {
+    uint8_t events = 0;
+    if (bits & ATTN_BIT_COMMAND) events |= ATTN_EVENT_COMMAND;
+    if (bits & ATTN_BIT_ENV) events |= ATTN_EVENT_ENV;
+    return events;
+}
+
+void syncPostAttnEvents(uint8_t events) {
+    EventBits_t bits = attnEventsToBits(events);
+    if (g_sleepEvent != NULL && bits != 0) {
+        xEventGroupSetBits(g_sleepEvent, bits);
+    }
+}
+
+uint8_t syncWaitAttnEvents(uint8_t events, uint32_t timeoutMs) {
+    EventBits_t wanted = attnEventsToBits(events);
+    if (g_sleepEvent == NULL) {
+        vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+        return 0;
+    }
+
+    // Wake on the sleep request too, which must stay set for other tasks;
+    // only this task's event bits are cleared
+    EventBits_t bits = xEventGroupWaitBits(
+        g_sleepEvent,
+        wanted | SLEEP_BIT_REQUEST,
+        pdFALSE,
+        pdFALSE,
+        pdMS_TO_TICKS(timeoutMs)
+    );
+
+    bits &= wanted;
+    if (bits != 0) {
+        xEventGroupClearBits(g_sleepEvent, bits);
+    }
+    return attnBitsToEvents(bits);
+}
+
+// =============================================================================
+// Report Cycle Tracking
+// =============================================================================
+
+void syncSetCycleDone(EventBits_t bit) {
+    if (g_sleepEvent != NULL) {
+        xEventGroupSetBits(g_sleepEvent, bit);
+    }
+}
+
+EventBits_t syncGetCycleBits(void) {
+    if (g_sleepEvent == NULL) {
+        return 0;
+    }
+    return xEventGroupGetBits(g_sleepEvent) & CYCLE_BITS_ALL;
+}
+
+void syncClearCycleBits(void) {
+    if (g_sleepEvent != NULL) {
+        xEventGroupClearBits(g_sleepEvent, CYCLE_BITS_ALL);
+    }
+}
+
+uint32_t syncNotesPending(void) {
+    taskENTER_CRITICAL();
+    uint32_t pending = noteQueueCount(&s_noteQueue) + noteSpillCount(&s_noteSpill);
+    taskEXIT_CRITICAL();
+    return pending;
+}
+
 // =============================================================================
 // Debug Helpers (only in debug builds)
 // =============================================================================
@@ -271,19 +505,43 @@ void vAssertCalled(const char* file, int line) {
 
 extern "C" {
 
-// Called when malloc fails
+// Kernel-owned tasks, allocated statically like ours
+// (configSUPPORT_STATIC_ALLOCATION requires the application to supply them)
+static StaticTask_t s_idleTcb RTOS_STATIC("tcb.idle");
+static StackType_t s_idleStack[configMINIMAL_STACK_SIZE] RTOS_STATIC("stack.idle");
+
+void vApplicationGetIdleTaskMemory(StaticTask_t** tcb, StackType_t** stack, uint32_t* stackSize) {
+    *tcb = &s_idleTcb;
+    *stack = s_idleStack;
+    *stackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if configUSE_TIMERS == 1
+static StaticTask_t s_timerTcb RTOS_STATIC("tcb.timer");
+static StackType_t s_timerStack[configTIMER_TASK_STACK_DEPTH] RTOS_STATIC("stack.timer");
+
+void vApplicationGetTimerTaskMemory(StaticTask_t** tcb, StackType_t** stack, uint32_t* stackSize) {
+    *tcb = &s_timerTcb;
+    *stack = s_timerStack;
+    *stackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
+// Called when pvPortMalloc fails. No Songbird kernel object comes from the
+// heap, so this means a stray dynamic allocation ran the heap dry.
 void vApplicationMallocFailedHook(void) {
     #ifdef DEBUG_MODE
     DEBUG_SERIAL.println("ERROR: FreeRTOS malloc failed!");
     DEBUG_SERIAL.flush();
     #endif
 
-    // Hang - this is a fatal error
-    taskDISABLE_INTERRUPTS();
-    for (;;);
+    // Fatal, but recoverable by a reboot; hanging here would leave the
+    // device dark in the field until someone power-cycles it
+    NVIC_SystemReset();
 }
 
-// Called on stack overflow
+// Called on stack overflow. The stack_free_<task> health fields show a
+// task running short well before this happens (see scripts/stack_usage.py).
 void vApplicationStackOverflowHook(TaskHandle_t xTask, char* pcTaskName) {
     #ifdef DEBUG_MODE
     DEBUG_SERIAL.print("ERROR: Stack overflow in task: ");
@@ -291,9 +549,9 @@ void vApplicationStackOverflowHook(TaskHandle_t xTask, char* pcTaskName) {
     DEBUG_SERIAL.flush();
     #endif
 
-    // Hang - this is a fatal error
-    taskDISABLE_INTERRUPTS();
-    for (;;);
+    // Whatever sits below the stack may be corrupt; start over rather
+    // than hang
+    NVIC_SystemReset();
 }
 
 } // extern "C"
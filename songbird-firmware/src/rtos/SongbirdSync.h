@@ -19,31 +19,25 @@
 #include <event_groups.h>
 
 #include "SongbirdConfig.h"
+#include "SongbirdNoteQueue.h"
+#include "SongbirdSleepCycle.h"
+
+// =============================================================================
+// Static Allocation
+// =============================================================================
+
+// Every task stack, TCB, queue and semaphore is allocated statically, so the
+// FreeRTOS objects never touch the heap and their RAM is fixed at link time.
+// Each object gets its own named .bss subsection ("rtos.<kind>.<name>") so
+// the linker map, and scripts/ram_map.py, attribute it by kind. The ".bss."
+// prefix keeps the objects in the stock linker script's zeroed .bss.
+#define RTOS_STATIC(name)   __attribute__((section(".bss.rtos." name)))
 
 // =============================================================================
 // Forward Declarations for Queue Item Types
 // =============================================================================
 
-// Audio event type (full definition in SongbirdAudio.h)
-typedef enum {
-    AUDIO_EVENT_POWER_ON = 0,
-    AUDIO_EVENT_CONNECTED,
-    AUDIO_EVENT_GPS_LOCK,
-    AUDIO_EVENT_TEMP_ALERT,
-    AUDIO_EVENT_HUMIDITY_ALERT,
-    AUDIO_EVENT_LOW_BATTERY,
-    AUDIO_EVENT_SLEEP,
-    AUDIO_EVENT_ERROR,
-    AUDIO_EVENT_PING,
-    AUDIO_EVENT_LOCATE_START,
-    AUDIO_EVENT_LOCATE_STOP,
-    AUDIO_EVENT_CUSTOM_TONE,
-    AUDIO_EVENT_TRANSIT_LOCK_ON,
-    AUDIO_EVENT_TRANSIT_LOCK_OFF,
-    AUDIO_EVENT_DEMO_LOCK_ON,
-    AUDIO_EVENT_DEMO_LOCK_OFF,
-    AUDIO_EVENT_COUNT
-} AudioEventType;
+// AudioEventType is in SongbirdConfig.h (shared with the command tables)
 
 // Audio queue item
 typedef struct {
@@ -53,25 +47,7 @@ typedef struct {
     uint16_t locateDurationSec; // For locate mode
 } AudioQueueItem;
 
-// Note type for outbound queue
-typedef enum {
-    NOTE_TYPE_TRACK = 0,
-    NOTE_TYPE_ALERT,
-    NOTE_TYPE_CMD_ACK,
-    NOTE_TYPE_HEALTH
-} NoteType;
-
-// Note queue item
-typedef struct {
-    NoteType type;
-    bool forceSync;             // Force immediate sync (e.g., for mode changes)
-    union {
-        SensorData track;
-        Alert alert;
-        CommandAck ack;
-        HealthData health;
-    } data;
-} NoteQueueItem;
+// Outbound note item and priority queue (SongbirdNoteQueue.h)
 
 // =============================================================================
 // Synchronization Primitive Handles (extern declarations)
@@ -79,16 +55,15 @@ typedef struct {
 
 // Mutexes
 extern SemaphoreHandle_t g_i2cMutex;        // Protects I2C bus (Notecard + BME280)
-extern SemaphoreHandle_t g_configMutex;     // Protects shared configuration
 extern SemaphoreHandle_t g_stateMutex;      // Protects SongbirdState s_state
 
 // Queues
 extern QueueHandle_t g_audioQueue;          // Audio events -> AudioTask
-extern QueueHandle_t g_noteQueue;           // Outbound notes -> NotecardTask
 extern QueueHandle_t g_configQueue;         // Config updates -> MainTask
 
 // Semaphores
 extern SemaphoreHandle_t g_syncSemaphore;   // Signals sync completion
+extern SemaphoreHandle_t g_noteReady;       // Counts notes in the outbound priority queue
 
 // Event Groups
 extern EventGroupHandle_t g_sleepEvent;     // Coordinates deep sleep
@@ -104,6 +79,20 @@ extern EventGroupHandle_t g_sleepEvent;     // Coordinates deep sleep
 #define SLEEP_BIT_NOTECARD  (1 << 4)
 #define SLEEP_BITS_ALL      (SLEEP_BIT_SENSOR | SLEEP_BIT_AUDIO | SLEEP_BIT_COMMAND | SLEEP_BIT_ENV | SLEEP_BIT_NOTECARD)
 
+// Set while a sleep is pending so tasks blocked in syncWaitSleepRequest() wake early
+#define SLEEP_BIT_REQUEST   (1 << 5)
+
+// Report-cycle bits CYCLE_BIT_* (bits 6-7) are defined in SongbirdSleepCycle.h
+
+// Pending inbound ATTN events, one bit per consuming task (syncPostAttnEvents)
+#define ATTN_BIT_COMMAND    (1 << 8)
+#define ATTN_BIT_ENV        (1 << 9)
+#define ATTN_BITS_ALL       (ATTN_BIT_COMMAND | ATTN_BIT_ENV)
+
+static_assert(((SLEEP_BITS_ALL | SLEEP_BIT_REQUEST) & (CYCLE_BITS_ALL | ATTN_BITS_ALL)) == 0 &&
+              (CYCLE_BITS_ALL & ATTN_BITS_ALL) == 0,
+              "g_sleepEvent bit groups overlap");
+
 // =============================================================================
 // Global Flags
 // =============================================================================
@@ -121,7 +110,8 @@ extern volatile bool g_pvdShutdownRequested; // Set by PVD ISR when voltage drop
  *
  * Must be called before creating any tasks. Creates:
  * - i2cMutex, configMutex, and stateMutex
- * - audioQueue, noteQueue, and configQueue
+ * - audioQueue and configQueue
+ * - outbound note priority queue and its noteReady semaphore
  * - syncSemaphore
  * - sleepEvent group
  *
@@ -142,19 +132,6 @@ bool syncAcquireI2C(uint32_t timeoutMs);
  */
 void syncReleaseI2C(void);
 
-/**
- * @brief Acquire the config mutex with timeout
- *
- * @param timeoutMs Maximum time to wait for mutex (ms)
- * @return true if mutex acquired, false on timeout
- */
-bool syncAcquireConfig(uint32_t timeoutMs);
-
-/**
- * @brief Release the config mutex
- */
-void syncReleaseConfig(void);
-
 /**
  * @brief Queue an audio event (non-blocking)
  *
@@ -183,13 +160,19 @@ bool syncReceiveAudio(AudioQueueItem* item, uint32_t timeoutMs);
 /**
  * @brief Queue an outbound note (non-blocking)
  *
+ * If the queue is full, the oldest note of a lower (or equal) priority
+ * class is moved to the spill buffer (SongbirdNoteSpill.h) to make room,
+ * or the incoming note is spilled if every queued note outranks it.
+ *
  * @param item Pointer to note queue item
- * @return true if queued successfully, false if queue full
+ * @return true if queued or spilled, false if lost
  */
 bool syncQueueNote(const NoteQueueItem* item);
 
 /**
- * @brief Receive an outbound note (blocking with timeout)
+ * @brief Receive the highest priority outbound note (blocking with timeout)
+ *
+ * Spilled notes are returned, oldest first, whenever the queue is empty.
  *
  * @param item Pointer to receive note queue item
  * @param timeoutMs Maximum time to wait (ms)
@@ -197,6 +180,39 @@ bool syncQueueNote(const NoteQueueItem* item);
  */
 bool syncReceiveNote(NoteQueueItem* item, uint32_t timeoutMs);
 
+/**
+ * @brief Get outbound notes lost since boot
+ *
+ * Counts notes that overflowed the queue and did not fit in (or cannot be
+ * stored in) the spill buffer.
+ *
+ * @param drops Output: lost count per NotePriority class
+ */
+void syncGetNoteDrops(uint32_t drops[NOTE_PRIORITY_COUNT]);
+
+/**
+ * @brief Spill every queued note and copy out the spill buffer
+ *
+ * Used at shutdown to persist undelivered notes in one Notecard request.
+ * The notes stay in the spill buffer until received.
+ *
+ * @param buffer Output blob (NOTE_SPILL_SIZE bytes)
+ * @param size Size of buffer
+ * @return Blob length, 0 if nothing is pending
+ */
+size_t syncSpillPending(uint8_t* buffer, size_t size);
+
+/**
+ * @brief Add notes persisted by syncSpillPending() on a previous boot
+ *
+ * Call after syncInit() and before tasksCreate().
+ *
+ * @param blob Persisted blob
+ * @param length Blob length
+ * @return Number of notes restored
+ */
+uint16_t syncImportSpill(const uint8_t* blob, size_t length);
+
 /**
  * @brief Queue a config update (blocking)
  *
@@ -246,4 +262,91 @@ bool syncWaitAllSleepReady(uint32_t timeoutMs);
  */
 void syncClearSleepBits(void);
 
+/**
+ * @brief Request that all tasks prepare for deep sleep
+ *
+ * Sets g_sleepRequested and wakes tasks waiting in syncWaitSleepRequest()
+ * so they reach their sleep-ready point without finishing their interval.
+ */
+void syncRequestSleep(void);
+
+/**
+ * @brief Withdraw a sleep request
+ *
+ * Clears g_sleepRequested, the request bit and all sleep ready bits.
+ * Tasks parked in syncParkForSleep() resume on their next poll.
+ */
+void syncCancelSleep(void);
+
+/**
+ * @brief Mark this task sleep-ready and block until the sleep is abandoned
+ *
+ * Normally the Notecard cuts power while the task is parked. If MainTask
+ * cancels the sleep instead, this returns and the task continues its loop.
+ *
+ * @param bit The SLEEP_BIT_* for this task (JobsTask sets all its jobs' bits)
+ */
+void syncParkForSleep(EventBits_t bit);
+
+/**
+ * @brief Wait for an interval, returning early if sleep is requested
+ *
+ * Drop-in replacement for vTaskDelay() in task loops.
+ *
+ * @param timeoutMs Interval to wait (ms)
+ * @return true if sleep was requested, false if the interval elapsed
+ */
+bool syncWaitSleepRequest(uint32_t timeoutMs);
+
+/**
+ * @brief Dispatch Notecard ATTN events to the tasks that handle them
+ *
+ * ATTN_EVENT_COMMAND goes to CommandTask and ATTN_EVENT_ENV to EnvTask (both
+ * to JobsTask with JOBS_MODE); other events have no waiting task and are
+ * ignored. An event stays pending until its task next waits, so none is lost
+ * while the task is busy.
+ *
+ * @param events ATTN_EVENT_* mask
+ */
+void syncPostAttnEvents(uint8_t events);
+
+/**
+ * @brief Wait for ATTN events, returning early if sleep is requested
+ *
+ * Drop-in replacement for syncWaitSleepRequest() in task loops driven by an
+ * ATTN event, with the interval as a safety poll.
+ *
+ * @param events ATTN_EVENT_* mask to wait for
+ * @param timeoutMs Safety poll interval (ms)
+ * @return ATTN_EVENT_* mask of the events received (cleared), 0 on timeout
+ *         or sleep request
+ */
+uint8_t syncWaitAttnEvents(uint8_t events, uint32_t timeoutMs);
+
+/**
+ * @brief Mark this task's work for the current wake period as done
+ *
+ * @param bit The CYCLE_BIT_* for this task
+ */
+void syncSetCycleDone(EventBits_t bit);
+
+/**
+ * @brief Get the report-cycle bits that are set
+ *
+ * @return CYCLE_BIT_* mask (0 before syncInit())
+ */
+EventBits_t syncGetCycleBits(void);
+
+/**
+ * @brief Clear all report-cycle bits
+ */
+void syncClearCycleBits(void);
+
+/**
+ * @brief Get the number of notes waiting for NotecardTask
+ *
+ * @return Number of queued and spilled outbound notes
+ */
+uint32_t syncNotesPending(void);
+
 #endif // SONGBIRD_SYNC_H
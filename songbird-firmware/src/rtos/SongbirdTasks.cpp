@@ -8,30 +8,79 @@
 
 #include "SongbirdTasks.h"
 #include "SongbirdSync.h"
+#include "SongbirdConfigStore.h"
 #include "SongbirdConfig.h"
 #include "SongbirdAudio.h"
 #include "SongbirdSensors.h"
 #include "SongbirdNotecard.h"
+#include "SongbirdTelemetry.h"
+#include "SongbirdCadence.h"
 #include "SongbirdEnv.h"
 #include "SongbirdCommands.h"
 #include "SongbirdState.h"
+#include "SongbirdAlertEngine.h"
 #include "SongbirdPower.h"
+#include "SongbirdPowerPolicy.h"
+#include "SongbirdGpsPower.h"
+#include "SongbirdSleepCycle.h"
+#include "SongbirdRunStats.h"
+#include "SongbirdMetrics.h"
+#include "SongbirdTrace.h"
+#include "SongbirdBootProfile.h"
+#include "SongbirdLatency.h"
+#include "SongbirdJobs.h"
 
 // =============================================================================
 // Task Handles
 // =============================================================================
 
 TaskHandle_t g_mainTaskHandle = NULL;
-TaskHandle_t g_sensorTaskHandle = NULL;
+TaskHandle_t g_sensorTaskHandle = NULL;     // NULL with JOBS_MODE
 TaskHandle_t g_audioTaskHandle = NULL;
-TaskHandle_t g_commandTaskHandle = NULL;
+TaskHandle_t g_commandTaskHandle = NULL;    // NULL with JOBS_MODE
 TaskHandle_t g_notecardTaskHandle = NULL;
-TaskHandle_t g_envTaskHandle = NULL;
+TaskHandle_t g_envTaskHandle = NULL;        // NULL with JOBS_MODE
+TaskHandle_t g_traceTaskHandle = NULL;
+TaskHandle_t g_jobsTaskHandle = NULL;       // JOBS_MODE only
 
 // =============================================================================
-// Shared Configuration (protected by g_configMutex)
+// Task Memory
 // =============================================================================
 
+// Stacks and TCBs, allocated statically (see RTOS_STATIC in SongbirdSync.h)
+static StackType_t s_mainStack[STACK_MAIN] RTOS_STATIC("stack.main");
+static StackType_t s_audioStack[STACK_AUDIO] RTOS_STATIC("stack.audio");
+static StackType_t s_notecardStack[STACK_NOTECARD] RTOS_STATIC("stack.notecard");
+
+static StaticTask_t s_mainTcb RTOS_STATIC("tcb.main");
+static StaticTask_t s_audioTcb RTOS_STATIC("tcb.audio");
+static StaticTask_t s_notecardTcb RTOS_STATIC("tcb.notecard");
+
+#ifndef TRACE_DISABLED
+static StackType_t s_traceStack[STACK_TRACE] RTOS_STATIC("stack.trace");
+static StaticTask_t s_traceTcb RTOS_STATIC("tcb.trace");
+#endif
+
+#ifdef JOBS_MODE
+// One stack runs the sensor, command and env jobs
+static StackType_t s_jobsStack[STACK_JOBS] RTOS_STATIC("stack.jobs");
+static StaticTask_t s_jobsTcb RTOS_STATIC("tcb.jobs");
+#else
+static StackType_t s_sensorStack[STACK_SENSOR] RTOS_STATIC("stack.sensor");
+static StackType_t s_commandStack[STACK_COMMAND] RTOS_STATIC("stack.command");
+static StackType_t s_envStack[STACK_ENV] RTOS_STATIC("stack.env");
+
+static StaticTask_t s_sensorTcb RTOS_STATIC("tcb.sensor");
+static StaticTask_t s_commandTcb RTOS_STATIC("tcb.command");
+static StaticTask_t s_envTcb RTOS_STATIC("tcb.env");
+#endif
+
+// =============================================================================
+// Shared Configuration
+// =============================================================================
+
+// MainTask's working copy; other tasks read what it publishes to the config
+// store (configStorePublish() after every change)
 static SongbirdConfig s_currentConfig;
 
 // =============================================================================
@@ -51,15 +100,182 @@ static uint8_t s_clickCount = 0;            // Number of clicks in current windo
 static uint32_t s_firstClickTime = 0;       // Time of first click
 static const uint32_t TRIPLE_CLICK_TIMEOUT_MS = 1000; // Total window for triple-click
 
+// =============================================================================
+// Battery-Aware Duty Cycling
+// =============================================================================
+
+// Earliest retry of a failed power policy hub.set (MainTask only)
+static uint32_t s_syncScaleRetryMs = 0;
+
+// =============================================================================
+// Run-Time Statistics
+// =============================================================================
+
+// Sample at the start of the current health report window (taken by
+// MainTask at startup, then NotecardTask only)
+static RunStatsSample s_runStatsWindowStart;
+
+// Metrics as of the last health.qo, for change detection (MainTask only)
+static MetricsSnapshot s_reportedMetrics;
+static uint32_t s_lastHealthReportMs = 0;
+
+// This boot's profile goes out with its first health.qo (NotecardTask only)
+static bool s_bootProfileReported = false;
+
+// Its compact form goes out with the first track.qo (NotecardTask only)
+static bool s_bootRecordReported = false;
+
+// =============================================================================
+// Deep Sleep Cycle
+// =============================================================================
+
+// millis() of the last sleep attempt that did not cut power (0 = none)
+static uint32_t s_lastSleepAttemptMs = 0;
+
 // =============================================================================
 // Helper Functions
 // =============================================================================
 
+/**
+ * @brief Check whether MainTask should schedule a deep sleep now
+ *
+ * @param warmBoot true if this boot was a wake from a previous sleep
+ * @return true if all conditions for sleep are met (see sleepCycleDue())
+ */
+static bool sleepCycleReady(bool warmBoot) {
+    SleepCycleInputs inputs;
+    inputs.mode = s_currentConfig.mode;
+    inputs.warmBoot = warmBoot;
+    inputs.busy = s_clickCount > 0 || g_pvdShutdownRequested;
+    inputs.nowMs = millis();
+    inputs.lastAttemptMs = s_lastSleepAttemptMs;
+    inputs.eventBits = syncGetCycleBits();
+    inputs.notesPending = syncNotesPending();
+    return sleepCycleDue(&inputs);
+}
+
+/**
+ * @brief Queue a health.qo request for NotecardTask
+ *
+ * Starts a new change-detection baseline. Called by MainTask when
+ * metricsReportDue() says so; the report itself is built by
+ * sendHealthNote() when NotecardTask sends it.
+ *
+ * @param trigger Why the report is being sent
+ * @param metrics Current metrics
+ * @param nowEpoch Wall clock (0 if unknown)
+ */
+static void queueHealthNote(MetricsTrigger trigger, const MetricsSnapshot* metrics,
+                            uint32_t nowEpoch) {
+    NoteQueueItem noteItem;
+    memset(&noteItem, 0, sizeof(noteItem));
+    noteItem.type = NOTE_TYPE_HEALTH;
+    noteItem.forceSync = false;
+    noteItem.createdMs = millis();
+    noteItem.data.health.trigger = trigger;
+
+    memcpy(&s_reportedMetrics, metrics, sizeof(MetricsSnapshot));
+    s_lastHealthReportMs = millis();
+    if (nowEpoch != 0) {
+        stateSetLastHealthEpoch(nowEpoch);
+    }
+    syncQueueNote(&noteItem);
+
+    traceRecord(TRACE_MAIN_HEALTH, trigger == METRICS_TRIGGER_CHANGE, 0);
+}
+
+/**
+ * @brief Build a requested health.qo note and send it
+ *
+ * Called by NotecardTask with the I2C bus held. The run-time statistics
+ * and alert latency windows, and the boot profile, move on only once the
+ * note is sent, so a retry reports them again.
+ *
+ * @param request The request MainTask queued
+ * @return true if sent
+ */
+static bool sendHealthNote(const HealthRequest* request) {
+    RunStatsSample sample;
+    runStatsCollect(&sample);
+
+    HealthData health;
+    memset(&health, 0, sizeof(health));
+    strncpy(health.firmwareVersion, FIRMWARE_VERSION, sizeof(health.firmwareVersion) - 1);
+    health.trigger = request->trigger;
+    health.uptimeSec = stateGetTotalUptimeSec();
+    health.bootCount = stateGetBootCount();
+    health.lastGpsFixSec = gpsPowerFixAgeSec(stateGet()->lastGpsFixEpoch, telemetryGetEpoch());
+    metricsSnapshot(&health.metrics);
+    runStatsComputeReport(&s_runStatsWindowStart, &sample, runStatsCounterHz(), &health.runStats);
+    syncGetNoteDrops(health.noteDrops);
+    latencyPeekReport(&health.alertLatency);
+    health.bootProfile = !s_bootProfileReported;
+
+    if (!notecardSendHealthNote(&health)) {
+        return false;
+    }
+
+    memcpy(&s_runStatsWindowStart, &sample, sizeof(sample));
+    latencyTakeReport(NULL);
+    s_bootProfileReported = true;
+    traceRecord(TRACE_NC_HEALTH_SENT, health.trigger == METRICS_TRIGGER_CHANGE,
+                health.runStats.cpuPermille);
+    return true;
+}
+
+/**
+ * @brief Get the time since the last health.qo report (seconds)
+ *
+ * Uses the wall clock persisted in state so the heartbeat survives deep
+ * sleep; falls back to this boot's uptime while the time is unknown.
+ *
+ * @param nowEpoch Wall clock (0 if unknown)
+ * @return Seconds since the last report (UINT32_MAX if never reported)
+ */
+static uint32_t healthSecondsSinceReport(uint32_t nowEpoch) {
+    uint32_t lastEpoch = stateGetLastHealthEpoch();
+    if (nowEpoch != 0) {
+        if (lastEpoch == 0) {
+            return UINT32_MAX;
+        }
+        if (nowEpoch >= lastEpoch) {
+            return nowEpoch - lastEpoch;
+        }
+    }
+    return (millis() - s_lastHealthReportMs) / 1000;
+}
+
+/**
+ * @brief Re-apply the Notecard cadence when a config change moves it
+ *
+ * Covers sync_interval_min and gps_interval_min changes within a mode; mode
+ * changes go through notecardConfigure(). GPS is left off while the signal
+ * timeout has it in power saving, and picks up the new interval on retry.
+ * Must be called while holding I2C mutex.
+ *
+ * @param oldConfig Configuration the Notecard was set up for
+ * @param newConfig Configuration now in effect
+ */
+static void applyCadenceChange(const SongbirdConfig* oldConfig, const SongbirdConfig* newConfig) {
+    NotecardCadence before;
+    NotecardCadence after;
+    cadenceCompute(oldConfig, &before);
+    cadenceCompute(newConfig, &after);
+
+    if (cadenceHubChanged(&before, &after)) {
+        notecardConfigureHub(newConfig);
+    }
+    if (cadenceGpsChanged(&before, &after) && !stateIsGpsPowerSaving()) {
+        notecardConfigureGPS(newConfig);
+    }
+}
+
 /**
  * @brief Queue an immediate track.qo note with current sensor readings
  *
  * Called when mode changes to immediately report the new mode along with
- * all current sensor readings. Must be called while holding I2C mutex.
+ * all current sensor readings. Takes the I2C mutex itself, and releases it
+ * while the BME280 conversion runs, so the caller must not hold it.
  *
  * @param mode The new operating mode to report
  */
@@ -67,41 +283,56 @@ static void queueImmediateTrackNote(OperatingMode mode) {
     SensorData data;
     memset(&data, 0, sizeof(data));
 
-    // Read current sensor values
-    if (sensorsRead(&data)) {
-        // Get battery voltage for alert checking (not sent in track.qo)
-        bool usbPowered = false;
-        data.voltage = notecardGetVoltage(&usbPowered);
+    // Start the conversion, then wait it out without holding the bus
+    bool started = false;
+    uint32_t conversionMs = 0;
+    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        started = sensorsStartMeasurement(&conversionMs);
+        syncReleaseI2C();
+    }
+    if (started && conversionMs > 0) {
+        // +1 tick: the first tick of a delay may be partial
+        vTaskDelay(pdMS_TO_TICKS(conversionMs) + 1);
+    }
 
-        // Add motion status
-        data.motion = notecardGetMotion();
+    bool read = false;
+    if (started && syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        read = sensorsReadMeasurement(&data);
+        if (read) {
+            // Get battery voltage for alert checking (not sent in track.qo)
+            bool usbPowered = false;
+            data.voltage = telemetryGetVoltage(&usbPowered, TELEMETRY_VOLTAGE_TTL_MS);
+
+            // Add motion status (latched for SensorTask's next report as well)
+            data.motion = telemetryGetMotion(TELEMETRY_MOTION_TTL_MS);
 
-        // Mark data as valid
-        data.valid = true;
-        data.timestamp = (uint32_t)time(NULL);
+            // Mark data as valid
+            data.valid = true;
+            data.timestamp = telemetryGetEpoch();
+        }
+        syncReleaseI2C();
+    }
 
+    if (read) {
         // Queue the track note with forced sync for immediate delivery
         NoteQueueItem noteItem;
         noteItem.type = NOTE_TYPE_TRACK;
         noteItem.forceSync = true;  // Mode changes should sync immediately
+        noteItem.createdMs = millis();
         memcpy(&noteItem.data.track, &data, sizeof(SensorData));
         syncQueueNote(&noteItem);
-
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.print("[MainTask] Queued immediate track.qo for mode change to: ");
-        DEBUG_SERIAL.println(envGetModeName(mode));
-        #endif
-    } else {
-        #ifdef DEBUG_MODE
-        DEBUG_SERIAL.println("[MainTask] Failed to read sensors for immediate track note");
-        #endif
     }
+
+    traceRecord(TRACE_MAIN_MODE_TRACK, mode, read);
 }
 
 // =============================================================================
 // PVD Safe Shutdown
 // =============================================================================
 
+// Notes spilled by pvdSafeShutdown() (kept off the MainTask stack)
+static uint8_t s_spillBlob[NOTE_SPILL_SIZE];
+
 /**
  * @brief Execute safe shutdown sequence when PVD fires (voltage ~2.9V)
  *
@@ -110,8 +341,9 @@ static void queueImmediateTrackNote(OperatingMode mode) {
  *   1. Play single low-battery warning tone
  *   2. Stop sensor reads / locate sequences
  *   3. Drain pending notes (up to PVD_QUEUE_DRAIN_LIMIT or deadline)
- *   4. Send health.qo shutdown note
- *   5. Save state, enter Notecard sleep
+ *   4. Spill the rest to Notecard flash for replay after the next boot
+ *   5. Send health.qo shutdown note
+ *   6. Save state, enter Notecard sleep
  *
  * After this function the device should power down via the Notecard ATTN/EN
  * mechanism. If that fails, the BOR will eventually reset the MCU.
@@ -122,9 +354,11 @@ static void pvdSafeShutdown(void) {
     DEBUG_SERIAL.println("[Power] PVD fired! Safe shutdown starting...");
 
     // Reserve the last 600ms strictly for stateSave() + notecardEnterSleep().
-    // Note queue drain and shutdown note must finish before queueDrainDeadline.
+    // Note queue drain and shutdown note must finish before queueDrainDeadline;
+    // the drain stops 400ms earlier so the spill always gets its request.
     uint32_t deadline         = millis() + PVD_SHUTDOWN_NOTE_TIMEOUT_MS;
     uint32_t queueDrainDeadline = deadline - 600;
+    uint32_t sendDeadline     = queueDrainDeadline - 400;
 
     // 1. Queue a low-battery warning event for AudioTask (non-blocking — does not
     //    touch I2C from this context, avoiding mutex contention with AudioTask).
@@ -138,42 +372,63 @@ static void pvdSafeShutdown(void) {
     //    Use time-remaining for all per-item mutex timeouts so we don't overshoot.
     NoteQueueItem item;
     uint8_t drained = 0;
-    while (drained < PVD_QUEUE_DRAIN_LIMIT && millis() < queueDrainDeadline) {
-        uint32_t remaining = queueDrainDeadline - millis();
+    while (drained < PVD_QUEUE_DRAIN_LIMIT && !MS_REACHED(millis(), sendDeadline)) {
+        uint32_t remaining = sendDeadline - millis();
         if (!syncReceiveNote(&item, MIN(200, remaining))) break;
+        if (item.type == NOTE_TYPE_HEALTH) {
+            // Building the report takes a run-time statistics sample; the
+            // next boot's report supersedes it
+            continue;
+        }
 
-        remaining = queueDrainDeadline - millis();
-        if (remaining < 100) break;  // Not enough time left
+        remaining = MS_REACHED(millis(), sendDeadline) ? 0 : sendDeadline - millis();
+        if (remaining < 100) {
+            // Not enough time left - keep the note for the spill
+            syncQueueNote(&item);
+            break;
+        }
         if (syncAcquireI2C(MIN(400, remaining - 50))) {
             switch (item.type) {
                 case NOTE_TYPE_TRACK:
                     notecardSendTrackNote(&item.data.track, s_currentConfig.mode, true);
                     break;
                 case NOTE_TYPE_ALERT:
-                    notecardSendAlertNote(&item.data.alert);
+                    notecardSendAlertNote(&item.data.alert, true,
+                                          latencyAgeMs(item.createdMs, millis()));
                     break;
                 case NOTE_TYPE_CMD_ACK:
                     notecardSendCommandAck(&item.data.ack);
                     break;
                 case NOTE_TYPE_HEALTH:
-                    notecardSendHealthNote(&item.data.health);
                     break;
             }
             syncReleaseI2C();
             drained++;
+        } else {
+            syncQueueNote(&item);
         }
     }
 
-    // 3. Send shutdown health note with current voltage (if budget allows).
-    if (millis() < queueDrainDeadline) {
+    // 3. Spill everything still pending to Notecard flash in one request.
+    //    main.cpp requeues it on the next boot.
+    size_t spillLength = syncSpillPending(s_spillBlob, sizeof(s_spillBlob));
+    if (spillLength > 0 && !MS_REACHED(millis(), queueDrainDeadline)) {
         if (syncAcquireI2C(MIN(400, queueDrainDeadline - millis()))) {
-            float voltage = notecardGetVoltage(NULL);
+            notecardSaveNoteSpill(s_spillBlob, spillLength);
+            syncReleaseI2C();
+        }
+    }
+
+    // 4. Send shutdown health note with current voltage (if budget allows).
+    if (!MS_REACHED(millis(), queueDrainDeadline)) {
+        if (syncAcquireI2C(MIN(400, queueDrainDeadline - millis()))) {
+            float voltage = telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
             notecardSendShutdownNote(voltage, "pvd_low_battery");
             syncReleaseI2C();
         }
     }
 
-    // 4. Save state and enter Notecard sleep (reserved 600ms budget).
+    // 5. Save state and enter Notecard sleep (reserved 600ms budget).
     //    Use a generous mutex timeout — this is the critical path.
     if (syncAcquireI2C(500)) {
         stateSetShutdownReason("pvd");
@@ -196,73 +451,112 @@ static void pvdSafeShutdown(void) {
 // =============================================================================
 
 bool tasksCreate(void) {
-    BaseType_t result;
-
     // Create MainTask
-    result = xTaskCreate(
+    g_mainTaskHandle = xTaskCreateStatic(
         MainTask,
         "Main",
         STACK_MAIN,
         NULL,
         PRIORITY_MAIN,
-        &g_mainTaskHandle
+        s_mainStack,
+        &s_mainTcb
     );
-    if (result != pdPASS) return false;
-
+    if (g_mainTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_mainTaskHandle, RUNSTATS_TASK_MAIN);
+
+    #ifdef JOBS_MODE
+    // Create JobsTask (runs the sensor, command and env jobs)
+    g_jobsTaskHandle = xTaskCreateStatic(
+        JobsTask,
+        "Jobs",
+        STACK_JOBS,
+        NULL,
+        PRIORITY_JOBS,
+        s_jobsStack,
+        &s_jobsTcb
+    );
+    if (g_jobsTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_jobsTaskHandle, RUNSTATS_TASK_JOBS);
+    #else
     // Create SensorTask
-    result = xTaskCreate(
+    g_sensorTaskHandle = xTaskCreateStatic(
         SensorTask,
         "Sensor",
         STACK_SENSOR,
         NULL,
         PRIORITY_SENSOR,
-        &g_sensorTaskHandle
-    );
-    if (result != pdPASS) return false;
-
-    // Create AudioTask
-    result = xTaskCreate(
-        AudioTask,
-        "Audio",
-        STACK_AUDIO,
-        NULL,
-        PRIORITY_AUDIO,
-        &g_audioTaskHandle
+        s_sensorStack,
+        &s_sensorTcb
     );
-    if (result != pdPASS) return false;
+    if (g_sensorTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_sensorTaskHandle, RUNSTATS_TASK_SENSOR);
 
     // Create CommandTask
-    result = xTaskCreate(
+    g_commandTaskHandle = xTaskCreateStatic(
         CommandTask,
         "Command",
         STACK_COMMAND,
         NULL,
         PRIORITY_COMMAND,
-        &g_commandTaskHandle
+        s_commandStack,
+        &s_commandTcb
     );
-    if (result != pdPASS) return false;
+    if (g_commandTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_commandTaskHandle, RUNSTATS_TASK_COMMAND);
+
+    // Create EnvTask
+    g_envTaskHandle = xTaskCreateStatic(
+        EnvTask,
+        "Env",
+        STACK_ENV,
+        NULL,
+        PRIORITY_ENV,
+        s_envStack,
+        &s_envTcb
+    );
+    if (g_envTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_envTaskHandle, RUNSTATS_TASK_ENV);
+    #endif
+
+    // Create AudioTask
+    g_audioTaskHandle = xTaskCreateStatic(
+        AudioTask,
+        "Audio",
+        STACK_AUDIO,
+        NULL,
+        PRIORITY_AUDIO,
+        s_audioStack,
+        &s_audioTcb
+    );
+    if (g_audioTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_audioTaskHandle, RUNSTATS_TASK_AUDIO);
 
     // Create NotecardTask
-    result = xTaskCreate(
+    g_notecardTaskHandle = xTaskCreateStatic(
         NotecardTask,
         "Notecard",
         STACK_NOTECARD,
         NULL,
         PRIORITY_NOTECARD,
-        &g_notecardTaskHandle
+        s_notecardStack,
+        &s_notecardTcb
     );
-    if (result != pdPASS) return false;
-
-    // Create EnvTask
-    result = xTaskCreate(
-        EnvTask,
-        "Env",
-        STACK_ENV,
+    if (g_notecardTaskHandle == NULL) return false;
+    vTaskSetTaskNumber(g_notecardTaskHandle, RUNSTATS_TASK_NOTECARD);
+
+    #ifndef TRACE_DISABLED
+    // Create TraceTask (untagged, so its time counts as "other")
+    g_traceTaskHandle = xTaskCreateStatic(
+        TraceTask,
+        "Trace",
+        STACK_TRACE,
         NULL,
-        PRIORITY_ENV,
-        &g_envTaskHandle
+        PRIORITY_TRACE,
+        s_traceStack,
+        &s_traceTcb
     );
-    if (result != pdPASS) return false;
+    if (g_traceTaskHandle == NULL) return false;
+    #endif
 
     #ifdef DEBUG_MODE
     DEBUG_SERIAL.println("[Tasks] All tasks created");
@@ -295,15 +589,25 @@ bool tasksSleepRequested(void) {
 void tasksGetConfig(SongbirdConfig* config) {
     if (config == NULL) return;
 
-    // Pre-populate with safe defaults in case mutex times out.
-    // Without this, a timeout would leave the caller with uninitialized
-    // stack data used as active configuration.
-    envInitDefaults(config);
+    // Safe defaults until MainTask publishes, rather than leaving the caller
+    // with uninitialized stack data used as active configuration
+    if (configStoreRead(config) == 0) {
+        envInitDefaults(config);
+    }
+}
+
+bool tasksRefreshConfig(SongbirdConfig* config, uint32_t* generation) {
+    if (config == NULL || generation == NULL) return false;
 
-    if (syncAcquireConfig(100)) {
-        memcpy(config, &s_currentConfig, sizeof(SongbirdConfig));
-        syncReleaseConfig();
+    if (configStoreRefresh(config, generation)) {
+        return true;
+    }
+    if (*generation == 0) {
+        // Nothing published yet
+        envInitDefaults(config);
+        return true;
     }
+    return false;
 }
 
 void tasksLogStackUsage(void) {
@@ -311,17 +615,26 @@ void tasksLogStackUsage(void) {
     DEBUG_SERIAL.println("[Tasks] Stack high water marks:");
     DEBUG_SERIAL.print("  Main: ");
     DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_mainTaskHandle));
+    #ifdef JOBS_MODE
+    DEBUG_SERIAL.print("  Jobs: ");
+    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_jobsTaskHandle));
+    #else
     DEBUG_SERIAL.print("  Sensor: ");
     DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_sensorTaskHandle));
-    DEBUG_SERIAL.print("  Audio: ");
-    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_audioTaskHandle));
     DEBUG_SERIAL.print("  Command: ");
     DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_commandTaskHandle));
-    DEBUG_SERIAL.print("  Notecard: ");
-    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_notecardTaskHandle));
     DEBUG_SERIAL.print("  Env: ");
     DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_envTaskHandle));
     #endif
+    DEBUG_SERIAL.print("  Audio: ");
+    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_audioTaskHandle));
+    DEBUG_SERIAL.print("  Notecard: ");
+    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_notecardTaskHandle));
+    #ifndef TRACE_DISABLED
+    DEBUG_SERIAL.print("  Trace: ");
+    DEBUG_SERIAL.println(uxTaskGetStackHighWaterMark(g_traceTaskHandle));
+    #endif
+    #endif
 }
 
 // =============================================================================
@@ -337,15 +650,35 @@ void MainTask(void* pvParameters) {
 
     // Initialize default configuration
     envInitDefaults(&s_currentConfig);
+    configStorePublish(&s_currentConfig);
 
-    // Play power-on melody directly (not queued) to avoid mutex contention
-    // during startup when we hold I2C for extended Notecard operations
-    audioPlayEvent(AUDIO_EVENT_POWER_ON, s_currentConfig.audioVolume);
+    // Baseline for the first health report window
+    runStatsCollect(&s_runStatsWindowStart);
+    metricsSnapshot(&s_reportedMetrics);
 
     // State was already loaded/initialized in setup() before FreeRTOS started.
     // Use stateIsWarmBoot() to determine cold vs. warm boot path.
     bool warmBoot = stateIsWarmBoot();
 
+    // A warm boot in storage/sleep mode is a scheduled wake from the deep
+    // sleep cycle - skip the melodies and the Notehub connection wait
+    OperatingMode restoredMode = stateGet()->currentMode;
+    bool sleepCycleWake = warmBoot &&
+                          (restoredMode == MODE_STORAGE || restoredMode == MODE_SLEEP);
+
+    if (warmBoot) {
+        traceRecord(TRACE_MAIN_WAKE, notecardGetWakeEvents(), 0);
+    }
+    if (sleepCycleWake) {
+        bootProfileFlag(BOOT_FLAG_SLEEP_WAKE);
+    }
+
+    // Play power-on melody directly (not queued) to avoid mutex contention
+    // during startup when we hold I2C for extended Notecard operations
+    if (!sleepCycleWake) {
+        audioPlayEvent(AUDIO_EVENT_POWER_ON, s_currentConfig.audioVolume);
+    }
+
     // Check PVD flag before any long blocking operation — the flag may have been
     // set during setup() just before the scheduler started, and this is the
     // earliest point MainTask can act on it.
@@ -355,33 +688,39 @@ void MainTask(void* pvParameters) {
         // Cold boot - configure Notecard (only on cold boot)
         // Note: GPS and tracking are configured inside notecardConfigure()
         if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-            notecardConfigure(s_currentConfig.mode);
+            notecardConfigure(&s_currentConfig);
             notecardSetupTemplates();
             syncReleaseI2C();
         }
+        bootProfileMark(BOOT_STAGE_CONFIGURE);
     } else {
         // Warm boot - restore mode from state
-        s_currentConfig.mode = stateGet()->currentMode;
+        s_currentConfig.mode = restoredMode;
+        configStorePublish(&s_currentConfig);
     }
 
     // Check PVD again before notecardWaitConnection() which can block up to 30s.
     if (g_pvdShutdownRequested) { pvdSafeShutdown(); }
 
-    // Wait for Notehub connection
+    // Wait for Notehub connection (periodic modes queue notes offline, so a
+    // scheduled wake does not spend 30s of battery waiting for the modem)
     bool connected = false;
-    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+    if (!sleepCycleWake && syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
         connected = notecardWaitConnection(NOTEHUB_CONNECT_TIMEOUT_MS);
         syncReleaseI2C();
+        bootProfileMark(BOOT_STAGE_CONNECT);
     }
 
     if (connected) {
+        bootProfileFlag(BOOT_FLAG_CONNECTED);
+
         // Play connected melody directly (not queued) to avoid mutex contention
         audioPlayEvent(AUDIO_EVENT_CONNECTED, s_currentConfig.audioVolume);
 
         // If this was a brownout reset, log it to Notehub now that we're connected
         if (powerWasBrownoutReset()) {
             if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                float voltage = notecardGetVoltage(NULL);
+                float voltage = telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
                 notecardSendShutdownNote(voltage, "brownout_reset");
                 syncReleaseI2C();
             }
@@ -392,15 +731,15 @@ void MainTask(void* pvParameters) {
     }
 
     // Fetch initial configuration from environment variables
-    OperatingMode initialMode = s_currentConfig.mode;
+    SongbirdConfig initialConfig;
+    memcpy(&initialConfig, &s_currentConfig, sizeof(SongbirdConfig));
+    OperatingMode initialMode = initialConfig.mode;
     if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
         SongbirdConfig newConfig;
         envInitDefaults(&newConfig);
         if (envFetchConfig(&newConfig)) {
-            if (syncAcquireConfig(100)) {
-                memcpy(&s_currentConfig, &newConfig, sizeof(SongbirdConfig));
-                syncReleaseConfig();
-            }
+            memcpy(&s_currentConfig, &newConfig, sizeof(SongbirdConfig));
+            configStorePublish(&s_currentConfig);
         }
 
         // If mode changed from default after fetching env vars, reconfigure Notecard
@@ -413,13 +752,19 @@ void MainTask(void* pvParameters) {
             DEBUG_SERIAL.println(envGetModeName(s_currentConfig.mode));
             #endif
             stateSetMode(s_currentConfig.mode);
-            notecardConfigure(s_currentConfig.mode);
+            notecardConfigure(&s_currentConfig);
+        } else {
+            // Same mode: apply non-default sync/GPS intervals. After a warm
+            // boot the Notecard usually has them already, and hub.set with
+            // unchanged values costs no radio time.
+            applyCadenceChange(&initialConfig, &s_currentConfig);
         }
 
         syncReleaseI2C();
     }
 
     // Signal system ready
+    bootProfileMark(BOOT_STAGE_ENV);
     g_systemReady = true;
 
     #ifdef DEBUG_MODE
@@ -440,50 +785,59 @@ void MainTask(void* pvParameters) {
         // Check for configuration updates from EnvTask
         SongbirdConfig newConfig;
         if (syncReceiveConfig(&newConfig)) {
-            #ifdef DEBUG_MODE
-            DEBUG_SERIAL.println("[MainTask] Config update received");
-            #endif
+            traceRecord(TRACE_MAIN_CONFIG_UPDATE, newConfig.mode, 0);
 
             // Apply new configuration
-            if (syncAcquireConfig(100)) {
-                OperatingMode oldMode = s_currentConfig.mode;
-                memcpy(&s_currentConfig, &newConfig, sizeof(SongbirdConfig));
-                syncReleaseConfig();
-
-                // If mode changed, reconfigure Notecard and send immediate track note
-                // Note: GPS and tracking are configured inside notecardConfigure()
-                if (oldMode != newConfig.mode) {
-                    stateSetMode(newConfig.mode);
-                    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                        notecardConfigure(newConfig.mode);
-                        // Queue immediate track.qo with new mode and current readings
-                        queueImmediateTrackNote(newConfig.mode);
-                        syncReleaseI2C();
-                    }
-
-                    // Reset GPS power state when changing modes
-                    // GPS will be reconfigured based on new mode settings
-                    if (newConfig.mode == MODE_TRANSIT || oldMode == MODE_TRANSIT) {
-                        stateSetGpsPowerSaving(false);
-                        stateSetGpsWasActive(false);
-                        stateSetGpsActiveStartTime(0);
-                        stateSetLastGpsRetryTime(0);
-                        #ifdef DEBUG_MODE
-                        DEBUG_SERIAL.println("[MainTask] GPS power state reset for mode change");
-                        #endif
-                    }
+            SongbirdConfig oldConfig;
+            memcpy(&oldConfig, &s_currentConfig, sizeof(SongbirdConfig));
+            OperatingMode oldMode = oldConfig.mode;
+            memcpy(&s_currentConfig, &newConfig, sizeof(SongbirdConfig));
+            configStorePublish(&s_currentConfig);
+
+            // If mode changed, reconfigure Notecard and send immediate track note
+            // Note: GPS and tracking are configured inside notecardConfigure()
+            if (oldMode != newConfig.mode) {
+                stateSetMode(newConfig.mode);
+                if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+                    notecardConfigure(&newConfig);
+                    syncReleaseI2C();
                 }
-
-                // Update audio settings
-                audioSetEnabled(newConfig.audioEnabled);
-                audioSetVolume(newConfig.audioVolume);
-                audioSetAlertsOnly(newConfig.audioAlertsOnly);
+                // Queue immediate track.qo with new mode and current readings
+                queueImmediateTrackNote(newConfig.mode);
+
+                // Reset GPS power state when changing modes
+                // GPS will be reconfigured based on new mode settings
+                GpsPowerState gps;
+                stateGetGpsPower(&gps);
+                if (gpsPowerModeChanged(&gps, oldMode, newConfig.mode)) {
+                    stateSetGpsPower(&gps);
+                    traceRecord(TRACE_MAIN_GPS_RESET, 0, 0);
+                }
+            } else if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+                // Same mode: follow sync_interval_min / gps_interval_min
+                applyCadenceChange(&oldConfig, &newConfig);
+                syncReleaseI2C();
             }
+
+            // Update audio settings
+            audioSetEnabled(newConfig.audioEnabled);
+            audioSetVolume(newConfig.audioVolume);
+            audioSetAlertsOnly(newConfig.audioAlertsOnly);
         }
 
-        // Check if we should enter deep sleep
-        // (In a real implementation, this would be more sophisticated)
-        // For now, we don't automatically sleep - let the device run continuously
+        // Re-apply hub.set sync intervals when the battery-aware power policy
+        // moves to a new scale step (SensorTask feeds it voltage readings).
+        // The applied scale is persisted, so a warm boot compares against
+        // what the Notecard really carries; a failed request is retried
+        // after SYNC_SCALE_RETRY_MS rather than every loop.
+        if (powerPolicyGetScalePercent() != stateGetAppliedSyncScale() &&
+            MS_REACHED(millis(), s_syncScaleRetryMs) &&
+            syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+            if (!notecardConfigureHub(&s_currentConfig)) {
+                s_syncScaleRetryMs = millis() + SYNC_SCALE_RETRY_MS;
+            }
+            syncReleaseI2C();
+        }
 
         // Handle user button: 1-click=transit lock, 2-click=demo lock, 3-click=mute
         // External panel-mount button only in release builds. BUTTON_PIN_ALT is the
@@ -510,10 +864,7 @@ void MainTask(void* pvParameters) {
                         s_firstClickTime = now;
                     }
 
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.print("[MainTask] Click count: ");
-                    DEBUG_SERIAL.println(s_clickCount);
-                    #endif
+                    traceRecord(TRACE_MAIN_CLICKS, s_clickCount, 0);
                 }
             }
         } else {
@@ -527,9 +878,7 @@ void MainTask(void* pvParameters) {
             // Check for triple-click (mute toggle) - must check first
             if (s_clickCount >= 3 && elapsed < TRIPLE_CLICK_TIMEOUT_MS) {
                 // Triple-click detected - toggle mute
-                #ifdef DEBUG_MODE
-                DEBUG_SERIAL.println("[MainTask] Triple-click - toggling mute");
-                #endif
+                traceRecord(TRACE_MAIN_MUTE, 0, 0);
                 audioToggleMute();
                 s_clickCount = 0;
             }
@@ -537,15 +886,9 @@ void MainTask(void* pvParameters) {
             // timeout so an in-flight 3rd click can still promote to a triple.
             else if (s_clickCount == 2 && elapsed >= TRIPLE_CLICK_TIMEOUT_MS) {
                 // Double-click detected - toggle demo lock
-                #ifdef DEBUG_MODE
-                DEBUG_SERIAL.println("[MainTask] Double-click - toggling demo lock");
-                #endif
-
                 // Guard: reject if transit lock is active (can't enable demo lock while transit locked)
                 if (stateIsTransitLocked() && !stateIsDemoLocked()) {
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.println("[MainTask] Demo lock rejected - transit lock is active");
-                    #endif
+                    traceRecord(TRACE_MAIN_LOCK_REJECTED, stateIsDemoLocked(), stateIsTransitLocked());
                     audioQueueEvent(AUDIO_EVENT_ERROR);
                     s_clickCount = 0;
                 }
@@ -556,23 +899,18 @@ void MainTask(void* pvParameters) {
                     stateSetMode(previousMode);
 
                     // Apply the restored mode
-                    if (syncAcquireConfig(100)) {
-                        s_currentConfig.mode = previousMode;
-                        syncReleaseConfig();
-                    }
+                    s_currentConfig.mode = previousMode;
+                    configStorePublish(&s_currentConfig);
                     if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                        notecardConfigure(previousMode);
-                        queueImmediateTrackNote(previousMode);
+                        notecardConfigure(&s_currentConfig);
                         syncReleaseI2C();
                     }
+                    queueImmediateTrackNote(previousMode);
 
                     audioQueueEvent(AUDIO_EVENT_DEMO_LOCK_OFF);
                     stateUpdateLockLED();
 
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.print("[MainTask] Demo lock OFF, restored mode: ");
-                    DEBUG_SERIAL.println(envGetModeName(previousMode));
-                    #endif
+                    traceRecord(TRACE_MAIN_DEMO_LOCK, false, previousMode);
                 } else {
                     // Lock: save current mode and switch to demo
                     OperatingMode currentMode = s_currentConfig.mode;
@@ -580,23 +918,18 @@ void MainTask(void* pvParameters) {
                     stateSetMode(MODE_DEMO);
 
                     // Apply demo mode
-                    if (syncAcquireConfig(100)) {
-                        s_currentConfig.mode = MODE_DEMO;
-                        syncReleaseConfig();
-                    }
+                    s_currentConfig.mode = MODE_DEMO;
+                    configStorePublish(&s_currentConfig);
                     if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                        notecardConfigure(MODE_DEMO);
-                        queueImmediateTrackNote(MODE_DEMO);
+                        notecardConfigure(&s_currentConfig);
                         syncReleaseI2C();
                     }
+                    queueImmediateTrackNote(MODE_DEMO);
 
                     audioQueueEvent(AUDIO_EVENT_DEMO_LOCK_ON);
                     stateUpdateLockLED();
 
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.print("[MainTask] Demo lock ON, saved mode: ");
-                    DEBUG_SERIAL.println(envGetModeName(currentMode));
-                    #endif
+                    traceRecord(TRACE_MAIN_DEMO_LOCK, true, currentMode);
                 }
 
                 s_clickCount = 0;
@@ -604,15 +937,9 @@ void MainTask(void* pvParameters) {
             // Single click: wait for full timeout to ensure no more clicks coming
             else if (s_clickCount == 1 && elapsed >= TRIPLE_CLICK_TIMEOUT_MS) {
                 // Single click - toggle transit lock
-                #ifdef DEBUG_MODE
-                DEBUG_SERIAL.println("[MainTask] Single-click - toggling transit lock");
-                #endif
-
                 // Guard: reject if demo lock is active (can't enable transit lock while demo locked)
                 if (stateIsDemoLocked() && !stateIsTransitLocked()) {
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.println("[MainTask] Transit lock rejected - demo lock is active");
-                    #endif
+                    traceRecord(TRACE_MAIN_LOCK_REJECTED, stateIsDemoLocked(), stateIsTransitLocked());
                     audioQueueEvent(AUDIO_EVENT_ERROR);
                 }
                 else if (stateIsTransitLocked()) {
@@ -622,23 +949,18 @@ void MainTask(void* pvParameters) {
                     stateSetMode(previousMode);
 
                     // Apply the restored mode
-                    if (syncAcquireConfig(100)) {
-                        s_currentConfig.mode = previousMode;
-                        syncReleaseConfig();
-                    }
+                    s_currentConfig.mode = previousMode;
+                    configStorePublish(&s_currentConfig);
                     if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                        notecardConfigure(previousMode);
-                        queueImmediateTrackNote(previousMode);
+                        notecardConfigure(&s_currentConfig);
                         syncReleaseI2C();
                     }
+                    queueImmediateTrackNote(previousMode);
 
                     audioQueueEvent(AUDIO_EVENT_TRANSIT_LOCK_OFF);
                     stateUpdateLockLED();
 
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.print("[MainTask] Transit lock OFF, restored mode: ");
-                    DEBUG_SERIAL.println(envGetModeName(previousMode));
-                    #endif
+                    traceRecord(TRACE_MAIN_TRANSIT_LOCK, false, previousMode);
                 } else {
                     // Lock: save current mode and switch to transit
                     OperatingMode currentMode = s_currentConfig.mode;
@@ -646,23 +968,18 @@ void MainTask(void* pvParameters) {
                     stateSetMode(MODE_TRANSIT);
 
                     // Apply transit mode
-                    if (syncAcquireConfig(100)) {
-                        s_currentConfig.mode = MODE_TRANSIT;
-                        syncReleaseConfig();
-                    }
+                    s_currentConfig.mode = MODE_TRANSIT;
+                    configStorePublish(&s_currentConfig);
                     if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                        notecardConfigure(MODE_TRANSIT);
-                        queueImmediateTrackNote(MODE_TRANSIT);
+                        notecardConfigure(&s_currentConfig);
                         syncReleaseI2C();
                     }
+                    queueImmediateTrackNote(MODE_TRANSIT);
 
                     audioQueueEvent(AUDIO_EVENT_TRANSIT_LOCK_ON);
                     stateUpdateLockLED();
 
-                    #ifdef DEBUG_MODE
-                    DEBUG_SERIAL.print("[MainTask] Transit lock ON, saved mode: ");
-                    DEBUG_SERIAL.println(envGetModeName(currentMode));
-                    #endif
+                    traceRecord(TRACE_MAIN_TRANSIT_LOCK, true, currentMode);
                 }
 
                 s_clickCount = 0;
@@ -673,36 +990,78 @@ void MainTask(void* pvParameters) {
             }
         }
 
-        // Periodic health check
+        // Keep the 64-bit run times exact across the 32-bit counter wrap
+        static uint32_t lastRunStatsUpdate = 0;
+        if (millis() - lastRunStatsUpdate >= RUNSTATS_UPDATE_INTERVAL_MS) {
+            lastRunStatsUpdate = millis();
+            runStatsUpdate();
+        }
+
+        // Periodic health check (also on the first pass, so a short
+        // sleep-cycle wake still reports when its heartbeat is due)
         static uint32_t lastHealthCheck = 0;
-        if (millis() - lastHealthCheck > HEALTH_CHECK_INTERVAL_MS) {
+        if (lastHealthCheck == 0 || millis() - lastHealthCheck > HEALTH_CHECK_INTERVAL_MS) {
             lastHealthCheck = millis();
 
             #ifdef DEBUG_MODE
             tasksLogStackUsage();
             #endif
+
+            NotecardStatus status;
+            notecardGetStatus(&status);
+            traceRecord(TRACE_MAIN_STATUS, status.connected, status.gpsEnabled && status.gpsLock);
+
+            // health.qo every heartbeat_hours, or early on a significant change
+            metricsRecordHeapFree((uint32_t)xPortGetFreeHeapSize());
+            uint32_t nowEpoch = 0;
+            if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+                nowEpoch = telemetryGetEpoch();
+                syncReleaseI2C();
+            }
+            MetricsSnapshot metrics;
+            metricsSnapshot(&metrics);
+            MetricsTrigger trigger = metricsReportDue(&s_reportedMetrics, &metrics,
+                                                      healthSecondsSinceReport(nowEpoch),
+                                                      HOURS_TO_SEC(s_currentConfig.heartbeatHours));
+            if (trigger != METRICS_TRIGGER_NONE) {
+                queueHealthNote(trigger, &metrics, nowEpoch);
+            }
+        }
+
+        // Storage/sleep mode: power down once this wake's report cycle is done
+        if (!g_sleepRequested && sleepCycleReady(warmBoot)) {
+            traceRecord(TRACE_MAIN_SLEEP_REQUEST, 0, 0);
+            syncRequestSleep();
         }
 
         // Check for sleep request
         if (g_sleepRequested) {
             // Coordinate sleep with all tasks
-            syncSetSleepReady(SLEEP_BIT_SENSOR);  // MainTask doesn't have its own bit
-
             if (syncWaitAllSleepReady(SLEEP_COORDINATION_TIMEOUT_MS)) {
-                // All tasks ready - enter sleep
-                audioPlayEvent(AUDIO_EVENT_SLEEP, s_currentConfig.audioVolume);
+                // All tasks ready - enter sleep. Only announce the first sleep
+                // after power-on, not every scheduled cycle.
+                if (!warmBoot) {
+                    audioPlayEvent(AUDIO_EVENT_SLEEP, s_currentConfig.audioVolume);
+                }
 
                 if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                    stateSave();
-                    notecardEnterSleep();
-                    // Should not return
+                    uint32_t sinceReport = healthSecondsSinceReport(telemetryGetEpoch());
+                    uint32_t sleepSec = sleepCycleDurationSec(&s_currentConfig, sinceReport);
+                    if (stateSaveAndSleep(sleepSec,
+                                          s_currentConfig.motionWakeEnabled,
+                                          s_currentConfig.cmdWakeEnabled)) {
+                        notecardEnterSleep();
+                        // Should not return
+                    }
                     syncReleaseI2C();
                 }
             }
 
-            // Sleep failed or timed out
-            g_sleepRequested = false;
-            syncClearSleepBits();
+            // Sleep failed or timed out - release parked tasks, require a
+            // fresh report cycle and back off before trying again
+            syncCancelSleep();
+            syncClearCycleBits();
+            s_lastSleepAttemptMs = sleepCycleAttemptFailed(millis());
         }
 
         vTaskDelay(pdMS_TO_TICKS(MAIN_LOOP_INTERVAL_MS));
@@ -713,18 +1072,22 @@ void MainTask(void* pvParameters) {
 // SensorTask Implementation
 // =============================================================================
 
-void SensorTask(void* pvParameters) {
-    (void)pvParameters;
+// SensorTask state between readings (JobsTask's with JOBS_MODE)
+static SongbirdConfig s_sensorConfig;
+static uint32_t s_sensorConfigGeneration = 0;
 
-    // Wait for system ready
-    while (!g_systemReady) {
-        vTaskDelay(pdMS_TO_TICKS(100));
-    }
+// Sensor profile currently applied (invalid until the first reading)
+static const SensorProfile* s_appliedProfile = NULL;
 
-    #ifdef DEBUG_MODE
-    DEBUG_SERIAL.println("[SensorTask] Starting");
-    #endif
+// Reading in progress: sensorJobStart() to sensorJobRead()
+static bool s_sensorStarted = false;
+static uint32_t s_sensorIntervalMs = 0;
 
+// Track USB power state to detect changes
+// Start with "unknown" state (-1) to force initial configuration
+static int8_t s_lastUsbPowered = -1;
+
+static void sensorJobInit(void) {
     // Note: Sensors are now initialized in main.cpp setup() for reliability
     // at low battery voltage. If init failed there, try again here.
     if (!sensorsIsAvailable()) {
@@ -736,124 +1099,210 @@ void SensorTask(void* pvParameters) {
             syncReleaseI2C();
         }
     }
+}
 
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    SensorData data;
+/**
+ * @brief Apply the mode's sensor profile and trigger a BME280 conversion
+ *
+ * @return Milliseconds until the conversion is done and sensorJobRead() may
+ *         run, or JOB_SENSOR_OFF if the mode disables sensors
+ */
+static uint32_t sensorJobStart(void) {
+    // Pick up a newly published config (no copy while unchanged)
+    tasksRefreshConfig(&s_sensorConfig, &s_sensorConfigGeneration);
+
+    // Apply the BME280 profile for the mode (retried next cycle on failure)
+    const SensorProfile* profile = envGetSensorProfile(&s_sensorConfig);
+    if (profile != s_appliedProfile && sensorsIsAvailable() &&
+        syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        if (sensorsApplyProfile(profile)) {
+            s_appliedProfile = profile;
+        }
+        syncReleaseI2C();
+    }
 
-    // Track USB power state to detect changes
-    // Start with "unknown" state (-1) to force initial configuration
-    static int8_t s_lastUsbPowered = -1;
+    // Check if sensors should be read in current mode
+    s_sensorIntervalMs = envGetSensorIntervalMs(&s_sensorConfig);
+    if (s_sensorIntervalMs == 0) {
+        // Sleep mode - sensors disabled, nothing to report this cycle
+        syncSetCycleDone(CYCLE_BIT_SENSOR);
+        return JOB_SENSOR_OFF;
+    }
 
-    for (;;) {
-        // Check for sleep request
-        if (g_sleepRequested) {
-            syncSetSleepReady(SLEEP_BIT_SENSOR);
-            vTaskSuspend(NULL);
-            continue;
+    // Start the conversion; the caller waits it out without holding the bus
+    uint32_t conversionMs = 0;
+    s_sensorStarted = false;
+    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        s_sensorStarted = sensorsStartMeasurement(&conversionMs);
+        syncReleaseI2C();
+    }
+    return s_sensorStarted ? conversionMs : 0;
+}
+
+/**
+ * @brief Read the conversion sensorJobStart() triggered, run the alert
+ *        engine and queue its notes
+ *
+ * @return Milliseconds from this reading's start to the next, stretched by
+ *         the battery-aware power policy
+ */
+static uint32_t sensorJobRead(void) {
+    // Read sensors
+    SensorData data;
+    bool readSuccess = false;
+    uint32_t nowSec = 0;
+    uint32_t sampleMs = 0;
+    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        if (s_sensorStarted) {
+            readSuccess = sensorsReadMeasurement(&data);
+            sampleMs = millis();
+        } else {
+            memset(&data, 0, sizeof(data));
         }
 
-        // Get current config
-        SongbirdConfig config;
-        tasksGetConfig(&config);
+        // Get battery voltage for alert checking and USB power status
+        // Note: voltage is used for firmware alerts but not sent in track.qo
+        // Battery info is reported to cloud via _log.qo (Mojo) and _health.qo
+        bool usbPowered = false;
+        data.voltage = telemetryGetVoltage(&usbPowered, TELEMETRY_VOLTAGE_TTL_MS);
 
-        // Check if sensors should be read in current mode
-        uint32_t interval = envGetSensorIntervalMs(&config);
-        if (interval == 0) {
-            // Sleep mode - sensors disabled, just wait
-            vTaskDelay(pdMS_TO_TICKS(SLEEP_MODE_SENSOR_WAIT_MS));
-            continue;
+        // Check for USB power state change and toggle Mojo monitoring
+        int8_t currentUsbState = usbPowered ? 1 : 0;
+        if (currentUsbState != s_lastUsbPowered) {
+            traceRecord(TRACE_SENSOR_USB_POWER, usbPowered, 0);
+
+            // Enable Mojo when on battery, disable when on USB
+            notecardConfigureMojo(!usbPowered, s_sensorConfig.mode);
+            s_lastUsbPowered = currentUsbState;
         }
 
-        // Read sensors
-        bool readSuccess = false;
-        if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-            readSuccess = sensorsRead(&data);
+        // Feed the battery-aware duty cycling policy
+        if (powerPolicyUpdate(&s_sensorConfig, data.voltage, usbPowered)) {
+            traceRecord(TRACE_SENSOR_POWER_SCALE, powerPolicyGetScalePercent(), 0);
+        }
 
-            // Get battery voltage for alert checking and USB power status
-            // Note: voltage is used for firmware alerts but not sent in track.qo
-            // Battery info is reported to cloud via _log.qo (Mojo) and _health.qo
-            bool usbPowered = false;
-            data.voltage = notecardGetVoltage(&usbPowered);
-
-            // Check for USB power state change and toggle Mojo monitoring
-            int8_t currentUsbState = usbPowered ? 1 : 0;
-            if (currentUsbState != s_lastUsbPowered) {
-                #ifdef DEBUG_MODE
-                DEBUG_SERIAL.print("[SensorTask] USB power state changed: ");
-                DEBUG_SERIAL.println(usbPowered ? "USB powered" : "battery powered");
-                #endif
-
-                // Enable Mojo when on battery, disable when on USB
-                notecardConfigureMojo(!usbPowered, config.mode);
-                s_lastUsbPowered = currentUsbState;
-            }
+        // Refresh motion status. The telemetry cache latches card.motion
+        // into the state, which is consumed when the track note is queued.
+        telemetryGetMotion(TELEMETRY_MOTION_TTL_MS);
 
-            // Get motion status
-            data.motion = notecardGetMotion() || stateGetAndClearMotion();
+        // Wall clock for the alert engine's rate and tendency history,
+        // and the note timestamp (notes may be replayed from the spill)
+        nowSec = telemetryGetEpoch();
+        data.timestamp = nowSec;
 
-            syncReleaseI2C();
+        syncReleaseI2C();
+    }
+
+    if (readSuccess) {
+        // Feed the alert engine (history persists in state across sleep)
+        uint8_t currentAlerts = stateGetAlerts();
+        AlertEngineState engine;
+        AlertEvaluation eval;
+        stateGetAlertEngine(&engine);
+        alertEngineUpdate(&engine, &data, &s_sensorConfig, nowSec, currentAlerts, &eval);
+        stateSetAlertEngine(&engine);
+
+        // All transitions from this cycle go out as one alert note.
+        // Raised alerts sync immediately; a note that only clears
+        // alerts rides the next regular sync.
+        if (eval.raised != 0 || eval.cleared != 0) {
+            NoteQueueItem noteItem;
+            noteItem.type = NOTE_TYPE_ALERT;
+            noteItem.forceSync = (eval.raised != 0);
+            noteItem.createdMs = sampleMs;  // Alert latency runs from the sample
+            sensorsBuildAlertNote(eval.raised, eval.cleared, &data, &eval,
+                                  &s_sensorConfig, &noteItem.data.alert);
+            syncQueueNote(&noteItem);
         }
 
-        if (readSuccess) {
-            // Check for alerts
-            uint8_t currentAlerts = stateGetAlerts();
-            uint8_t newAlerts = sensorsCheckAlerts(&data, &config,
-                                                    stateGetLastPressure(),
-                                                    currentAlerts);
-
-            // Process new alerts
-            if (newAlerts != 0) {
-                for (uint8_t flag = 1; flag != 0; flag <<= 1) {
-                    if (newAlerts & flag) {
-                        // Build alert
-                        Alert alert;
-                        sensorsBuildAlert(flag, &data, &config, &alert);
-
-                        // Queue alert note
-                        NoteQueueItem noteItem;
-                        noteItem.type = NOTE_TYPE_ALERT;
-                        memcpy(&noteItem.data.alert, &alert, sizeof(Alert));
-                        syncQueueNote(&noteItem);
-
-                        // Queue audio
-                        if (flag & (ALERT_FLAG_TEMP_HIGH | ALERT_FLAG_TEMP_LOW)) {
-                            audioQueueEvent(AUDIO_EVENT_TEMP_ALERT);
-                        } else if (flag & (ALERT_FLAG_HUMIDITY_HIGH | ALERT_FLAG_HUMIDITY_LOW)) {
-                            audioQueueEvent(AUDIO_EVENT_HUMIDITY_ALERT);
-                        } else if (flag & ALERT_FLAG_LOW_BATTERY) {
-                            audioQueueEvent(AUDIO_EVENT_LOW_BATTERY);
-                        }
+        // Queue audio
+        if (eval.raised & (ALERT_FLAG_TEMP_HIGH | ALERT_FLAG_TEMP_LOW |
+                           ALERT_FLAG_TEMP_RATE)) {
+            audioQueueEvent(AUDIO_EVENT_TEMP_ALERT);
+        }
+        if (eval.raised & (ALERT_FLAG_HUMIDITY_HIGH | ALERT_FLAG_HUMIDITY_LOW)) {
+            audioQueueEvent(AUDIO_EVENT_HUMIDITY_ALERT);
+        }
+        if (eval.raised & ALERT_FLAG_LOW_BATTERY) {
+            audioQueueEvent(AUDIO_EVENT_LOW_BATTERY);
+        }
 
-                        // Mark alert as sent
-                        stateSetAlert(flag);
-                    }
-                }
+        // Mark raised alerts as sent and clear recovered ones
+        for (uint8_t flag = 1; flag != 0; flag <<= 1) {
+            if (eval.raised & flag) {
+                stateSetAlert(flag);
+            } else if (eval.cleared & flag) {
+                stateClearAlert(flag);
             }
+        }
 
-            // Check for cleared alerts
-            uint8_t clearedAlerts = sensorsCheckAlertsCleared(&data, &config, currentAlerts);
-            for (uint8_t flag = 1; flag != 0; flag <<= 1) {
-                if (clearedAlerts & flag) {
-                    stateClearAlert(flag);
-                }
-            }
+        // Motion since the last report (includes motion seen by a
+        // mode-change note or persisted across sleep)
+        data.motion = stateGetAndClearMotion();
 
-            // Update state
-            stateUpdateLastPressure(data.pressure);
-            if (data.motion) {
-                stateSetMotion(true);
-            }
+        // Queue track note
+        NoteQueueItem noteItem;
+        noteItem.type = NOTE_TYPE_TRACK;
+        noteItem.forceSync = false;  // Regular sensor readings use mode-based sync
+        noteItem.createdMs = sampleMs;
+        memcpy(&noteItem.data.track, &data, sizeof(SensorData));
+        syncQueueNote(&noteItem);
+    }
 
-            // Queue track note
-            NoteQueueItem noteItem;
-            noteItem.type = NOTE_TYPE_TRACK;
-            noteItem.forceSync = false;  // Regular sensor readings use mode-based sync
-            memcpy(&noteItem.data.track, &data, sizeof(SensorData));
-            syncQueueNote(&noteItem);
+    // This wake's reading is queued (or failed) - sleep may proceed
+    syncSetCycleDone(CYCLE_BIT_SENSOR);
+
+    return powerPolicyScaleInterval(s_sensorIntervalMs);
+}
+
+void SensorTask(void* pvParameters) {
+    (void)pvParameters;
+
+    // Wait for system ready
+    while (!g_systemReady) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    #ifdef DEBUG_MODE
+    DEBUG_SERIAL.println("[SensorTask] Starting");
+    #endif
+
+    sensorJobInit();
+
+    TickType_t lastWakeTime = xTaskGetTickCount();
+
+    for (;;) {
+        // Check for sleep request
+        if (g_sleepRequested) {
+            syncParkForSleep(SLEEP_BIT_SENSOR);
+            lastWakeTime = xTaskGetTickCount();
+            continue;
         }
 
-        // Wait for next interval (interval guaranteed > 0 here due to check above)
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(interval));
+        uint32_t conversionMs = sensorJobStart();
+        if (conversionMs == JOB_SENSOR_OFF) {
+            // Sleep mode - check the mode again later
+            syncWaitSleepRequest(SLEEP_MODE_SENSOR_WAIT_MS);
+            continue;
+        }
+        if (conversionMs > 0) {
+            // +1 tick: the first tick of a delay may be partial
+            vTaskDelay(pdMS_TO_TICKS(conversionMs) + 1);
+        }
+        uint32_t periodMs = sensorJobRead();
+
+        // Wait for next interval. Returns early if MainTask schedules deep sleep.
+        TickType_t period = pdMS_TO_TICKS(periodMs);
+        TickType_t elapsed = xTaskGetTickCount() - lastWakeTime;
+        if (elapsed < period) {
+            if (syncWaitSleepRequest((period - elapsed) * portTICK_PERIOD_MS)) {
+                continue;
+            }
+            lastWakeTime += period;
+        } else {
+            // Overran the interval - restart the schedule from now
+            lastWakeTime = xTaskGetTickCount();
+        }
     }
 }
 
@@ -875,16 +1324,16 @@ void AudioTask(void* pvParameters) {
     for (;;) {
         // Check for sleep request
         if (g_sleepRequested && !locateActive) {
-            syncSetSleepReady(SLEEP_BIT_AUDIO);
-            vTaskSuspend(NULL);
+            syncParkForSleep(SLEEP_BIT_AUDIO);
             continue;
         }
 
-        // Determine wait time
-        TickType_t waitTime = locateActive ? pdMS_TO_TICKS(50) : portMAX_DELAY;
+        // Determine wait time. Idle waits are bounded so a sleep request is
+        // noticed without an audio event to wake the task.
+        uint32_t waitMs = locateActive ? 50 : AUDIO_IDLE_WAIT_MS;
 
         // Check for audio events
-        if (syncReceiveAudio(&item, waitTime)) {
+        if (syncReceiveAudio(&item, waitMs)) {
             switch (item.event) {
                 case AUDIO_EVENT_LOCATE_STOP:
                     locateActive = false;
@@ -923,6 +1372,58 @@ void AudioTask(void* pvParameters) {
 // CommandTask Implementation
 // =============================================================================
 
+// CommandTask state between polls (JobsTask's with JOBS_MODE)
+static SongbirdConfig s_commandConfig;
+static uint32_t s_commandConfigGeneration = 0;
+
+/**
+ * @brief Check command.qi once, execute any command and queue its ack
+ *
+ * @return 0 after a command (another may be waiting), otherwise milliseconds
+ *         until the next poll, stretched by the battery-aware power policy
+ */
+static uint32_t commandJobRun(void) {
+    // Pick up a newly published config (no copy while unchanged)
+    tasksRefreshConfig(&s_commandConfig, &s_commandConfigGeneration);
+
+    // Check for commands
+    Command cmd;
+    bool hasCommand = false;
+
+    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        hasCommand = notecardGetCommand(&cmd);
+        syncReleaseI2C();
+    }
+
+    if (hasCommand) {
+        // Execute command
+        CommandAck ack;
+        commandsExecute(&cmd, &s_commandConfig, &ack);
+
+        // Send acknowledgment if enabled
+        if (s_commandConfig.cmdAckEnabled) {
+            NoteQueueItem noteItem;
+            noteItem.type = NOTE_TYPE_CMD_ACK;
+            noteItem.forceSync = false;
+            noteItem.createdMs = millis();
+            memcpy(&noteItem.data.ack, &ack, sizeof(CommandAck));
+            syncQueueNote(&noteItem);
+        }
+    }
+
+    // note.get returns one command; check again at once until command.qi
+    // is empty, so a wake handles every command the sync delivered
+    if (hasCommand) {
+        return 0;
+    }
+
+    // command.qi has been checked this wake - sleep may proceed
+    syncSetCycleDone(CYCLE_BIT_COMMAND);
+
+    uint32_t interval = powerPolicyScaleInterval(envGetCommandPollIntervalMs(&s_commandConfig));
+    return interval > 0 ? interval : 1000;
+}
+
 void CommandTask(void* pvParameters) {
     (void)pvParameters;
 
@@ -938,45 +1439,13 @@ void CommandTask(void* pvParameters) {
     for (;;) {
         // Check for sleep request
         if (g_sleepRequested) {
-            syncSetSleepReady(SLEEP_BIT_COMMAND);
-            vTaskSuspend(NULL);
+            syncParkForSleep(SLEEP_BIT_COMMAND);
             continue;
         }
 
-        // Get current config
-        SongbirdConfig config;
-        tasksGetConfig(&config);
-
-        // Check for commands
-        Command cmd;
-        bool hasCommand = false;
-
-        if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-            hasCommand = notecardGetCommand(&cmd);
-            syncReleaseI2C();
-        }
-
-        if (hasCommand) {
-            // Execute command
-            CommandAck ack;
-            commandsExecute(&cmd, &config, &ack);
-
-            // Send acknowledgment if enabled
-            if (config.cmdAckEnabled) {
-                NoteQueueItem noteItem;
-                noteItem.type = NOTE_TYPE_CMD_ACK;
-                memcpy(&noteItem.data.ack, &ack, sizeof(CommandAck));
-                syncQueueNote(&noteItem);
-            }
-        }
-
-        // Wait for next poll
-        uint32_t interval = envGetCommandPollIntervalMs(&config);
-        if (interval > 0) {
-            vTaskDelay(pdMS_TO_TICKS(interval));
-        } else {
-            vTaskDelay(pdMS_TO_TICKS(1000));
-        }
+        // Wait for next poll, or check at once when NotecardTask sees
+        // inbound data arrive
+        syncWaitAttnEvents(ATTN_EVENT_COMMAND, commandJobRun());
     }
 }
 
@@ -996,152 +1465,159 @@ void NotecardTask(void* pvParameters) {
     DEBUG_SERIAL.println("[NotecardTask] Starting");
     #endif
 
-    uint32_t lastSyncCheck = 0;
+    uint32_t lastStatusPoll = 0;
+    uint32_t lastSyncTime = 0;      // Last completed sync seen in the status snapshot
     NoteQueueItem item;
 
+    SongbirdConfig config;
+    uint32_t configGeneration = 0;
+
     for (;;) {
         // Check for sleep request
         if (g_sleepRequested) {
-            syncSetSleepReady(SLEEP_BIT_NOTECARD);
-            vTaskSuspend(NULL);
+            syncParkForSleep(SLEEP_BIT_NOTECARD);
             continue;
         }
 
-        // Get current config
-        SongbirdConfig config;
-        tasksGetConfig(&config);
+        // Pick up a newly published config (no copy while unchanged)
+        tasksRefreshConfig(&config, &configGeneration);
 
         // Process note queue
         if (syncReceiveNote(&item, 100)) {
+            NoteLatencyStamps stamps;
+            stamps.createdMs = item.createdMs;
+            stamps.dequeuedMs = millis();
+            bool sent = false;
             if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+                stamps.acquiredMs = millis();
+                bootProfileMark(BOOT_STAGE_FIRST_NOTE);
                 switch (item.type) {
                     case NOTE_TYPE_TRACK:
-                        notecardSendTrackNote(&item.data.track, config.mode, item.forceSync);
+                        sent = notecardSendTrackNote(&item.data.track, config.mode, item.forceSync,
+                                                     !s_bootRecordReported);
+                        if (sent) {
+                            s_bootRecordReported = true;
+                        }
                         break;
 
                     case NOTE_TYPE_ALERT:
-                        notecardSendAlertNote(&item.data.alert);
+                        sent = notecardSendAlertNote(&item.data.alert, item.forceSync,
+                                                     latencyAgeMs(item.createdMs, stamps.acquiredMs));
+                        if (sent) {
+                            stamps.addedMs = millis();
+                            latencyRecordAlert(&stamps);
+                        }
                         break;
 
                     case NOTE_TYPE_CMD_ACK:
-                        notecardSendCommandAck(&item.data.ack);
+                        sent = notecardSendCommandAck(&item.data.ack);
                         break;
 
                     case NOTE_TYPE_HEALTH:
-                        notecardSendHealthNote(&item.data.health);
+                        sent = sendHealthNote(&item.data.health);
                         break;
                 }
                 syncReleaseI2C();
             }
+
+            if (sent) {
+                metricsIncrement(METRIC_NOTES_SENT);
+            } else {
+                // Bus stall or failed request: put the note back (or spill
+                // it) and pause before retrying, rather than lose it
+                bool kept = syncQueueNote(&item);
+                traceRecord(TRACE_NOTE_RETRY, item.type, kept);
+                syncWaitSleepRequest(NOTE_SEND_RETRY_MS);
+            }
         }
 
-        // Periodic sync check
-        if (millis() - lastSyncCheck > SYNC_CHECK_INTERVAL_MS) {
-            lastSyncCheck = millis();
+        // Refresh the Notecard status snapshot at the mode's rate. GPS is only
+        // polled while enabled, sync state only in demo mode, and hub.status
+        // at most once per STATUS_CONNECTION_POLL_MS.
+        if (lastStatusPoll == 0 ||
+            millis() - lastStatusPoll >= envGetStatusPollIntervalMs(&config)) {
+            lastStatusPoll = millis();
+
+            bool wantSync = (config.mode == MODE_DEMO);
+            NotecardStatus status;
+            notecardGetStatus(&status);
+            bool wantConnection = (status.connectedAtMs == 0 ||
+                                   millis() - status.connectedAtMs >= STATUS_CONNECTION_POLL_MS);
 
             if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                // Check GPS status
-                bool hasLock;
-                double lat, lon;
-                uint32_t timeSec;
-                bool isActive = false;
-                bool hasSignal = false;
-                if (notecardGetGPSStatus(&hasLock, &lat, &lon, &timeSec, &isActive, &hasSignal)) {
-                    if (hasLock && timeSec < 10) {
+                notecardRefreshStatus(wantSync, wantConnection);
+                notecardGetStatus(&status);
+
+                // A completed sync may have brought env var changes or
+                // commands; hand them to EnvTask and CommandTask now rather
+                // than at their next poll
+                if (wantSync && status.lastSyncTime != lastSyncTime) {
+                    if (lastSyncTime != 0) {
+                        syncPostAttnEvents(ATTN_EVENTS_INBOUND);
+                    }
+                    lastSyncTime = status.lastSyncTime;
+                }
+
+                bool hasLock = status.gpsLock;
+                bool isActive = status.gpsActive;
+                bool hasSignal = status.gpsSignal;
+                if (status.gpsValid) {
+                    if (hasLock && status.gpsTime != 0) {
+                        stateSetLastGpsFix(status.gpsTime);
+                    }
+                    if (hasLock && status.gpsTime < 10) {
                         // Fresh GPS fix
-                        stateUpdateGpsFixTime();
                         audioQueueEvent(AUDIO_EVENT_GPS_LOCK);
                     }
                 }
 
                 // GPS Power Management for Transit Mode
-                // Monitor GPS activity and disable if no signal after timeout
-                // After retry interval, re-enable GPS to try again
+                // Disable GPS after the signal timeout, re-enable it after
+                // the retry interval
                 if (config.mode == MODE_TRANSIT && config.gpsPowerSaveEnabled) {
-                    bool gpsIsDisabled = stateIsGpsPowerSaving();
-                    bool wasActive = stateGetGpsWasActive();
-                    uint32_t activeStartTime = stateGetGpsActiveStartTime();
-                    uint32_t now = millis();
+                    GpsPowerState gps;
+                    stateGetGpsPower(&gps);
 
-                    if (gpsIsDisabled) {
-                        // GPS is disabled - check if it's time to retry
-                        uint32_t retryIntervalMs = (uint32_t)config.gpsRetryIntervalMin * 60UL * 1000UL;
-                        uint32_t lastRetry = stateGetLastGpsRetryTime();
-                        uint32_t elapsed = now - lastRetry;
-
-                        if (elapsed >= retryIntervalMs) {
-                            // Time to retry - re-enable GPS
-                            #ifdef DEBUG_MODE
-                            DEBUG_SERIAL.print("[NotecardTask] GPS retry interval elapsed (");
-                            DEBUG_SERIAL.print(config.gpsRetryIntervalMin);
-                            DEBUG_SERIAL.println(" min) - re-enabling GPS");
-                            #endif
-                            if (notecardEnableTransitGPS()) {
-                                stateSetGpsPowerSaving(false);
-                                stateSetGpsActiveStartTime(0);
-                                stateSetLastGpsRetryTime(now);
-                            }
-                        }
-                    } else {
-                        // GPS is enabled - monitor for signal timeout
-
-                        // Detect transition from inactive to active
-                        if (isActive && !wasActive) {
-                            // GPS just became active - start timing if no signal
-                            if (!hasSignal && !hasLock) {
-                                #ifdef DEBUG_MODE
-                                DEBUG_SERIAL.println("[NotecardTask] GPS became active without signal - starting timeout");
-                                #endif
-                                stateSetGpsActiveStartTime(now);
-                            }
-                        }
+                    GpsPowerInputs inputs;
+                    inputs.active = isActive;
+                    inputs.signal = hasSignal;
+                    inputs.lock = hasLock;
 
-                        // Check if we have signal or lock - reset timeout tracking
-                        if (hasSignal || hasLock) {
-                            if (activeStartTime != 0) {
-                                #ifdef DEBUG_MODE
-                                DEBUG_SERIAL.println("[NotecardTask] GPS has signal - clearing timeout");
-                                #endif
-                                stateSetGpsActiveStartTime(0);
+                    uint32_t now = millis();
+                    GpsPowerAction action = gpsPowerUpdate(&gps, &config, &inputs, now);
+                    switch (action) {
+                        case GPS_POWER_TIMING:
+                            traceRecord(TRACE_GPS_TIMEOUT_START, 0, 0);
+                            break;
+                        case GPS_POWER_SIGNAL:
+                            traceRecord(TRACE_GPS_SIGNAL, 0, 0);
+                            break;
+                        case GPS_POWER_INACTIVE:
+                            traceRecord(TRACE_GPS_INACTIVE, 0, 0);
+                            break;
+                        case GPS_POWER_DISABLE:
+                            traceRecord(TRACE_GPS_TIMEOUT, config.gpsSignalTimeoutMin, 0);
+                            if (notecardDisableGPS()) {
+                                gpsPowerApplied(&gps, action, now);
                             }
-                        }
-                        // Check if active without signal for too long
-                        else if (isActive && activeStartTime != 0) {
-                            uint32_t timeoutMs = (uint32_t)config.gpsSignalTimeoutMin * 60UL * 1000UL;
-                            uint32_t activeElapsed = now - activeStartTime;
-
-                            if (activeElapsed >= timeoutMs) {
-                                // Timeout - disable GPS to save power
-                                #ifdef DEBUG_MODE
-                                DEBUG_SERIAL.print("[NotecardTask] GPS active ");
-                                DEBUG_SERIAL.print(config.gpsSignalTimeoutMin);
-                                DEBUG_SERIAL.println(" min without signal - disabling GPS");
-                                #endif
-                                if (notecardDisableGPS()) {
-                                    stateSetGpsPowerSaving(true);
-                                    stateSetGpsActiveStartTime(0);
-                                    stateSetLastGpsRetryTime(now);
-                                }
+                            break;
+                        case GPS_POWER_RETRY:
+                            traceRecord(TRACE_GPS_RETRY, config.gpsRetryIntervalMin, 0);
+                            if (notecardEnableTransitGPS(&config)) {
+                                gpsPowerApplied(&gps, action, now);
                             }
-                        }
-                        // If not active and was active (transition to inactive)
-                        else if (!isActive && wasActive && activeStartTime != 0) {
-                            // GPS went inactive while we were timing - reset
-                            #ifdef DEBUG_MODE
-                            DEBUG_SERIAL.println("[NotecardTask] GPS went inactive - resetting timeout");
-                            #endif
-                            stateSetGpsActiveStartTime(0);
-                        }
+                            break;
+                        default:
+                            break;
                     }
 
-                    // Update previous active state for next iteration
-                    stateSetGpsWasActive(isActive);
+                    stateSetGpsPower(&gps);
                 }
 
                 // Check if we need to sync
-                if (config.mode == MODE_DEMO) {
+                if (wantSync) {
                     // Continuous sync in demo mode
-                    if (!notecardIsSyncing()) {
+                    if (!status.syncing) {
                         notecardSync();
                     }
                 }
@@ -1156,6 +1632,57 @@ void NotecardTask(void* pvParameters) {
 // EnvTask Implementation
 // =============================================================================
 
+// EnvTask's copy of the config it last sent (JobsTask's with JOBS_MODE)
+static SongbirdConfig s_envLastConfig;
+
+static void envJobInit(void) {
+    tasksGetConfig(&s_envLastConfig);
+}
+
+/**
+ * @brief Check env.modified once and send MainTask any changed config
+ *
+ * @return Milliseconds until the next safety poll
+ */
+static uint32_t envJobRun(void) {
+    // Check if environment variables modified
+    bool modified = false;
+    if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+        modified = envCheckModified();
+        syncReleaseI2C();
+    }
+
+    if (modified) {
+        // Fetch new configuration
+        SongbirdConfig newConfig;
+        tasksGetConfig(&newConfig);  // Start with current
+
+        if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
+            envFetchConfig(&newConfig);
+            syncReleaseI2C();
+        }
+
+        // Check if config actually changed
+        if (envConfigChanged(&s_envLastConfig, &newConfig)) {
+            // Log which specific values changed (always, for demo visibility)
+            envLogConfigChanges(&s_envLastConfig, &newConfig);
+
+            // Send to MainTask
+            syncQueueConfig(&newConfig);
+
+            // Update our copy
+            memcpy(&s_envLastConfig, &newConfig, sizeof(SongbirdConfig));
+        }
+    }
+
+    // Slow safety poll where an ATTN_EVENT_ENV announces changes, a short
+    // poll in the modes that have no ATTN source (the mode may have been
+    // changed by the button, so not s_envLastConfig)
+    SongbirdConfig current;
+    tasksGetConfig(&current);
+    return powerPolicyScaleInterval(envGetEnvPollIntervalMs(&current));
+}
+
 void EnvTask(void* pvParameters) {
     (void)pvParameters;
 
@@ -1168,47 +1695,135 @@ void EnvTask(void* pvParameters) {
     DEBUG_SERIAL.println("[EnvTask] Starting");
     #endif
 
-    SongbirdConfig lastConfig;
-    tasksGetConfig(&lastConfig);
+    envJobInit();
 
     for (;;) {
         // Check for sleep request
         if (g_sleepRequested) {
-            syncSetSleepReady(SLEEP_BIT_ENV);
-            vTaskSuspend(NULL);
+            syncParkForSleep(SLEEP_BIT_ENV);
             continue;
         }
 
-        // Check if environment variables modified
-        bool modified = false;
-        if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-            modified = envCheckModified();
-            syncReleaseI2C();
+        syncWaitAttnEvents(ATTN_EVENT_ENV, envJobRun());
+    }
+}
+
+#ifdef JOBS_MODE
+// =============================================================================
+// JobsTask Implementation
+// =============================================================================
+
+// Next run of each job (JobsTask only)
+static JobSchedule s_jobs;
+
+// Do a due job's work and arm its next run (SongbirdJobs.h)
+static void runJob(uint8_t job, uint32_t deadlineMs) {
+    uint32_t result;
+    switch (job) {
+        case JOB_SENSOR_START:
+            result = sensorJobStart();
+            break;
+        case JOB_SENSOR_READ:
+            result = sensorJobRead();
+            break;
+        case JOB_COMMAND:
+            result = commandJobRun();
+            break;
+        case JOB_ENV:
+            result = envJobRun();
+            break;
+        default:
+            return;
+    }
+    jobsFinished(&s_jobs, job, deadlineMs, result, millis());
+}
+
+void JobsTask(void* pvParameters) {
+    (void)pvParameters;
+
+    // Wait for system ready
+    while (!g_systemReady) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    #ifdef DEBUG_MODE
+    DEBUG_SERIAL.println("[JobsTask] Starting");
+    #endif
+
+    sensorJobInit();
+    envJobInit();
+    jobsInit(&s_jobs);
+
+    // Every job runs at once on startup and after a cancelled sleep, as
+    // their tasks do
+    bool rearm = true;
+
+    for (;;) {
+        // Check for sleep request (parks for all three jobs)
+        if (g_sleepRequested) {
+            syncParkForSleep(SLEEP_BIT_SENSOR | SLEEP_BIT_COMMAND | SLEEP_BIT_ENV);
+            rearm = true;
+            continue;
+        }
+
+        if (rearm) {
+            jobsArmAll(&s_jobs, millis());
+            rearm = false;
         }
 
-        if (modified) {
-            // Fetch new configuration
-            SongbirdConfig newConfig;
-            tasksGetConfig(&newConfig);  // Start with current
+        // Run one due job per pass so a sleep request is seen between jobs
+        uint8_t job;
+        uint32_t deadlineMs;
+        if (jobsPopDue(&s_jobs, millis(), &job, &deadlineMs)) {
+            runJob(job, deadlineMs);
+            continue;
+        }
 
-            if (syncAcquireI2C(I2C_MUTEX_TIMEOUT_MS)) {
-                envFetchConfig(&newConfig);
-                syncReleaseI2C();
-            }
+        // Sleep until the earliest deadline (a conversion completing is
+        // one); an ATTN event brings its job forward, as it wakes
+        // CommandTask or EnvTask
+        uint8_t events = syncWaitAttnEvents(
+            ATTN_EVENT_COMMAND | ATTN_EVENT_ENV,
+            jobsWaitMs(&s_jobs, millis(), ENV_SAFETY_POLL_MS));
+        uint32_t now = millis();
+        if (events & ATTN_EVENT_COMMAND) {
+            jobsRunNow(&s_jobs, JOB_COMMAND, now);
+        }
+        if (events & ATTN_EVENT_ENV) {
+            jobsRunNow(&s_jobs, JOB_ENV, now);
+        }
+    }
+}
+#endif // JOBS_MODE
+
+// =============================================================================
+// TraceTask Implementation
+// =============================================================================
 
-            // Check if config actually changed
-            if (envConfigChanged(&lastConfig, &newConfig)) {
-                // Log which specific values changed (always, for demo visibility)
-                envLogConfigChanges(&lastConfig, &newConfig);
+#ifndef TRACE_DISABLED
+void TraceTask(void* pvParameters) {
+    (void)pvParameters;
 
-                // Send to MainTask
-                syncQueueConfig(&newConfig);
+    uint8_t frames[TRACE_DRAIN_BUFFER_SIZE];
 
-                // Update our copy
-                memcpy(&lastConfig, &newConfig, sizeof(SongbirdConfig));
-            }
+    for (;;) {
+        // Take only what the UART can queue without blocking, so a slow or
+        // disconnected console never stalls this task or the idle hook
+        int room = DEBUG_SERIAL.availableForWrite();
+        size_t length = 0;
+        if (room >= TRACE_FRAME_SIZE) {
+            length = traceDrain(frames, MIN((size_t)room, sizeof(frames)));
         }
 
-        vTaskDelay(pdMS_TO_TICKS(ENV_POLL_INTERVAL_MS));
+        if (length > 0) {
+            DEBUG_SERIAL.write(frames, length);
+        } else if (room < TRACE_FRAME_SIZE) {
+            // Records waiting on the UART: retry once it has sent some
+            vTaskDelay(pdMS_TO_TICKS(TRACE_DRAIN_INTERVAL_MS));
+        } else if (!tracePending()) {
+            // Caught up: sleep until a writer commits the next slot
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
     }
 }
+#endif // TRACE_DISABLED
@@ -25,6 +25,8 @@ extern TaskHandle_t g_audioTaskHandle;
 extern TaskHandle_t g_commandTaskHandle;
 extern TaskHandle_t g_notecardTaskHandle;
 extern TaskHandle_t g_envTaskHandle;
+extern TaskHandle_t g_traceTaskHandle;
+extern TaskHandle_t g_jobsTaskHandle;
 
 // =============================================================================
 // Task Creation
@@ -76,6 +78,7 @@ void MainTask(void* pvParameters);
  *
  * Priority: Normal (2)
  * Stack: 512 words
+ * Not created with JOBS_MODE (runs as a job on JobsTask)
  */
 void SensorTask(void* pvParameters);
 
@@ -103,6 +106,7 @@ void AudioTask(void* pvParameters);
  *
  * Priority: Above Normal (3)
  * Stack: 512 words
+ * Not created with JOBS_MODE (runs as a job on JobsTask)
  */
 void CommandTask(void* pvParameters);
 
@@ -124,15 +128,52 @@ void NotecardTask(void* pvParameters);
  * @brief Environment variable task
  *
  * Responsibilities:
- * - Poll for environment variable changes
+ * - Check for environment variable changes on ATTN_EVENT_ENV
  * - Parse and validate new configuration
  * - Send config updates to MainTask
  *
  * Priority: Below Normal (1)
  * Stack: 512 words
+ * Not created with JOBS_MODE (runs as a job on JobsTask)
  */
 void EnvTask(void* pvParameters);
 
+/**
+ * @brief Cooperative job task (JOBS_MODE only)
+ *
+ * Responsibilities:
+ * - Run the sensor, command and env jobs (the loop bodies of SensorTask,
+ *   CommandTask and EnvTask) one at a time, earliest deadline first, from
+ *   the schedule in SongbirdJobs.h
+ * - Keep each job's timing: fixed-rate sensor reads, command and env polls
+ *   a delay after the last, ATTN events run their job at once
+ * - Run other jobs while a BME280 conversion completes, between the
+ *   reading's start and read jobs
+ * - Park for sleep on behalf of all three
+ *
+ * Saves two stacks and TCBs, at the cost of a job waiting for the one
+ * ahead of it.
+ *
+ * Priority: Normal (2)
+ * Stack: 512 words
+ */
+void JobsTask(void* pvParameters);
+
+/**
+ * @brief Trace log drain task
+ *
+ * Responsibilities:
+ * - Stream binary trace frames (SongbirdTrace) to the debug UART
+ * - Write only as much as the UART TX buffer can take
+ * - Sleep on a task notification while the ring is empty
+ *
+ * Not created with TRACE_DISABLED.
+ *
+ * Priority: Idle (0)
+ * Stack: 128 words
+ */
+void TraceTask(void* pvParameters);
+
 // =============================================================================
 // Task Utilities
 // =============================================================================
@@ -145,14 +186,27 @@ void EnvTask(void* pvParameters);
 bool tasksSleepRequested(void);
 
 /**
- * @brief Get current configuration (thread-safe)
+ * @brief Get current configuration (thread-safe, lock-free)
  *
- * Copies current configuration to provided structure.
+ * Copies the configuration last published by MainTask, or the defaults if
+ * nothing has been published yet.
  *
  * @param config Pointer to config structure to fill
  */
 void tasksGetConfig(SongbirdConfig* config);
 
+/**
+ * @brief Refresh a task's config copy if MainTask published a newer one
+ *
+ * For task loops: the copy is skipped while the generation is unchanged.
+ * Start with *generation = 0; the first call always fills the config.
+ *
+ * @param config Task's config copy, updated in place
+ * @param generation Generation of the task's copy, updated in place
+ * @return true if the config was updated
+ */
+bool tasksRefreshConfig(SongbirdConfig* config, uint32_t* generation);
+
 /**
  * @brief Log task stack high water marks (debug)
  *
@@ -0,0 +1,119 @@
+/**
+ * @file SongbirdTimerQueue.cpp
+ * @brief Deadline-ordered timer queue implementation
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdTimerQueue.h"
+#include <string.h>
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+// True if deadline a is later than b (wrap-safe)
+static bool isLater(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) > 0;
+}
+
+// Position of an armed timer in the order, or -1
+static int findTimer(const TimerQueue* queue, uint8_t id) {
+    for (uint8_t i = 0; i < queue->count; i++) {
+        if (queue->order[i] == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void removeAt(TimerQueue* queue, uint8_t position) {
+    memmove(&queue->order[position], &queue->order[position + 1],
+            queue->count - position - 1);
+    queue->count--;
+}
+
+// =============================================================================
+// Timer Queue
+// =============================================================================
+
+void timerQueueInit(TimerQueue* queue) {
+    if (queue == NULL) {
+        return;
+    }
+
+    memset(queue, 0, sizeof(TimerQueue));
+}
+
+bool timerQueueArm(TimerQueue* queue, uint8_t id, uint32_t deadlineMs) {
+    if (queue == NULL || id >= TIMER_QUEUE_SIZE) {
+        return false;
+    }
+
+    int position = findTimer(queue, id);
+    if (position >= 0) {
+        removeAt(queue, (uint8_t)position);
+    }
+
+    // After every timer due at or before this one, so equal deadlines stay FIFO
+    uint8_t insert = queue->count;
+    while (insert > 0 && isLater(queue->deadlineMs[queue->order[insert - 1]], deadlineMs)) {
+        insert--;
+    }
+    memmove(&queue->order[insert + 1], &queue->order[insert], queue->count - insert);
+    queue->order[insert] = id;
+    queue->deadlineMs[id] = deadlineMs;
+    queue->count++;
+    return true;
+}
+
+void timerQueueCancel(TimerQueue* queue, uint8_t id) {
+    if (queue == NULL) {
+        return;
+    }
+
+    int position = findTimer(queue, id);
+    if (position >= 0) {
+        removeAt(queue, (uint8_t)position);
+    }
+}
+
+bool timerQueueIsArmed(const TimerQueue* queue, uint8_t id) {
+    return queue != NULL && findTimer(queue, id) >= 0;
+}
+
+uint32_t timerQueueWaitMs(const TimerQueue* queue, uint32_t nowMs, uint32_t maxMs) {
+    if (queue == NULL || queue->count == 0) {
+        return maxMs;
+    }
+
+    uint32_t deadline = queue->deadlineMs[queue->order[0]];
+    if (!isLater(deadline, nowMs)) {
+        return 0;
+    }
+    uint32_t wait = deadline - nowMs;
+    return wait < maxMs ? wait : maxMs;
+}
+
+bool timerQueuePopDue(TimerQueue* queue, uint32_t nowMs, uint8_t* id, uint32_t* deadlineMs) {
+    if (queue == NULL || id == NULL || queue->count == 0) {
+        return false;
+    }
+
+    uint8_t first = queue->order[0];
+    if (isLater(queue->deadlineMs[first], nowMs)) {
+        return false;
+    }
+
+    removeAt(queue, 0);
+    *id = first;
+    if (deadlineMs != NULL) {
+        *deadlineMs = queue->deadlineMs[first];
+    }
+    return true;
+}
+
+uint8_t timerQueueCount(const TimerQueue* queue) {
+    return queue != NULL ? queue->count : 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file SongbirdTimerQueue.h
+ * @brief Deadline-ordered timer queue for the cooperative job scheduler
+ *
+ * Holds at most one deadline per timer id (0 to TIMER_QUEUE_SIZE - 1), kept
+ * sorted so the earliest is always at the front. Arming an armed timer moves
+ * it to its new deadline. Timers with equal deadlines expire in the order
+ * they were armed.
+ *
+ * Deadlines are millis() values compared by signed difference, like
+ * MS_REACHED, so the order survives the 49.7 day wrap as long as every
+ * deadline is within 24.8 days of the current time.
+ *
+ * With JOBS_MODE, JobsTask runs the sensor, command and env jobs from one of
+ * these in place of their own tasks (see SongbirdJobs.h).
+ *
+ * Pure data structure (no FreeRTOS calls) so it can be unit tested on the
+ * host; only JobsTask touches its queue, so it needs no locking.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_TIMER_QUEUE_H
+#define SONGBIRD_TIMER_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+static_assert(TIMER_QUEUE_SIZE <= 255, "Timer ids are one byte");
+
+// =============================================================================
+// Queue Structure
+// =============================================================================
+
+typedef struct {
+    uint32_t deadlineMs[TIMER_QUEUE_SIZE];  // By timer id, valid while armed
+    uint8_t order[TIMER_QUEUE_SIZE];        // Armed ids, earliest deadline first
+    uint8_t count;                          // Armed timers
+} TimerQueue;
+
+// =============================================================================
+// Queue Interface
+// =============================================================================
+
+/**
+ * @brief Disarm every timer
+ *
+ * @param queue Queue
+ */
+void timerQueueInit(TimerQueue* queue);
+
+/**
+ * @brief Arm a timer, or move it if already armed
+ *
+ * @param queue Queue
+ * @param id Timer id
+ * @param deadlineMs millis() value at which the timer expires
+ * @return true if armed, false if id is out of range
+ */
+bool timerQueueArm(TimerQueue* queue, uint8_t id, uint32_t deadlineMs);
+
+/**
+ * @brief Disarm a timer (no effect if not armed)
+ *
+ * @param queue Queue
+ * @param id Timer id
+ */
+void timerQueueCancel(TimerQueue* queue, uint8_t id);
+
+/**
+ * @brief Check whether a timer is armed
+ *
+ * @param queue Queue
+ * @param id Timer id
+ * @return true if armed
+ */
+bool timerQueueIsArmed(const TimerQueue* queue, uint8_t id);
+
+/**
+ * @brief Get the time until the earliest deadline
+ *
+ * @param queue Queue
+ * @param nowMs Current millis()
+ * @param maxMs Returned when nothing is armed or the deadline is further away
+ * @return 0 if a timer has expired, otherwise milliseconds to wait (at most maxMs)
+ */
+uint32_t timerQueueWaitMs(const TimerQueue* queue, uint32_t nowMs, uint32_t maxMs);
+
+/**
+ * @brief Disarm and return the earliest expired timer
+ *
+ * @param queue Queue
+ * @param nowMs Current millis()
+ * @param id Output timer id
+ * @param deadlineMs Output (optional): the deadline it was armed for
+ * @return true if a timer had expired, false otherwise
+ */
+bool timerQueuePopDue(TimerQueue* queue, uint32_t nowMs, uint8_t* id, uint32_t* deadlineMs);
+
+/**
+ * @brief Get the number of armed timers
+ *
+ * @param queue Queue
+ * @return Armed timers
+ */
+uint8_t timerQueueCount(const TimerQueue* queue);
+
+#endif // SONGBIRD_TIMER_QUEUE_H
@@ -0,0 +1,51 @@
+/**
+ * @file SongbirdAlertNote.cpp
+ * @brief Alert note assembly
+ *
+ * Packs one cycle's alert transitions into an AlertNote. Kept apart from
+ * the BME280 I/O in SongbirdSensors.cpp so the native tests and benchmarks
+ * link the real function.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#include "SongbirdSensors.h"
+#include <string.h>
+#include <math.h>
+
+// =============================================================================
+// Alert Building
+// =============================================================================
+
+void sensorsBuildAlertNote(uint8_t raised,
+                           uint8_t cleared,
+                           const SensorData* data,
+                           const AlertEvaluation* eval,
+                           const SongbirdConfig* config,
+                           AlertNote* note) {
+    if (note == NULL || data == NULL || eval == NULL || config == NULL) {
+        return;
+    }
+
+    memset(note, 0, sizeof(AlertNote));
+    note->raised = raised;
+    note->cleared = cleared;
+    note->temperature = eval->temperature;
+    note->humidity = eval->humidity;
+    note->pressure = eval->pressure;
+    note->voltage = data->voltage;
+    note->tempRate = eval->tempRate;
+    note->pressureTendency = eval->pressureTendency;
+
+    // The limit each raised alert crossed, so the cloud can show value
+    // against threshold without a copy of the device config
+    note->tempThreshold = (raised & ALERT_FLAG_TEMP_HIGH) ? config->tempAlertHighC
+                        : (raised & ALERT_FLAG_TEMP_LOW) ? config->tempAlertLowC : NAN;
+    note->humidityThreshold = (raised & ALERT_FLAG_HUMIDITY_HIGH) ? config->humidityAlertHigh
+                            : (raised & ALERT_FLAG_HUMIDITY_LOW) ? config->humidityAlertLow : NAN;
+    note->pressureThreshold = (raised & ALERT_FLAG_PRESSURE_DELTA) ? config->pressureAlertDelta : NAN;
+    note->voltageThreshold = (raised & ALERT_FLAG_LOW_BATTERY) ? config->voltageAlertLow : NAN;
+    note->tempRateThreshold = (raised & ALERT_FLAG_TEMP_RATE) ? ALERT_TEMP_RATE_C_PER_HOUR : NAN;
+    note->timestamp = data->timestamp;
+}
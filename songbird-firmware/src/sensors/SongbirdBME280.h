@@ -0,0 +1,209 @@
+/**
+ * @file SongbirdBME280.h
+ * @brief Minimal BME280 driver for Songbird
+ *
+ * Reads temperature, pressure and humidity with a single burst read of the
+ * eight data registers (0xF7-0xFE) and compensates all three channels from
+ * that one raw frame, so each forced measurement costs one trigger write,
+ * a status poll and one read transaction on the shared I2C bus.
+ *
+ * Measurements are split into start and read steps so the caller can wait
+ * out the conversion time without holding the I2C mutex.
+ *
+ * Calibration parsing and compensation are pure (Bosch integer reference
+ * algorithms, BST-BME280-DS002 section 4.2.3) and build natively for tests;
+ * the I2C half is excluded from NATIVE_TEST builds.
+ *
+ * Songbird - Blues Sales Demo Device
+ * Copyright (c) 2025 Blues Inc.
+ */
+
+#ifndef SONGBIRD_BME280_H
+#define SONGBIRD_BME280_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "SongbirdConfig.h"
+
+// =============================================================================
+// Registers
+// =============================================================================
+
+#define BME280_CHIP_ID              0x60
+
+#define BME280_REG_CALIB00          0x88    // dig_T1 .. dig_H1 (26 bytes)
+#define BME280_REG_CHIP_ID          0xD0
+#define BME280_REG_RESET            0xE0
+#define BME280_REG_CALIB26          0xE1    // dig_H2 .. dig_H6 (7 bytes)
+#define BME280_REG_CTRL_HUM         0xF2
+#define BME280_REG_STATUS           0xF3
+#define BME280_REG_CTRL_MEAS        0xF4
+#define BME280_REG_CONFIG           0xF5
+#define BME280_REG_DATA             0xF7    // press[3], temp[3], hum[2]
+
+#define BME280_CALIB00_LEN          26
+#define BME280_CALIB26_LEN          7
+#define BME280_DATA_LEN             8
+
+#define BME280_RESET_CMD            0xB6
+#define BME280_STATUS_MEASURING     0x08
+#define BME280_STATUS_IM_UPDATE     0x01
+
+#define BME280_MODE_SLEEP           0x00
+#define BME280_MODE_FORCED          0x01
+#define BME280_MODE_NORMAL          0x03
+
+// =============================================================================
+// Data Structures
+// =============================================================================
+
+// Factory trimming parameters (datasheet table 16)
+typedef struct {
+    uint16_t t1;
+    int16_t t2;
+    int16_t t3;
+    uint16_t p1;
+    int16_t p2;
+    int16_t p3;
+    int16_t p4;
+    int16_t p5;
+    int16_t p6;
+    int16_t p7;
+    int16_t p8;
+    int16_t p9;
+    uint8_t h1;
+    int16_t h2;
+    uint8_t h3;
+    int16_t h4;
+    int16_t h5;
+    int8_t h6;
+} Bme280Calib;
+
+// Compensated measurement
+typedef struct {
+    float temperature;          // Celsius
+    float pressure;             // hPa
+    float humidity;             // %RH
+} Bme280Reading;
+
+// =============================================================================
+// Compensation (pure)
+// =============================================================================
+
+/**
+ * @brief Parse calibration registers into trimming parameters
+ *
+ * @param calib00 26 bytes read from BME280_REG_CALIB00
+ * @param calib26 7 bytes read from BME280_REG_CALIB26
+ * @param calib Output trimming parameters
+ */
+void bme280ParseCalib(const uint8_t* calib00, const uint8_t* calib26, Bme280Calib* calib);
+
+/**
+ * @brief Compensate one raw data frame
+ *
+ * Temperature is compensated first and its t_fine shared with the pressure
+ * and humidity formulas, so the frame is never re-read.
+ *
+ * @param calib Trimming parameters
+ * @param frame 8 bytes read from BME280_REG_DATA
+ * @param reading Output values
+ * @return false if the frame holds the reset value for temperature
+ *         (no measurement has completed)
+ */
+bool bme280Compensate(const Bme280Calib* calib, const uint8_t* frame, Bme280Reading* reading);
+
+/**
+ * @brief Get the maximum conversion time for a profile
+ *
+ * Datasheet appendix B: 1.25 ms + 2.3 ms per temperature sample +
+ * (2.3 ms per sample + 0.575 ms) for each enabled pressure/humidity channel.
+ *
+ * @param profile Measurement settings
+ * @return Worst-case time in microseconds
+ */
+uint32_t bme280MeasureTimeUs(const SensorProfile* profile);
+
+/**
+ * @brief Get the config register's filter field for an IIR coefficient
+ *
+ * @param coefficient Filter coefficient (rounded down to 0, 2, 4, 8 or 16)
+ * @return config.filter value
+ */
+uint8_t bme280EncodeFilter(uint8_t coefficient);
+
+/**
+ * @brief Get the config register's standby field for a standby time
+ *
+ * @param standbyMs Standby time; the longest setting not exceeding it is used
+ * @return config.t_sb value
+ */
+uint8_t bme280EncodeStandby(uint16_t standbyMs);
+
+// =============================================================================
+// I2C Interface (target only)
+// =============================================================================
+
+#ifndef NATIVE_TEST
+
+#include <Wire.h>
+
+/**
+ * @brief Probe, reset and configure the sensor
+ *
+ * Reads calibration and configures x1 oversampling on all channels with
+ * the IIR filter off in forced mode.
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param address I2C address (0x76 or 0x77)
+ * @param wire I2C bus
+ * @return true if a BME280 responded and was configured
+ */
+bool bme280Begin(uint8_t address, TwoWire* wire);
+
+/**
+ * @brief Apply measurement settings
+ *
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param profile Measurement settings
+ * @return true if the registers were written
+ */
+bool bme280Configure(const SensorProfile* profile);
+
+/**
+ * @brief Start a measurement
+ *
+ * In forced mode triggers a conversion; in normal mode the data registers
+ * always hold the latest conversion and nothing is written.
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param waitMs Output: time to wait before bme280ReadMeasurement()
+ * @return true if the measurement was started
+ */
+bool bme280StartMeasurement(uint32_t* waitMs);
+
+/**
+ * @brief Burst-read and compensate the latest conversion
+ *
+ * Polls briefly if a forced conversion is still running.
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param reading Output values
+ * @return true if a valid frame was read
+ */
+bool bme280ReadMeasurement(Bme280Reading* reading);
+
+/**
+ * @brief Take one measurement, waiting for the conversion in place
+ *
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param reading Output values
+ * @return true if measurement succeeded
+ */
+bool bme280Measure(Bme280Reading* reading);
+
+#endif // NATIVE_TEST
+
+#endif // SONGBIRD_BME280_H
@@ -14,6 +14,7 @@
 
 #include <Arduino.h>
 #include "SongbirdConfig.h"
+#include "SongbirdAlertEngine.h"
 
 // =============================================================================
 // Sensor Module Interface
@@ -37,7 +38,29 @@ bool sensorsInit(void);
 bool sensorsIsAvailable(void);
 
 /**
- * @brief Read all sensor values
+ * @brief Apply a measurement profile (oversampling, IIR filter, mode)
+ *
+ * Does NOT acquire I2C mutex - caller must handle this.
+ *
+ * @param profile Profile for the current operating mode
+ * @return true if the sensor was configured
+ */
+bool sensorsApplyProfile(const SensorProfile* profile);
+
+/**
+ * @brief Start a measurement
+ *
+ * Does NOT acquire I2C mutex - caller must handle this. The caller should
+ * release the mutex, wait waitMs, then call sensorsReadMeasurement().
+ *
+ * @param waitMs Output: conversion time for the active profile (0 in
+ *               normal mode, where the latest conversion is always ready)
+ * @return true if the measurement was started
+ */
+bool sensorsStartMeasurement(uint32_t* waitMs);
+
+/**
+ * @brief Read the result of sensorsStartMeasurement()
  *
  * Does NOT acquire I2C mutex - caller must handle this.
  * Populates all fields of SensorData structure.
@@ -45,7 +68,7 @@ bool sensorsIsAvailable(void);
  * @param data Pointer to SensorData structure to fill
  * @return true if read successful
  */
-bool sensorsRead(SensorData* data);
+bool sensorsReadMeasurement(SensorData* data);
 
 /**
  * @brief Read temperature only
@@ -87,52 +110,26 @@ uint32_t sensorsGetErrorCount(void);
 void sensorsResetErrorCount(void);
 
 // =============================================================================
-// Alert Checking
+// Alert Building
 // =============================================================================
 
-/**
- * @brief Check sensor data against alert thresholds
- *
- * Compares current sensor readings against configured thresholds.
- * Returns bitmask of triggered alerts.
- *
- * @param data Current sensor data
- * @param config Current configuration with thresholds
- * @param previousPressure Previous pressure reading (for delta check)
- * @param currentAlerts Current alert state (for deduplication)
- * @return Bitmask of newly triggered alerts (ALERT_FLAG_*)
- */
-uint8_t sensorsCheckAlerts(const SensorData* data,
-                           const SongbirdConfig* config,
-                           float previousPressure,
-                           uint8_t currentAlerts);
+// Alert detection (smoothing, persistence, tendency) lives in SongbirdAlertEngine
 
 /**
- * @brief Check which alerts have cleared
- *
- * Returns bitmask of alerts that were active but have now cleared
- * (values returned to normal range).
- *
- * @param data Current sensor data
- * @param config Current configuration with thresholds
- * @param currentAlerts Currently active alerts
- * @return Bitmask of cleared alerts
+ * @brief Pack one cycle's alert transitions into a single note
+ *
+ * @param raised Alerts raised this cycle (ALERT_FLAG_*)
+ * @param cleared Alerts cleared this cycle (ALERT_FLAG_*)
+ * @param data Current sensor data (raw voltage)
+ * @param eval Alert engine evaluation (smoothed values, rate and tendency)
+ * @param config Configuration holding the thresholds the alerts crossed
+ * @param note Pointer to AlertNote structure to fill
  */
-uint8_t sensorsCheckAlertsCleared(const SensorData* data,
-                                   const SongbirdConfig* config,
-                                   uint8_t currentAlerts);
-
-/**
- * @brief Build an Alert structure for a triggered alert
- *
- * @param alertFlag Single alert flag (e.g., ALERT_FLAG_TEMP_HIGH)
- * @param data Current sensor data
- * @param config Current configuration
- * @param alert Pointer to Alert structure to fill
- */
-void sensorsBuildAlert(uint8_t alertFlag,
-                       const SensorData* data,
-                       const SongbirdConfig* config,
-                       Alert* alert);
+void sensorsBuildAlertNote(uint8_t raised,
+                           uint8_t cleared,
+                           const SensorData* data,
+                           const AlertEvaluation* eval,
+                           const SongbirdConfig* config,
+                           AlertNote* note);
 
 #endif // SONGBIRD_SENSORS_H
@@ -0,0 +1,17 @@
+/**
+ * @file Arduino.h
+ * @brief Shim for native test builds
+ *
+ * Several module headers (SongbirdCommands.h, SongbirdEnv.h, SongbirdState.h,
+ * SongbirdSensors.h) include <Arduino.h> for the Arduino types. This shim
+ * satisfies that include with the stubs in native_stubs.h, so the native
+ * tests and benchmarks can compile the host-buildable parts of those
+ * modules.
+ */
+
+#ifndef ARDUINO_H_SHIM
+#define ARDUINO_H_SHIM
+
+#include "native_stubs.h"
+
+#endif // ARDUINO_H_SHIM
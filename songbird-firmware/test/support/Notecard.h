@@ -0,0 +1,121 @@
+/**
+ * @file Notecard.h
+ * @brief Notecard library stand-in for native test builds
+ *
+ * Records the fields a module adds to a request so tests can assert the
+ * parameters that would be sent to the Notecard. Only the flat J calls the
+ * firmware uses to build requests and read responses are provided; nested
+ * objects and arrays are not. Each field keeps its JSON type, and numbers
+ * parsed from JSON keep their text, so NotecardReplay.h can print an object
+ * back byte for byte.
+ */
+
+#ifndef NOTECARD_H_STANDIN
+#define NOTECARD_H_STANDIN
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+
+typedef double JNUMBER;
+
+#define J_STANDIN_MAX_FIELDS    16
+#define J_STANDIN_NAME_LEN      24
+#define J_STANDIN_STRING_LEN    256
+
+// Field types
+#define J_STANDIN_STRING        0
+#define J_STANDIN_NUMBER        1
+#define J_STANDIN_BOOL          2
+#define J_STANDIN_RAW           3       // Nested object or array, kept as JSON text
+
+typedef struct J {
+    uint8_t count;
+    char names[J_STANDIN_MAX_FIELDS][J_STANDIN_NAME_LEN];
+    uint8_t types[J_STANDIN_MAX_FIELDS];
+    char strings[J_STANDIN_MAX_FIELDS][J_STANDIN_STRING_LEN];   // Text of numbers parsed from JSON
+    JNUMBER numbers[J_STANDIN_MAX_FIELDS];
+} J;
+
+// SongbirdNotecard.h declares notecardGetInstance()
+class Notecard;
+
+static inline J* JCreateObject(void) {
+    return (J*)calloc(1, sizeof(J));
+}
+
+static inline void JDelete(J* item) {
+    free(item);
+}
+
+static inline J* JStandinAdd(J* object, const char* name) {
+    if (object == NULL || name == NULL || object->count >= J_STANDIN_MAX_FIELDS) {
+        return NULL;
+    }
+    uint8_t i = object->count++;
+    strncpy(object->names[i], name, J_STANDIN_NAME_LEN - 1);
+    object->types[i] = J_STANDIN_STRING;
+    return object;
+}
+
+static inline int JStandinFind(const J* object, const char* name) {
+    if (object == NULL || name == NULL) {
+        return -1;
+    }
+    for (uint8_t i = 0; i < object->count; i++) {
+        if (strcmp(object->names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static inline J* JAddStringToObject(J* object, const char* name, const char* string) {
+    J* added = JStandinAdd(object, name);
+    if (added != NULL && string != NULL) {
+        strncpy(object->strings[object->count - 1], string, J_STANDIN_STRING_LEN - 1);
+    }
+    return added;
+}
+
+static inline J* JAddNumberToObject(J* object, const char* name, JNUMBER number) {
+    J* added = JStandinAdd(object, name);
+    if (added != NULL) {
+        object->types[object->count - 1] = J_STANDIN_NUMBER;
+        object->numbers[object->count - 1] = number;
+    }
+    return added;
+}
+
+static inline J* JAddBoolToObject(J* object, const char* name, bool boolean) {
+    J* added = JAddNumberToObject(object, name, boolean ? 1 : 0);
+    if (added != NULL) {
+        object->types[object->count - 1] = J_STANDIN_BOOL;
+    }
+    return added;
+}
+
+static inline bool JIsPresent(J* object, const char* name) {
+    return JStandinFind(object, name) >= 0;
+}
+
+static inline const char* JGetString(J* object, const char* name) {
+    int i = JStandinFind(object, name);
+    return (i < 0 || object->types[i] != J_STANDIN_STRING) ? "" : object->strings[i];
+}
+
+static inline JNUMBER JGetNumber(J* object, const char* name) {
+    int i = JStandinFind(object, name);
+    return i < 0 ? 0 : object->numbers[i];
+}
+
+static inline long JGetInt(J* object, const char* name) {
+    return (long)JGetNumber(object, name);
+}
+
+static inline bool JGetBool(J* object, const char* name) {
+    return JGetNumber(object, name) != 0;
+}
+
+#endif // NOTECARD_H_STANDIN
@@ -0,0 +1,418 @@
+/**
+ * @file NotecardReplay.h
+ * @brief Notecard transcript replay for native test builds
+ *
+ * Loads the NCT lines written by the "transcript" command (format in
+ * SongbirdTranscript.h) and plays the transactions back in order. Each
+ * step sets millis() to the time the request was sent, hands back the
+ * response as a stand-in J, then moves millis() on by the recorded latency,
+ * so the firmware code under test sees the field timing, including stalls,
+ * without the test waiting for it.
+ *
+ * The JSON codec covers what the firmware's response handling reads: a flat
+ * object of strings, numbers and booleans. Nested objects and arrays are
+ * kept as raw JSON text. Printing a parsed object produces the bytes it was
+ * parsed from when they came from note-c (JPrintUnformatted), which
+ * replayCheckBytes() verifies for every request and response.
+ *
+ * Include from one translation unit per test program only.
+ */
+
+#ifndef NOTECARD_REPLAY_H
+#define NOTECARD_REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "native_stubs.h"
+#include "Notecard.h"
+#include "SongbirdTranscript.h"
+
+#define REPLAY_MAX_ENTRIES      512
+
+static TranscriptEntry s_replayEntries[REPLAY_MAX_ENTRIES];
+static uint16_t s_replayCount = 0;
+static uint16_t s_replayNext = 0;
+
+// =============================================================================
+// Loading
+// =============================================================================
+
+/**
+ * @brief Load a capture, skipping anything that is not an NCT line
+ *
+ * Debug output and trace frames may be interleaved with the NCT lines.
+ *
+ * @param text Capture text
+ * @return Entries loaded (replaces any earlier load)
+ */
+static uint16_t replayLoad(const char* text) {
+    s_replayCount = 0;
+    s_replayNext = 0;
+
+    const char* line = text;
+    while (line != NULL && *line != '\0' && s_replayCount < REPLAY_MAX_ENTRIES) {
+        const char* start = strstr(line, TRANSCRIPT_LINE_PREFIX);
+        if (start == NULL) {
+            break;
+        }
+        if (transcriptParse(start, &s_replayEntries[s_replayCount])) {
+            s_replayCount++;
+        }
+        line = strchr(start, '\n');
+        if (line != NULL) {
+            line++;
+        }
+    }
+
+    return s_replayCount;
+}
+
+/**
+ * @brief Load a capture from a file
+ *
+ * @param path File path
+ * @return Entries loaded, or 0 if the file could not be read
+ */
+static uint16_t replayLoadFile(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* text = (char*)malloc((size_t)size + 1);
+    size_t read = (text != NULL) ? fread(text, 1, (size_t)size, file) : 0;
+    fclose(file);
+    if (text == NULL) {
+        return 0;
+    }
+    text[read] = '\0';
+
+    uint16_t count = replayLoad(text);
+    free(text);
+    return count;
+}
+
+// =============================================================================
+// Playback
+// =============================================================================
+
+/**
+ * @brief Start the next transaction
+ *
+ * Sets millis() to the time the request was sent. Call replayFinish()
+ * once the firmware has handled the response.
+ *
+ * @return Next entry, or NULL at the end of the transcript
+ */
+static const TranscriptEntry* replayBegin(void) {
+    if (s_replayNext >= s_replayCount) {
+        return NULL;
+    }
+    const TranscriptEntry* entry = &s_replayEntries[s_replayNext++];
+    mock_set_millis(entry->atMs);
+    return entry;
+}
+
+/**
+ * @brief Complete a transaction: millis() moves on by its latency
+ *
+ * @param entry Entry from replayBegin()
+ */
+static void replayFinish(const TranscriptEntry* entry) {
+    mock_set_millis(entry->atMs + (entry->latencyUs + 500) / 1000);
+}
+
+// =============================================================================
+// JSON Codec
+// =============================================================================
+
+static bool replayPut(char* out, size_t size, size_t* used, const char* text, size_t length) {
+    if (*used + length >= size) {
+        return false;
+    }
+    memcpy(&out[*used], text, length);
+    *used += length;
+    out[*used] = '\0';
+    return true;
+}
+
+static bool replayPutString(char* out, size_t size, size_t* used, const char* text) {
+    if (!replayPut(out, size, used, "\"", 1)) {
+        return false;
+    }
+    for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++) {
+        char escaped[8];
+        const char* piece = escaped;
+        size_t length = 2;
+        escaped[0] = '\\';
+        switch (*c) {
+            case '"':  escaped[1] = '"'; break;
+            case '\\': escaped[1] = '\\'; break;
+            case '\b': escaped[1] = 'b'; break;
+            case '\f': escaped[1] = 'f'; break;
+            case '\n': escaped[1] = 'n'; break;
+            case '\r': escaped[1] = 'r'; break;
+            case '\t': escaped[1] = 't'; break;
+            default:
+                if (*c < 0x20) {
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                    length = 6;
+                } else {
+                    piece = (const char*)c;
+                    length = 1;
+                }
+                break;
+        }
+        if (!replayPut(out, size, used, piece, length)) {
+            return false;
+        }
+    }
+    return replayPut(out, size, used, "\"", 1);
+}
+
+/**
+ * @brief Print a stand-in object as unformatted JSON
+ *
+ * @param object Object
+ * @param out Output
+ * @param size Output size
+ * @return Characters written, or 0 if the output is too small
+ */
+static size_t replayPrint(const J* object, char* out, size_t size) {
+    if (object == NULL || out == NULL || size == 0) {
+        return 0;
+    }
+
+    size_t used = 0;
+    out[0] = '\0';
+    if (!replayPut(out, size, &used, "{", 1)) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < object->count; i++) {
+        if ((i > 0 && !replayPut(out, size, &used, ",", 1)) ||
+            !replayPutString(out, size, &used, object->names[i]) ||
+            !replayPut(out, size, &used, ":", 1)) {
+            return 0;
+        }
+
+        bool ok = false;
+        char number[32];
+        switch (object->types[i]) {
+            case J_STANDIN_STRING:
+                ok = replayPutString(out, size, &used, object->strings[i]);
+                break;
+            case J_STANDIN_BOOL:
+                ok = object->numbers[i] != 0 ? replayPut(out, size, &used, "true", 4)
+                                             : replayPut(out, size, &used, "false", 5);
+                break;
+            case J_STANDIN_RAW:
+                ok = replayPut(out, size, &used, object->strings[i], strlen(object->strings[i]));
+                break;
+            default:
+                if (object->strings[i][0] != '\0') {
+                    // Parsed from JSON: keep the original text
+                    ok = replayPut(out, size, &used, object->strings[i], strlen(object->strings[i]));
+                } else {
+                    JNUMBER value = object->numbers[i];
+                    if (value == (JNUMBER)(long long)value) {
+                        snprintf(number, sizeof(number), "%lld", (long long)value);
+                    } else {
+                        snprintf(number, sizeof(number), "%.15g", value);
+                    }
+                    ok = replayPut(out, size, &used, number, strlen(number));
+                }
+                break;
+        }
+        if (!ok) {
+            return 0;
+        }
+    }
+
+    return replayPut(out, size, &used, "}", 1) ? used : 0;
+}
+
+static const char* replaySkipSpace(const char* c) {
+    while (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n') {
+        c++;
+    }
+    return c;
+}
+
+/**
+ * @brief Parse a JSON string, cursor on the opening quote
+ *
+ * @return Cursor after the closing quote, or NULL if malformed or too long
+ */
+static const char* replayParseString(const char* c, char* out, size_t size) {
+    if (*c++ != '"') {
+        return NULL;
+    }
+    size_t used = 0;
+    while (*c != '"') {
+        if (*c == '\0' || used + 4 >= size) {
+            return NULL;
+        }
+        if (*c != '\\') {
+            out[used++] = *c++;
+            continue;
+        }
+        c++;
+        switch (*c) {
+            case '"': case '\\': case '/': out[used++] = *c; break;
+            case 'b': out[used++] = '\b'; break;
+            case 'f': out[used++] = '\f'; break;
+            case 'n': out[used++] = '\n'; break;
+            case 'r': out[used++] = '\r'; break;
+            case 't': out[used++] = '\t'; break;
+            case 'u': {
+                char hex[5] = {0};
+                for (int i = 0; i < 4; i++) {
+                    if (c[1 + i] == '\0') {
+                        return NULL;
+                    }
+                    hex[i] = c[1 + i];
+                }
+                unsigned long code = strtoul(hex, NULL, 16);
+                if (code < 0x80) {
+                    out[used++] = (char)code;
+                } else if (code < 0x800) {
+                    out[used++] = (char)(0xC0 | (code >> 6));
+                    out[used++] = (char)(0x80 | (code & 0x3F));
+                } else {
+                    out[used++] = (char)(0xE0 | (code >> 12));
+                    out[used++] = (char)(0x80 | ((code >> 6) & 0x3F));
+                    out[used++] = (char)(0x80 | (code & 0x3F));
+                }
+                c += 4;
+                break;
+            }
+            default:
+                return NULL;
+        }
+        c++;
+    }
+    out[used] = '\0';
+    return c + 1;
+}
+
+/**
+ * @brief Find the end of a nested object or array, cursor on the bracket
+ *
+ * @return Cursor after the closing bracket, or NULL if unterminated
+ */
+static const char* replaySkipNested(const char* c) {
+    int depth = 0;
+    bool inString = false;
+    for (; *c != '\0'; c++) {
+        if (inString) {
+            if (*c == '\\' && c[1] != '\0') {
+                c++;
+            } else if (*c == '"') {
+                inString = false;
+            }
+        } else if (*c == '"') {
+            inString = true;
+        } else if (*c == '{' || *c == '[') {
+            depth++;
+        } else if (*c == '}' || *c == ']') {
+            if (--depth == 0) {
+                return c + 1;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Parse a JSON object into a stand-in J
+ *
+ * @param json JSON text
+ * @return Object (free with JDelete), or NULL if malformed or too large
+ */
+static J* replayParse(const char* json) {
+    if (json == NULL) {
+        return NULL;
+    }
+
+    J* object = JCreateObject();
+    const char* c = replaySkipSpace(json);
+    if (*c++ != '{') {
+        JDelete(object);
+        return NULL;
+    }
+
+    c = replaySkipSpace(c);
+    while (*c != '}') {
+        char name[J_STANDIN_NAME_LEN];
+        c = replayParseString(c, name, sizeof(name));
+        if (c == NULL || *(c = replaySkipSpace(c)) != ':' || JStandinAdd(object, name) == NULL) {
+            JDelete(object);
+            return NULL;
+        }
+        c = replaySkipSpace(c + 1);
+
+        uint8_t i = object->count - 1;
+        if (*c == '"') {
+            c = replayParseString(c, object->strings[i], J_STANDIN_STRING_LEN);
+        } else if (strncmp(c, "true", 4) == 0 || strncmp(c, "false", 5) == 0) {
+            object->types[i] = J_STANDIN_BOOL;
+            object->numbers[i] = (*c == 't') ? 1 : 0;
+            c += (*c == 't') ? 4 : 5;
+        } else if (*c == '{' || *c == '[' || strncmp(c, "null", 4) == 0) {
+            const char* end = (*c == 'n') ? c + 4 : replaySkipNested(c);
+            if (end == NULL || (size_t)(end - c) >= J_STANDIN_STRING_LEN) {
+                c = NULL;
+            } else {
+                object->types[i] = J_STANDIN_RAW;
+                memcpy(object->strings[i], c, (size_t)(end - c));
+                c = end;
+            }
+        } else {
+            char* end = NULL;
+            object->numbers[i] = strtod(c, &end);
+            if (end == c || (size_t)(end - c) >= J_STANDIN_STRING_LEN) {
+                c = NULL;
+            } else {
+                object->types[i] = J_STANDIN_NUMBER;
+                memcpy(object->strings[i], c, (size_t)(end - c));
+                c = end;
+            }
+        }
+
+        if (c == NULL) {
+            JDelete(object);
+            return NULL;
+        }
+        c = replaySkipSpace(c);
+        if (*c == ',') {
+            c = replaySkipSpace(c + 1);
+        } else if (*c != '}') {
+            JDelete(object);
+            return NULL;
+        }
+    }
+
+    return object;
+}
+
+/**
+ * @brief Check that an object prints back to the recorded bytes
+ *
+ * @param object Parsed object
+ * @param recorded Recorded JSON
+ * @return true if identical
+ */
+static bool replayCheckBytes(const J* object, const char* recorded) {
+    char printed[TRANSCRIPT_TEXT_MAX * 2];
+    return replayPrint(object, printed, sizeof(printed)) > 0 && strcmp(printed, recorded) == 0;
+}
+
+#endif // NOTECARD_REPLAY_H
@@ -0,0 +1,58 @@
+/**
+ * @file alloc_count.h
+ * @brief Heap allocation counter for native test builds
+ *
+ * Replaces operator new everywhere, and the malloc family on glibc hosts,
+ * with versions that count calls in g_allocCount. The firmware's periodic
+ * paths must not allocate (heap fragmentation over weeks of uptime), so the
+ * benchmarks and the soak simulation assert on the count.
+ *
+ * Include from one translation unit per test program only.
+ */
+
+#ifndef ALLOC_COUNT_H
+#define ALLOC_COUNT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+static uint32_t g_allocCount = 0;
+
+void* operator new(size_t size) {
+    g_allocCount++;
+    void* p = malloc(size ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* p, size_t size);
+
+void* malloc(size_t size) {
+    g_allocCount++;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    g_allocCount++;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* p, size_t size) {
+    g_allocCount++;
+    return __libc_realloc(p, size);
+}
+}
+#endif
+
+#endif // ALLOC_COUNT_H
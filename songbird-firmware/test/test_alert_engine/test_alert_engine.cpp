@@ -0,0 +1,279 @@
+/**
+ * @file test_alert_engine.cpp
+ * @brief Unit tests for the streaming sensor alert engine
+ *
+ * Feeds synthetic sensor traces through SongbirdAlertEngine.cpp and checks
+ * spike rejection, N-of-M persistence, hysteresis, barometric tendency,
+ * temperature rate of change and history resets using PlatformIO Unity on
+ * the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The engine is pure logic; compile the real module (test_build_src = false)
+#include "SongbirdAlertEngine.cpp"
+
+#define T0          1700000000UL    // Arbitrary wall clock start
+#define INTERVAL    300UL           // 5 minute sample interval
+
+static SongbirdConfig s_config;
+static AlertEngineState s_engine;
+static AlertEvaluation s_eval;
+
+static SensorData make_data(float temperature, float humidity, float pressure, float voltage) {
+    SensorData data;
+    memset(&data, 0, sizeof(data));
+    data.temperature = temperature;
+    data.humidity = humidity;
+    data.pressure = pressure;
+    data.voltage = voltage;
+    data.valid = true;
+    return data;
+}
+
+// Feed one sample and return the raised mask
+static uint8_t feed(const SensorData* data, uint32_t nowSec, uint8_t active) {
+    TEST_ASSERT_TRUE(alertEngineUpdate(&s_engine, data, &s_config, nowSec, active, &s_eval));
+    return s_eval.raised;
+}
+
+static uint8_t feedTemp(float temperature, uint32_t nowSec, uint8_t active) {
+    SensorData data = make_data(temperature, 45.0f, 1013.0f, 4.1f);
+    return feed(&data, nowSec, active);
+}
+
+void setUp(void) {
+    memset(&s_config, 0, sizeof(s_config));
+    s_config.tempAlertHighC = DEFAULT_TEMP_ALERT_HIGH_C;
+    s_config.tempAlertLowC = DEFAULT_TEMP_ALERT_LOW_C;
+    s_config.humidityAlertHigh = DEFAULT_HUMIDITY_ALERT_HIGH;
+    s_config.humidityAlertLow = DEFAULT_HUMIDITY_ALERT_LOW;
+    s_config.pressureAlertDelta = DEFAULT_PRESSURE_ALERT_DELTA;
+    s_config.voltageAlertLow = DEFAULT_VOLTAGE_ALERT_LOW;
+    alertEngineReset(&s_engine);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Argument Handling
+// ============================================================================
+
+void test_rejects_null_and_invalid(void) {
+    SensorData data = make_data(22.0f, 45.0f, 1013.0f, 4.1f);
+    TEST_ASSERT_FALSE(alertEngineUpdate(NULL, &data, &s_config, T0, 0, &s_eval));
+    TEST_ASSERT_FALSE(alertEngineUpdate(&s_engine, NULL, &s_config, T0, 0, &s_eval));
+    TEST_ASSERT_FALSE(alertEngineUpdate(&s_engine, &data, NULL, T0, 0, &s_eval));
+    TEST_ASSERT_FALSE(alertEngineUpdate(&s_engine, &data, &s_config, T0, 0, NULL));
+
+    data.valid = false;
+    TEST_ASSERT_FALSE(alertEngineUpdate(&s_engine, &data, &s_config, T0, 0, &s_eval));
+    TEST_ASSERT_FALSE(s_engine.smoothed);
+}
+
+// ============================================================================
+// Level Thresholds
+// ============================================================================
+
+void test_single_spike_does_not_alert(void) {
+    for (uint32_t i = 0; i < 12; i++) {
+        float t = (i == 5) ? 60.0f : 22.0f;
+        TEST_ASSERT_EQUAL_HEX8(0, feedTemp(t, T0 + i * INTERVAL, 0));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 22.0f, s_eval.temperature);
+}
+
+void test_sustained_exceedance_raises_after_persist_count(void) {
+    TEST_ASSERT_EQUAL_HEX8(0, feedTemp(40.0f, T0, 0));
+    TEST_ASSERT_EQUAL_HEX8(0, feedTemp(40.0f, T0 + INTERVAL, 0));
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_TEMP_HIGH, feedTemp(40.0f, T0 + 2 * INTERVAL, 0));
+}
+
+void test_active_alert_is_not_raised_again(void) {
+    for (uint32_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, feedTemp(40.0f, T0 + i * INTERVAL, ALERT_FLAG_TEMP_HIGH));
+    }
+}
+
+void test_intermittent_exceedance_needs_n_of_m(void) {
+    // Alternating samples: the EWMA holds the level near the midpoint,
+    // below the threshold
+    for (uint32_t i = 0; i < 10; i++) {
+        float t = (i % 2) ? 38.0f : 30.0f;
+        TEST_ASSERT_EQUAL_HEX8(0, feedTemp(t, T0 + i * INTERVAL, 0) & ALERT_FLAG_TEMP_HIGH);
+    }
+}
+
+void test_clear_requires_hysteresis(void) {
+    // Inside the hysteresis band: stays active
+    for (uint32_t i = 0; i < 6; i++) {
+        feedTemp(34.0f, T0 + i * INTERVAL, ALERT_FLAG_TEMP_HIGH);
+        TEST_ASSERT_EQUAL_HEX8(0, s_eval.cleared);
+    }
+
+    // Past the band: clears after the persistence count
+    alertEngineReset(&s_engine);
+    feedTemp(30.0f, T0, ALERT_FLAG_TEMP_HIGH);
+    TEST_ASSERT_EQUAL_HEX8(0, s_eval.cleared);
+    feedTemp(30.0f, T0 + INTERVAL, ALERT_FLAG_TEMP_HIGH);
+    TEST_ASSERT_EQUAL_HEX8(0, s_eval.cleared);
+    feedTemp(30.0f, T0 + 2 * INTERVAL, ALERT_FLAG_TEMP_HIGH);
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_TEMP_HIGH, s_eval.cleared);
+}
+
+void test_humidity_low(void) {
+    SensorData data = make_data(22.0f, 10.0f, 1013.0f, 4.1f);
+    uint8_t raised = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        raised = feed(&data, T0 + i * INTERVAL, 0);
+    }
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_HUMIDITY_LOW, raised);
+}
+
+void test_level_alerts_work_without_clock(void) {
+    TEST_ASSERT_EQUAL_HEX8(0, feedTemp(40.0f, 0, 0));
+    TEST_ASSERT_EQUAL_HEX8(0, feedTemp(40.0f, 0, 0));
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_TEMP_HIGH, feedTemp(40.0f, 0, 0));
+    TEST_ASSERT_TRUE(isnan(s_eval.tempRate));
+    TEST_ASSERT_TRUE(isnan(s_eval.pressureTendency));
+}
+
+// ============================================================================
+// Battery
+// ============================================================================
+
+void test_low_battery_ignores_failed_reads(void) {
+    SensorData low = make_data(22.0f, 45.0f, 1013.0f, 3.2f);
+    SensorData failed = make_data(22.0f, 45.0f, 1013.0f, 0.0f);
+
+    TEST_ASSERT_EQUAL_HEX8(0, feed(&low, T0, 0));
+    TEST_ASSERT_EQUAL_HEX8(0, feed(&low, T0 + INTERVAL, 0));
+    TEST_ASSERT_EQUAL_HEX8(0, feed(&failed, T0 + 2 * INTERVAL, 0));
+    TEST_ASSERT_EQUAL_HEX8(0, feed(&failed, T0 + 3 * INTERVAL, 0));
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_LOW_BATTERY, feed(&low, T0 + 4 * INTERVAL, 0));
+}
+
+// ============================================================================
+// Barometric Tendency
+// ============================================================================
+
+void test_slow_pressure_drop_raises_tendency_alert(void) {
+    // 4 hPa/hour: 0.33 hPa between samples, 12 hPa over the 3 hour window
+    const float dropPerSample = 4.0f * INTERVAL / 3600.0f;
+    const uint32_t windowSamples = ALERT_TENDENCY_WINDOW_SEC / INTERVAL;
+    uint8_t raised = 0;
+    uint32_t raisedAt = 0;
+
+    for (uint32_t i = 0; i <= windowSamples + 12 && raised == 0; i++) {
+        SensorData data = make_data(22.0f, 45.0f, 1013.0f - dropPerSample * i, 4.1f);
+        raised = feed(&data, T0 + i * INTERVAL, 0);
+        if (i < windowSamples - ALERT_TENDENCY_SLOT_SEC / INTERVAL) {
+            // History does not reach back a full window yet
+            TEST_ASSERT_TRUE(isnan(s_eval.pressureTendency));
+        }
+        raisedAt = i;
+    }
+
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_PRESSURE_DELTA, raised);
+    TEST_ASSERT_TRUE(raisedAt >= windowSamples - ALERT_TENDENCY_SLOT_SEC / INTERVAL);
+    TEST_ASSERT_TRUE(s_eval.pressureTendency < -DEFAULT_PRESSURE_ALERT_DELTA);
+}
+
+void test_stable_pressure_does_not_alert(void) {
+    for (uint32_t i = 0; i < 60; i++) {
+        SensorData data = make_data(22.0f, 45.0f, 1013.0f + ((int)(i % 3) - 1) * 0.5f, 4.1f);
+        TEST_ASSERT_EQUAL_HEX8(0, feed(&data, T0 + i * INTERVAL, 0));
+    }
+    TEST_ASSERT_FALSE(isnan(s_eval.pressureTendency));
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 0.0f, s_eval.pressureTendency);
+}
+
+void test_tendency_unknown_without_clock(void) {
+    for (uint32_t i = 0; i < 60; i++) {
+        SensorData data = make_data(22.0f, 45.0f, 1013.0f - i, 4.1f);
+        TEST_ASSERT_EQUAL_HEX8(0, feed(&data, 0, 0));
+        TEST_ASSERT_TRUE(isnan(s_eval.pressureTendency));
+    }
+}
+
+// ============================================================================
+// Temperature Rate
+// ============================================================================
+
+void test_temperature_ramp_raises_rate_alert(void) {
+    // 20 C/hour from 5 C: stays within the level thresholds for an hour
+    const float risePerSample = 20.0f * INTERVAL / 3600.0f;
+    uint8_t raised = 0;
+    for (uint32_t i = 0; i < 12 && raised == 0; i++) {
+        raised = feedTemp(5.0f + risePerSample * i, T0 + i * INTERVAL, 0);
+    }
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_TEMP_RATE, raised);
+    TEST_ASSERT_TRUE(s_eval.tempRate > ALERT_TEMP_RATE_C_PER_HOUR);
+
+    // Temperature levels off: the rate alert clears
+    float level = s_eval.temperature;
+    uint8_t cleared = 0;
+    for (uint32_t i = 12; i < 48 && cleared == 0; i++) {
+        feedTemp(level, T0 + i * INTERVAL, ALERT_FLAG_TEMP_RATE);
+        cleared = s_eval.cleared;
+    }
+    TEST_ASSERT_EQUAL_HEX8(ALERT_FLAG_TEMP_RATE, cleared);
+}
+
+// ============================================================================
+// History Resets
+// ============================================================================
+
+void test_long_gap_reseeds_smoothing(void) {
+    for (uint32_t i = 0; i < 6; i++) {
+        feedTemp(22.0f, T0 + i * INTERVAL, 0);
+    }
+
+    uint32_t later = T0 + 5 * INTERVAL + ALERT_MAX_GAP_SEC + 1;
+    feedTemp(30.0f, later, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 30.0f, s_eval.temperature);
+    TEST_ASSERT_TRUE(isnan(s_eval.tempRate));
+}
+
+void test_clock_step_back_reseeds_smoothing(void) {
+    for (uint32_t i = 0; i < 6; i++) {
+        feedTemp(22.0f, T0 + i * INTERVAL, 0);
+    }
+
+    feedTemp(30.0f, T0 - 3600, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 30.0f, s_eval.temperature);
+    TEST_ASSERT_TRUE(isnan(s_eval.pressureTendency));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rejects_null_and_invalid);
+
+    RUN_TEST(test_single_spike_does_not_alert);
+    RUN_TEST(test_sustained_exceedance_raises_after_persist_count);
+    RUN_TEST(test_active_alert_is_not_raised_again);
+    RUN_TEST(test_intermittent_exceedance_needs_n_of_m);
+    RUN_TEST(test_clear_requires_hysteresis);
+    RUN_TEST(test_humidity_low);
+    RUN_TEST(test_level_alerts_work_without_clock);
+
+    RUN_TEST(test_low_battery_ignores_failed_reads);
+
+    RUN_TEST(test_slow_pressure_drop_raises_tendency_alert);
+    RUN_TEST(test_stable_pressure_does_not_alert);
+    RUN_TEST(test_tendency_unknown_without_clock);
+
+    RUN_TEST(test_temperature_ramp_raises_rate_alert);
+
+    RUN_TEST(test_long_gap_reseeds_smoothing);
+    RUN_TEST(test_clock_step_back_reseeds_smoothing);
+
+    return UNITY_END();
+}
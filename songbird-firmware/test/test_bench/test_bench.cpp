@@ -0,0 +1,255 @@
+/**
+ * @file test_bench.cpp
+ * @brief Microbenchmarks for the pure firmware modules
+ *
+ * Links the real alert engine and alert note assembly, env var parsing and
+ * config comparison, command table lookups and the state checksum, and
+ * times each function on the host. Each benchmark prints one line:
+ *
+ *   BENCH {"name":"envApplyVar","ns_per_op":41.2,"allocs_per_op":0,"iterations":524288}
+ *
+ * scripts/bench_report.py joins these with per-function code size from the
+ * firmware ELF and compares against a saved baseline. The host timings only
+ * track relative change between builds on one machine; they are not Cygnet
+ * timings (see PROFILE_MODE for those).
+ *
+ * Allocations are counted with alloc_count.h. None of these functions may
+ * allocate, so that is asserted.
+ *
+ * Run with: pio test -e native_bench
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+#include "alloc_count.h"
+#include <chrono>
+
+// The modules under test are pure; compile the real ones (test_build_src = false)
+#include "SongbirdAlertEngine.cpp"
+#include "SongbirdAlertNote.cpp"
+#include "SongbirdEnvParse.cpp"
+#include "SongbirdCommandTable.cpp"
+#include "SongbirdStateChecksum.cpp"
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+#define BENCH_MIN_NS        20000000ULL     // Target length of one timed batch
+#define BENCH_REPEATS       5               // Report the fastest batch
+
+typedef void (*BenchFn)(uint32_t i);
+
+// Results feed this so the calls are not optimized away
+static volatile uint32_t s_sink;
+
+static uint64_t bench_now_ns(void) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t bench_batch(BenchFn fn, uint32_t iterations) {
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < iterations; i++) {
+        fn(i);
+    }
+    return bench_now_ns() - start;
+}
+
+static void bench_run(const char* name, BenchFn fn) {
+    uint32_t iterations = 1;
+    while (bench_batch(fn, iterations) < BENCH_MIN_NS / 10 && iterations < (1UL << 30)) {
+        iterations *= 2;
+    }
+    iterations *= 10;
+
+    uint64_t best = UINT64_MAX;
+    uint32_t allocsBefore = g_allocCount;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint64_t elapsed = bench_batch(fn, iterations);
+        best = elapsed < best ? elapsed : best;
+    }
+    uint32_t allocs = g_allocCount - allocsBefore;
+
+    double nsPerOp = (double)best / iterations;
+    double allocsPerOp = (double)allocs / ((double)iterations * BENCH_REPEATS);
+    printf("BENCH {\"name\":\"%s\",\"ns_per_op\":%.2f,\"allocs_per_op\":%.4f,\"iterations\":%lu}\n",
+           name, nsPerOp, allocsPerOp, (unsigned long)iterations);
+    fflush(stdout);
+
+    TEST_ASSERT_EQUAL_MESSAGE(0, allocs, name);
+}
+
+// ============================================================================
+// Fixtures
+// ============================================================================
+
+static SongbirdConfig s_config;
+static SongbirdConfig s_configCopy;
+static AlertEngineState s_engine;
+static SensorData s_data;
+static AlertEvaluation s_eval;
+static SongbirdState s_state;
+
+// One value per env var, as Notehub returns them
+static const char* const ENV_VALUES[][2] = {
+    {ENV_MODE, "transit"},
+    {ENV_GPS_INTERVAL_MIN, "5"},
+    {ENV_SYNC_INTERVAL_MIN, "15"},
+    {ENV_HEARTBEAT_HOURS, "24"},
+    {ENV_TEMP_ALERT_HIGH_C, "35.5"},
+    {ENV_TEMP_ALERT_LOW_C, "0"},
+    {ENV_HUMIDITY_ALERT_HIGH, "80"},
+    {ENV_HUMIDITY_ALERT_LOW, "20"},
+    {ENV_PRESSURE_ALERT_DELTA, "10"},
+    {ENV_VOLTAGE_ALERT_LOW, "3.6"},
+    {ENV_MOTION_SENSITIVITY, "medium"},
+    {ENV_MOTION_WAKE_ENABLED, "true"},
+    {ENV_AUDIO_ENABLED, "true"},
+    {ENV_AUDIO_VOLUME, "80"},
+    {ENV_AUDIO_ALERTS_ONLY, "false"},
+    {ENV_CMD_WAKE_ENABLED, "true"},
+    {ENV_CMD_ACK_ENABLED, "true"},
+    {ENV_LOCATE_DURATION_SEC, "60"},
+    {ENV_LED_ENABLED, "true"},
+    {ENV_DEBUG_MODE, "false"},
+    {ENV_GPS_POWER_SAVE_ENABLED, "true"},
+    {ENV_GPS_SIGNAL_TIMEOUT_MIN, "15"},
+    {ENV_GPS_RETRY_INTERVAL_MIN, "30"},
+    {ENV_POWER_POLICY_ENABLED, "true"},
+    {ENV_POWER_POLICY_FULL_V, "3.9"},
+    {ENV_POWER_POLICY_LOW_V, "3.5"},
+    {ENV_POWER_POLICY_MAX_SCALE, "4"},
+};
+#define ENV_VALUE_COUNT (sizeof(ENV_VALUES) / sizeof(ENV_VALUES[0]))
+
+// Command names as received, including one that is not a command
+static const char* const COMMAND_INPUTS[] = {
+    "ping", "locate", "play_melody", "test_audio", "set_volume", "unlock", "profile", "reboot"
+};
+static const char* const MELODY_INPUTS[] = {
+    "connected", "power_on", "alert", "ping", "error", "low_battery", "gps_lock", "sleep", "fanfare"
+};
+
+void setUp(void) {
+    envInitDefaults(&s_config);
+    s_configCopy = s_config;
+    alertEngineReset(&s_engine);
+    memset(&s_data, 0, sizeof(s_data));
+    s_data.temperature = 22.0f;
+    s_data.humidity = 45.0f;
+    s_data.pressure = 1013.0f;
+    s_data.voltage = 4.1f;
+    s_data.valid = true;
+    s_data.timestamp = 1700000000;
+    memset(&s_eval, 0, sizeof(s_eval));
+    memset(&s_state, 0, sizeof(s_state));
+    s_state.magic = STATE_MAGIC;
+    s_state.version = STATE_VERSION;
+    s_state.bootCount = 42;
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Sensors: Alert Logic
+// ============================================================================
+
+static void op_alert_engine_update(uint32_t i) {
+    // A slow temperature wave that crosses the high threshold now and then
+    s_data.temperature = 22.0f + (float)(i % 64) * 0.25f;
+    uint32_t nowSec = 1700000000UL + i * 60;
+    alertEngineUpdate(&s_engine, &s_data, &s_config, nowSec, 0, &s_eval);
+    s_sink += s_eval.raised;
+}
+
+static void op_build_alert_note(uint32_t i) {
+    AlertNote note;
+    sensorsBuildAlertNote((uint8_t)i, 0, &s_data, &s_eval, &s_config, &note);
+    s_sink += note.raised;
+}
+
+void test_bench_alert_engine_update(void) {
+    bench_run("alertEngineUpdate", op_alert_engine_update);
+}
+
+void test_bench_build_alert_note(void) {
+    bench_run("sensorsBuildAlertNote", op_build_alert_note);
+}
+
+// ============================================================================
+// Env: Parsing and Comparison
+// ============================================================================
+
+static void op_env_apply_var(uint32_t i) {
+    const char* const* pair = ENV_VALUES[i % ENV_VALUE_COUNT];
+    s_sink += envApplyVar(&s_config, pair[0], pair[1]);
+}
+
+static void op_env_config_changed(uint32_t i) {
+    // Equal configs: every field is compared
+    s_sink += envConfigChanged(&s_config, &s_configCopy) + (i & 1);
+}
+
+void test_bench_env_apply_var(void) {
+    bench_run("envApplyVar", op_env_apply_var);
+}
+
+void test_bench_env_config_changed(void) {
+    bench_run("envConfigChanged", op_env_config_changed);
+}
+
+// ============================================================================
+// Commands: Dispatch Lookups
+// ============================================================================
+
+static void op_commands_parse_type(uint32_t i) {
+    s_sink += commandsParseType(COMMAND_INPUTS[i % 8]);
+}
+
+static void op_commands_melody_event(uint32_t i) {
+    s_sink += commandsGetMelodyEvent(MELODY_INPUTS[i % 9]);
+}
+
+void test_bench_commands_parse_type(void) {
+    bench_run("commandsParseType", op_commands_parse_type);
+}
+
+void test_bench_commands_melody_event(void) {
+    bench_run("commandsGetMelodyEvent", op_commands_melody_event);
+}
+
+// ============================================================================
+// State: Checksum
+// ============================================================================
+
+static void op_state_checksum(uint32_t i) {
+    s_state.totalUptimeSec = i;
+    s_sink += stateCalculateChecksum(&s_state);
+}
+
+void test_bench_state_checksum(void) {
+    bench_run("stateCalculateChecksum", op_state_checksum);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bench_alert_engine_update);
+    RUN_TEST(test_bench_build_alert_note);
+
+    RUN_TEST(test_bench_env_apply_var);
+    RUN_TEST(test_bench_env_config_changed);
+
+    RUN_TEST(test_bench_commands_parse_type);
+    RUN_TEST(test_bench_commands_melody_event);
+
+    RUN_TEST(test_bench_state_checksum);
+
+    return UNITY_END();
+}
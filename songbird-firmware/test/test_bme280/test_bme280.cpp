@@ -0,0 +1,257 @@
+/**
+ * @file test_bme280.cpp
+ * @brief Unit tests for BME280 calibration parsing and compensation
+ *
+ * Feeds recorded calibration registers and raw data frames through the
+ * compensation in SongbirdBME280.cpp and checks the results against the
+ * datasheet example (BST-BME280-DS002 section 8.1) and the datasheet's
+ * floating-point reference formulas, and checks the conversion time budget
+ * used by SensorTask, using PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+
+// Compensation is pure; compile the real module (test_build_src = false)
+#include "SongbirdBME280.cpp"
+
+// ============================================================================
+// Recorded Register Data
+// ============================================================================
+
+// 0x88..0xA1: dig_T1=27504 T2=26435 T3=-1000 P1=36477 P2=-10685 P3=3024
+// P4=2855 P5=140 P6=-7 P7=15500 P8=-14600 P9=6000, (0xA0), H1=75
+static const uint8_t CALIB00[BME280_CALIB00_LEN] = {
+    0x70, 0x6B, 0x43, 0x67, 0x18, 0xFC,
+    0x7D, 0x8E, 0x43, 0xD6, 0xD0, 0x0B, 0x27, 0x0B, 0x8C, 0x00,
+    0xF9, 0xFF, 0x8C, 0x3C, 0xF8, 0xC6, 0x70, 0x17,
+    0x00, 0x4B
+};
+
+// 0xE1..0xE7: H2=362 H3=0 H4=313 H5=50 H6=30
+static const uint8_t CALIB26[BME280_CALIB26_LEN] = {
+    0x6A, 0x01, 0x00, 0x13, 0x29, 0x03, 0x1E
+};
+
+static Bme280Calib s_calib;
+
+// Pack raw ADC values into the 0xF7..0xFE register layout
+static void makeFrame(uint32_t adcP, uint32_t adcT, uint16_t adcH, uint8_t* frame) {
+    frame[0] = (uint8_t)(adcP >> 12);
+    frame[1] = (uint8_t)(adcP >> 4);
+    frame[2] = (uint8_t)((adcP & 0x0F) << 4);
+    frame[3] = (uint8_t)(adcT >> 12);
+    frame[4] = (uint8_t)(adcT >> 4);
+    frame[5] = (uint8_t)((adcT & 0x0F) << 4);
+    frame[6] = (uint8_t)(adcH >> 8);
+    frame[7] = (uint8_t)adcH;
+}
+
+void setUp(void) {
+    bme280ParseCalib(CALIB00, CALIB26, &s_calib);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Calibration Parsing
+// ============================================================================
+
+void test_parse_temperature_pressure_calib(void) {
+    TEST_ASSERT_EQUAL_UINT16(27504, s_calib.t1);
+    TEST_ASSERT_EQUAL_INT16(26435, s_calib.t2);
+    TEST_ASSERT_EQUAL_INT16(-1000, s_calib.t3);
+    TEST_ASSERT_EQUAL_UINT16(36477, s_calib.p1);
+    TEST_ASSERT_EQUAL_INT16(-10685, s_calib.p2);
+    TEST_ASSERT_EQUAL_INT16(3024, s_calib.p3);
+    TEST_ASSERT_EQUAL_INT16(2855, s_calib.p4);
+    TEST_ASSERT_EQUAL_INT16(140, s_calib.p5);
+    TEST_ASSERT_EQUAL_INT16(-7, s_calib.p6);
+    TEST_ASSERT_EQUAL_INT16(15500, s_calib.p7);
+    TEST_ASSERT_EQUAL_INT16(-14600, s_calib.p8);
+    TEST_ASSERT_EQUAL_INT16(6000, s_calib.p9);
+}
+
+void test_parse_humidity_calib(void) {
+    TEST_ASSERT_EQUAL_UINT8(75, s_calib.h1);
+    TEST_ASSERT_EQUAL_INT16(362, s_calib.h2);
+    TEST_ASSERT_EQUAL_UINT8(0, s_calib.h3);
+    TEST_ASSERT_EQUAL_INT16(313, s_calib.h4);
+    TEST_ASSERT_EQUAL_INT16(50, s_calib.h5);
+    TEST_ASSERT_EQUAL_INT8(30, s_calib.h6);
+}
+
+void test_parse_negative_packed_humidity_calib(void) {
+    // H4 = -3 (0xFFD) and H5 = -2 (0xFFE) share nibbles of 0xE5
+    const uint8_t calib26[BME280_CALIB26_LEN] = { 0x6A, 0x01, 0x00, 0xFF, 0xED, 0xFF, 0xF6 };
+    Bme280Calib calib;
+    bme280ParseCalib(CALIB00, calib26, &calib);
+
+    TEST_ASSERT_EQUAL_INT16(-3, calib.h4);
+    TEST_ASSERT_EQUAL_INT16(-2, calib.h5);
+    TEST_ASSERT_EQUAL_INT8(-10, calib.h6);
+}
+
+// ============================================================================
+// Compensation
+// ============================================================================
+
+void test_datasheet_example(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    makeFrame(415148, 519888, 30000, frame);
+
+    Bme280Reading reading;
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 25.08f, reading.temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1006.53f, reading.pressure);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 55.00f, reading.humidity);
+}
+
+void test_cold_frame(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    makeFrame(415148, 400000, 25000, frame);
+
+    Bme280Reading reading;
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+
+    // Datasheet floating-point formulas: -12.644 C, 949.163 hPa, 27.83 %RH
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, -12.64f, reading.temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 949.16f, reading.pressure);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 27.83f, reading.humidity);
+}
+
+void test_hot_frame(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    makeFrame(415148, 600000, 30000, frame);
+
+    Bme280Reading reading;
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+
+    // Datasheet floating-point formulas: 50.110 C, 1045.277 hPa, 55.76 %RH
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.11f, reading.temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, 1045.28f, reading.pressure);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 55.76f, reading.humidity);
+}
+
+void test_humidity_is_clamped(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    Bme280Reading reading;
+
+    makeFrame(415148, 519888, 0, frame);
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, reading.humidity);
+
+    makeFrame(415148, 519888, 0xFFFF, frame);
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, reading.humidity);
+}
+
+void test_skipped_channels_are_nan(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    makeFrame(0x80000, 519888, 0x8000, frame);
+
+    Bme280Reading reading;
+    TEST_ASSERT_TRUE(bme280Compensate(&s_calib, frame, &reading));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 25.08f, reading.temperature);
+    TEST_ASSERT_TRUE(isnan(reading.pressure));
+    TEST_ASSERT_TRUE(isnan(reading.humidity));
+}
+
+void test_reset_frame_is_rejected(void) {
+    // Power-on register contents before the first conversion
+    const uint8_t frame[BME280_DATA_LEN] = { 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00 };
+
+    Bme280Reading reading;
+    TEST_ASSERT_FALSE(bme280Compensate(&s_calib, frame, &reading));
+}
+
+void test_null_arguments(void) {
+    uint8_t frame[BME280_DATA_LEN];
+    Bme280Reading reading;
+    makeFrame(415148, 519888, 30000, frame);
+
+    TEST_ASSERT_FALSE(bme280Compensate(NULL, frame, &reading));
+    TEST_ASSERT_FALSE(bme280Compensate(&s_calib, NULL, &reading));
+    TEST_ASSERT_FALSE(bme280Compensate(&s_calib, frame, NULL));
+}
+
+// ============================================================================
+// Measurement Settings
+// ============================================================================
+
+void test_measure_time_x1(void) {
+    // Datasheet: 1.25 + 2.3 + 2.875 + 2.875 = 9.3 ms
+    SensorProfile profile = { 1, 1, 1, 0, false, 0 };
+    TEST_ASSERT_EQUAL_UINT32(9300, bme280MeasureTimeUs(&profile));
+}
+
+void test_measure_time_oversampled(void) {
+    // 1.25 + 2.3*2 + (2.3*16 + 0.575) + (2.3*1 + 0.575) = 46.1 ms
+    SensorProfile profile = { 2, 16, 1, 16, true, 500 };
+    TEST_ASSERT_EQUAL_UINT32(46100, bme280MeasureTimeUs(&profile));
+}
+
+void test_measure_time_skipped_channels(void) {
+    SensorProfile profile = { 1, 0, 0, 0, false, 0 };
+    TEST_ASSERT_EQUAL_UINT32(3550, bme280MeasureTimeUs(&profile));
+    TEST_ASSERT_EQUAL_UINT32(0, bme280MeasureTimeUs(NULL));
+}
+
+void test_unsupported_factors_round_down(void) {
+    // x3 is applied as x2, x20 as x16
+    SensorProfile requested = { 3, 20, 1, 0, false, 0 };
+    SensorProfile applied = { 2, 16, 1, 0, false, 0 };
+    TEST_ASSERT_EQUAL_UINT32(bme280MeasureTimeUs(&applied), bme280MeasureTimeUs(&requested));
+
+    TEST_ASSERT_EQUAL_UINT8(0, encodeOversampling(0));
+    TEST_ASSERT_EQUAL_UINT8(3, encodeOversampling(4));
+    TEST_ASSERT_EQUAL_UINT8(5, encodeOversampling(16));
+}
+
+void test_filter_and_standby_encoding(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, bme280EncodeFilter(0));
+    TEST_ASSERT_EQUAL_UINT8(0, bme280EncodeFilter(1));
+    TEST_ASSERT_EQUAL_UINT8(2, bme280EncodeFilter(4));
+    TEST_ASSERT_EQUAL_UINT8(4, bme280EncodeFilter(16));
+
+    TEST_ASSERT_EQUAL_UINT8(0, bme280EncodeStandby(0));
+    TEST_ASSERT_EQUAL_UINT8(6, bme280EncodeStandby(10));
+    TEST_ASSERT_EQUAL_UINT8(7, bme280EncodeStandby(50));
+    TEST_ASSERT_EQUAL_UINT8(4, bme280EncodeStandby(500));
+    TEST_ASSERT_EQUAL_UINT8(5, bme280EncodeStandby(2000));
+}
+
+// ============================================================================
+// Test Runner
+// ============================================================================
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+
+    // Calibration parsing
+    RUN_TEST(test_parse_temperature_pressure_calib);
+    RUN_TEST(test_parse_humidity_calib);
+    RUN_TEST(test_parse_negative_packed_humidity_calib);
+
+    // Compensation
+    RUN_TEST(test_datasheet_example);
+    RUN_TEST(test_cold_frame);
+    RUN_TEST(test_hot_frame);
+    RUN_TEST(test_humidity_is_clamped);
+    RUN_TEST(test_skipped_channels_are_nan);
+    RUN_TEST(test_reset_frame_is_rejected);
+    RUN_TEST(test_null_arguments);
+
+    // Measurement settings
+    RUN_TEST(test_measure_time_x1);
+    RUN_TEST(test_measure_time_oversampled);
+    RUN_TEST(test_measure_time_skipped_channels);
+    RUN_TEST(test_unsupported_factors_round_down);
+    RUN_TEST(test_filter_and_standby_encoding);
+
+    return UNITY_END();
+}
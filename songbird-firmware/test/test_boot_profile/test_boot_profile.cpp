@@ -0,0 +1,222 @@
+/**
+ * @file test_boot_profile.cpp
+ * @brief Unit tests for the boot-time profile
+ *
+ * Tests stage marks, stage durations across skipped stages, the compact
+ * persistent record and the history from SongbirdBootProfile.cpp using
+ * PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The profile is pure apart from millis(); compile the real module (test_build_src = false)
+#include "SongbirdBootProfile.cpp"
+
+static BootProfile s_boot;
+
+void setUp(void) {
+    memset(&s_boot, 0, sizeof(s_boot));
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Stage Marks
+// ============================================================================
+
+void test_unmarked_stage_not_reached(void) {
+    uint32_t ms = 123;
+    TEST_ASSERT_FALSE(bootProfileElapsedMs(&s_boot, BOOT_STAGE_AUDIO, &ms));
+    TEST_ASSERT_FALSE(bootProfileStageMs(&s_boot, BOOT_STAGE_AUDIO, &ms));
+    TEST_ASSERT_EQUAL_UINT32(123, ms);
+}
+
+void test_first_mark_wins(void) {
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_SENSORS, 400);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_SENSORS, 900);
+
+    uint32_t ms = 0;
+    TEST_ASSERT_TRUE(bootProfileElapsedMs(&s_boot, BOOT_STAGE_SENSORS, &ms));
+    TEST_ASSERT_EQUAL_UINT32(400, ms);
+}
+
+void test_mark_at_zero_is_reached(void) {
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_CORE, 0);
+
+    uint32_t ms = 99;
+    TEST_ASSERT_TRUE(bootProfileStageMs(&s_boot, BOOT_STAGE_CORE, &ms));
+    TEST_ASSERT_EQUAL_UINT32(0, ms);
+}
+
+void test_invalid_stage_ignored(void) {
+    uint32_t ms = 0;
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_COUNT, 100);
+    TEST_ASSERT_EQUAL_UINT32(0, s_boot.reached);
+    TEST_ASSERT_FALSE(bootProfileElapsedMs(&s_boot, BOOT_STAGE_COUNT, &ms));
+    TEST_ASSERT_EQUAL_STRING("unknown", bootStageName(BOOT_STAGE_COUNT));
+    TEST_ASSERT_EQUAL_STRING("first_note", bootStageName(BOOT_STAGE_FIRST_NOTE));
+}
+
+void test_flags_accumulate(void) {
+    bootProfileSetFlags(&s_boot, BOOT_FLAG_WARM);
+    bootProfileSetFlags(&s_boot, BOOT_FLAG_SLEEP_WAKE);
+    TEST_ASSERT_EQUAL_HEX8(BOOT_FLAG_WARM | BOOT_FLAG_SLEEP_WAKE, s_boot.flags);
+}
+
+// ============================================================================
+// Stage Durations
+// ============================================================================
+
+void test_stage_duration_from_previous(void) {
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_CORE, 20);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_I2C, 90);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_AUDIO, 250);
+
+    uint32_t ms = 0;
+    bootProfileStageMs(&s_boot, BOOT_STAGE_CORE, &ms);
+    TEST_ASSERT_EQUAL_UINT32(20, ms);
+    bootProfileStageMs(&s_boot, BOOT_STAGE_I2C, &ms);
+    TEST_ASSERT_EQUAL_UINT32(70, ms);
+    bootProfileStageMs(&s_boot, BOOT_STAGE_AUDIO, &ms);
+    TEST_ASSERT_EQUAL_UINT32(160, ms);
+}
+
+void test_skipped_stages_fold_into_next(void) {
+    // Scheduled wake: no configure, no connection wait
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_TASKS, 1500);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_ENV, 1900);
+
+    uint32_t ms = 0;
+    TEST_ASSERT_FALSE(bootProfileStageMs(&s_boot, BOOT_STAGE_CONNECT, &ms));
+    TEST_ASSERT_TRUE(bootProfileStageMs(&s_boot, BOOT_STAGE_ENV, &ms));
+    TEST_ASSERT_EQUAL_UINT32(400, ms);
+}
+
+void test_out_of_order_stage_clamps_to_zero(void) {
+    // First note sent by NotecardTask before MainTask marked env
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_FIRST_NOTE, 1000);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_ENV, 1200);
+
+    uint32_t ms = 99;
+    bootProfileStageMs(&s_boot, BOOT_STAGE_FIRST_NOTE, &ms);
+    TEST_ASSERT_EQUAL_UINT32(0, ms);
+}
+
+// ============================================================================
+// Persistent Record
+// ============================================================================
+
+void test_compact_record(void) {
+    bootProfileSetFlags(&s_boot, BOOT_FLAG_CONNECTED);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_CORE, 5);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_TASKS, 1234);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_CONNECT, 9234);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_ENV, 9500);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_FIRST_NOTE, 9700);
+
+    BootProfileRecord record;
+    bootProfileCompact(&s_boot, &record);
+    TEST_ASSERT_EQUAL_HEX8(BOOT_FLAG_CONNECTED, record.flags);
+    TEST_ASSERT_EQUAL_UINT16(124, record.tasksCs);      // Rounded up
+    TEST_ASSERT_EQUAL_UINT16(950, record.readyCs);
+    TEST_ASSERT_EQUAL_UINT16(970, record.firstNoteCs);
+    TEST_ASSERT_EQUAL_UINT8(BOOT_STAGE_CONNECT, record.slowestStage);
+    TEST_ASSERT_EQUAL_UINT16(800, record.slowestCs);
+}
+
+void test_compact_unreached_and_saturated(void) {
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_CORE, 0);
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_TASKS, 1000000);
+
+    BootProfileRecord record;
+    bootProfileCompact(&s_boot, &record);
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, record.tasksCs);
+    TEST_ASSERT_EQUAL_UINT16(0, record.readyCs);
+    TEST_ASSERT_EQUAL_UINT16(0, record.firstNoteCs);
+
+    // A reached point never reads as "not reached"
+    memset(&s_boot, 0, sizeof(s_boot));
+    bootProfileMarkAt(&s_boot, BOOT_STAGE_TASKS, 0);
+    bootProfileCompact(&s_boot, &record);
+    TEST_ASSERT_EQUAL_UINT16(1, record.tasksCs);
+}
+
+// ============================================================================
+// History
+// ============================================================================
+
+void test_history_keeps_latest(void) {
+    BootProfileHistory history;
+    memset(&history, 0, sizeof(history));
+    TEST_ASSERT_EQUAL_UINT32(0, bootProfileHistoryMaxFirstNoteMs(&history));
+
+    BootProfileRecord record;
+    memset(&record, 0, sizeof(record));
+    for (uint16_t i = 1; i <= BOOT_PROFILE_HISTORY + 2; i++) {
+        record.firstNoteCs = (i == 2) ? 5000 : i * 100;
+        bootProfileHistoryAdd(&history, &record);
+    }
+
+    // The 50 s boot has been replaced; the newest are kept
+    TEST_ASSERT_EQUAL_UINT8(BOOT_PROFILE_HISTORY, history.count);
+    TEST_ASSERT_EQUAL_UINT32((BOOT_PROFILE_HISTORY + 2) * 1000,
+                             bootProfileHistoryMaxFirstNoteMs(&history));
+}
+
+void test_history_partial(void) {
+    BootProfileHistory history;
+    memset(&history, 0, sizeof(history));
+
+    BootProfileRecord record;
+    memset(&record, 0, sizeof(record));
+    record.firstNoteCs = 321;
+    bootProfileHistoryAdd(&history, &record);
+
+    TEST_ASSERT_EQUAL_UINT8(1, history.count);
+    TEST_ASSERT_EQUAL_UINT32(3210, bootProfileHistoryMaxFirstNoteMs(&history));
+}
+
+// ============================================================================
+// This Boot
+// ============================================================================
+
+void test_mark_uses_millis(void) {
+    mock_set_millis(4321);
+    bootProfileMark(BOOT_STAGE_STATE);
+    bootProfileFlag(BOOT_FLAG_WARM);
+
+    uint32_t ms = 0;
+    TEST_ASSERT_TRUE(bootProfileElapsedMs(bootProfileGet(), BOOT_STAGE_STATE, &ms));
+    TEST_ASSERT_EQUAL_UINT32(4321, ms);
+    TEST_ASSERT_EQUAL_HEX8(BOOT_FLAG_WARM, bootProfileGet()->flags);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_unmarked_stage_not_reached);
+    RUN_TEST(test_first_mark_wins);
+    RUN_TEST(test_mark_at_zero_is_reached);
+    RUN_TEST(test_invalid_stage_ignored);
+    RUN_TEST(test_flags_accumulate);
+
+    RUN_TEST(test_stage_duration_from_previous);
+    RUN_TEST(test_skipped_stages_fold_into_next);
+    RUN_TEST(test_out_of_order_stage_clamps_to_zero);
+
+    RUN_TEST(test_compact_record);
+    RUN_TEST(test_compact_unreached_and_saturated);
+
+    RUN_TEST(test_history_keeps_latest);
+    RUN_TEST(test_history_partial);
+
+    RUN_TEST(test_mark_uses_millis);
+
+    return UNITY_END();
+}
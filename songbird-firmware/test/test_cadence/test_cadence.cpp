@@ -0,0 +1,223 @@
+/**
+ * @file test_cadence.cpp
+ * @brief Unit tests for the Notecard sync and GPS cadence
+ *
+ * Builds hub.set and card.location.mode requests with SongbirdCadence.cpp
+ * against the J stand-in in test/support/Notecard.h and checks the emitted
+ * parameters for each mode and interval, using PlatformIO Unity on the
+ * native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// Cadence and policy are pure; compile the real modules (test_build_src = false)
+#include "SongbirdPowerPolicy.cpp"
+#include "SongbirdCadence.cpp"
+
+static SongbirdConfig s_config;
+static J* s_req;
+
+void setUp(void) {
+    memset(&s_config, 0, sizeof(s_config));
+    s_config.mode = MODE_TRANSIT;
+    s_config.gpsIntervalMin = DEFAULT_GPS_INTERVAL_MIN;
+    s_config.syncIntervalMin = DEFAULT_SYNC_INTERVAL_MIN;
+    s_config.powerPolicyEnabled = DEFAULT_POWER_POLICY_ENABLED;
+    s_config.powerPolicyFullV = DEFAULT_POWER_POLICY_FULL_V;
+    s_config.powerPolicyLowV = DEFAULT_POWER_POLICY_LOW_V;
+    s_config.powerPolicyMaxScale = DEFAULT_POWER_POLICY_MAX_SCALE;
+    powerPolicyReset();
+    s_req = JCreateObject();
+}
+
+void tearDown(void) {
+    JDelete(s_req);
+}
+
+// Build the hub.set fields for the current config
+static void buildHubSet(void) {
+    NotecardCadence cadence;
+    cadenceCompute(&s_config, &cadence);
+    cadenceAddHubSet(s_req, &cadence);
+}
+
+// Build the card.location.mode fields for the current config
+static void buildLocationMode(void) {
+    NotecardCadence cadence;
+    cadenceCompute(&s_config, &cadence);
+    cadenceAddLocationMode(s_req, &cadence);
+}
+
+// ============================================================================
+// hub.set
+// ============================================================================
+
+void test_transit_syncs_at_sync_interval(void) {
+    s_config.syncIntervalMin = 45;
+    buildHubSet();
+    TEST_ASSERT_EQUAL_STRING("periodic", JGetString(s_req, "mode"));
+    TEST_ASSERT_EQUAL_INT(45, (int)JGetNumber(s_req, "outbound"));
+    TEST_ASSERT_EQUAL_INT(45, (int)JGetNumber(s_req, "inbound"));
+    TEST_ASSERT_FALSE(JIsPresent(s_req, "sync"));
+    TEST_ASSERT_FALSE(JIsPresent(s_req, "duration"));
+}
+
+void test_demo_stays_continuous(void) {
+    s_config.mode = MODE_DEMO;
+    s_config.syncIntervalMin = 120;
+    buildHubSet();
+    TEST_ASSERT_EQUAL_STRING("continuous", JGetString(s_req, "mode"));
+    TEST_ASSERT_TRUE(JGetBool(s_req, "sync"));
+    TEST_ASSERT_EQUAL_INT(DEMO_OUTBOUND_MIN, (int)JGetNumber(s_req, "outbound"));
+    TEST_ASSERT_EQUAL_INT(DEMO_INBOUND_MIN, (int)JGetNumber(s_req, "inbound"));
+    TEST_ASSERT_EQUAL_INT(DEMO_CONTINUOUS_DURATION_MIN, (int)JGetNumber(s_req, "duration"));
+}
+
+void test_storage_honours_floor(void) {
+    s_config.mode = MODE_STORAGE;
+    s_config.syncIntervalMin = 5;
+    buildHubSet();
+    TEST_ASSERT_EQUAL_STRING("periodic", JGetString(s_req, "mode"));
+    TEST_ASSERT_EQUAL_INT(STORAGE_SYNC_FLOOR_MIN, (int)JGetNumber(s_req, "outbound"));
+    TEST_ASSERT_EQUAL_INT(STORAGE_SYNC_FLOOR_MIN, (int)JGetNumber(s_req, "inbound"));
+}
+
+void test_storage_longer_interval_honoured(void) {
+    s_config.mode = MODE_STORAGE;
+    s_config.syncIntervalMin = 240;
+    buildHubSet();
+    TEST_ASSERT_EQUAL_INT(240, (int)JGetNumber(s_req, "outbound"));
+    TEST_ASSERT_EQUAL_INT(240, (int)JGetNumber(s_req, "inbound"));
+}
+
+void test_sleep_is_minimum(void) {
+    s_config.mode = MODE_SLEEP;
+    buildHubSet();
+    TEST_ASSERT_EQUAL_STRING("minimum", JGetString(s_req, "mode"));
+    TEST_ASSERT_FALSE(JIsPresent(s_req, "outbound"));
+    TEST_ASSERT_FALSE(JIsPresent(s_req, "inbound"));
+}
+
+void test_low_battery_stretches_sync(void) {
+    TEST_ASSERT_TRUE(powerPolicyUpdate(&s_config, 3.2f, false));
+    buildHubSet();
+    TEST_ASSERT_EQUAL_INT(DEFAULT_SYNC_INTERVAL_MIN * DEFAULT_POWER_POLICY_MAX_SCALE,
+                          (int)JGetNumber(s_req, "outbound"));
+    TEST_ASSERT_EQUAL_INT(DEFAULT_SYNC_INTERVAL_MIN * DEFAULT_POWER_POLICY_MAX_SCALE,
+                          (int)JGetNumber(s_req, "inbound"));
+}
+
+void test_cadence_records_scale(void) {
+    NotecardCadence cadence;
+    cadenceCompute(&s_config, &cadence);
+    TEST_ASSERT_EQUAL_UINT16(100, cadence.scalePct);
+
+    powerPolicyUpdate(&s_config, 3.2f, false);
+    cadenceCompute(&s_config, &cadence);
+    TEST_ASSERT_EQUAL_UINT16(DEFAULT_POWER_POLICY_MAX_SCALE * 100, cadence.scalePct);
+}
+
+// ============================================================================
+// card.location.mode
+// ============================================================================
+
+void test_transit_gps_at_gps_interval(void) {
+    s_config.gpsIntervalMin = 10;
+    buildLocationMode();
+    TEST_ASSERT_EQUAL_STRING("periodic", JGetString(s_req, "mode"));
+    TEST_ASSERT_EQUAL_INT(600, (int)JGetNumber(s_req, "seconds"));
+}
+
+void test_gps_off_outside_transit(void) {
+    const OperatingMode modes[] = { MODE_DEMO, MODE_STORAGE, MODE_SLEEP };
+    for (uint8_t i = 0; i < 3; i++) {
+        J* req = JCreateObject();
+        NotecardCadence cadence;
+        s_config.mode = modes[i];
+        cadenceCompute(&s_config, &cadence);
+        cadenceAddLocationMode(req, &cadence);
+        TEST_ASSERT_EQUAL_STRING("off", JGetString(req, "mode"));
+        TEST_ASSERT_FALSE(JIsPresent(req, "seconds"));
+        JDelete(req);
+    }
+}
+
+void test_gps_not_stretched_by_power_policy(void) {
+    powerPolicyUpdate(&s_config, 3.2f, false);
+    buildLocationMode();
+    TEST_ASSERT_EQUAL_INT(DEFAULT_GPS_INTERVAL_MIN * 60, (int)JGetNumber(s_req, "seconds"));
+}
+
+// ============================================================================
+// Change Detection
+// ============================================================================
+
+void test_sync_interval_change_moves_hub_only(void) {
+    NotecardCadence before;
+    NotecardCadence after;
+    cadenceCompute(&s_config, &before);
+    s_config.syncIntervalMin = 30;
+    cadenceCompute(&s_config, &after);
+    TEST_ASSERT_TRUE(cadenceHubChanged(&before, &after));
+    TEST_ASSERT_FALSE(cadenceGpsChanged(&before, &after));
+}
+
+void test_gps_interval_change_moves_gps_only(void) {
+    NotecardCadence before;
+    NotecardCadence after;
+    cadenceCompute(&s_config, &before);
+    s_config.gpsIntervalMin = 2;
+    cadenceCompute(&s_config, &after);
+    TEST_ASSERT_FALSE(cadenceHubChanged(&before, &after));
+    TEST_ASSERT_TRUE(cadenceGpsChanged(&before, &after));
+}
+
+void test_interval_change_in_demo_is_not_a_change(void) {
+    NotecardCadence before;
+    NotecardCadence after;
+    s_config.mode = MODE_DEMO;
+    cadenceCompute(&s_config, &before);
+    s_config.syncIntervalMin = 30;
+    s_config.gpsIntervalMin = 2;
+    cadenceCompute(&s_config, &after);
+    TEST_ASSERT_FALSE(cadenceHubChanged(&before, &after));
+    TEST_ASSERT_FALSE(cadenceGpsChanged(&before, &after));
+}
+
+void test_null_config_uses_defaults(void) {
+    NotecardCadence cadence;
+    cadenceCompute(NULL, &cadence);
+    TEST_ASSERT_EQUAL_STRING("continuous", cadence.hubMode);
+    cadenceAddHubSet(NULL, &cadence);
+    cadenceAddLocationMode(s_req, NULL);
+    TEST_ASSERT_EQUAL_UINT8(0, s_req->count);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_transit_syncs_at_sync_interval);
+    RUN_TEST(test_demo_stays_continuous);
+    RUN_TEST(test_storage_honours_floor);
+    RUN_TEST(test_storage_longer_interval_honoured);
+    RUN_TEST(test_sleep_is_minimum);
+    RUN_TEST(test_low_battery_stretches_sync);
+    RUN_TEST(test_cadence_records_scale);
+
+    RUN_TEST(test_transit_gps_at_gps_interval);
+    RUN_TEST(test_gps_off_outside_transit);
+    RUN_TEST(test_gps_not_stretched_by_power_policy);
+
+    RUN_TEST(test_sync_interval_change_moves_hub_only);
+    RUN_TEST(test_gps_interval_change_moves_gps_only);
+    RUN_TEST(test_interval_change_in_demo_is_not_a_change);
+    RUN_TEST(test_null_config_uses_defaults);
+
+    return UNITY_END();
+}
@@ -2,79 +2,16 @@
  * @file test_commands.cpp
  * @brief Native tests for command parsing and melody lookup logic
  *
- * Re-implements the pure lookup functions from SongbirdCommands.cpp
- * to avoid pulling in hardware dependencies.
+ * Tests the lookup functions from SongbirdCommandTable.cpp, the part of
+ * the command module with no hardware dependencies.
  */
 
 #include <unity.h>
 #include "native_stubs.h"
 #include "SongbirdConfig.h"
 
-// =============================================================================
-// Local type and data definitions (copied from firmware to avoid hardware deps)
-// =============================================================================
-
-// Audio event types (from SongbirdSync.h, which pulls in FreeRTOS)
-typedef enum {
-    AUDIO_EVENT_POWER_ON = 0,
-    AUDIO_EVENT_CONNECTED,
-    AUDIO_EVENT_GPS_LOCK,
-    AUDIO_EVENT_TEMP_ALERT,
-    AUDIO_EVENT_HUMIDITY_ALERT,
-    AUDIO_EVENT_LOW_BATTERY,
-    AUDIO_EVENT_SLEEP,
-    AUDIO_EVENT_ERROR,
-    AUDIO_EVENT_PING,
-    AUDIO_EVENT_LOCATE_START,
-    AUDIO_EVENT_LOCATE_STOP,
-    AUDIO_EVENT_CUSTOM_TONE,
-    AUDIO_EVENT_TRANSIT_LOCK_ON,
-    AUDIO_EVENT_TRANSIT_LOCK_OFF,
-    AUDIO_EVENT_DEMO_LOCK_ON,
-    AUDIO_EVENT_DEMO_LOCK_OFF,
-    AUDIO_EVENT_COUNT
-} AudioEventType;
-
-// Command names (from SongbirdCommands.cpp)
-static const char* const COMMAND_NAMES[] = {
-    "ping", "locate", "play_melody", "test_audio", "set_volume", "unlock", "unknown"
-};
-
-static CommandType commandsParseType(const char* name) {
-    if (name == NULL) return CMD_UNKNOWN;
-    for (int i = 0; i < CMD_UNKNOWN; i++) {
-        if (strcmp(name, COMMAND_NAMES[i]) == 0) return (CommandType)i;
-    }
-    return CMD_UNKNOWN;
-}
-
-static const char* commandsGetTypeName(CommandType type) {
-    if (type <= CMD_UNKNOWN) return COMMAND_NAMES[type];
-    return COMMAND_NAMES[CMD_UNKNOWN];
-}
-
-// Melody mappings (from SongbirdCommands.cpp)
-typedef struct { const char* name; AudioEventType event; } MelodyMapping;
-
-static const MelodyMapping MELODY_MAPPINGS[] = {
-    {"connected", AUDIO_EVENT_CONNECTED},
-    {"power_on", AUDIO_EVENT_POWER_ON},
-    {"alert", AUDIO_EVENT_TEMP_ALERT},
-    {"ping", AUDIO_EVENT_PING},
-    {"error", AUDIO_EVENT_ERROR},
-    {"low_battery", AUDIO_EVENT_LOW_BATTERY},
-    {"gps_lock", AUDIO_EVENT_GPS_LOCK},
-    {"sleep", AUDIO_EVENT_SLEEP},
-    {NULL, AUDIO_EVENT_ERROR}
-};
-
-static AudioEventType commandsGetMelodyEvent(const char* name) {
-    if (name == NULL) return AUDIO_EVENT_ERROR;
-    for (const MelodyMapping* m = MELODY_MAPPINGS; m->name != NULL; m++) {
-        if (strcmp(name, m->name) == 0) return m->event;
-    }
-    return AUDIO_EVENT_ERROR;
-}
+// The tables are pure; compile the real module (test_build_src = false)
+#include "SongbirdCommandTable.cpp"
 
 // =============================================================================
 // Test Setup / Teardown
@@ -111,6 +48,14 @@ void test_parse_type_unlock(void) {
     TEST_ASSERT_EQUAL(CMD_UNLOCK, commandsParseType("unlock"));
 }
 
+void test_parse_type_profile(void) {
+    TEST_ASSERT_EQUAL(CMD_PROFILE, commandsParseType("profile"));
+}
+
+void test_parse_type_transcript(void) {
+    TEST_ASSERT_EQUAL(CMD_TRANSCRIPT, commandsParseType("transcript"));
+}
+
 void test_parse_type_null_returns_unknown(void) {
     TEST_ASSERT_EQUAL(CMD_UNKNOWN, commandsParseType(NULL));
 }
@@ -197,6 +142,8 @@ int main(int argc, char **argv) {
     RUN_TEST(test_parse_type_test_audio);
     RUN_TEST(test_parse_type_set_volume);
     RUN_TEST(test_parse_type_unlock);
+    RUN_TEST(test_parse_type_profile);
+    RUN_TEST(test_parse_type_transcript);
     RUN_TEST(test_parse_type_null_returns_unknown);
     RUN_TEST(test_parse_type_bogus_returns_unknown);
 
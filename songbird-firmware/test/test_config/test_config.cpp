@@ -35,7 +35,9 @@ void test_command_type_enum_values(void) {
     TEST_ASSERT_EQUAL(3, CMD_TEST_AUDIO);
     TEST_ASSERT_EQUAL(4, CMD_SET_VOLUME);
     TEST_ASSERT_EQUAL(5, CMD_UNLOCK);
-    TEST_ASSERT_EQUAL(6, CMD_UNKNOWN);
+    TEST_ASSERT_EQUAL(6, CMD_PROFILE);
+    TEST_ASSERT_EQUAL(7, CMD_TRANSCRIPT);
+    TEST_ASSERT_EQUAL(8, CMD_UNKNOWN);
 }
 
 // ============================================================================
@@ -175,6 +177,17 @@ void test_sensor_interval_transit_less_than_storage(void) {
     TEST_ASSERT_TRUE(SENSOR_INTERVAL_TRANSIT_MS <= SENSOR_INTERVAL_STORAGE_MS);
 }
 
+void test_status_poll_slows_in_low_power_modes(void) {
+    TEST_ASSERT_TRUE(STATUS_POLL_DEMO_MS <= STATUS_POLL_TRANSIT_MS);
+    TEST_ASSERT_TRUE(STATUS_POLL_TRANSIT_MS <= STATUS_POLL_IDLE_MS);
+}
+
+void test_connect_backoff_bounds(void) {
+    TEST_ASSERT_TRUE(CONNECT_POLL_MIN_MS > 0);
+    TEST_ASSERT_TRUE(CONNECT_POLL_MIN_MS <= CONNECT_POLL_MAX_MS);
+    TEST_ASSERT_TRUE(CONNECT_POLL_MAX_MS < NOTEHUB_CONNECT_TIMEOUT_MS);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -222,6 +235,8 @@ int main(int argc, char **argv) {
     // Sensor intervals
     RUN_TEST(test_sensor_interval_demo_less_than_storage);
     RUN_TEST(test_sensor_interval_transit_less_than_storage);
+    RUN_TEST(test_status_poll_slows_in_low_power_modes);
+    RUN_TEST(test_connect_backoff_bounds);
 
     return UNITY_END();
 }
@@ -0,0 +1,163 @@
+/**
+ * @file test_config_store.cpp
+ * @brief Unit tests for the lock-free published configuration
+ *
+ * Tests publication, generations, refresh-on-change and reads racing a
+ * publication in progress from SongbirdConfigStore.cpp using PlatformIO
+ * Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The store has no FreeRTOS dependencies; compile the real module (test_build_src = false)
+#include "SongbirdConfigStore.cpp"
+
+static SongbirdConfig s_config;
+
+static void makeConfig(SongbirdConfig* config, OperatingMode mode, uint16_t syncMin) {
+    memset(config, 0, sizeof(SongbirdConfig));
+    config->mode = mode;
+    config->syncIntervalMin = syncMin;
+    config->gpsIntervalMin = syncMin / 3;
+}
+
+void setUp(void) {
+    configStoreInit();
+    memset(&s_config, 0, sizeof(s_config));
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Publication
+// ============================================================================
+
+void test_empty_store_reads_nothing(void) {
+    s_config.syncIntervalMin = 99;
+    TEST_ASSERT_EQUAL_UINT32(0, configStoreGeneration());
+    TEST_ASSERT_EQUAL_UINT32(0, configStoreRead(&s_config));
+    TEST_ASSERT_EQUAL_UINT16(99, s_config.syncIntervalMin);
+}
+
+void test_publish_then_read(void) {
+    SongbirdConfig published;
+    makeConfig(&published, MODE_TRANSIT, 30);
+    configStorePublish(&published);
+
+    TEST_ASSERT_EQUAL_UINT32(1, configStoreRead(&s_config));
+    TEST_ASSERT_EQUAL_MEMORY(&published, &s_config, sizeof(SongbirdConfig));
+}
+
+void test_generation_advances_per_publish(void) {
+    SongbirdConfig published;
+    for (uint16_t i = 1; i <= 5; i++) {
+        makeConfig(&published, MODE_STORAGE, i * 10);
+        configStorePublish(&published);
+        TEST_ASSERT_EQUAL_UINT32(i, configStoreGeneration());
+    }
+    configStoreRead(&s_config);
+    TEST_ASSERT_EQUAL_UINT16(50, s_config.syncIntervalMin);
+}
+
+void test_publish_null_ignored(void) {
+    configStorePublish(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, configStoreGeneration());
+    TEST_ASSERT_EQUAL_UINT32(0, configStoreRead(NULL));
+}
+
+// ============================================================================
+// Refresh
+// ============================================================================
+
+void test_refresh_copies_only_on_change(void) {
+    SongbirdConfig published;
+    uint32_t generation = 0;
+    makeConfig(&published, MODE_TRANSIT, 15);
+    configStorePublish(&published);
+
+    TEST_ASSERT_TRUE(configStoreRefresh(&s_config, &generation));
+    TEST_ASSERT_EQUAL_UINT32(1, generation);
+
+    // Local edits survive while nothing new is published
+    s_config.syncIntervalMin = 1234;
+    TEST_ASSERT_FALSE(configStoreRefresh(&s_config, &generation));
+    TEST_ASSERT_EQUAL_UINT16(1234, s_config.syncIntervalMin);
+
+    makeConfig(&published, MODE_TRANSIT, 45);
+    configStorePublish(&published);
+    TEST_ASSERT_TRUE(configStoreRefresh(&s_config, &generation));
+    TEST_ASSERT_EQUAL_UINT16(45, s_config.syncIntervalMin);
+    TEST_ASSERT_EQUAL_UINT32(2, generation);
+}
+
+void test_refresh_before_publish(void) {
+    uint32_t generation = 0;
+    TEST_ASSERT_FALSE(configStoreRefresh(&s_config, &generation));
+    TEST_ASSERT_EQUAL_UINT32(0, generation);
+    TEST_ASSERT_FALSE(configStoreRefresh(NULL, &generation));
+    TEST_ASSERT_FALSE(configStoreRefresh(&s_config, NULL));
+}
+
+// ============================================================================
+// Concurrent Publication
+// ============================================================================
+
+void test_publication_in_progress_not_visible(void) {
+    SongbirdConfig published;
+    makeConfig(&published, MODE_DEMO, 60);
+    configStorePublish(&published);
+
+    // Writer preempted halfway through filling the next buffer
+    memset(&s_buffers[(configStoreGeneration() + 1) & 1], 0xA5, sizeof(SongbirdConfig) / 2);
+
+    TEST_ASSERT_EQUAL_UINT32(1, configStoreRead(&s_config));
+    TEST_ASSERT_EQUAL_MEMORY(&published, &s_config, sizeof(SongbirdConfig));
+}
+
+void test_alternates_buffers(void) {
+    SongbirdConfig first;
+    SongbirdConfig second;
+    makeConfig(&first, MODE_TRANSIT, 30);
+    makeConfig(&second, MODE_STORAGE, 90);
+    configStorePublish(&first);
+    configStorePublish(&second);
+
+    // The previous generation stays intact in the idle buffer
+    TEST_ASSERT_EQUAL_MEMORY(&first, &s_buffers[1], sizeof(SongbirdConfig));
+    TEST_ASSERT_EQUAL_MEMORY(&second, &s_buffers[0], sizeof(SongbirdConfig));
+}
+
+void test_generation_wrap_skips_zero(void) {
+    SongbirdConfig published;
+    makeConfig(&published, MODE_TRANSIT, 30);
+    s_generation = UINT32_MAX;
+    configStorePublish(&published);
+
+    TEST_ASSERT_EQUAL_UINT32(2, configStoreGeneration());
+    TEST_ASSERT_EQUAL_UINT32(2, configStoreRead(&s_config));
+    TEST_ASSERT_EQUAL_UINT16(30, s_config.syncIntervalMin);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_store_reads_nothing);
+    RUN_TEST(test_publish_then_read);
+    RUN_TEST(test_generation_advances_per_publish);
+    RUN_TEST(test_publish_null_ignored);
+
+    RUN_TEST(test_refresh_copies_only_on_change);
+    RUN_TEST(test_refresh_before_publish);
+
+    RUN_TEST(test_publication_in_progress_not_visible);
+    RUN_TEST(test_alternates_buffers);
+    RUN_TEST(test_generation_wrap_skips_zero);
+
+    return UNITY_END();
+}
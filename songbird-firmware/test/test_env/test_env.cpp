@@ -0,0 +1,167 @@
+/**
+ * @file test_env.cpp
+ * @brief Unit tests for environment variable parsing
+ *
+ * Tests the env var table, value parsing and clamping, mode presets and
+ * the config comparison from SongbirdEnvParse.cpp using PlatformIO Unity on
+ * the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// Parsing is pure; compile the real module (test_build_src = false)
+#include "SongbirdEnvParse.cpp"
+
+static SongbirdConfig s_config;
+
+void setUp(void) {
+    envInitDefaults(&s_config);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Variable Table
+// ============================================================================
+
+void test_table_in_fetch_order(void) {
+    TEST_ASSERT_EQUAL_STRING(ENV_MODE, envVarName(0));
+    TEST_ASSERT_EQUAL_STRING(ENV_GPS_INTERVAL_MIN, envVarName(1));
+
+    uint8_t count = 0;
+    while (envVarName(count) != NULL) {
+        count++;
+    }
+    TEST_ASSERT_EQUAL_UINT8(27, count);
+    TEST_ASSERT_EQUAL_STRING(ENV_POWER_POLICY_MAX_SCALE, envVarName(count - 1));
+}
+
+void test_unknown_variable_ignored(void) {
+    SongbirdConfig before = s_config;
+    TEST_ASSERT_FALSE(envApplyVar(&s_config, "bogus", "1"));
+    TEST_ASSERT_FALSE(envApplyVar(&s_config, NULL, "1"));
+    TEST_ASSERT_FALSE(envApplyVar(&s_config, ENV_AUDIO_VOLUME, NULL));
+    TEST_ASSERT_FALSE(envConfigChanged(&before, &s_config));
+}
+
+// ============================================================================
+// Value Parsing
+// ============================================================================
+
+void test_integer_clamped_to_range(void) {
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_GPS_INTERVAL_MIN, "5000"));
+    TEST_ASSERT_EQUAL_UINT16(1440, s_config.gpsIntervalMin);
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_LOCATE_DURATION_SEC, "1"));
+    TEST_ASSERT_EQUAL_UINT16(5, s_config.locateDurationSec);
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_AUDIO_VOLUME, "42"));
+    TEST_ASSERT_EQUAL_UINT8(42, s_config.audioVolume);
+}
+
+void test_negative_integer_ignored(void) {
+    uint8_t volume = s_config.audioVolume;
+    TEST_ASSERT_FALSE(envApplyVar(&s_config, ENV_AUDIO_VOLUME, "-5"));
+    TEST_ASSERT_EQUAL_UINT8(volume, s_config.audioVolume);
+}
+
+void test_float_clamped_to_range(void) {
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_TEMP_ALERT_HIGH_C, "31.5"));
+    TEST_ASSERT_EQUAL_FLOAT(31.5f, s_config.tempAlertHighC);
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_VOLTAGE_ALERT_LOW, "2.0"));
+    TEST_ASSERT_EQUAL_FLOAT(3.3f, s_config.voltageAlertLow);
+    TEST_ASSERT_FALSE(envApplyVar(&s_config, ENV_VOLTAGE_ALERT_LOW, "nan"));
+}
+
+void test_bool_true_or_one(void) {
+    TEST_ASSERT_TRUE(envApplyVar(&s_config, ENV_LED_ENABLED, "true"));
+    TEST_ASSERT_TRUE(s_config.ledEnabled);
+    envApplyVar(&s_config, ENV_LED_ENABLED, "yes");
+    TEST_ASSERT_FALSE(s_config.ledEnabled);
+    envApplyVar(&s_config, ENV_LED_ENABLED, "1");
+    TEST_ASSERT_TRUE(s_config.ledEnabled);
+}
+
+void test_mode_and_sensitivity_by_name(void) {
+    envApplyVar(&s_config, ENV_MODE, "storage");
+    TEST_ASSERT_EQUAL(MODE_STORAGE, s_config.mode);
+    envApplyVar(&s_config, ENV_MODE, "warp");
+    TEST_ASSERT_EQUAL(DEFAULT_MODE, s_config.mode);
+    envApplyVar(&s_config, ENV_MOTION_SENSITIVITY, "high");
+    TEST_ASSERT_EQUAL(MOTION_SENSITIVITY_HIGH, s_config.motionSensitivity);
+    TEST_ASSERT_EQUAL_STRING("storage", envGetModeName(MODE_STORAGE));
+}
+
+// ============================================================================
+// Comparison
+// ============================================================================
+
+void test_config_changed_detects_field(void) {
+    SongbirdConfig other = s_config;
+    TEST_ASSERT_FALSE(envConfigChanged(&s_config, &other));
+    envApplyVar(&other, ENV_POWER_POLICY_MAX_SCALE, "7");
+    TEST_ASSERT_TRUE(envConfigChanged(&s_config, &other));
+    TEST_ASSERT_TRUE(envConfigChanged(&s_config, NULL));
+}
+
+void test_mode_preset(void) {
+    envApplyModePreset(&s_config, MODE_TRANSIT);
+    TEST_ASSERT_EQUAL(MODE_TRANSIT, s_config.mode);
+    TEST_ASSERT_EQUAL_UINT16(5, s_config.gpsIntervalMin);
+    TEST_ASSERT_EQUAL_UINT16(15, s_config.syncIntervalMin);
+}
+
+// ============================================================================
+// Env Polling
+// ============================================================================
+
+void test_env_poll_is_slow_with_attn_source(void) {
+    // Demo: NotecardTask posts ATTN_EVENT_ENV after each sync; sleep: env wake
+    s_config.mode = MODE_DEMO;
+    TEST_ASSERT_EQUAL_UINT32(ENV_SAFETY_POLL_MS, envGetEnvPollIntervalMs(&s_config));
+    s_config.mode = MODE_SLEEP;
+    TEST_ASSERT_EQUAL_UINT32(ENV_SAFETY_POLL_MS, envGetEnvPollIntervalMs(&s_config));
+}
+
+void test_env_poll_is_short_without_attn_source(void) {
+    s_config.mode = MODE_TRANSIT;
+    TEST_ASSERT_EQUAL_UINT32(ENV_POLL_TRANSIT_MS, envGetEnvPollIntervalMs(&s_config));
+    s_config.mode = MODE_STORAGE;
+    TEST_ASSERT_EQUAL_UINT32(ENV_POLL_STORAGE_MS, envGetEnvPollIntervalMs(&s_config));
+
+    // No slower than the command poll in the same mode
+    s_config.mode = MODE_TRANSIT;
+    TEST_ASSERT_TRUE(envGetEnvPollIntervalMs(&s_config) <= envGetCommandPollIntervalMs(&s_config));
+    s_config.mode = MODE_STORAGE;
+    TEST_ASSERT_TRUE(envGetEnvPollIntervalMs(&s_config) <= envGetCommandPollIntervalMs(&s_config));
+}
+
+void test_env_poll_without_config(void) {
+    TEST_ASSERT_EQUAL_UINT32(ENV_SAFETY_POLL_MS, envGetEnvPollIntervalMs(NULL));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_table_in_fetch_order);
+    RUN_TEST(test_unknown_variable_ignored);
+
+    RUN_TEST(test_integer_clamped_to_range);
+    RUN_TEST(test_negative_integer_ignored);
+    RUN_TEST(test_float_clamped_to_range);
+    RUN_TEST(test_bool_true_or_one);
+    RUN_TEST(test_mode_and_sensitivity_by_name);
+
+    RUN_TEST(test_config_changed_detects_field);
+    RUN_TEST(test_mode_preset);
+
+    RUN_TEST(test_env_poll_is_slow_with_attn_source);
+    RUN_TEST(test_env_poll_is_short_without_attn_source);
+    RUN_TEST(test_env_poll_without_config);
+
+    return UNITY_END();
+}
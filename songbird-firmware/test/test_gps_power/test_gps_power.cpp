@@ -0,0 +1,217 @@
+/**
+ * @file test_gps_power.cpp
+ * @brief Unit tests for GPS signal-timeout power management
+ *
+ * Tests the timeout and retry state machine from SongbirdGpsPower.cpp,
+ * including across the millis() wrap, using PlatformIO Unity on the native
+ * platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The state machine is pure; compile the real module (test_build_src = false)
+#include "SongbirdGpsPower.cpp"
+
+static SongbirdConfig s_config;
+static GpsPowerState s_gps;
+
+void setUp(void) {
+    memset(&s_config, 0, sizeof(s_config));
+    s_config.gpsSignalTimeoutMin = 15;
+    s_config.gpsRetryIntervalMin = 30;
+    memset(&s_gps, 0, sizeof(s_gps));
+}
+
+void tearDown(void) {}
+
+static GpsPowerAction check(bool active, bool signal, bool lock, uint32_t nowMs) {
+    GpsPowerInputs inputs;
+    inputs.active = active;
+    inputs.signal = signal;
+    inputs.lock = lock;
+    return gpsPowerUpdate(&s_gps, &s_config, &inputs, nowMs);
+}
+
+// ============================================================================
+// Signal Timeout
+// ============================================================================
+
+void test_timing_starts_when_active_without_signal(void) {
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(false, false, false, 1000));
+    TEST_ASSERT_EQUAL(GPS_POWER_TIMING, check(true, false, false, 2000));
+    TEST_ASSERT_EQUAL_UINT32(2000, s_gps.activeStartMs);
+    TEST_ASSERT_TRUE(s_gps.wasActive);
+}
+
+void test_disable_after_timeout(void) {
+    check(true, false, false, 1000);
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(true, false, false, 1000 + MINUTES_TO_MS(15) - 1));
+    TEST_ASSERT_EQUAL(GPS_POWER_DISABLE, check(true, false, false, 1000 + MINUTES_TO_MS(15)));
+
+    // Not applied (request failed): asked again at the next check
+    TEST_ASSERT_EQUAL(GPS_POWER_DISABLE, check(true, false, false, 2000 + MINUTES_TO_MS(15)));
+    gpsPowerApplied(&s_gps, GPS_POWER_DISABLE, 2000 + MINUTES_TO_MS(15));
+    TEST_ASSERT_TRUE(s_gps.saving);
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.activeStartMs);
+}
+
+void test_signal_clears_timeout(void) {
+    check(true, false, false, 1000);
+    TEST_ASSERT_EQUAL(GPS_POWER_SIGNAL, check(true, true, false, 5000));
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.activeStartMs);
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(true, true, false, MINUTES_TO_MS(20)));
+}
+
+void test_signal_lost_restarts_timeout(void) {
+    // Powered up with a signal, then lost it: still times out
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(true, true, false, 1000));
+    TEST_ASSERT_EQUAL(GPS_POWER_TIMING, check(true, false, false, 20000));
+    TEST_ASSERT_EQUAL(GPS_POWER_DISABLE, check(true, false, false, 20000 + MINUTES_TO_MS(15)));
+}
+
+void test_inactive_clears_timeout(void) {
+    check(true, false, false, 1000);
+    TEST_ASSERT_EQUAL(GPS_POWER_INACTIVE, check(false, false, false, 5000));
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.activeStartMs);
+}
+
+// ============================================================================
+// Retry
+// ============================================================================
+
+void test_retry_after_interval(void) {
+    s_gps.saving = true;
+    s_gps.lastRetryMs = 5000;
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(false, false, false, 5000 + MINUTES_TO_MS(30) - 1));
+    TEST_ASSERT_EQUAL(GPS_POWER_RETRY, check(false, false, false, 5000 + MINUTES_TO_MS(30)));
+    gpsPowerApplied(&s_gps, GPS_POWER_RETRY, 5000 + MINUTES_TO_MS(30));
+    TEST_ASSERT_FALSE(s_gps.saving);
+    TEST_ASSERT_EQUAL_UINT32(5000 + MINUTES_TO_MS(30), s_gps.lastRetryMs);
+}
+
+void test_applied_ignores_other_actions(void) {
+    s_gps.activeStartMs = 1234;
+    gpsPowerApplied(&s_gps, GPS_POWER_SIGNAL, 9999);
+    TEST_ASSERT_EQUAL_UINT32(1234, s_gps.activeStartMs);
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.lastRetryMs);
+}
+
+// ============================================================================
+// millis() Wrap
+// ============================================================================
+
+void test_timeout_across_wrap(void) {
+    uint32_t start = UINT32_MAX - MINUTES_TO_MS(5);
+    check(true, false, false, start);
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(true, false, false, start + MINUTES_TO_MS(10)));
+    TEST_ASSERT_EQUAL(GPS_POWER_DISABLE, check(true, false, false, start + MINUTES_TO_MS(15)));
+}
+
+void test_timing_started_at_zero(void) {
+    // A start exactly on the wrap must not read as "not timing"
+    TEST_ASSERT_EQUAL(GPS_POWER_TIMING, check(true, false, false, 0));
+    TEST_ASSERT_NOT_EQUAL(0, s_gps.activeStartMs);
+    TEST_ASSERT_EQUAL(GPS_POWER_DISABLE, check(true, false, false, MINUTES_TO_MS(15) + 1));
+}
+
+void test_retry_across_wrap(void) {
+    s_gps.saving = true;
+    s_gps.lastRetryMs = UINT32_MAX - 1000;
+    TEST_ASSERT_EQUAL(GPS_POWER_NONE, check(false, false, false, 5000));
+    TEST_ASSERT_EQUAL(GPS_POWER_RETRY, check(false, false, false, MINUTES_TO_MS(30)));
+}
+
+// ============================================================================
+// Mode Changes and Warm Boot
+// ============================================================================
+
+void test_leaving_transit_resets_state(void) {
+    check(true, false, false, 1000);
+    check(true, false, false, 1000 + MINUTES_TO_MS(15));
+    gpsPowerApplied(&s_gps, GPS_POWER_DISABLE, 1000 + MINUTES_TO_MS(15));
+    TEST_ASSERT_TRUE(s_gps.saving);
+
+    TEST_ASSERT_TRUE(gpsPowerModeChanged(&s_gps, MODE_TRANSIT, MODE_STORAGE));
+    TEST_ASSERT_FALSE(s_gps.saving);
+    TEST_ASSERT_FALSE(s_gps.wasActive);
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.activeStartMs);
+    TEST_ASSERT_EQUAL_UINT32(0, s_gps.lastRetryMs);
+}
+
+void test_entering_transit_starts_fresh(void) {
+    s_gps.saving = true;
+    s_gps.lastRetryMs = 5000;
+    TEST_ASSERT_TRUE(gpsPowerModeChanged(&s_gps, MODE_DEMO, MODE_TRANSIT));
+    TEST_ASSERT_FALSE(s_gps.saving);
+    TEST_ASSERT_TRUE(gpsPowerIsEnabled(&s_gps, MODE_TRANSIT));
+}
+
+void test_other_mode_changes_keep_state(void) {
+    s_gps.lastRetryMs = 5000;
+    TEST_ASSERT_FALSE(gpsPowerModeChanged(&s_gps, MODE_DEMO, MODE_STORAGE));
+    TEST_ASSERT_FALSE(gpsPowerModeChanged(&s_gps, MODE_STORAGE, MODE_SLEEP));
+    TEST_ASSERT_FALSE(gpsPowerModeChanged(&s_gps, MODE_TRANSIT, MODE_TRANSIT));
+    TEST_ASSERT_EQUAL_UINT32(5000, s_gps.lastRetryMs);
+}
+
+void test_warm_boot_gps_off_outside_transit(void) {
+    // A storage or sleep mode wake must not poll card.location
+    const OperatingMode modes[] = { MODE_DEMO, MODE_STORAGE, MODE_SLEEP };
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_FALSE(gpsPowerIsEnabled(&s_gps, modes[i]));
+    }
+}
+
+void test_warm_boot_gps_in_transit(void) {
+    TEST_ASSERT_TRUE(gpsPowerIsEnabled(&s_gps, MODE_TRANSIT));
+
+    // Turned off by the signal timeout before the sleep: still off
+    s_gps.saving = true;
+    TEST_ASSERT_FALSE(gpsPowerIsEnabled(&s_gps, MODE_TRANSIT));
+}
+
+void test_fix_age_is_wall_clock_across_warm_boot(void) {
+    // Fix an hour before the sleep; millis() restarts after the wake
+    uint32_t fixEpoch = 1700000000;
+    mock_set_millis(2000);
+    TEST_ASSERT_EQUAL_UINT32(5400, gpsPowerFixAgeSec(fixEpoch, fixEpoch + 5400));
+}
+
+void test_fix_age_unknown(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, gpsPowerFixAgeSec(0, 1700000000));
+    TEST_ASSERT_EQUAL_UINT32(0, gpsPowerFixAgeSec(1700000000, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, gpsPowerFixAgeSec(1700000000, 1699999999));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_timing_starts_when_active_without_signal);
+    RUN_TEST(test_disable_after_timeout);
+    RUN_TEST(test_signal_clears_timeout);
+    RUN_TEST(test_signal_lost_restarts_timeout);
+    RUN_TEST(test_inactive_clears_timeout);
+
+    RUN_TEST(test_retry_after_interval);
+    RUN_TEST(test_applied_ignores_other_actions);
+
+    RUN_TEST(test_timeout_across_wrap);
+    RUN_TEST(test_timing_started_at_zero);
+    RUN_TEST(test_retry_across_wrap);
+
+    RUN_TEST(test_leaving_transit_resets_state);
+    RUN_TEST(test_entering_transit_starts_fresh);
+    RUN_TEST(test_other_mode_changes_keep_state);
+    RUN_TEST(test_warm_boot_gps_off_outside_transit);
+    RUN_TEST(test_warm_boot_gps_in_transit);
+    RUN_TEST(test_fix_age_is_wall_clock_across_warm_boot);
+    RUN_TEST(test_fix_age_unknown);
+
+    return UNITY_END();
+}
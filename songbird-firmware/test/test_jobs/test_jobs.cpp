@@ -0,0 +1,748 @@
+/**
+ * @file test_jobs.cpp
+ * @brief Timer queue and job schedule tests, and a task vs. job scheduling
+ *        simulation
+ *
+ * Tests the deadline-ordered timer queue from SongbirdTimerQueue.cpp and
+ * JobsTask's schedule from SongbirdJobs.cpp, then simulates SIM_HOURS of
+ * each operating mode at millisecond resolution twice: with SensorTask,
+ * CommandTask and EnvTask as separate tasks, and with JOBS_MODE, where
+ * JobsTask runs the same work from one schedule.
+ *
+ * The jobs run is driven by the firmware's schedule: it pops due jobs and
+ * hands back each job's work result the way JobsTask's runJob() does, so
+ * the job timing, including the sensor's read job after the BME280
+ * conversion, is the real code's. Intervals and the conversion time are the
+ * firmware's too (env parsing and the sensor profiles); I2C costs are
+ * test_soak_model's stand-in figures. NotecardTask's status
+ * polls compete for the bus in both runs. Command and env ATTN events arrive
+ * at pseudo-random times. The power policy is at full rate.
+ *
+ * Prints a table and one machine-readable line:
+ *
+ *   JOBS {"hours":24,"demo":{"tasks":{..},"jobs":{..}},...,"stack_saved":..}
+ *
+ * with, per run: job runs, task wakes (switch-ins after blocking), start
+ * latency after the deadline (p50, p99, max), the longest ATTN event to poll
+ * latency, and the RAM the three jobs need for stacks and timers.
+ *
+ * Build with -D SIM_HOURS=n to change the length.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The modules under test are pure; compile the real ones (test_build_src = false)
+#include "SongbirdTimerQueue.cpp"
+#include "SongbirdJobs.cpp"
+#include "SongbirdEnvParse.cpp"
+#include "SongbirdBME280.cpp"
+
+static TimerQueue s_queue;
+
+void setUp(void) {
+    timerQueueInit(&s_queue);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Ordering
+// ============================================================================
+
+void test_pops_in_deadline_order(void) {
+    timerQueueArm(&s_queue, 0, 300);
+    timerQueueArm(&s_queue, 1, 100);
+    timerQueueArm(&s_queue, 2, 200);
+    TEST_ASSERT_EQUAL_UINT8(3, timerQueueCount(&s_queue));
+
+    uint8_t id;
+    uint32_t deadline;
+    TEST_ASSERT_FALSE(timerQueuePopDue(&s_queue, 99, &id, &deadline));
+
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, &deadline));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+    TEST_ASSERT_EQUAL_UINT32(100, deadline);
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, &deadline));
+    TEST_ASSERT_EQUAL_UINT8(2, id);
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, id);
+    TEST_ASSERT_FALSE(timerQueuePopDue(&s_queue, 1000, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, timerQueueCount(&s_queue));
+}
+
+void test_equal_deadlines_are_fifo(void) {
+    timerQueueArm(&s_queue, 2, 50);
+    timerQueueArm(&s_queue, 0, 50);
+    timerQueueArm(&s_queue, 1, 50);
+
+    uint8_t id;
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 50, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(2, id);
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 50, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, id);
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 50, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+}
+
+void test_rearm_moves_timer(void) {
+    timerQueueArm(&s_queue, 0, 100);
+    timerQueueArm(&s_queue, 1, 200);
+    timerQueueArm(&s_queue, 0, 300);     // Later
+    TEST_ASSERT_EQUAL_UINT8(2, timerQueueCount(&s_queue));
+
+    uint8_t id;
+    uint32_t deadline;
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, &deadline));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+
+    timerQueueArm(&s_queue, 1, 250);
+    timerQueueArm(&s_queue, 0, 10);      // Earlier
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, &deadline));
+    TEST_ASSERT_EQUAL_UINT8(0, id);
+    TEST_ASSERT_EQUAL_UINT32(10, deadline);
+}
+
+void test_cancel(void) {
+    timerQueueArm(&s_queue, 0, 100);
+    timerQueueArm(&s_queue, 1, 200);
+    TEST_ASSERT_TRUE(timerQueueIsArmed(&s_queue, 0));
+
+    timerQueueCancel(&s_queue, 0);
+    timerQueueCancel(&s_queue, 3);       // Not armed
+    TEST_ASSERT_FALSE(timerQueueIsArmed(&s_queue, 0));
+    TEST_ASSERT_TRUE(timerQueueIsArmed(&s_queue, 1));
+
+    uint8_t id;
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, 1000, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+}
+
+void test_rejects_bad_id(void) {
+    TEST_ASSERT_FALSE(timerQueueArm(&s_queue, TIMER_QUEUE_SIZE, 100));
+    TEST_ASSERT_FALSE(timerQueueArm(NULL, 0, 100));
+    TEST_ASSERT_EQUAL_UINT8(0, timerQueueCount(&s_queue));
+    TEST_ASSERT_FALSE(timerQueueIsArmed(&s_queue, TIMER_QUEUE_SIZE));
+}
+
+// ============================================================================
+// Waiting and millis() Wrap
+// ============================================================================
+
+void test_wait_ms(void) {
+    TEST_ASSERT_EQUAL_UINT32(5000, timerQueueWaitMs(&s_queue, 0, 5000));    // Nothing armed
+
+    timerQueueArm(&s_queue, 0, 1000);
+    TEST_ASSERT_EQUAL_UINT32(600, timerQueueWaitMs(&s_queue, 400, 5000));
+    TEST_ASSERT_EQUAL_UINT32(100, timerQueueWaitMs(&s_queue, 400, 100));    // Capped
+    TEST_ASSERT_EQUAL_UINT32(0, timerQueueWaitMs(&s_queue, 1000, 5000));
+    TEST_ASSERT_EQUAL_UINT32(0, timerQueueWaitMs(&s_queue, 9000, 5000));    // Overdue
+}
+
+void test_order_across_wrap(void) {
+    uint32_t now = UINT32_MAX - 50;
+    timerQueueArm(&s_queue, 0, now + 100);   // Wrapped: 49
+    timerQueueArm(&s_queue, 1, now + 20);    // Not yet wrapped
+
+    TEST_ASSERT_EQUAL_UINT32(20, timerQueueWaitMs(&s_queue, now, 5000));
+
+    uint8_t id;
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, now + 30, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+    TEST_ASSERT_FALSE(timerQueuePopDue(&s_queue, now + 30, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT32(70, timerQueueWaitMs(&s_queue, now + 30, 5000));
+    TEST_ASSERT_TRUE(timerQueuePopDue(&s_queue, now + 100, &id, NULL));
+    TEST_ASSERT_EQUAL_UINT8(0, id);
+}
+
+// ============================================================================
+// Job Schedule
+// ============================================================================
+
+static JobSchedule s_jobs;
+
+// Pop the next due job, asserting which one it is
+static uint32_t pop_job(uint32_t nowMs, uint8_t expected) {
+    uint8_t job;
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(jobsPopDue(&s_jobs, nowMs, &job, &deadline));
+    TEST_ASSERT_EQUAL_UINT8(expected, job);
+    return deadline;
+}
+
+void test_jobs_all_run_at_startup_in_order(void) {
+    jobsInit(&s_jobs);
+    jobsArmAll(&s_jobs, 100);
+    pop_job(100, JOB_SENSOR_START);
+    pop_job(100, JOB_COMMAND);
+    pop_job(100, JOB_ENV);
+
+    uint8_t job;
+    TEST_ASSERT_FALSE(jobsPopDue(&s_jobs, 100, &job, NULL));
+}
+
+void test_jobs_read_after_conversion(void) {
+    jobsInit(&s_jobs);
+    jobsArmAll(&s_jobs, 100);
+    uint32_t due = pop_job(100, JOB_SENSOR_START);
+    jobsFinished(&s_jobs, JOB_SENSOR_START, due, 40, 102);
+
+    // The other jobs run during the conversion
+    pop_job(102, JOB_COMMAND);
+    jobsFinished(&s_jobs, JOB_COMMAND, 100, 1000, 110);
+    pop_job(110, JOB_ENV);
+    jobsFinished(&s_jobs, JOB_ENV, 100, 60000, 116);
+    TEST_ASSERT_EQUAL_UINT32(27, jobsWaitMs(&s_jobs, 116, 5000));
+
+    pop_job(143, JOB_SENSOR_READ);
+}
+
+void test_jobs_continuous_profile_reads_at_once(void) {
+    jobsInit(&s_jobs);
+    jobsArmAll(&s_jobs, 100);
+    uint32_t due = pop_job(100, JOB_SENSOR_START);
+    jobsFinished(&s_jobs, JOB_SENSOR_START, due, 0, 101);
+
+    // Ahead of the command and env checks due before it
+    pop_job(101, JOB_COMMAND);
+    pop_job(101, JOB_ENV);
+    pop_job(101, JOB_SENSOR_READ);
+}
+
+void test_jobs_sensor_fixed_rate(void) {
+    jobsInit(&s_jobs);
+    timerQueueArm(&s_jobs.timers, JOB_SENSOR_START, 1000);
+    uint32_t due = pop_job(1030, JOB_SENSOR_START);     // Started late
+    jobsFinished(&s_jobs, JOB_SENSOR_START, due, 40, 1032);
+    jobsFinished(&s_jobs, JOB_SENSOR_READ, pop_job(1073, JOB_SENSOR_READ), 60000, 1091);
+
+    // A period after the reading was due, not after it started or ended
+    TEST_ASSERT_EQUAL_UINT32(1000 + 60000, s_jobs.timers.deadlineMs[JOB_SENSOR_START]);
+}
+
+void test_jobs_sensor_overrun_restarts_now(void) {
+    jobsInit(&s_jobs);
+    timerQueueArm(&s_jobs.timers, JOB_SENSOR_START, 1000);
+    jobsFinished(&s_jobs, JOB_SENSOR_START, pop_job(1000, JOB_SENSOR_START), 40, 1002);
+    jobsFinished(&s_jobs, JOB_SENSOR_READ, pop_job(1500, JOB_SENSOR_READ), 400, 1520);
+    pop_job(1520, JOB_SENSOR_START);
+}
+
+void test_jobs_sensor_off_checks_later(void) {
+    jobsInit(&s_jobs);
+    jobsArmAll(&s_jobs, 100);
+    jobsFinished(&s_jobs, JOB_SENSOR_START, pop_job(100, JOB_SENSOR_START), JOB_SENSOR_OFF, 101);
+    TEST_ASSERT_FALSE(timerQueueIsArmed(&s_jobs.timers, JOB_SENSOR_READ));
+    TEST_ASSERT_EQUAL_UINT32(101 + SLEEP_MODE_SENSOR_WAIT_MS,
+                             s_jobs.timers.deadlineMs[JOB_SENSOR_START]);
+}
+
+void test_jobs_polls_wait_after_finish(void) {
+    jobsInit(&s_jobs);
+    jobsRunNow(&s_jobs, JOB_COMMAND, 100);
+    jobsFinished(&s_jobs, JOB_COMMAND, pop_job(100, JOB_COMMAND), 1000, 108);
+    TEST_ASSERT_EQUAL_UINT32(1000, jobsWaitMs(&s_jobs, 108, 5000));
+
+    // An ATTN event brings it forward
+    jobsRunNow(&s_jobs, JOB_COMMAND, 500);
+    pop_job(500, JOB_COMMAND);
+}
+
+void test_jobs_rearm_drops_unread_conversion(void) {
+    jobsInit(&s_jobs);
+    jobsArmAll(&s_jobs, 100);
+    jobsFinished(&s_jobs, JOB_SENSOR_START, pop_job(100, JOB_SENSOR_START), 40, 102);
+
+    // Sleep cancelled: start a fresh reading
+    jobsArmAll(&s_jobs, 5000);
+    TEST_ASSERT_FALSE(timerQueueIsArmed(&s_jobs.timers, JOB_SENSOR_READ));
+    pop_job(5000, JOB_SENSOR_START);
+}
+
+// ============================================================================
+// Scheduling Simulation
+// ============================================================================
+
+#ifndef SIM_HOURS
+#define SIM_HOURS               24
+#endif
+
+// I2C time per request (test_soak_model's figures)
+#define SIM_BUS_START_MS        2       // BME280 forced-mode trigger
+#define SIM_BUS_SENSOR_MS       18      // BME280 read, card.voltage, card.time
+#define SIM_BUS_COMMAND_POLL_MS 8       // note.get
+#define SIM_BUS_STATUS_MS       10      // card.location (+ hub.sync.status)
+#define SIM_BUS_ENV_CHECK_MS    6       // env.modified
+
+// Inbound commands and env changes, each every 1 to 2x this on average
+#define SIM_ATTN_MEAN_MS        600000UL
+
+#define SIM_LATENCY_BINS        1000    // 1 ms bins; the last one collects the rest
+
+// JobsTask's JobId values, then NotecardTask's status poll, a separate task
+// in both runs
+#define SIM_JOB_STATUS          JOB_COUNT
+#define SIM_JOB_COUNT           (JOB_COUNT + 1)
+
+typedef enum { SIM_IDLE, SIM_BUS_WAIT, SIM_BUS, SIM_CONVERSION } SimPhase;
+
+// A task: JobsTask with the firmware's schedule, or a task that runs one
+// job in a loop the way SensorTask, CommandTask, EnvTask and NotecardTask do
+typedef struct {
+    uint8_t priority;
+    bool counted;               // Wakes count toward the result (not NotecardTask)
+    JobSchedule* jobs;          // JobsTask's schedule, NULL for a one-job task
+    uint8_t ownJob;             // One-job task: its job
+    uint32_t ownDueMs;          // One-job task: its next run
+    uint32_t sensorDueMs;       // SensorTask: deadline of the reading in progress
+    SimPhase phase;
+    bool awake;                 // Running, rather than blocked
+    uint8_t job;                // Running job
+    uint32_t deadlineMs;        // Of the running job
+    uint32_t requestMs;         // When it asked for the bus
+    uint32_t endMs;             // End of the bus transfer or conversion
+    bool started;               // First bus transfer of this run granted
+    uint8_t pendingAttn;        // ATTN events not yet seen (bit per job)
+} SimTask;
+
+typedef struct {
+    uint32_t runs;
+    uint32_t wakes;
+    uint32_t latency[SIM_LATENCY_BINS];
+    uint32_t latencyMaxMs;
+    uint32_t attnMaxMs;
+    uint32_t conversionMs;      // BME280 conversion for the mode's profile
+    uint32_t ramBytes;
+} SimResult;
+
+typedef struct {
+    SongbirdConfig config;
+    uint32_t conversionMs;
+    JobSchedule jobs;
+    SimTask tasks[SIM_JOB_COUNT];
+    uint8_t taskCount;
+    uint8_t owner[SIM_JOB_COUNT];       // Task running each job
+    uint32_t attnAtMs[SIM_JOB_COUNT];   // Oldest unserved ATTN event, 0 = none
+    uint32_t busFreeMs;
+    uint32_t seed;
+    SimResult* result;
+} SimState;
+
+static SimState s_sim;
+static SimResult s_results[3][2];
+
+static uint32_t sim_random(uint32_t limit) {
+    s_sim.seed = s_sim.seed * 1103515245u + 12345u;
+    return (s_sim.seed >> 8) % limit;
+}
+
+static uint32_t sim_bus_ms(uint8_t job) {
+    switch (job) {
+        case JOB_SENSOR_START: return s_sim.conversionMs > 0 ? SIM_BUS_START_MS : 0;
+        case JOB_SENSOR_READ:  return SIM_BUS_SENSOR_MS;
+        case JOB_COMMAND:      return SIM_BUS_COMMAND_POLL_MS;
+        case JOB_ENV:          return SIM_BUS_ENV_CHECK_MS;
+        default:               return SIM_BUS_STATUS_MS;
+    }
+}
+
+// What the job's work returns in SongbirdTasks.cpp (see jobsFinished())
+static uint32_t sim_work_result(uint8_t job) {
+    switch (job) {
+        case JOB_SENSOR_START:
+            return envGetSensorIntervalMs(&s_sim.config) == 0 ? JOB_SENSOR_OFF
+                                                               : s_sim.conversionMs;
+        case JOB_SENSOR_READ:
+            return envGetSensorIntervalMs(&s_sim.config);
+        case JOB_COMMAND: {
+            uint32_t interval = envGetCommandPollIntervalMs(&s_sim.config);
+            return interval > 0 ? interval : 1000;
+        }
+        case JOB_ENV:
+            return envGetEnvPollIntervalMs(&s_sim.config);
+        default:
+            return envGetStatusPollIntervalMs(&s_sim.config);
+    }
+}
+
+static void sim_wake(SimTask* task) {
+    if (!task->awake) {
+        task->awake = true;
+        if (task->counted) {
+            s_sim.result->wakes++;
+        }
+    }
+}
+
+static void sim_begin(SimTask* task, uint8_t job, uint32_t deadlineMs, uint32_t nowMs) {
+    task->job = job;
+    task->deadlineMs = deadlineMs;
+    task->started = false;
+    task->phase = SIM_BUS_WAIT;
+    task->requestMs = nowMs;
+}
+
+// A one-job task's loop after its job's bus work, as in SongbirdTasks.cpp
+static void sim_task_finished(SimTask* task, uint32_t result, uint32_t nowMs) {
+    switch (task->job) {
+        case JOB_SENSOR_START:
+            if (result == JOB_SENSOR_OFF) {
+                task->ownDueMs = nowMs + SLEEP_MODE_SENSOR_WAIT_MS;
+            } else if (result > 0) {
+                // vTaskDelay() through the conversion
+                task->sensorDueMs = task->deadlineMs;
+                task->phase = SIM_CONVERSION;
+                task->endMs = nowMs + result + 1;
+                task->awake = false;
+                return;
+            } else {
+                task->sensorDueMs = task->deadlineMs;
+                sim_begin(task, JOB_SENSOR_READ, nowMs, nowMs);
+                return;
+            }
+            break;
+        case JOB_SENSOR_READ:
+            if (MS_REACHED(nowMs, task->sensorDueMs + result)) {
+                task->ownDueMs = nowMs;
+            } else {
+                task->ownDueMs = task->sensorDueMs + result;
+            }
+            break;
+        default:
+            task->ownDueMs = nowMs + result;
+            break;
+    }
+    task->phase = SIM_IDLE;
+}
+
+static void sim_record_start(SimTask* task, uint32_t nowMs) {
+    uint32_t latency = nowMs - task->deadlineMs;
+    if (task->counted) {
+        s_sim.result->runs++;
+        s_sim.result->latency[latency < SIM_LATENCY_BINS ? latency : SIM_LATENCY_BINS - 1]++;
+        if (latency > s_sim.result->latencyMaxMs) {
+            s_sim.result->latencyMaxMs = latency;
+        }
+    }
+    uint32_t attnAt = s_sim.attnAtMs[task->job];
+    if (attnAt != 0) {
+        if (nowMs - attnAt > s_sim.result->attnMaxMs) {
+            s_sim.result->attnMaxMs = nowMs - attnAt;
+        }
+        s_sim.attnAtMs[task->job] = 0;
+    }
+}
+
+// Pick the task's next due job; false if none is due
+static bool sim_pop_due(SimTask* task, uint32_t nowMs, uint8_t* job, uint32_t* deadline) {
+    if (task->jobs != NULL) {
+        return jobsPopDue(task->jobs, nowMs, job, deadline);
+    }
+    if (!MS_REACHED(nowMs, task->ownDueMs)) {
+        return false;
+    }
+    *job = task->ownJob;
+    *deadline = task->ownDueMs;
+    return true;
+}
+
+// Advance one task at nowMs; true if its state changed
+static bool sim_step_task(SimTask* task, uint32_t nowMs) {
+    switch (task->phase) {
+        case SIM_IDLE: {
+            uint8_t job;
+            uint32_t deadline;
+            if (!sim_pop_due(task, nowMs, &job, &deadline)) {
+                if (task->pendingAttn == 0) {
+                    task->awake = false;    // Blocks until a deadline or event
+                    return false;
+                }
+                // The wait returns at once with the event; its job runs now
+                for (uint8_t j = 0; j < SIM_JOB_COUNT; j++) {
+                    if (task->pendingAttn & (1 << j)) {
+                        if (task->jobs != NULL) {
+                            jobsRunNow(task->jobs, j, nowMs);
+                        } else {
+                            task->ownDueMs = nowMs;
+                        }
+                    }
+                }
+                task->pendingAttn = 0;
+                sim_wake(task);
+                return true;
+            }
+            sim_wake(task);
+            sim_begin(task, job, deadline, nowMs);
+            return true;
+        }
+        case SIM_BUS: {
+            if (!MS_REACHED(nowMs, task->endMs)) {
+                return false;
+            }
+            uint32_t result = sim_work_result(task->job);
+            if (task->jobs != NULL) {
+                // The firmware's rules arm the next run
+                jobsFinished(task->jobs, task->job, task->deadlineMs, result, nowMs);
+                task->phase = SIM_IDLE;
+            } else {
+                sim_task_finished(task, result, nowMs);
+            }
+            return true;
+        }
+        case SIM_CONVERSION:
+            if (!MS_REACHED(nowMs, task->endMs)) {
+                return false;
+            }
+            sim_wake(task);
+            sim_begin(task, JOB_SENSOR_READ, nowMs, nowMs);
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Grant a free bus to the highest priority waiter (FreeRTOS mutex order)
+static bool sim_grant_bus(uint32_t nowMs) {
+    if (!MS_REACHED(nowMs, s_sim.busFreeMs)) {
+        return false;
+    }
+    SimTask* next = NULL;
+    for (uint8_t i = 0; i < s_sim.taskCount; i++) {
+        SimTask* task = &s_sim.tasks[i];
+        if (task->phase == SIM_BUS_WAIT &&
+            (next == NULL || task->priority > next->priority ||
+             (task->priority == next->priority &&
+              (int32_t)(task->requestMs - next->requestMs) < 0))) {
+            next = task;
+        }
+    }
+    if (next == NULL) {
+        return false;
+    }
+
+    if (next->requestMs != nowMs) {
+        // Blocked on the mutex, so this is another switch-in
+        next->awake = false;
+        sim_wake(next);
+    }
+    if (!next->started) {
+        next->started = true;
+        sim_record_start(next, nowMs);
+    }
+    next->phase = SIM_BUS;
+    next->endMs = nowMs + sim_bus_ms(next->job);
+    s_sim.busFreeMs = next->endMs;
+    return true;
+}
+
+static uint32_t sim_next_event(uint32_t nowMs, uint32_t nextAttnMs) {
+    uint32_t next = nextAttnMs;
+    for (uint8_t i = 0; i < s_sim.taskCount; i++) {
+        const SimTask* task = &s_sim.tasks[i];
+        uint32_t at;
+        switch (task->phase) {
+            case SIM_IDLE:
+                at = task->jobs != NULL
+                    ? nowMs + jobsWaitMs(task->jobs, nowMs, UINT32_MAX / 2)
+                    : task->ownDueMs;
+                break;
+            case SIM_BUS_WAIT:
+                at = s_sim.busFreeMs;
+                break;
+            default:
+                at = task->endMs;
+                break;
+        }
+        if ((int32_t)(at - nowMs) > 0 && (int32_t)(at - next) < 0) {
+            next = at;
+        }
+    }
+    return next;
+}
+
+static void sim_run(OperatingMode mode, bool jobsMode, SimResult* result) {
+    memset(&s_sim, 0, sizeof(s_sim));
+    memset(result, 0, sizeof(SimResult));
+    s_sim.result = result;
+    s_sim.seed = 12345 + mode;
+
+    envInitDefaults(&s_sim.config);
+    envApplyModePreset(&s_sim.config, mode);
+    const SensorProfile* profile = envGetSensorProfile(&s_sim.config);
+    s_sim.conversionMs = profile->continuous ? 0 : (bme280MeasureTimeUs(profile) + 999) / 1000;
+    result->conversionMs = s_sim.conversionMs;
+
+    static const uint8_t TASK_JOB[4] = {
+        JOB_SENSOR_START, JOB_COMMAND, JOB_ENV, SIM_JOB_STATUS
+    };
+    static const uint8_t TASK_PRIORITY[4] = {
+        PRIORITY_SENSOR, PRIORITY_COMMAND, PRIORITY_ENV, PRIORITY_NOTECARD
+    };
+    for (uint8_t i = 0; i < 4; i++) {
+        bool shared = jobsMode && TASK_JOB[i] != SIM_JOB_STATUS;
+        uint8_t index = shared ? 0 : s_sim.taskCount;
+        SimTask* task = &s_sim.tasks[index];
+        if (index == s_sim.taskCount) {
+            task->priority = shared ? PRIORITY_JOBS : TASK_PRIORITY[i];
+            task->counted = (TASK_JOB[i] != SIM_JOB_STATUS);
+            task->awake = true;
+            if (shared) {
+                // Every job runs at startup
+                task->jobs = &s_sim.jobs;
+                jobsInit(task->jobs);
+                jobsArmAll(task->jobs, 1);
+            } else {
+                task->ownJob = TASK_JOB[i];
+                task->ownDueMs = 1;
+            }
+            s_sim.taskCount++;
+        }
+        s_sim.owner[TASK_JOB[i]] = index;
+    }
+    s_sim.owner[JOB_SENSOR_READ] = s_sim.owner[JOB_SENSOR_START];
+
+    result->ramBytes = jobsMode
+        ? STACK_JOBS * sizeof(uint32_t) + sizeof(JobSchedule)
+        : (STACK_SENSOR + STACK_COMMAND + STACK_ENV) * sizeof(uint32_t);
+
+    uint32_t endMs = SIM_HOURS * 3600000UL;
+    uint32_t nextAttnMs = SIM_ATTN_MEAN_MS / 2 + sim_random(SIM_ATTN_MEAN_MS);
+    uint8_t attnJob = JOB_COMMAND;
+    uint32_t now = 1;
+
+    while ((int32_t)(now - endMs) < 0) {
+        if (now == nextAttnMs) {
+            // Wakes the task if it is waiting; otherwise seen at its next wait
+            SimTask* task = &s_sim.tasks[s_sim.owner[attnJob]];
+            task->pendingAttn |= (uint8_t)(1 << attnJob);
+            if (s_sim.attnAtMs[attnJob] == 0) {
+                s_sim.attnAtMs[attnJob] = now;
+            }
+            attnJob = (attnJob == JOB_COMMAND) ? JOB_ENV : JOB_COMMAND;
+            nextAttnMs = now + SIM_ATTN_MEAN_MS / 2 + sim_random(SIM_ATTN_MEAN_MS);
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (uint8_t i = 0; i < s_sim.taskCount; i++) {
+                changed |= sim_step_task(&s_sim.tasks[i], now);
+            }
+            changed |= sim_grant_bus(now);
+        }
+
+        now = sim_next_event(now, nextAttnMs);
+    }
+}
+
+static uint32_t sim_percentile(const SimResult* result, uint32_t permille) {
+    uint32_t target = (uint32_t)(((uint64_t)result->runs * permille + 999) / 1000);
+    uint32_t seen = 0;
+    for (uint32_t ms = 0; ms < SIM_LATENCY_BINS; ms++) {
+        seen += result->latency[ms];
+        if (seen >= target && seen > 0) {
+            return ms;
+        }
+    }
+    return SIM_LATENCY_BINS - 1;
+}
+
+static const char* const SIM_MODE_NAMES[3] = { "demo", "transit", "storage" };
+static const char* const SIM_MODEL_NAMES[2] = { "tasks", "jobs" };
+
+static void sim_report(void) {
+    char line[160];
+    TEST_MESSAGE("mode     model   runs    wakes    p50  p99  max  attn_max  ram_bytes");
+    for (uint8_t mode = 0; mode < 3; mode++) {
+        for (uint8_t model = 0; model < 2; model++) {
+            const SimResult* r = &s_results[mode][model];
+            snprintf(line, sizeof(line), "%-8s %-6s %6lu %8lu %5lu %4lu %4lu %9lu %10lu",
+                     SIM_MODE_NAMES[mode], SIM_MODEL_NAMES[model], (unsigned long)r->runs,
+                     (unsigned long)r->wakes, (unsigned long)sim_percentile(r, 500),
+                     (unsigned long)sim_percentile(r, 990), (unsigned long)r->latencyMaxMs,
+                     (unsigned long)r->attnMaxMs, (unsigned long)r->ramBytes);
+            TEST_MESSAGE(line);
+        }
+    }
+
+    printf("JOBS {\"hours\":%d", SIM_HOURS);
+    for (uint8_t mode = 0; mode < 3; mode++) {
+        printf(",\"%s\":{", SIM_MODE_NAMES[mode]);
+        for (uint8_t model = 0; model < 2; model++) {
+            const SimResult* r = &s_results[mode][model];
+            printf("%s\"%s\":{\"runs\":%lu,\"wakes\":%lu,\"p50_ms\":%lu,\"p99_ms\":%lu,"
+                   "\"max_ms\":%lu,\"attn_max_ms\":%lu,\"ram_bytes\":%lu}",
+                   model ? "," : "", SIM_MODEL_NAMES[model], (unsigned long)r->runs,
+                   (unsigned long)r->wakes, (unsigned long)sim_percentile(r, 500),
+                   (unsigned long)sim_percentile(r, 990), (unsigned long)r->latencyMaxMs,
+                   (unsigned long)r->attnMaxMs, (unsigned long)r->ramBytes);
+        }
+        printf("}");
+    }
+    printf(",\"stack_saved\":%lu}\n",
+           (unsigned long)(s_results[0][0].ramBytes - s_results[0][1].ramBytes));
+    fflush(stdout);
+}
+
+void test_jobs_vs_tasks(void) {
+    static const OperatingMode MODES[3] = { MODE_DEMO, MODE_TRANSIT, MODE_STORAGE };
+    for (uint8_t mode = 0; mode < 3; mode++) {
+        sim_run(MODES[mode], false, &s_results[mode][0]);
+        sim_run(MODES[mode], true, &s_results[mode][1]);
+    }
+    sim_report();
+
+    for (uint8_t mode = 0; mode < 3; mode++) {
+        const SimResult* tasks = &s_results[mode][0];
+        const SimResult* jobs = &s_results[mode][1];
+
+        // Same work, no more switch-ins
+        TEST_ASSERT_UINT32_WITHIN(tasks->runs / 100 + 2, tasks->runs, jobs->runs);
+        TEST_ASSERT_TRUE(jobs->wakes <= tasks->wakes);
+
+        // A job waits at most for the others' bus transfers and a status
+        // poll, never for a conversion
+        uint32_t bound = SIM_BUS_START_MS + SIM_BUS_SENSOR_MS + SIM_BUS_COMMAND_POLL_MS +
+                         SIM_BUS_ENV_CHECK_MS + SIM_BUS_STATUS_MS;
+        TEST_ASSERT_TRUE(jobs->latencyMaxMs <= bound);
+        TEST_ASSERT_TRUE(jobs->attnMaxMs <= bound);
+    }
+
+    // One stack for three (plus the schedule)
+    TEST_ASSERT_TRUE(s_results[0][0].ramBytes - s_results[0][1].ramBytes >=
+                     (STACK_SENSOR + STACK_COMMAND + STACK_ENV - STACK_JOBS) * sizeof(uint32_t) -
+                     sizeof(JobSchedule));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    // Timer queue
+    RUN_TEST(test_pops_in_deadline_order);
+    RUN_TEST(test_equal_deadlines_are_fifo);
+    RUN_TEST(test_rearm_moves_timer);
+    RUN_TEST(test_cancel);
+    RUN_TEST(test_rejects_bad_id);
+    RUN_TEST(test_wait_ms);
+    RUN_TEST(test_order_across_wrap);
+
+    // Job schedule
+    RUN_TEST(test_jobs_all_run_at_startup_in_order);
+    RUN_TEST(test_jobs_read_after_conversion);
+    RUN_TEST(test_jobs_continuous_profile_reads_at_once);
+    RUN_TEST(test_jobs_sensor_fixed_rate);
+    RUN_TEST(test_jobs_sensor_overrun_restarts_now);
+    RUN_TEST(test_jobs_sensor_off_checks_later);
+    RUN_TEST(test_jobs_polls_wait_after_finish);
+    RUN_TEST(test_jobs_rearm_drops_unread_conversion);
+
+    // Simulation
+    RUN_TEST(test_jobs_vs_tasks);
+
+    return UNITY_END();
+}
@@ -0,0 +1,315 @@
+/**
+ * @file test_latency.cpp
+ * @brief Unit tests and a load benchmark for the alert latency histograms
+ *
+ * Tests bucketing, percentiles and stage stamps from SongbirdLatency.cpp
+ * using PlatformIO Unity on the native platform, then drives the real note
+ * queue with a simulated sensor, command and health load to report alert
+ * p50/p99 per stage.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// Both modules are pure; compile the real ones (test_build_src = false)
+#include "SongbirdLatency.cpp"
+#include "SongbirdNoteQueue.cpp"
+
+static LatencyHistograms s_histograms;
+
+void setUp(void) {
+    memset(&s_histograms, 0, sizeof(s_histograms));
+}
+
+void tearDown(void) {}
+
+static NoteLatencyStamps make_stamps(uint32_t created, uint32_t dequeued,
+                                     uint32_t acquired, uint32_t added) {
+    NoteLatencyStamps stamps;
+    stamps.createdMs = created;
+    stamps.dequeuedMs = dequeued;
+    stamps.acquiredMs = acquired;
+    stamps.addedMs = added;
+    return stamps;
+}
+
+// ============================================================================
+// Buckets
+// ============================================================================
+
+void test_bucket_small_values_exact(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, latencyBucket(0));
+    TEST_ASSERT_EQUAL_UINT8(1, latencyBucket(1));
+    TEST_ASSERT_EQUAL_UINT8(2, latencyBucket(2));
+    TEST_ASSERT_EQUAL_UINT8(3, latencyBucket(3));
+}
+
+void test_bucket_half_octaves(void) {
+    TEST_ASSERT_EQUAL_UINT8(4, latencyBucket(4));
+    TEST_ASSERT_EQUAL_UINT8(4, latencyBucket(5));
+    TEST_ASSERT_EQUAL_UINT8(5, latencyBucket(6));
+    TEST_ASSERT_EQUAL_UINT8(5, latencyBucket(7));
+    TEST_ASSERT_EQUAL_UINT8(19, latencyBucket(1000));
+    TEST_ASSERT_EQUAL_UINT32(1023, latencyBucketMaxMs(19));
+}
+
+void test_bucket_edges_consistent(void) {
+    for (uint8_t b = 0; b < LATENCY_BUCKETS - 1; b++) {
+        uint32_t edge = latencyBucketMaxMs(b);
+        TEST_ASSERT_EQUAL_UINT8(b, latencyBucket(edge));
+        TEST_ASSERT_EQUAL_UINT8(b + 1, latencyBucket(edge + 1));
+    }
+}
+
+void test_bucket_out_of_range_clamps(void) {
+    TEST_ASSERT_EQUAL_UINT8(LATENCY_BUCKETS - 1, latencyBucket(65536));
+    TEST_ASSERT_EQUAL_UINT8(LATENCY_BUCKETS - 1, latencyBucket(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, latencyBucketMaxMs(LATENCY_BUCKETS - 1));
+}
+
+// ============================================================================
+// Percentiles
+// ============================================================================
+
+void test_percentile_empty(void) {
+    LatencyHistogram* histogram = &s_histograms.stages[LATENCY_STAGE_TOTAL];
+    TEST_ASSERT_EQUAL_UINT32(0, latencyHistogramPercentile(histogram, 500));
+    TEST_ASSERT_EQUAL_UINT32(0, latencyHistogramCount(histogram));
+}
+
+void test_percentile_capped_at_max_seen(void) {
+    LatencyHistogram* histogram = &s_histograms.stages[LATENCY_STAGE_TOTAL];
+    latencyHistogramAdd(histogram, 37);
+    TEST_ASSERT_EQUAL_UINT32(37, latencyHistogramPercentile(histogram, 500));
+    TEST_ASSERT_EQUAL_UINT32(37, latencyHistogramPercentile(histogram, 990));
+}
+
+void test_percentile_tail(void) {
+    LatencyHistogram* histogram = &s_histograms.stages[LATENCY_STAGE_TOTAL];
+    for (int i = 0; i < 99; i++) {
+        latencyHistogramAdd(histogram, 10);
+    }
+    latencyHistogramAdd(histogram, 1000);
+
+    // Bucket upper edge: 10 ms lands in [8, 12)
+    TEST_ASSERT_EQUAL_UINT32(11, latencyHistogramPercentile(histogram, 500));
+    TEST_ASSERT_EQUAL_UINT32(11, latencyHistogramPercentile(histogram, 990));
+    TEST_ASSERT_EQUAL_UINT32(1000, latencyHistogramPercentile(histogram, 1000));
+}
+
+void test_count_saturates(void) {
+    LatencyHistogram* histogram = &s_histograms.stages[LATENCY_STAGE_TOTAL];
+    for (uint32_t i = 0; i < UINT16_MAX + 10UL; i++) {
+        latencyHistogramAdd(histogram, 5);
+    }
+    TEST_ASSERT_EQUAL_UINT32(UINT16_MAX, latencyHistogramCount(histogram));
+}
+
+// ============================================================================
+// Stage Stamps
+// ============================================================================
+
+void test_record_stages(void) {
+    NoteLatencyStamps stamps = make_stamps(1000, 1003, 1043, 1123);
+    TEST_ASSERT_TRUE(latencyHistogramsRecord(&s_histograms, &stamps));
+
+    LatencyReport report;
+    latencySummarize(&s_histograms, &report);
+    TEST_ASSERT_EQUAL_UINT16(1, report.count);
+    TEST_ASSERT_EQUAL_UINT16(3, report.p50Ms[LATENCY_STAGE_QUEUE]);
+    TEST_ASSERT_EQUAL_UINT16(40, report.p50Ms[LATENCY_STAGE_I2C]);
+    TEST_ASSERT_EQUAL_UINT16(80, report.p50Ms[LATENCY_STAGE_ADD]);
+    TEST_ASSERT_EQUAL_UINT16(123, report.p99Ms[LATENCY_STAGE_TOTAL]);
+}
+
+void test_record_unknown_creation_skipped(void) {
+    NoteLatencyStamps stamps = make_stamps(0, 1003, 1043, 1123);
+    TEST_ASSERT_FALSE(latencyHistogramsRecord(&s_histograms, &stamps));
+    TEST_ASSERT_EQUAL_UINT32(0, latencyHistogramCount(&s_histograms.stages[LATENCY_STAGE_QUEUE]));
+}
+
+void test_record_across_millis_wrap(void) {
+    NoteLatencyStamps stamps = make_stamps(UINT32_MAX - 10, 5, 6, 30);
+    latencyHistogramsRecord(&s_histograms, &stamps);
+    TEST_ASSERT_EQUAL_UINT32(16, s_histograms.stages[LATENCY_STAGE_QUEUE].maxMs);
+    TEST_ASSERT_EQUAL_UINT32(41, s_histograms.stages[LATENCY_STAGE_TOTAL].maxMs);
+}
+
+void test_age(void) {
+    TEST_ASSERT_EQUAL_UINT32(LATENCY_UNKNOWN, latencyAgeMs(0, 500));
+    TEST_ASSERT_EQUAL_UINT32(250, latencyAgeMs(250, 500));
+    TEST_ASSERT_EQUAL_UINT32(11, latencyAgeMs(UINT32_MAX - 5, 5));
+}
+
+void test_peek_report_keeps_window(void) {
+    NoteLatencyStamps stamps = make_stamps(100, 110, 120, 200);
+    latencyRecordAlert(&stamps);
+
+    // A health.qo that fails to send reports the same alerts on its retry
+    LatencyReport report;
+    latencyPeekReport(&report);
+    TEST_ASSERT_EQUAL_UINT16(1, report.count);
+    latencyPeekReport(&report);
+    TEST_ASSERT_EQUAL_UINT16(1, report.count);
+
+    // Once it is sent, the window starts again
+    latencyTakeReport(NULL);
+    latencyPeekReport(&report);
+    TEST_ASSERT_EQUAL_UINT16(0, report.count);
+}
+
+void test_take_report_starts_new_window(void) {
+    NoteLatencyStamps stamps = make_stamps(100, 110, 120, 200);
+    latencyRecordAlert(&stamps);
+    latencyRecordAlert(&stamps);
+
+    LatencyReport report;
+    latencyTakeReport(&report);
+    TEST_ASSERT_EQUAL_UINT16(2, report.count);
+    TEST_ASSERT_EQUAL_UINT16(100, report.p50Ms[LATENCY_STAGE_TOTAL]);
+
+    latencyTakeReport(&report);
+    TEST_ASSERT_EQUAL_UINT16(0, report.count);
+    TEST_ASSERT_EQUAL_UINT16(0, report.p99Ms[LATENCY_STAGE_TOTAL]);
+    TEST_ASSERT_EQUAL_STRING("add", latencyStageName(LATENCY_STAGE_ADD));
+    TEST_ASSERT_EQUAL_STRING("unknown", latencyStageName(LATENCY_STAGE_COUNT));
+}
+
+// ============================================================================
+// Synthetic Load Benchmark
+// ============================================================================
+
+// Six simulated hours of demo-mode traffic through the real note queue. One
+// consumer (NotecardTask) sends one note at a time; the I2C bus is sometimes
+// held by another task, and note.add sometimes stalls while the Notecard
+// syncs. Alerts raised from a sample overtake the track backlog.
+#define SIM_DURATION_MS     (6UL * 3600UL * 1000UL)
+#define SIM_SENSOR_MS       5000UL      // Sensor cycle (track note each cycle)
+#define SIM_HEALTH_MS       60000UL     // Health report
+#define SIM_MAX_ALERTS      4096
+
+static uint32_t s_rng = 12345;
+static NoteQueue s_simQueue;
+static uint32_t s_alertTotals[SIM_MAX_ALERTS];
+
+static uint32_t sim_random(uint32_t low, uint32_t high) {
+    s_rng = s_rng * 1103515245UL + 12345UL;
+    return low + ((s_rng >> 8) % (high - low + 1));
+}
+
+static void sim_push(NoteType type, uint32_t createdMs) {
+    NoteQueueItem item;
+    memset(&item, 0, sizeof(item));
+    item.type = type;
+    item.createdMs = createdMs;
+    noteQueuePush(&s_simQueue, &item, NULL, NULL);
+}
+
+static int compare_uint32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+void test_benchmark_alert_latency_under_load(void) {
+    noteQueueInit(&s_simQueue);
+    uint32_t alerts = 0;
+    uint32_t busyUntil = 0;
+    uint32_t nextAlertReadyMs = 0;      // Alert engine runs after the sample
+    uint32_t pendingAlertSample = 0;
+
+    for (uint32_t now = 1; now < SIM_DURATION_MS; now++) {
+        // Producers
+        if (now % SIM_SENSOR_MS == 0) {
+            sim_push(NOTE_TYPE_TRACK, now);
+            if (sim_random(0, 99) < 10) {
+                pendingAlertSample = now;
+                nextAlertReadyMs = now + sim_random(1, 4);
+            }
+        }
+        if (pendingAlertSample != 0 && now == nextAlertReadyMs) {
+            sim_push(NOTE_TYPE_ALERT, pendingAlertSample);
+            pendingAlertSample = 0;
+        }
+        if (now % SIM_HEALTH_MS == 0) {
+            sim_push(NOTE_TYPE_HEALTH, now);
+        }
+        if (sim_random(0, 99999) < 5) {
+            sim_push(NOTE_TYPE_CMD_ACK, now);
+        }
+
+        // Consumer
+        NoteQueueItem item;
+        if (now < busyUntil || !noteQueuePop(&s_simQueue, &item)) {
+            continue;
+        }
+        NoteLatencyStamps stamps;
+        stamps.createdMs = item.createdMs;
+        stamps.dequeuedMs = now;
+        stamps.acquiredMs = now + (sim_random(0, 99) < 30 ? sim_random(5, 150) : 0);
+        uint32_t addMs = sim_random(0, 99) < 2 ? sim_random(500, 1500) : sim_random(30, 120);
+        stamps.addedMs = stamps.acquiredMs + addMs;
+        busyUntil = stamps.addedMs;
+
+        if (item.type == NOTE_TYPE_ALERT && alerts < SIM_MAX_ALERTS) {
+            latencyHistogramsRecord(&s_histograms, &stamps);
+            s_alertTotals[alerts++] = stamps.addedMs - stamps.createdMs;
+        }
+    }
+
+    LatencyReport report;
+    latencySummarize(&s_histograms, &report);
+    TEST_ASSERT_TRUE(report.count > 100);
+    TEST_ASSERT_EQUAL_UINT32(alerts, report.count);
+
+    char line[96];
+    for (uint8_t i = 0; i < LATENCY_STAGE_COUNT; i++) {
+        snprintf(line, sizeof(line), "alert %-5s p50=%u ms p99=%u ms",
+                 latencyStageName((LatencyStage)i), report.p50Ms[i], report.p99Ms[i]);
+        TEST_MESSAGE(line);
+        TEST_ASSERT_TRUE(report.p50Ms[i] <= report.p99Ms[i]);
+    }
+
+    // The histogram percentile never understates the exact one and is
+    // within one half-octave bucket of it
+    qsort(s_alertTotals, alerts, sizeof(uint32_t), compare_uint32);
+    uint32_t exactP50 = s_alertTotals[(alerts * 500 + 999) / 1000 - 1];
+    uint32_t exactP99 = s_alertTotals[(alerts * 990 + 999) / 1000 - 1];
+    snprintf(line, sizeof(line), "alert total exact p50=%lu ms p99=%lu ms (n=%lu)",
+             (unsigned long)exactP50, (unsigned long)exactP99, (unsigned long)alerts);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE(report.p50Ms[LATENCY_STAGE_TOTAL] >= exactP50);
+    TEST_ASSERT_TRUE(report.p50Ms[LATENCY_STAGE_TOTAL] <= exactP50 + exactP50 / 2);
+    TEST_ASSERT_TRUE(report.p99Ms[LATENCY_STAGE_TOTAL] >= exactP99);
+    TEST_ASSERT_TRUE(report.p99Ms[LATENCY_STAGE_TOTAL] <= exactP99 + exactP99 / 2);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bucket_small_values_exact);
+    RUN_TEST(test_bucket_half_octaves);
+    RUN_TEST(test_bucket_edges_consistent);
+    RUN_TEST(test_bucket_out_of_range_clamps);
+
+    RUN_TEST(test_percentile_empty);
+    RUN_TEST(test_percentile_capped_at_max_seen);
+    RUN_TEST(test_percentile_tail);
+    RUN_TEST(test_count_saturates);
+
+    RUN_TEST(test_record_stages);
+    RUN_TEST(test_record_unknown_creation_skipped);
+    RUN_TEST(test_record_across_millis_wrap);
+    RUN_TEST(test_age);
+    RUN_TEST(test_peek_report_keeps_window);
+    RUN_TEST(test_take_report_starts_new_window);
+
+    RUN_TEST(test_benchmark_alert_latency_under_load);
+
+    return UNITY_END();
+}
@@ -0,0 +1,216 @@
+/**
+ * @file test_metrics.cpp
+ * @brief Unit tests for the device metrics and health report trigger
+ *
+ * Tests counters, high- and low-water marks and metricsReportDue() from
+ * SongbirdMetrics.cpp using PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The metrics module has no hardware dependencies; compile the real module (test_build_src = false)
+#include "SongbirdMetrics.cpp"
+
+#define HEARTBEAT_SEC   (6UL * 3600UL)
+
+static MetricsSnapshot s_reported;
+static MetricsSnapshot s_current;
+
+void setUp(void) {
+    metricsInit();
+    metricsSnapshot(&s_reported);
+    metricsSnapshot(&s_current);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void test_counters_start_at_zero(void) {
+    for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, metricsGet((MetricCounter)i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, s_current.heapFreeMin);
+}
+
+void test_increment_and_reset(void) {
+    metricsIncrement(METRIC_NOTECARD_ERRORS);
+    metricsIncrement(METRIC_NOTECARD_ERRORS);
+    metricsIncrement(METRIC_NOTES_SENT);
+    TEST_ASSERT_EQUAL_UINT32(2, metricsGet(METRIC_NOTECARD_ERRORS));
+    TEST_ASSERT_EQUAL_UINT32(1, metricsGet(METRIC_NOTES_SENT));
+
+    metricsReset(METRIC_NOTECARD_ERRORS);
+    TEST_ASSERT_EQUAL_UINT32(0, metricsGet(METRIC_NOTECARD_ERRORS));
+    TEST_ASSERT_EQUAL_UINT32(1, metricsGet(METRIC_NOTES_SENT));
+}
+
+void test_out_of_range_ignored(void) {
+    metricsIncrement(METRIC_COUNTER_COUNT);
+    metricsRecordPeak(METRIC_PEAK_COUNT, 5);
+    TEST_ASSERT_EQUAL_UINT32(0, metricsGet(METRIC_COUNTER_COUNT));
+}
+
+void test_peak_only_rises(void) {
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, 3);
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, 7);
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, 2);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_UINT32(7, s_current.peaks[METRIC_PEAK_NOTE_QUEUE]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_current.peaks[METRIC_PEAK_AUDIO_QUEUE]);
+}
+
+void test_heap_low_water_only_falls(void) {
+    metricsRecordHeapFree(9000);
+    metricsRecordHeapFree(4000);
+    metricsRecordHeapFree(12000);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_UINT32(4000, s_current.heapFreeMin);
+}
+
+void test_init_clears_everything(void) {
+    metricsIncrement(METRIC_SENSOR_ERRORS);
+    metricsRecordPeak(METRIC_PEAK_NOTE_SPILL, 9);
+    metricsRecordHeapFree(100);
+    metricsInit();
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_UINT32(0, s_current.counters[METRIC_SENSOR_ERRORS]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_current.peaks[METRIC_PEAK_NOTE_SPILL]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, s_current.heapFreeMin);
+}
+
+// ============================================================================
+// Report Trigger
+// ============================================================================
+
+void test_quiet_device_reports_on_heartbeat(void) {
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, HEARTBEAT_SEC - 1, HEARTBEAT_SEC));
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_HEARTBEAT,
+                          metricsReportDue(&s_reported, &s_current, HEARTBEAT_SEC, HEARTBEAT_SEC));
+}
+
+void test_error_burst_reports_early(void) {
+    for (uint8_t i = 0; i < METRICS_ERROR_DELTA - 1; i++) {
+        metricsIncrement(i % 2 ? METRIC_SENSOR_ERRORS : METRIC_I2C_TIMEOUTS);
+    }
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+
+    metricsIncrement(METRIC_NOTECARD_ERRORS);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_CHANGE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+}
+
+void test_change_reports_are_rate_limited(void) {
+    metricsIncrement(METRIC_NOTES_LOST);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, METRICS_MIN_REPORT_SEC - 1,
+                                           HEARTBEAT_SEC));
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_CHANGE,
+                          metricsReportDue(&s_reported, &s_current, METRICS_MIN_REPORT_SEC,
+                                           HEARTBEAT_SEC));
+}
+
+void test_errors_already_reported_do_not_retrigger(void) {
+    for (uint8_t i = 0; i < METRICS_ERROR_DELTA; i++) {
+        metricsIncrement(METRIC_SENSOR_ERRORS);
+    }
+    metricsSnapshot(&s_current);
+    memcpy(&s_reported, &s_current, sizeof(MetricsSnapshot));
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+}
+
+void test_reset_counter_does_not_look_like_errors(void) {
+    // sensorsInit() and notecardResetErrorCount() clear counters that the
+    // last report already included
+    for (uint8_t i = 0; i < METRICS_ERROR_DELTA + 2; i++) {
+        metricsIncrement(METRIC_NOTECARD_ERRORS);
+    }
+    metricsSnapshot(&s_reported);
+
+    metricsReset(METRIC_NOTECARD_ERRORS);
+    metricsIncrement(METRIC_NOTECARD_ERRORS);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+
+    // Errors after the reset still count
+    for (uint8_t i = 1; i < METRICS_ERROR_DELTA; i++) {
+        metricsIncrement(METRIC_NOTECARD_ERRORS);
+    }
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_CHANGE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+}
+
+void test_heap_crossing_low_mark_reports(void) {
+    metricsRecordHeapFree(METRICS_HEAP_LOW_BYTES + 500);
+    metricsSnapshot(&s_reported);
+
+    metricsRecordHeapFree(METRICS_HEAP_LOW_BYTES - 1);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_CHANGE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+
+    // Once reported, staying low is not news
+    memcpy(&s_reported, &s_current, sizeof(MetricsSnapshot));
+    metricsRecordHeapFree(METRICS_HEAP_LOW_BYTES - 100);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+}
+
+void test_note_queue_filling_reports(void) {
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, NOTE_QUEUE_SIZE - 1);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, NOTE_QUEUE_SIZE);
+    metricsSnapshot(&s_current);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_CHANGE,
+                          metricsReportDue(&s_reported, &s_current, 3600, HEARTBEAT_SEC));
+}
+
+void test_null_arguments(void) {
+    metricsSnapshot(NULL);
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(NULL, &s_current, HEARTBEAT_SEC, HEARTBEAT_SEC));
+    TEST_ASSERT_EQUAL_INT(METRICS_TRIGGER_NONE,
+                          metricsReportDue(&s_reported, NULL, HEARTBEAT_SEC, HEARTBEAT_SEC));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_counters_start_at_zero);
+    RUN_TEST(test_increment_and_reset);
+    RUN_TEST(test_out_of_range_ignored);
+    RUN_TEST(test_peak_only_rises);
+    RUN_TEST(test_heap_low_water_only_falls);
+    RUN_TEST(test_init_clears_everything);
+
+    RUN_TEST(test_quiet_device_reports_on_heartbeat);
+    RUN_TEST(test_error_burst_reports_early);
+    RUN_TEST(test_change_reports_are_rate_limited);
+    RUN_TEST(test_errors_already_reported_do_not_retrigger);
+    RUN_TEST(test_reset_counter_does_not_look_like_errors);
+    RUN_TEST(test_heap_crossing_low_mark_reports);
+    RUN_TEST(test_note_queue_filling_reports);
+    RUN_TEST(test_null_arguments);
+
+    return UNITY_END();
+}
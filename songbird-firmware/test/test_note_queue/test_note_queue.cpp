@@ -0,0 +1,222 @@
+/**
+ * @file test_note_queue.cpp
+ * @brief Unit tests for the priority-ordered outbound note queue
+ *
+ * Tests class ordering, FIFO order within a class, drop-oldest-lowest
+ * overflow and per-class drop counters from SongbirdNoteQueue.cpp using
+ * PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The queue is a pure data structure; compile the real module (test_build_src = false)
+#include "SongbirdNoteQueue.cpp"
+
+static NoteQueue s_queue;
+
+// Notes are told apart by type and a sequence number in the body
+static NoteQueueItem make_note(NoteType type, uint32_t seq) {
+    NoteQueueItem item;
+    memset(&item, 0, sizeof(item));
+    item.type = type;
+    item.data.track.timestamp = seq;
+    return item;
+}
+
+static bool push(NoteType type, uint32_t seq) {
+    NoteQueueItem item = make_note(type, seq);
+    return noteQueuePush(&s_queue, &item, NULL, NULL);
+}
+
+static void assert_pop(NoteType type, uint32_t seq) {
+    NoteQueueItem item;
+    TEST_ASSERT_TRUE(noteQueuePop(&s_queue, &item));
+    TEST_ASSERT_EQUAL_INT(type, item.type);
+    TEST_ASSERT_EQUAL_UINT32(seq, item.data.track.timestamp);
+}
+
+void setUp(void) {
+    noteQueueInit(&s_queue);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Ordering
+// ============================================================================
+
+void test_empty_queue_pops_nothing(void) {
+    NoteQueueItem item;
+    TEST_ASSERT_FALSE(noteQueuePop(&s_queue, &item));
+    TEST_ASSERT_EQUAL_UINT32(0, noteQueueCount(&s_queue));
+}
+
+void test_fifo_within_class(void) {
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(push(NOTE_TYPE_TRACK, i));
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        assert_pop(NOTE_TYPE_TRACK, i);
+    }
+}
+
+void test_classes_delivered_by_priority(void) {
+    push(NOTE_TYPE_HEALTH, 1);
+    push(NOTE_TYPE_TRACK, 2);
+    push(NOTE_TYPE_CMD_ACK, 3);
+    push(NOTE_TYPE_ALERT, 4);
+
+    assert_pop(NOTE_TYPE_ALERT, 4);
+    assert_pop(NOTE_TYPE_CMD_ACK, 3);
+    assert_pop(NOTE_TYPE_TRACK, 2);
+    assert_pop(NOTE_TYPE_HEALTH, 1);
+}
+
+void test_alert_overtakes_track_backlog(void) {
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE - 1; i++) {
+        push(NOTE_TYPE_TRACK, i);
+    }
+    push(NOTE_TYPE_ALERT, 100);
+
+    assert_pop(NOTE_TYPE_ALERT, 100);
+    assert_pop(NOTE_TYPE_TRACK, 0);
+}
+
+void test_slots_are_reused(void) {
+    // Many more notes than slots pass through without loss
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE * 4; i++) {
+        TEST_ASSERT_TRUE(push((i % 2) ? NOTE_TYPE_TRACK : NOTE_TYPE_ALERT, i));
+        if (i % 2) {
+            // Alert first, then the track queued after it
+            assert_pop(NOTE_TYPE_ALERT, i - 1);
+            assert_pop(NOTE_TYPE_TRACK, i);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, noteQueueCount(&s_queue));
+    for (uint8_t p = 0; p < NOTE_PRIORITY_COUNT; p++) {
+        TEST_ASSERT_EQUAL_UINT32(0, s_queue.drops[p]);
+    }
+}
+
+// ============================================================================
+// Overflow
+// ============================================================================
+
+void test_full_queue_drops_oldest_lowest_priority(void) {
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE - 2; i++) {
+        push(NOTE_TYPE_TRACK, i);
+    }
+    push(NOTE_TYPE_HEALTH, 50);
+    push(NOTE_TYPE_HEALTH, 51);
+
+    bool evicted = false;
+    NoteQueueItem dropped;
+    NoteQueueItem alert = make_note(NOTE_TYPE_ALERT, 100);
+    TEST_ASSERT_TRUE(noteQueuePush(&s_queue, &alert, &evicted, &dropped));
+    TEST_ASSERT_TRUE(evicted);
+    TEST_ASSERT_EQUAL_INT(NOTE_TYPE_HEALTH, dropped.type);
+    TEST_ASSERT_EQUAL_UINT32(50, dropped.data.track.timestamp);
+    TEST_ASSERT_EQUAL_UINT32(1, s_queue.drops[NOTE_PRIORITY_HEALTH]);
+    TEST_ASSERT_EQUAL_UINT32(NOTE_QUEUE_SIZE, noteQueueCount(&s_queue));
+
+    // Health 50 was the oldest of the lowest class
+    assert_pop(NOTE_TYPE_ALERT, 100);
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE - 2; i++) {
+        assert_pop(NOTE_TYPE_TRACK, i);
+    }
+    assert_pop(NOTE_TYPE_HEALTH, 51);
+}
+
+void test_full_queue_evicts_oldest_of_same_class(void) {
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE; i++) {
+        push(NOTE_TYPE_TRACK, i);
+    }
+    TEST_ASSERT_TRUE(push(NOTE_TYPE_TRACK, 100));
+    TEST_ASSERT_EQUAL_UINT32(1, s_queue.drops[NOTE_PRIORITY_TRACK]);
+
+    // Newest data wins
+    assert_pop(NOTE_TYPE_TRACK, 1);
+}
+
+void test_lower_priority_note_dropped_when_all_outrank_it(void) {
+    for (uint32_t i = 0; i < NOTE_QUEUE_SIZE; i++) {
+        push(NOTE_TYPE_ALERT, i);
+    }
+
+    bool evicted = true;
+    NoteQueueItem dropped;
+    NoteQueueItem track = make_note(NOTE_TYPE_TRACK, 100);
+    TEST_ASSERT_FALSE(noteQueuePush(&s_queue, &track, &evicted, &dropped));
+    TEST_ASSERT_FALSE(evicted);
+    TEST_ASSERT_EQUAL_INT(NOTE_TYPE_TRACK, dropped.type);
+    TEST_ASSERT_EQUAL_UINT32(100, dropped.data.track.timestamp);
+    TEST_ASSERT_EQUAL_UINT32(1, s_queue.drops[NOTE_PRIORITY_TRACK]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_queue.drops[NOTE_PRIORITY_ALERT]);
+
+    assert_pop(NOTE_TYPE_ALERT, 0);
+}
+
+void test_alerts_survive_sustained_backlog(void) {
+    // Producers keep queueing while the consumer is stalled
+    for (uint32_t i = 0; i < 100; i++) {
+        push(NOTE_TYPE_TRACK, i);
+        if (i % 10 == 0) {
+            TEST_ASSERT_TRUE(push(NOTE_TYPE_ALERT, 1000 + i));
+        }
+    }
+
+    // All ten alerts are first out, in order
+    for (uint32_t i = 0; i < 100; i += 10) {
+        assert_pop(NOTE_TYPE_ALERT, 1000 + i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, s_queue.drops[NOTE_PRIORITY_ALERT]);
+    TEST_ASSERT_EQUAL_UINT32(100 - (NOTE_QUEUE_SIZE - 10), s_queue.drops[NOTE_PRIORITY_TRACK]);
+}
+
+// ============================================================================
+// Argument Handling
+// ============================================================================
+
+void test_null_arguments(void) {
+    NoteQueueItem item = make_note(NOTE_TYPE_TRACK, 0);
+    bool evicted = true;
+    TEST_ASSERT_FALSE(noteQueuePush(NULL, &item, &evicted, NULL));
+    TEST_ASSERT_FALSE(evicted);
+    TEST_ASSERT_FALSE(noteQueuePush(&s_queue, NULL, NULL, NULL));
+    TEST_ASSERT_FALSE(noteQueuePop(&s_queue, NULL));
+    TEST_ASSERT_FALSE(noteQueuePop(NULL, &item));
+    TEST_ASSERT_EQUAL_UINT32(0, noteQueueCount(NULL));
+}
+
+void test_priority_mapping(void) {
+    TEST_ASSERT_EQUAL_INT(NOTE_PRIORITY_ALERT, noteQueuePriority(NOTE_TYPE_ALERT));
+    TEST_ASSERT_EQUAL_INT(NOTE_PRIORITY_CMD_ACK, noteQueuePriority(NOTE_TYPE_CMD_ACK));
+    TEST_ASSERT_EQUAL_INT(NOTE_PRIORITY_TRACK, noteQueuePriority(NOTE_TYPE_TRACK));
+    TEST_ASSERT_EQUAL_INT(NOTE_PRIORITY_HEALTH, noteQueuePriority(NOTE_TYPE_HEALTH));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_queue_pops_nothing);
+    RUN_TEST(test_fifo_within_class);
+    RUN_TEST(test_classes_delivered_by_priority);
+    RUN_TEST(test_alert_overtakes_track_backlog);
+    RUN_TEST(test_slots_are_reused);
+
+    RUN_TEST(test_full_queue_drops_oldest_lowest_priority);
+    RUN_TEST(test_full_queue_evicts_oldest_of_same_class);
+    RUN_TEST(test_lower_priority_note_dropped_when_all_outrank_it);
+    RUN_TEST(test_alerts_survive_sustained_backlog);
+
+    RUN_TEST(test_null_arguments);
+    RUN_TEST(test_priority_mapping);
+
+    return UNITY_END();
+}
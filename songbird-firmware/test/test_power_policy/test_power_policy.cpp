@@ -0,0 +1,162 @@
+/**
+ * @file test_power_policy.cpp
+ * @brief Unit tests for the battery-aware duty cycling policy
+ *
+ * Tests the voltage -> interval scale curve, quantization, hysteresis and
+ * USB relaxation from SongbirdPowerPolicy.cpp using PlatformIO Unity on
+ * the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The policy is pure logic; compile the real module (test_build_src = false)
+#include "SongbirdPowerPolicy.cpp"
+
+static SongbirdConfig s_config;
+
+void setUp(void) {
+    memset(&s_config, 0, sizeof(s_config));
+    s_config.powerPolicyEnabled = DEFAULT_POWER_POLICY_ENABLED;
+    s_config.powerPolicyFullV = DEFAULT_POWER_POLICY_FULL_V;
+    s_config.powerPolicyLowV = DEFAULT_POWER_POLICY_LOW_V;
+    s_config.powerPolicyMaxScale = DEFAULT_POWER_POLICY_MAX_SCALE;
+    powerPolicyReset();
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Scale Curve
+// ============================================================================
+
+void test_full_battery_uses_presets(void) {
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 4.1f, false));
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 3.9f, false));
+}
+
+void test_low_battery_uses_max_scale(void) {
+    TEST_ASSERT_EQUAL_UINT16(400, powerPolicyComputeScale(&s_config, 3.5f, false));
+    TEST_ASSERT_EQUAL_UINT16(400, powerPolicyComputeScale(&s_config, 3.2f, false));
+}
+
+void test_midpoint_is_linear(void) {
+    // Halfway between 3.9 V and 3.5 V -> 1x + (4x - 1x) / 2 = 250%
+    TEST_ASSERT_EQUAL_UINT16(250, powerPolicyComputeScale(&s_config, 3.7f, false));
+}
+
+void test_scale_is_quantized(void) {
+    uint16_t pct = powerPolicyComputeScale(&s_config, 3.83f, false);
+    TEST_ASSERT_EQUAL_UINT16(0, pct % POWER_POLICY_SCALE_STEP_PCT);
+}
+
+void test_scale_is_monotonic(void) {
+    uint16_t last = 0;
+    for (float v = 4.2f; v >= 3.0f; v -= 0.01f) {
+        uint16_t pct = powerPolicyComputeScale(&s_config, v, false);
+        TEST_ASSERT_TRUE(pct >= last);
+        last = pct;
+    }
+}
+
+void test_usb_power_uses_presets(void) {
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 3.4f, true));
+}
+
+void test_disabled_policy_uses_presets(void) {
+    s_config.powerPolicyEnabled = false;
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 3.4f, false));
+}
+
+void test_max_scale_of_one_disables_stretch(void) {
+    s_config.powerPolicyMaxScale = 1;
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 3.4f, false));
+}
+
+void test_inverted_knees_step_at_low_voltage(void) {
+    s_config.powerPolicyFullV = 3.5f;
+    s_config.powerPolicyLowV = 3.6f;
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyComputeScale(&s_config, 3.7f, false));
+    TEST_ASSERT_EQUAL_UINT16(400, powerPolicyComputeScale(&s_config, 3.5f, false));
+}
+
+// ============================================================================
+// Hysteresis and State
+// ============================================================================
+
+void test_hysteresis_holds_step_near_boundary(void) {
+    // Falling voltage only takes the step that holds HYSTERESIS above the reading
+    uint16_t current = powerPolicyNextScale(&s_config, 3.7f, false, 100);
+    TEST_ASSERT_EQUAL_UINT16(powerPolicyComputeScale(&s_config, 3.75f, false), current);
+    TEST_ASSERT_TRUE(current > 100);
+
+    // A slightly higher reading within the band keeps the current step
+    TEST_ASSERT_EQUAL_UINT16(current, powerPolicyNextScale(&s_config, 3.72f, false, current));
+
+    // Well above the band relaxes
+    TEST_ASSERT_TRUE(powerPolicyNextScale(&s_config, 3.85f, false, current) < current);
+}
+
+void test_usb_relaxes_immediately(void) {
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyNextScale(&s_config, 3.5f, true, 400));
+}
+
+void test_update_ignores_failed_reading(void) {
+    TEST_ASSERT_TRUE(powerPolicyUpdate(&s_config, 3.4f, false));
+    TEST_ASSERT_EQUAL_UINT16(400, powerPolicyGetScalePercent());
+    TEST_ASSERT_FALSE(powerPolicyUpdate(&s_config, 0.0f, false));
+    TEST_ASSERT_EQUAL_UINT16(400, powerPolicyGetScalePercent());
+}
+
+void test_scale_interval(void) {
+    TEST_ASSERT_EQUAL_UINT32(60000, powerPolicyScaleInterval(60000));
+    powerPolicyUpdate(&s_config, 3.4f, false);
+    TEST_ASSERT_EQUAL_UINT32(240000, powerPolicyScaleInterval(60000));
+    TEST_ASSERT_EQUAL_UINT32(0, powerPolicyScaleInterval(0));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, powerPolicyScaleInterval(UINT32_MAX));
+}
+
+void test_restore_resumes_applied_scale(void) {
+    powerPolicyRestore(200);
+    TEST_ASSERT_EQUAL_UINT16(200, powerPolicyGetScalePercent());
+
+    // A reading that still selects 200% is not a change (no hub.set)
+    float voltage = 3.9f - (3.9f - 3.5f) / 3.0f;
+    TEST_ASSERT_EQUAL_UINT16(200, powerPolicyNextScale(&s_config, voltage, false, 200));
+    TEST_ASSERT_FALSE(powerPolicyUpdate(&s_config, voltage, false));
+
+    powerPolicyRestore(0);
+    TEST_ASSERT_EQUAL_UINT16(100, powerPolicyGetScalePercent());
+}
+
+// ============================================================================
+// Test Runner
+// ============================================================================
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+
+    // Scale curve
+    RUN_TEST(test_full_battery_uses_presets);
+    RUN_TEST(test_low_battery_uses_max_scale);
+    RUN_TEST(test_midpoint_is_linear);
+    RUN_TEST(test_scale_is_quantized);
+    RUN_TEST(test_scale_is_monotonic);
+    RUN_TEST(test_usb_power_uses_presets);
+    RUN_TEST(test_disabled_policy_uses_presets);
+    RUN_TEST(test_max_scale_of_one_disables_stretch);
+    RUN_TEST(test_inverted_knees_step_at_low_voltage);
+
+    // Hysteresis and state
+    RUN_TEST(test_hysteresis_holds_step_near_boundary);
+    RUN_TEST(test_usb_relaxes_immediately);
+    RUN_TEST(test_update_ignores_failed_reading);
+    RUN_TEST(test_scale_interval);
+    RUN_TEST(test_restore_resumes_applied_scale);
+
+    return UNITY_END();
+}
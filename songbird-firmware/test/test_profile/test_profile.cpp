@@ -0,0 +1,171 @@
+/**
+ * @file test_profile.cpp
+ * @brief Unit tests for the profiling scopes
+ *
+ * Tests statistics accumulation, formatting and the scoped timer from
+ * SongbirdProfile.cpp using PlatformIO Unity on the native platform, where
+ * the time base is std::chrono.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+
+// The host half has no hardware dependencies; compile the real module (test_build_src = false)
+#include "SongbirdProfile.cpp"
+
+void setUp(void) {
+    profileInit();
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+void test_empty_stats(void) {
+    ProfileStats stats;
+    TEST_ASSERT_TRUE(profileGet(PROFILE_SENSORS_READ, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.minTicks);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.maxTicks);
+    TEST_ASSERT_EQUAL(PROFILE_SCOPE_COUNT, profileSlowest());
+}
+
+void test_record_min_max_total(void) {
+    profileRecord(PROFILE_ENV_FETCH, 300);
+    profileRecord(PROFILE_ENV_FETCH, 100);
+    profileRecord(PROFILE_ENV_FETCH, 200);
+
+    ProfileStats stats;
+    profileGet(PROFILE_ENV_FETCH, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.minTicks);
+    TEST_ASSERT_EQUAL_UINT32(300, stats.maxTicks);
+    TEST_ASSERT_TRUE(stats.totalTicks == 600);
+
+    // Other scopes are untouched
+    profileGet(PROFILE_SENSORS_READ, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+}
+
+void test_total_does_not_wrap_at_32_bits(void) {
+    profileRecord(PROFILE_AUDIO_MELODY, UINT32_MAX);
+    profileRecord(PROFILE_AUDIO_MELODY, UINT32_MAX);
+
+    ProfileStats stats;
+    profileGet(PROFILE_AUDIO_MELODY, &stats);
+    TEST_ASSERT_TRUE(stats.totalTicks == 2ULL * UINT32_MAX);
+}
+
+void test_invalid_id_ignored(void) {
+    ProfileStats stats;
+    profileRecord(PROFILE_SCOPE_COUNT, 100);
+    TEST_ASSERT_FALSE(profileGet(PROFILE_SCOPE_COUNT, &stats));
+    TEST_ASSERT_FALSE(profileGet(PROFILE_SENSORS_READ, NULL));
+    TEST_ASSERT_EQUAL_STRING("unknown", profileScopeName(PROFILE_SCOPE_COUNT));
+}
+
+void test_reset_clears(void) {
+    profileRecord(PROFILE_NC_SEND_TRACK, 50);
+    profileReset();
+
+    ProfileStats stats;
+    profileGet(PROFILE_NC_SEND_TRACK, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+}
+
+void test_slowest_by_max(void) {
+    profileRecord(PROFILE_SENSORS_READ, 500);
+    profileRecord(PROFILE_NC_SEND_TRACK, 900);
+    profileRecord(PROFILE_NC_SEND_TRACK, 10);
+    profileRecord(PROFILE_ENV_FETCH, 700);
+    TEST_ASSERT_EQUAL(PROFILE_NC_SEND_TRACK, profileSlowest());
+}
+
+// ============================================================================
+// Formatting
+// ============================================================================
+
+void test_ticks_to_us(void) {
+    TEST_ASSERT_EQUAL_UINT32(1000, profileTicksToUs(80000, 80000000UL));
+    TEST_ASSERT_EQUAL_UINT32(53687091, profileTicksToUs(UINT32_MAX, 80000000UL));
+    TEST_ASSERT_EQUAL_UINT32(0, profileTicksToUs(100, 0));
+}
+
+void test_format_line(void) {
+    // Native ticks are nanoseconds
+    profileRecord(PROFILE_SENSORS_READ, 1000000);
+    profileRecord(PROFILE_SENSORS_READ, 3000000);
+
+    char line[64];
+    size_t length = profileFormat(PROFILE_SENSORS_READ, line, sizeof(line));
+    TEST_ASSERT_EQUAL_STRING("sensors_read n=2 avg=2000 min=1000 max=3000 us", line);
+    TEST_ASSERT_EQUAL_UINT(strlen(line), length);
+}
+
+void test_format_truncates(void) {
+    char line[8];
+    TEST_ASSERT_EQUAL_UINT(7, profileFormat(PROFILE_SENSORS_READ, line, sizeof(line)));
+    TEST_ASSERT_EQUAL_STRING("sensors", line);
+    TEST_ASSERT_EQUAL_UINT(0, profileFormat(PROFILE_SENSORS_READ, NULL, 8));
+}
+
+// ============================================================================
+// Scoped Timer
+// ============================================================================
+
+static void busyWaitUs(uint32_t us) {
+    uint32_t start = profileNow();
+    while (profileNow() - start < us * 1000) {
+    }
+}
+
+void test_scope_records_on_exit(void) {
+    {
+        PROFILE_SCOPE(PROFILE_AUDIO_MELODY);
+        busyWaitUs(200);
+    }
+
+    ProfileStats stats;
+    profileGet(PROFILE_AUDIO_MELODY, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_TRUE(stats.maxTicks >= 200000);
+}
+
+void test_scope_records_on_continue(void) {
+    for (int i = 0; i < 3; i++) {
+        PROFILE_SCOPE(PROFILE_ENV_FETCH);
+        if (i == 1) {
+            continue;
+        }
+    }
+
+    ProfileStats stats;
+    profileGet(PROFILE_ENV_FETCH, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_stats);
+    RUN_TEST(test_record_min_max_total);
+    RUN_TEST(test_total_does_not_wrap_at_32_bits);
+    RUN_TEST(test_invalid_id_ignored);
+    RUN_TEST(test_reset_clears);
+    RUN_TEST(test_slowest_by_max);
+
+    RUN_TEST(test_ticks_to_us);
+    RUN_TEST(test_format_line);
+    RUN_TEST(test_format_truncates);
+
+    RUN_TEST(test_scope_records_on_exit);
+    RUN_TEST(test_scope_records_on_continue);
+
+    return UNITY_END();
+}
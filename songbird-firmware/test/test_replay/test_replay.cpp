@@ -0,0 +1,450 @@
+/**
+ * @file test_replay.cpp
+ * @brief Replay of recorded Notecard transcripts against the firmware logic
+ *
+ * Plays a transcript from the "transcript" command back through the real
+ * response handling (SongbirdNotecardParse.cpp) and what NotecardTask and
+ * EnvTask do with the results: env var parsing and GPS power management.
+ * millis() follows the recorded send times and latencies, so a hub.status
+ * stall or a slow sync lands on the same decisions it did in the field.
+ *
+ * Every request and response must print back to the recorded bytes, and
+ * the GPS power decisions must agree with the card.location.mode requests
+ * the device actually sent. Prints per-request timing and one line:
+ *
+ *   REPLAY {"requests":..,"bus_ms":..,"slowest_req":"hub.status",...}
+ *
+ * The built-in transcript covers a hub.status stall, a slow sync, an
+ * env.get I/O error and a GPS signal timeout. capture_demo.txt is a saved
+ * serial capture from a demo mode device, loaded from the file the way a
+ * field capture is. To replay a field capture:
+ *
+ *   PLATFORMIO_BUILD_FLAGS='-DREPLAY_FILE=\"capture.txt\"' pio test -e native -f test_replay -v
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+#include "NotecardReplay.h"
+
+// The modules under test are pure; compile the real ones (test_build_src = false)
+#include "SongbirdTranscript.cpp"
+#include "SongbirdNotecardParse.cpp"
+#include "SongbirdEnvParse.cpp"
+#include "SongbirdGpsPower.cpp"
+
+// ============================================================================
+// Built-in Transcript
+// ============================================================================
+
+// Transit mode, GPS searching without a signal. Debug output between the
+// NCT lines is skipped by the loader.
+static const char SAMPLE_TRANSCRIPT[] =
+    "[Commands] Executing: transcript\n"
+    "NCT\t0\t1000\t61000\t0\t{\"req\":\"card.location\"}\t{\"status\":\"GPS search (12 sec, 21/25 dB SNR, 0/1 sats) {gps-active} {gps-sats}\",\"mode\":\"periodic\"}\n"
+    "NCT\t1\t1250\t8250000\t0\t{\"req\":\"hub.status\"}\t{\"status\":\"connected (session open) {connected}\",\"connected\":true}\n"
+    "NCT\t2\t9600\t23000\t0\t{\"req\":\"env.modified\"}\t{\"time\":1767225900}\n"
+    "NCT\t3\t9700\t41000\t0\t{\"req\":\"env.get\",\"name\":\"mode\"}\t{\"text\":\"transit\",\"time\":1767225900}\n"
+    "NCT\t4\t9800\t1004000\t0\t{\"req\":\"env.get\",\"name\":\"sync_interval_min\"}\t{\"err\":\"env.get: I2C receive error {io}\"}\n"
+    "NCT\t5\t10900\t38000\t0\t{\"req\":\"env.get\",\"name\":\"heartbeat_hours\"}\t{\"text\":\"12\",\"time\":1767225900}\n"
+    "NCT\t6\t11000\t36000\t0\t{\"req\":\"env.get\",\"name\":\"gps_signal_timeout_min\"}\t{}\n"
+    "[Profile] env_fetch n=1 avg=1202 ms max=1202 ms\n"
+    "NCT\t7\t60000\t310000\t0\t{\"req\":\"hub.sync.status\"}\t{\"status\":\"sync in progress {sync-begin}\",\"requested\":45,\"time\":1767225000}\n"
+    "NCT\t8\t120000\t58000\t0\t{\"req\":\"card.location\"}\t{\"status\":\"GPS search (120 sec, 19/22 dB SNR, 0/0 sats) {gps-active}\",\"mode\":\"periodic\"}\n"
+    "NCT\t9\t901100\t60000\t0\t{\"req\":\"card.location\"}\t{\"status\":\"GPS search (900 sec, 18/20 dB SNR, 0/0 sats) {gps-active}\",\"mode\":\"periodic\"}\n"
+    "NCT\t10\t901200\t47000\t0\t{\"req\":\"card.location.mode\",\"mode\":\"off\"}\t{\"mode\":\"off\",\"seconds\":60}\n"
+    "NCT\t11\t905000\t1000000\t4\t{\"req\":\"card.time\"}\t\n";
+
+// Saved serial capture, relative to the project directory pio test runs in
+#define REPLAY_DEMO_CAPTURE     "test/test_replay/capture_demo.txt"
+
+// ============================================================================
+// Replayed Device State
+// ============================================================================
+
+#define REPLAY_MAX_REQUEST_TYPES    24
+
+typedef struct {
+    char name[J_STANDIN_NAME_LEN];
+    uint32_t count;
+    uint32_t failed;            // No response, or "err"
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint32_t maxSeq;
+} RequestStats;
+
+static SongbirdConfig s_config;
+static NotecardStatus s_status;
+static GpsPowerState s_gps;
+static GpsPowerAction s_gpsPending;     // Last DISABLE/RETRY decision not yet applied
+static uint32_t s_envModCount;
+
+static RequestStats s_stats[REPLAY_MAX_REQUEST_TYPES];
+static uint8_t s_statsCount;
+static uint32_t s_mismatches;           // Bytes differ after parse and print
+static uint32_t s_truncated;            // Not checked or applied
+static uint32_t s_divergences;          // Device did something the replayed logic did not decide
+static uint32_t s_envErrors;
+static uint32_t s_envModified;
+static uint32_t s_gpsDisables;
+static uint32_t s_gpsRetries;
+static uint32_t s_disableDecidedAtMs;
+
+void setUp(void) {
+    envInitDefaults(&s_config);
+    s_config.mode = MODE_TRANSIT;
+    memset(&s_status, 0, sizeof(s_status));
+    memset(&s_gps, 0, sizeof(s_gps));
+    s_gpsPending = GPS_POWER_NONE;
+    s_envModCount = 0;
+
+    memset(s_stats, 0, sizeof(s_stats));
+    s_statsCount = 0;
+    s_mismatches = 0;
+    s_truncated = 0;
+    s_divergences = 0;
+    s_envErrors = 0;
+    s_envModified = 0;
+    s_gpsDisables = 0;
+    s_gpsRetries = 0;
+    s_disableDecidedAtMs = 0;
+
+    mock_set_millis(0);
+}
+
+void tearDown(void) {}
+
+static RequestStats* statsFor(const char* name) {
+    for (uint8_t i = 0; i < s_statsCount; i++) {
+        if (strcmp(s_stats[i].name, name) == 0) {
+            return &s_stats[i];
+        }
+    }
+    if (s_statsCount >= REPLAY_MAX_REQUEST_TYPES) {
+        return &s_stats[REPLAY_MAX_REQUEST_TYPES - 1];
+    }
+    RequestStats* stats = &s_stats[s_statsCount++];
+    strncpy(stats->name, name, sizeof(stats->name) - 1);
+    return stats;
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+/**
+ * @brief Hand one response to the firmware code that issued the request
+ *
+ * Mirrors the callers in SongbirdNotecard.cpp, NotecardTask and EnvTask.
+ * Runs at the time the response arrived.
+ */
+static void applyResponse(const char* reqName, J* req, J* rsp) {
+    if (strcmp(reqName, "card.location") == 0) {
+        s_status.gpsValid = notecardParseLocation(rsp, &s_status);
+        if (s_status.gpsValid && s_config.mode == MODE_TRANSIT && s_config.gpsPowerSaveEnabled) {
+            GpsPowerInputs inputs;
+            inputs.active = s_status.gpsActive;
+            inputs.signal = s_status.gpsSignal;
+            inputs.lock = s_status.gpsLock;
+            GpsPowerAction action = gpsPowerUpdate(&s_gps, &s_config, &inputs, millis());
+            if (action == GPS_POWER_DISABLE || action == GPS_POWER_RETRY) {
+                if (s_gpsPending != action && action == GPS_POWER_DISABLE) {
+                    s_disableDecidedAtMs = millis();
+                }
+                s_gpsPending = action;
+            }
+        }
+    } else if (strcmp(reqName, "card.location.mode") == 0) {
+        // notecardDisableGPS() or notecardEnableTransitGPS() after a
+        // decision, or notecardConfigureGPS() for a config change. Turning
+        // GPS off in transit mode is only ever a power management decision.
+        bool disable = strcmp(JGetString(req, "mode"), "off") == 0;
+        GpsPowerAction action = disable ? GPS_POWER_DISABLE : GPS_POWER_RETRY;
+        if (action != s_gpsPending) {
+            if (disable && s_config.mode == MODE_TRANSIT) {
+                s_divergences++;
+            }
+        } else if (rsp != NULL && !JIsPresent(rsp, "err")) {
+            gpsPowerApplied(&s_gps, action, millis());
+            s_gpsPending = GPS_POWER_NONE;
+            if (disable) {
+                s_gpsDisables++;
+            } else {
+                s_gpsRetries++;
+            }
+        }
+    } else if (strcmp(reqName, "hub.status") == 0) {
+        if (rsp != NULL) {
+            s_status.connected = notecardParseConnected(rsp);
+            s_status.connectedAtMs = millis();
+        }
+    } else if (strcmp(reqName, "hub.sync.status") == 0) {
+        s_status.syncing = notecardParseSyncStatus(rsp, &s_status.lastSyncTime);
+    } else if (strcmp(reqName, "env.modified") == 0) {
+        uint32_t modCount = 0;
+        if (notecardParseEnvModified(rsp, &modCount) && modCount != s_envModCount) {
+            s_envModCount = modCount;
+            s_envModified++;
+        }
+    } else if (strcmp(reqName, "env.get") == 0) {
+        char value[32];
+        const char* name = JGetString(req, "name");
+        if (rsp == NULL || JIsPresent(rsp, "err")) {
+            s_envErrors++;
+        } else if (notecardParseEnvText(rsp, value, sizeof(value))) {
+            envApplyVar(&s_config, name, value);
+        }
+    }
+}
+
+/**
+ * @brief Replay the loaded transcript to the end
+ *
+ * @param stopAfterSeq Stop after this entry (UINT32_MAX for all)
+ */
+static void replayRun(uint32_t stopAfterSeq) {
+    const TranscriptEntry* entry;
+    while ((entry = replayBegin()) != NULL) {
+        J* req = replayParse(entry->request);
+        const char* reqName = (req != NULL) ? JGetString(req, "req") : "";
+        RequestStats* stats = statsFor(reqName[0] != '\0' ? reqName : "(unparsed)");
+
+        J* rsp = NULL;
+        bool noResponse = (entry->flags & TRANSCRIPT_FLAG_NO_RESPONSE) != 0;
+        if (!noResponse) {
+            rsp = replayParse(entry->response);
+        }
+
+        if (entry->flags & (TRANSCRIPT_FLAG_REQUEST_TRUNCATED | TRANSCRIPT_FLAG_RESPONSE_TRUNCATED)) {
+            s_truncated++;
+        } else {
+            if (!replayCheckBytes(req, entry->request) ||
+                (!noResponse && !replayCheckBytes(rsp, entry->response))) {
+                s_mismatches++;
+            }
+        }
+
+        stats->count++;
+        stats->totalUs += entry->latencyUs;
+        if (entry->latencyUs > stats->maxUs) {
+            stats->maxUs = entry->latencyUs;
+            stats->maxSeq = entry->seq;
+        }
+        if (rsp == NULL || JIsPresent(rsp, "err")) {
+            stats->failed++;
+        }
+
+        // The caller sees the response once the latency has passed
+        replayFinish(entry);
+        if (req != NULL && !(entry->flags & TRANSCRIPT_FLAG_RESPONSE_TRUNCATED)) {
+            applyResponse(reqName, req, rsp);
+        }
+
+        if (req != NULL) JDelete(req);
+        if (rsp != NULL) JDelete(rsp);
+
+        if (entry->seq == stopAfterSeq) {
+            break;
+        }
+    }
+}
+
+static void replayReport(void) {
+    char line[160];
+    uint64_t busUs = 0;
+    uint32_t requests = 0;
+    uint32_t failed = 0;
+    const RequestStats* slowest = NULL;
+
+    for (uint8_t i = 0; i < s_statsCount; i++) {
+        const RequestStats* stats = &s_stats[i];
+        snprintf(line, sizeof(line), "%-20s n=%-4lu failed=%-3lu avg=%lu ms max=%lu ms (seq %lu)",
+                 stats->name, (unsigned long)stats->count, (unsigned long)stats->failed,
+                 (unsigned long)(stats->totalUs / stats->count / 1000),
+                 (unsigned long)(stats->maxUs / 1000), (unsigned long)stats->maxSeq);
+        TEST_MESSAGE(line);
+
+        busUs += stats->totalUs;
+        requests += stats->count;
+        failed += stats->failed;
+        if (slowest == NULL || stats->maxUs > slowest->maxUs) {
+            slowest = stats;
+        }
+    }
+
+    printf("REPLAY {\"requests\":%lu,\"failed\":%lu,\"bus_ms\":%lu,\"slowest_req\":\"%s\","
+           "\"slowest_ms\":%lu,\"slowest_seq\":%lu,\"mismatches\":%lu,\"truncated\":%lu,"
+           "\"divergences\":%lu}\n",
+           (unsigned long)requests, (unsigned long)failed, (unsigned long)(busUs / 1000),
+           slowest ? slowest->name : "", (unsigned long)(slowest ? slowest->maxUs / 1000 : 0),
+           (unsigned long)(slowest ? slowest->maxSeq : 0), (unsigned long)s_mismatches,
+           (unsigned long)s_truncated, (unsigned long)s_divergences);
+}
+
+// ============================================================================
+// Built-in Transcript Tests
+// ============================================================================
+
+void test_sample_replays_byte_exact(void) {
+    TEST_ASSERT_EQUAL_UINT16(12, replayLoad(SAMPLE_TRANSCRIPT));
+    replayRun(UINT32_MAX);
+    replayReport();
+
+    TEST_ASSERT_EQUAL_UINT32(0, s_mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, s_truncated);
+    TEST_ASSERT_EQUAL_UINT32(0, s_divergences);
+}
+
+void test_latencies_reach_the_clock(void) {
+    replayLoad(SAMPLE_TRANSCRIPT);
+
+    // The hub.status stall: the caller sees the answer 8.25 s after asking
+    replayRun(1);
+    TEST_ASSERT_EQUAL_UINT32(1250 + 8250, millis());
+    TEST_ASSERT_TRUE(s_status.connected);
+    TEST_ASSERT_EQUAL_UINT32(9500, s_status.connectedAtMs);
+
+    replayRun(UINT32_MAX);
+    TEST_ASSERT_EQUAL_UINT32(905000 + 1000, millis());
+    TEST_ASSERT_EQUAL_STRING("hub.status", s_stats[1].name);
+    TEST_ASSERT_EQUAL_UINT32(8250000, s_stats[1].maxUs);
+}
+
+void test_env_error_keeps_default(void) {
+    replayLoad(SAMPLE_TRANSCRIPT);
+    replayRun(UINT32_MAX);
+
+    TEST_ASSERT_EQUAL_UINT32(1, s_envModified);
+    TEST_ASSERT_EQUAL_UINT32(1, s_envErrors);
+    TEST_ASSERT_EQUAL(MODE_TRANSIT, s_config.mode);
+    TEST_ASSERT_EQUAL_UINT16(DEFAULT_SYNC_INTERVAL_MIN, s_config.syncIntervalMin);
+    TEST_ASSERT_EQUAL_UINT16(12, s_config.heartbeatHours);
+    TEST_ASSERT_EQUAL_UINT8(DEFAULT_GPS_SIGNAL_TIMEOUT_MIN, s_config.gpsSignalTimeoutMin);  // Unset
+}
+
+void test_sync_status_from_replay(void) {
+    replayLoad(SAMPLE_TRANSCRIPT);
+    replayRun(7);
+
+    TEST_ASSERT_TRUE(s_status.syncing);
+    TEST_ASSERT_EQUAL_UINT32(1767225000, s_status.lastSyncTime);
+}
+
+void test_gps_timeout_follows_recorded_time(void) {
+    replayLoad(SAMPLE_TRANSCRIPT);
+    replayRun(UINT32_MAX);
+
+    // Timing started at the first card.location response (1000 + 61 ms) and
+    // ran out at the response to the one 15 minutes later
+    TEST_ASSERT_EQUAL_UINT32(901100 + 60, s_disableDecidedAtMs);
+    TEST_ASSERT_EQUAL_UINT32(1, s_gpsDisables);
+    TEST_ASSERT_TRUE(s_gps.saving);
+}
+
+void test_divergence_is_detected(void) {
+    // The device turned GPS off although the replayed logic has not timed out
+    replayLoad(
+        "NCT\t0\t1000\t50000\t0\t{\"req\":\"card.location\"}\t{\"status\":\"GPS search {gps-active}\"}\n"
+        "NCT\t1\t2000\t50000\t0\t{\"req\":\"card.location.mode\",\"mode\":\"off\"}\t{\"mode\":\"off\"}\n");
+    replayRun(UINT32_MAX);
+
+    TEST_ASSERT_EQUAL_UINT32(1, s_divergences);
+    TEST_ASSERT_FALSE(s_gps.saving);
+}
+
+void test_byte_mismatch_is_detected(void) {
+    // Not note-c output (whitespace), so it does not print back identically
+    replayLoad("NCT\t0\t0\t1000\t0\t{\"req\":\"hub.status\"}\t{\"connected\": true}\n");
+    replayRun(UINT32_MAX);
+
+    TEST_ASSERT_EQUAL_UINT32(1, s_mismatches);
+    TEST_ASSERT_TRUE(s_status.connected);
+}
+
+void test_codec_round_trip(void) {
+    const char* json =
+        "{\"status\":\"a \\\"quoted\\\" \\\\ tab\\t nl\\n ctl\\u0001\",\"lat\":42.577600000000004,"
+        "\"lon\":-70.87173333333334,\"n\":-3,\"e\":1.5e-07,\"ok\":false,\"files\":[\"a\",{\"b\":\"]\"}],"
+        "\"body\":{\"x\":1},\"none\":null}";
+    J* object = replayParse(json);
+    TEST_ASSERT_NOT_NULL(object);
+    TEST_ASSERT_TRUE(replayCheckBytes(object, json));
+    TEST_ASSERT_EQUAL_FLOAT(42.5776f, (float)JGetNumber(object, "lat"));
+    TEST_ASSERT_EQUAL(-3, JGetInt(object, "n"));
+    TEST_ASSERT_FALSE(JGetBool(object, "ok"));
+    TEST_ASSERT_EQUAL_STRING("", JGetString(object, "body"));
+    JDelete(object);
+
+    TEST_ASSERT_NULL(replayParse("{\"a\":"));
+    TEST_ASSERT_NULL(replayParse("{\"a\":[1,2}"));
+    TEST_ASSERT_NULL(replayParse("not json"));
+}
+
+// ============================================================================
+// Field Capture
+// ============================================================================
+
+void test_recorded_capture_file(void) {
+    TEST_ASSERT_EQUAL_UINT16(8, replayLoadFile(REPLAY_DEMO_CAPTURE));
+    s_config.mode = MODE_TRANSIT;   // Until the env.get "mode" response
+    replayRun(UINT32_MAX);
+    replayReport();
+
+    TEST_ASSERT_EQUAL_UINT32(0, s_mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, s_truncated);
+    TEST_ASSERT_EQUAL_UINT32(0, s_divergences);
+
+    TEST_ASSERT_EQUAL(MODE_DEMO, s_config.mode);
+    TEST_ASSERT_EQUAL_UINT8(40, s_config.audioVolume);
+    TEST_ASSERT_EQUAL_FLOAT(DEFAULT_TEMP_ALERT_HIGH_C, s_config.tempAlertHighC);  // Unset
+    TEST_ASSERT_FALSE(s_status.syncing);
+    TEST_ASSERT_EQUAL_UINT32(1767312050, s_status.lastSyncTime);
+
+    // The last hub.status got no response: still connected as of the first
+    TEST_ASSERT_TRUE(s_status.connected);
+    TEST_ASSERT_EQUAL_UINT32(500 + 212, s_status.connectedAtMs);
+    TEST_ASSERT_EQUAL_UINT32(65000 + 1000, millis());
+    TEST_ASSERT_EQUAL_UINT32(1, statsFor("hub.status")->failed);
+}
+
+void test_missing_capture_file(void) {
+    TEST_ASSERT_EQUAL_UINT16(0, replayLoadFile("test/test_replay/no_such_capture.txt"));
+    TEST_ASSERT_NULL(replayBegin());
+}
+
+#ifdef REPLAY_FILE
+void test_capture_file(void) {
+    TEST_ASSERT_TRUE_MESSAGE(replayLoadFile(REPLAY_FILE) > 0, "No NCT lines in " REPLAY_FILE);
+    s_config.mode = MODE_DEMO;  // Follows the env.get "mode" responses if present
+    replayRun(UINT32_MAX);
+    replayReport();
+
+    TEST_ASSERT_EQUAL_UINT32(0, s_mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, s_divergences);
+}
+#endif
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_sample_replays_byte_exact);
+    RUN_TEST(test_latencies_reach_the_clock);
+    RUN_TEST(test_env_error_keeps_default);
+    RUN_TEST(test_sync_status_from_replay);
+    RUN_TEST(test_gps_timeout_follows_recorded_time);
+    RUN_TEST(test_divergence_is_detected);
+    RUN_TEST(test_byte_mismatch_is_detected);
+    RUN_TEST(test_codec_round_trip);
+    RUN_TEST(test_recorded_capture_file);
+    RUN_TEST(test_missing_capture_file);
+
+    #ifdef REPLAY_FILE
+    RUN_TEST(test_capture_file);
+    #endif
+
+    return UNITY_END();
+}
@@ -0,0 +1,266 @@
+/**
+ * @file test_runstats.cpp
+ * @brief Unit tests for run-time statistics reporting
+ *
+ * Tests the sample -> report reduction from SongbirdRunStats.cpp (per-task
+ * load, CPU load from idle time, wake deltas, I2C wait conversion and
+ * widening of the wrapping 32-bit run-time counters) using PlatformIO Unity
+ * on the native platform. This is the
+ * host-side equivalent of the on-target health.qo statistics.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// Report computation is pure; compile the real module (test_build_src = false)
+#include "SongbirdRunStats.cpp"
+
+// 80 MHz >> RUNSTATS_COUNTER_SHIFT
+static const uint32_t COUNTER_HZ = 312500;
+
+static RunStatsSample s_prev;
+static RunStatsSample s_cur;
+static RunStatsReport s_report;
+static RunStatsWidener s_widener;
+
+// Widen raw 32-bit counters the way runStatsCollect() does
+static void widen_into(RunStatsSample* sample, uint32_t total, uint32_t idle, uint32_t main) {
+    uint32_t runTime[RUNSTATS_TASK_COUNT] = { 0 };
+    runTime[RUNSTATS_TASK_IDLE] = idle;
+    runTime[RUNSTATS_TASK_MAIN] = main;
+    runStatsWiden(&s_widener, total, runTime);
+    sample->totalTime = s_widener.totalTime;
+    memcpy(sample->runTime, s_widener.runTime, sizeof(sample->runTime));
+}
+
+void setUp(void) {
+    memset(&s_widener, 0, sizeof(s_widener));
+    memset(&s_prev, 0, sizeof(s_prev));
+    memset(&s_cur, 0, sizeof(s_cur));
+    memset(&s_report, 0xA5, sizeof(s_report));
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// CPU Load
+// ============================================================================
+
+void test_load_is_share_of_window(void) {
+    // 10 second window: main 1s, sensor 0.5s, idle 8.5s
+    s_cur.totalTime = 10 * COUNTER_HZ;
+    s_cur.runTime[RUNSTATS_TASK_MAIN] = COUNTER_HZ;
+    s_cur.runTime[RUNSTATS_TASK_SENSOR] = COUNTER_HZ / 2;
+    s_cur.runTime[RUNSTATS_TASK_IDLE] = 17 * COUNTER_HZ / 2;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(10000, s_report.windowMs);
+    TEST_ASSERT_EQUAL_UINT16(100, s_report.loadPermille[RUNSTATS_TASK_MAIN]);
+    TEST_ASSERT_EQUAL_UINT16(50, s_report.loadPermille[RUNSTATS_TASK_SENSOR]);
+    TEST_ASSERT_EQUAL_UINT16(850, s_report.loadPermille[RUNSTATS_TASK_IDLE]);
+    TEST_ASSERT_EQUAL_UINT16(0, s_report.loadPermille[RUNSTATS_TASK_AUDIO]);
+}
+
+void test_cpu_load_is_non_idle_time(void) {
+    s_cur.totalTime = 1000;
+    s_cur.runTime[RUNSTATS_TASK_IDLE] = 970;
+    s_cur.runTime[RUNSTATS_TASK_NOTECARD] = 30;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT16(30, s_report.cpuPermille);
+}
+
+void test_load_is_clamped(void) {
+    // Run time sampled slightly after the total can exceed the window
+    s_cur.totalTime = 1000;
+    s_cur.runTime[RUNSTATS_TASK_MAIN] = 1010;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT16(1000, s_report.loadPermille[RUNSTATS_TASK_MAIN]);
+    TEST_ASSERT_EQUAL_UINT16(1000, s_report.cpuPermille);
+}
+
+void test_window_is_delta_between_samples(void) {
+    s_prev.totalTime = 5000;
+    s_prev.runTime[RUNSTATS_TASK_IDLE] = 4000;
+    s_cur.totalTime = 6000;
+    s_cur.runTime[RUNSTATS_TASK_IDLE] = 4500;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT16(500, s_report.loadPermille[RUNSTATS_TASK_IDLE]);
+    TEST_ASSERT_EQUAL_UINT16(500, s_report.cpuPermille);
+}
+
+void test_counter_wrap(void) {
+    // 32-bit counters wrap between samples
+    widen_into(&s_prev, UINT32_MAX - 499, UINT32_MAX - 99, 0);
+    widen_into(&s_cur, 500, 800, 0);
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT16(900, s_report.loadPermille[RUNSTATS_TASK_IDLE]);
+    TEST_ASSERT_EQUAL_UINT16(100, s_report.cpuPermille);
+}
+
+void test_heartbeat_window_spans_several_wraps(void) {
+    // 24 hours at 10% main, 90% idle, widened every RUNSTATS_UPDATE_INTERVAL_MS;
+    // the 32-bit counters wrap about six times
+    const uint64_t perUpdate = (uint64_t)COUNTER_HZ * (RUNSTATS_UPDATE_INTERVAL_MS / 1000);
+    uint64_t total = 0;
+    widen_into(&s_prev, 0, 0, 0);
+    for (uint8_t hour = 0; hour < 24; hour++) {
+        total += perUpdate;
+        widen_into(&s_cur, (uint32_t)total, (uint32_t)(total * 9 / 10), (uint32_t)(total / 10));
+    }
+    TEST_ASSERT_TRUE(total > 5ULL * UINT32_MAX);
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(24UL * 3600UL * 1000UL, s_report.windowMs);
+    TEST_ASSERT_EQUAL_UINT16(900, s_report.loadPermille[RUNSTATS_TASK_IDLE]);
+    TEST_ASSERT_EQUAL_UINT16(100, s_report.loadPermille[RUNSTATS_TASK_MAIN]);
+    TEST_ASSERT_EQUAL_UINT16(100, s_report.cpuPermille);
+}
+
+void test_update_interval_is_inside_wrap(void) {
+    uint64_t wrapSec = (1ULL << 32) / COUNTER_HZ;
+    TEST_ASSERT_TRUE(RUNSTATS_UPDATE_INTERVAL_MS / 1000 < wrapSec);
+}
+
+void test_empty_window_reports_zero(void) {
+    s_prev.totalTime = 1234;
+    s_cur.totalTime = 1234;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(0, s_report.windowMs);
+    TEST_ASSERT_EQUAL_UINT16(0, s_report.cpuPermille);
+    TEST_ASSERT_EQUAL_UINT16(0, s_report.loadPermille[RUNSTATS_TASK_IDLE]);
+}
+
+// ============================================================================
+// Wakes and I2C Contention
+// ============================================================================
+
+void test_wakes_are_deltas(void) {
+    s_prev.wakes[RUNSTATS_TASK_SENSOR] = 10;
+    s_cur.wakes[RUNSTATS_TASK_SENSOR] = 70;
+    s_prev.wakes[RUNSTATS_TASK_ENV] = UINT32_MAX;
+    s_cur.wakes[RUNSTATS_TASK_ENV] = 4;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(60, s_report.wakes[RUNSTATS_TASK_SENSOR]);
+    TEST_ASSERT_EQUAL_UINT32(5, s_report.wakes[RUNSTATS_TASK_ENV]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_report.wakes[RUNSTATS_TASK_MAIN]);
+}
+
+void test_i2c_wait_in_ms(void) {
+    s_prev.i2cAcquires = 100;
+    s_prev.i2cWaitTime = COUNTER_HZ;
+    s_cur.i2cAcquires = 150;
+    s_cur.i2cWaitTime = COUNTER_HZ + COUNTER_HZ / 4;
+    s_cur.i2cWaitMax = COUNTER_HZ / 10;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(50, s_report.i2cAcquires);
+    TEST_ASSERT_EQUAL_UINT32(250, s_report.i2cWaitMs);
+    // Max is reset per sample, so it is taken from the current sample only
+    TEST_ASSERT_EQUAL_UINT32(100, s_report.i2cWaitMaxMs);
+}
+
+void test_long_window_ms_does_not_overflow(void) {
+    // A full hour at the target counter rate
+    s_cur.totalTime = 3600 * COUNTER_HZ;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(3600000, s_report.windowMs);
+}
+
+void test_zero_counter_hz(void) {
+    s_cur.totalTime = 1000;
+    s_cur.i2cWaitTime = 500;
+
+    runStatsComputeReport(&s_prev, &s_cur, 0, &s_report);
+
+    TEST_ASSERT_EQUAL_UINT32(0, s_report.windowMs);
+    TEST_ASSERT_EQUAL_UINT32(0, s_report.i2cWaitMs);
+}
+
+void test_null_arguments(void) {
+    RunStatsReport untouched;
+    memset(&untouched, 0xA5, sizeof(untouched));
+
+    runStatsComputeReport(NULL, &s_cur, COUNTER_HZ, &s_report);
+    runStatsComputeReport(&s_prev, NULL, COUNTER_HZ, &s_report);
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, NULL);
+
+    TEST_ASSERT_EQUAL_MEMORY(&untouched, &s_report, sizeof(s_report));
+}
+
+void test_task_names(void) {
+    TEST_ASSERT_EQUAL_STRING("main", runStatsTaskName(RUNSTATS_TASK_MAIN));
+    TEST_ASSERT_EQUAL_STRING("idle", runStatsTaskName(RUNSTATS_TASK_IDLE));
+    TEST_ASSERT_EQUAL_STRING("unknown", runStatsTaskName(RUNSTATS_TASK_COUNT));
+}
+
+// ============================================================================
+// Stack High-Water Marks
+// ============================================================================
+
+void test_stack_free_is_from_current_sample(void) {
+    for (uint8_t i = 0; i < RUNSTATS_TASK_COUNT; i++) {
+        s_prev.stackFreeMin[i] = 4000;
+        s_cur.stackFreeMin[i] = RUNSTATS_STACK_UNKNOWN;
+    }
+    s_cur.stackFreeMin[RUNSTATS_TASK_NOTECARD] = 1320;
+    s_cur.stackFreeMin[RUNSTATS_TASK_AUDIO] = 96;
+
+    runStatsComputeReport(&s_prev, &s_cur, COUNTER_HZ, &s_report);
+
+    // Since boot, not a delta over the window
+    TEST_ASSERT_EQUAL_UINT16(1320, s_report.stackFreeMin[RUNSTATS_TASK_NOTECARD]);
+    TEST_ASSERT_EQUAL_UINT16(96, s_report.stackFreeMin[RUNSTATS_TASK_AUDIO]);
+    TEST_ASSERT_EQUAL_UINT16(RUNSTATS_STACK_UNKNOWN, s_report.stackFreeMin[RUNSTATS_TASK_MAIN]);
+}
+
+// ============================================================================
+// Test Runner
+// ============================================================================
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+
+    // CPU load
+    RUN_TEST(test_load_is_share_of_window);
+    RUN_TEST(test_cpu_load_is_non_idle_time);
+    RUN_TEST(test_load_is_clamped);
+    RUN_TEST(test_window_is_delta_between_samples);
+    RUN_TEST(test_counter_wrap);
+    RUN_TEST(test_heartbeat_window_spans_several_wraps);
+    RUN_TEST(test_update_interval_is_inside_wrap);
+    RUN_TEST(test_empty_window_reports_zero);
+
+    // Wakes and I2C contention
+    RUN_TEST(test_wakes_are_deltas);
+    RUN_TEST(test_i2c_wait_in_ms);
+    RUN_TEST(test_long_window_ms_does_not_overflow);
+    RUN_TEST(test_zero_counter_hz);
+    RUN_TEST(test_null_arguments);
+    RUN_TEST(test_task_names);
+
+    // Stack high-water marks
+    RUN_TEST(test_stack_free_is_from_current_sample);
+
+    return UNITY_END();
+}
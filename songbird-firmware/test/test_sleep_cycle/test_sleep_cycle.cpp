@@ -0,0 +1,185 @@
+/**
+ * @file test_sleep_cycle.cpp
+ * @brief Unit tests for the deep sleep cycle decisions
+ *
+ * Tests the report-cycle bits, the cold-boot and retry guards and the timer
+ * wake from SongbirdSleepCycle.cpp using PlatformIO Unity on the native
+ * platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// Sleep cycle, env intervals and policy are pure; compile the real modules (test_build_src = false)
+#include "SongbirdPowerPolicy.cpp"
+#include "SongbirdEnvParse.cpp"
+#include "SongbirdSleepCycle.cpp"
+
+// Sleep bits 0-5 and ATTN bits 8-9 that share g_sleepEvent (SongbirdSync.h)
+#define OTHER_EVENT_BITS    0x033F
+
+static SongbirdConfig s_config;
+static SleepCycleInputs s_inputs;
+
+void setUp(void) {
+    envInitDefaults(&s_config);
+    s_config.mode = MODE_STORAGE;
+    powerPolicyReset();
+
+    // A warm boot whose report cycle is complete
+    memset(&s_inputs, 0, sizeof(s_inputs));
+    s_inputs.mode = MODE_STORAGE;
+    s_inputs.warmBoot = true;
+    s_inputs.nowMs = 5000;
+    s_inputs.eventBits = CYCLE_BITS_ALL;
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Report-Cycle Bits
+// ============================================================================
+
+void test_cycle_bits_do_not_overlap_other_bits(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, CYCLE_BITS_ALL & OTHER_EVENT_BITS);
+    TEST_ASSERT_NOT_EQUAL(CYCLE_BIT_SENSOR, CYCLE_BIT_COMMAND);
+}
+
+void test_due_when_all_cycle_bits_set(void) {
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+}
+
+void test_not_due_until_every_task_is_done(void) {
+    s_inputs.eventBits = CYCLE_BIT_SENSOR;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.eventBits = CYCLE_BIT_COMMAND;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.eventBits = 0;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+}
+
+void test_other_event_bits_do_not_count(void) {
+    // Sleep-ready, request and ATTN bits alone are not a finished cycle
+    s_inputs.eventBits = OTHER_EVENT_BITS;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+
+    // Nor do they block one
+    s_inputs.eventBits = OTHER_EVENT_BITS | CYCLE_BITS_ALL;
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+}
+
+void test_not_due_with_notes_pending(void) {
+    s_inputs.notesPending = 1;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+}
+
+// ============================================================================
+// Guards
+// ============================================================================
+
+void test_only_storage_and_sleep_modes(void) {
+    const OperatingMode awake[] = { MODE_DEMO, MODE_TRANSIT };
+    for (uint8_t i = 0; i < 2; i++) {
+        s_inputs.mode = awake[i];
+        TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    }
+    s_inputs.mode = MODE_SLEEP;
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+}
+
+void test_not_due_while_busy(void) {
+    s_inputs.busy = true;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+}
+
+void test_cold_boot_stays_awake(void) {
+    s_inputs.warmBoot = false;
+    s_inputs.nowMs = SLEEP_CYCLE_COLD_BOOT_AWAKE_MS - 1;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.nowMs = SLEEP_CYCLE_COLD_BOOT_AWAKE_MS;
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+}
+
+void test_failed_attempt_backs_off(void) {
+    s_inputs.lastAttemptMs = sleepCycleAttemptFailed(s_inputs.nowMs);
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.nowMs += SLEEP_CYCLE_RETRY_MS - 1;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.nowMs += 1;
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+
+    // MainTask clears the cycle bits after a failure: wait for a fresh cycle
+    s_inputs.eventBits = 0;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+}
+
+void test_back_off_across_wrap(void) {
+    TEST_ASSERT_EQUAL_UINT32(1, sleepCycleAttemptFailed(0));
+    s_inputs.lastAttemptMs = sleepCycleAttemptFailed(UINT32_MAX - 1000);
+    s_inputs.nowMs = 5000;
+    TEST_ASSERT_FALSE(sleepCycleDue(&s_inputs));
+    s_inputs.nowMs = SLEEP_CYCLE_RETRY_MS;
+    TEST_ASSERT_TRUE(sleepCycleDue(&s_inputs));
+}
+
+// ============================================================================
+// Timer Wake
+// ============================================================================
+
+void test_storage_sleeps_gps_interval(void) {
+    s_config.gpsIntervalMin = 30;
+    TEST_ASSERT_EQUAL_UINT32(1800, sleepCycleDurationSec(&s_config, 0));
+}
+
+void test_sleep_is_cut_short_at_heartbeat(void) {
+    s_config.gpsIntervalMin = 120;
+    uint32_t heartbeatSec = HOURS_TO_SEC(s_config.heartbeatHours);
+    TEST_ASSERT_EQUAL_UINT32(600, sleepCycleDurationSec(&s_config, heartbeatSec - 600));
+
+    // Overdue (or never reported): the mode timer, not a zero-length sleep
+    TEST_ASSERT_EQUAL_UINT32(7200, sleepCycleDurationSec(&s_config, UINT32_MAX));
+}
+
+void test_sleep_mode_wakes_for_heartbeat(void) {
+    s_config.mode = MODE_SLEEP;
+    TEST_ASSERT_EQUAL_UINT32(HOURS_TO_SEC(s_config.heartbeatHours),
+                             sleepCycleDurationSec(&s_config, 0));
+}
+
+void test_sleep_is_stretched_and_floored(void) {
+    s_config.gpsIntervalMin = 30;
+    TEST_ASSERT_TRUE(powerPolicyUpdate(&s_config, 3.2f, false));
+    TEST_ASSERT_EQUAL_UINT32(1800 * DEFAULT_POWER_POLICY_MAX_SCALE,
+                             sleepCycleDurationSec(&s_config, 0));
+
+    uint32_t heartbeatSec = HOURS_TO_SEC(s_config.heartbeatHours);
+    TEST_ASSERT_EQUAL_UINT32(SLEEP_CYCLE_MIN_SEC, sleepCycleDurationSec(&s_config, heartbeatSec - 1));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_cycle_bits_do_not_overlap_other_bits);
+    RUN_TEST(test_due_when_all_cycle_bits_set);
+    RUN_TEST(test_not_due_until_every_task_is_done);
+    RUN_TEST(test_other_event_bits_do_not_count);
+    RUN_TEST(test_not_due_with_notes_pending);
+
+    RUN_TEST(test_only_storage_and_sleep_modes);
+    RUN_TEST(test_not_due_while_busy);
+    RUN_TEST(test_cold_boot_stays_awake);
+    RUN_TEST(test_failed_attempt_backs_off);
+    RUN_TEST(test_back_off_across_wrap);
+
+    RUN_TEST(test_storage_sleeps_gps_interval);
+    RUN_TEST(test_sleep_is_cut_short_at_heartbeat);
+    RUN_TEST(test_sleep_mode_wakes_for_heartbeat);
+    RUN_TEST(test_sleep_is_stretched_and_floored);
+
+    return UNITY_END();
+}
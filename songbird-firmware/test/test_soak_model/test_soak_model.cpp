@@ -0,0 +1,1118 @@
+/**
+ * @file test_soak_model.cpp
+ * @brief Accelerated-time soak model of weeks of device operation
+ *
+ * Runs SOAK_DAYS of scripted operation in about a second: mode changes
+ * through env vars, USB and battery power, GPS sky view, Notecard and
+ * cellular outages, heat events and inbound commands. Time advances in
+ * SOAK_TICK_MS steps through mock_set_millis(); millis() restarts on every
+ * deep sleep wake and wraps after 49.7 days of uptime, which the default
+ * script crosses in transit mode.
+ *
+ * The scheduling and the note path are the firmware's own pure modules.
+ * The sensor, command and env work runs from the JOBS_MODE schedule
+ * (SongbirdJobs.cpp): each tick pops the due jobs, does their work and hands
+ * the result to jobsFinished(), and an env change brings JOB_ENV forward
+ * with jobsRunNow() as its ATTN event does. Notes go through
+ * noteSpillOffer(), the queue-or-spill step of syncQueueNote(), and the
+ * NotecardTask step pops the queue, replays the spill once it is empty and
+ * offers an unsent note back, pausing NOTE_SEND_RETRY_MS. The alert engine,
+ * env parsing and intervals, the power policy, cadence, metrics, GPS power
+ * management and the deep sleep cycle are real as well.
+ *
+ * What the job bodies talk to is stood in for: the BME280, the battery, the
+ * GPS receiver and the Notecard. The Notecard answers J requests built with
+ * the test/support Notecard.h stand-in, and its answers are read by the
+ * real response parsing (SongbirdNotecardParse.cpp); while it is down it
+ * returns no response, as requestAndResponse() does. Each request charges
+ * estimated I2C bus time and current so runs can be compared.
+ *
+ * Prints a report and one machine-readable line:
+ *
+ *   SOAK {"days":60,"notes_sent":..,"bus_s":..,"energy_mah":..,...}
+ *
+ * and checks the long-horizon invariants: the state machines keep working
+ * across the millis() wrap, health reports never miss a heartbeat, commands
+ * are handled within one inbound sync interval of being deliverable, no
+ * note the spill can hold is lost through a Notecard outage, and nothing
+ * allocates.
+ *
+ * Build with -D SOAK_DAYS=n to change the length (the script repeats).
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+#include "Notecard.h"
+#include "alloc_count.h"
+
+// The modules under test are pure; compile the real ones (test_build_src = false)
+#include "SongbirdEnvParse.cpp"
+#include "SongbirdPowerPolicy.cpp"
+#include "SongbirdCadence.cpp"
+#include "SongbirdAlertEngine.cpp"
+#include "SongbirdAlertNote.cpp"
+#include "SongbirdNoteQueue.cpp"
+#include "SongbirdNoteSpill.cpp"
+#include "SongbirdMetrics.cpp"
+#include "SongbirdGpsPower.cpp"
+#include "SongbirdCommandTable.cpp"
+#include "SongbirdSleepCycle.cpp"
+#include "SongbirdTimerQueue.cpp"
+#include "SongbirdJobs.cpp"
+#include "SongbirdBME280.cpp"
+#include "SongbirdNotecardParse.cpp"
+
+#ifndef SOAK_DAYS
+#define SOAK_DAYS               60
+#endif
+
+#define SOAK_TICK_MS            1000UL
+#define SOAK_DAY_SEC            86400UL
+#define SOAK_START_EPOCH        1767225600UL    // 2026-01-01 00:00 UTC
+
+// ============================================================================
+// Stand-in Costs
+// ============================================================================
+
+// Rough figures for comparing runs, not a power budget
+#define SIM_HOST_AWAKE_MA       5.0     // Cygnet running (host off in deep sleep)
+#define SIM_NOTECARD_IDLE_MA    0.01
+#define SIM_GPS_MA              25.0    // Receiver searching or tracking
+#define SIM_RADIO_CONTINUOUS_MA 12.0    // Continuous mode average
+#define SIM_SYNC_MAS            2500.0  // One periodic sync session (mA x s)
+#define SIM_BATTERY_MAH         2000.0
+#define SIM_CHARGE_MA           400.0
+
+// I2C time per request, including Notecard processing
+#define SIM_BUS_NOTE_ADD_MS     25
+#define SIM_BUS_SENSOR_MS       18      // BME280 read, card.voltage, card.time
+#define SIM_BUS_BME280_START_MS 1       // Trigger a forced conversion
+#define SIM_BUS_COMMAND_POLL_MS 8       // note.get
+#define SIM_BUS_STATUS_MS       10      // card.location (+ hub.sync.status)
+#define SIM_BUS_ENV_CHECK_MS    6       // env.modified
+#define SIM_BUS_ENV_VAR_MS      7       // env.get, per variable
+#define SIM_BUS_HUB_SET_MS      12      // hub.set, card.location.mode
+#define SIM_BUS_SLEEP_MS        40      // State save and card.attn
+
+// GPS receiver
+#define SIM_GPS_SIGNAL_SEC      10      // Satellites in view after power-up
+#define SIM_GPS_FIX_SEC         35      // Fix, then powers down until the next period
+
+// Awake time of a deep sleep wake cycle once the reports are queued
+#define SIM_WAKE_SETTLE_MS      5000UL
+
+// ============================================================================
+// Scenario
+// ============================================================================
+
+typedef struct {
+    uint16_t startDay;
+    const char* mode;           // mode env var
+    uint8_t usbHours;           // Hours per day on USB or vehicle power, from 08:00
+    uint8_t obstructedPct;      // Share of hours on battery with no GPS sky view
+    uint16_t commandsPerDay;
+    const char* syncIntervalMin;    // sync_interval_min env var
+    const char* gpsIntervalMin;     // gps_interval_min env var
+} SoakPhase;
+
+// Demo and transit keep the host up, so millis() runs past its wrap at
+// day 49.7 before the storage phase starts deep sleep cycles
+static const SoakPhase SOAK_SCRIPT[] = {
+    //  day  mode       usb  obstructed  cmds/day  sync_interval_min  gps_interval_min
+    {   0,  "demo",     24,    0,        144,      "15",              "1"  },
+    {   2,  "transit",   8,   60,          6,      "15",              "5"  },
+    {  16,  "demo",     24,    0,        144,      "15",              "1"  },
+    {  17,  "transit",   6,   80,          6,      "30",              "5"  },
+    {  47,  "transit",   0,   90,          6,      "30",              "5"  },  // Parked, no power
+    {  52,  "storage",   0,  100,          2,      "60",              "60" },
+    {  56,  "sleep",     0,  100,          1,      "60",              "60" },
+    {  58,  "transit",   8,   60,          6,      "15",              "5"  },
+};
+#define SOAK_SCRIPT_DAYS        60
+#define SOAK_PHASE_COUNT        (sizeof(SOAK_SCRIPT) / sizeof(SOAK_SCRIPT[0]))
+
+typedef struct {
+    uint32_t startSec;          // Seconds from the start of the run
+    uint16_t minutes;
+    bool notecard;              // Notecard unresponsive (else cellular only)
+} SoakOutage;
+
+// The Notecard outages outlast the note queue at one reading a minute, so
+// their notes only survive through the spill
+static const SoakOutage SOAK_OUTAGES[] = {
+    { 5 * SOAK_DAY_SEC + 14 * 3600,     90, false },
+    { 12 * SOAK_DAY_SEC + 3 * 3600,     20, true  },    // Notecard firmware update
+    { 16 * SOAK_DAY_SEC + 11 * 3600,    30, true  },    // Demo: alerts, acks and tracks
+    { 30 * SOAK_DAY_SEC + 9 * 3600,    480, false },
+    { 49 * SOAK_DAY_SEC + 16 * 3600,   240, false },    // Around the millis() wrap
+    { 50 * SOAK_DAY_SEC + 1 * 3600,     10, true  },
+    { 54 * SOAK_DAY_SEC + 0 * 3600,    600, false },
+};
+#define SOAK_OUTAGE_COUNT       (sizeof(SOAK_OUTAGES) / sizeof(SOAK_OUTAGES[0]))
+
+static const char* const SOAK_COMMANDS[] = { "ping", "locate", "play_melody", "set_volume" };
+
+// ============================================================================
+// Stand-in State
+// ============================================================================
+
+// MainTask's health check and NotecardTask's status poll, which have no job
+// schedule of their own
+typedef enum {
+    SOAK_TIMER_HEALTH = 0,
+    SOAK_TIMER_STATUS
+} SoakTimer;
+
+typedef struct {
+    // Host
+    SongbirdConfig config;
+    bool awake;
+    uint64_t wakeAtSec;             // Timer wake while asleep
+    uint64_t bootSimMs;             // Simulation time of the last boot
+    bool coldBoot;
+    uint32_t lastMillis;
+    uint8_t alerts;                 // Active alerts (persisted in state)
+    AlertEngineState engine;        // Persisted in state
+    uint32_t lastHealthEpoch;       // Persisted in state
+    MetricsSnapshot reportedMetrics;
+    GpsPowerState gps;              // Persisted in state
+    NotecardCadence cadence;
+    uint32_t envModCount;           // Last env.modified time seen
+
+    // Tasks (RAM, restarted on every boot)
+    JobSchedule jobs;               // JobsTask
+    TimerQueue periods;             // SoakTimer
+    uint32_t sensorIntervalMs;      // Reading in progress
+    uint32_t sendRetryMs;           // NotecardTask paused after a failed send until
+    bool sendPaused;
+    bool sensorDone;                // Wake cycle bits
+    bool commandDone;
+
+    // Outbound
+    NoteQueue queue;
+    NoteSpill spill;
+
+    // Notecard and the world
+    const SoakPhase* phase;         // Env vars on Notehub
+    uint32_t envModified;           // Their env.modified time
+    uint32_t notecardPending;       // Notes added since the last sync
+    uint64_t lastSyncSec;
+    bool syncRequested;
+    uint32_t commandsWaiting;       // At Notehub
+    uint32_t commandsDelivered;     // On the Notecard
+    uint64_t commandQueuedSec[8];
+    uint32_t commandBlockedSec[8];  // Time at Notehub with no inbound sync possible
+    bool gpsEnabled;                // Not turned off by power management
+    bool gpsActive;
+    uint64_t gpsActiveSinceSec;
+    uint32_t gpsBlindSec;           // Active without signal, so far
+    uint64_t gpsNextRunSec;
+    double batteryMah;
+} SoakDevice;
+
+typedef struct {
+    uint32_t notesQueued;           // Notes the tasks created
+    uint32_t notesSent[4];          // By NoteType
+    uint32_t notesFailed;           // note.add got no response (offered back)
+    uint32_t notesLost[4];          // Neither queued nor spilled, by NoteType
+    uint32_t notesLostInOutage;
+    uint32_t notesSpilled;
+    uint32_t syncs;
+    uint32_t syncsFailed;
+    uint64_t busMs;
+    double energyMah;
+    double batteryMah;              // Drawn from the battery
+    float minVoltage;
+    uint32_t gpsTimeouts;
+    uint32_t gpsRetries;
+    uint32_t gpsRetriesAfterWrap;
+    uint64_t gpsActiveSec;
+    uint32_t gpsLongestBlindSec;    // Longest time active without signal while managed
+    uint32_t jobs;
+    uint32_t wakes;
+    uint32_t millisWraps;
+    uint32_t alertsRaised;
+    uint32_t commands;
+    uint64_t commandLatencySec;
+    uint32_t commandLatencyMaxSec;
+    uint32_t commandServiceMaxSec;  // Latency less the blocked time
+    uint32_t healthNotes;
+    uint32_t healthMaxGapSec;
+    uint32_t scaleChanges;
+    uint32_t allocs;
+} SoakCounters;
+
+static SoakDevice s_dev;
+static SoakCounters s_count;
+static uint64_t s_nowSec;           // Simulation time
+static uint32_t s_rng = 20260101;
+
+static uint32_t sim_random(uint32_t low, uint32_t high) {
+    s_rng = s_rng * 1103515245UL + 12345UL;
+    return low + ((s_rng >> 8) % (high - low + 1));
+}
+
+static const SoakPhase* soak_phase(uint64_t sec) {
+    uint32_t day = (uint32_t)((sec / SOAK_DAY_SEC) % SOAK_SCRIPT_DAYS);
+    const SoakPhase* phase = &SOAK_SCRIPT[0];
+    for (uint8_t i = 0; i < SOAK_PHASE_COUNT; i++) {
+        if (SOAK_SCRIPT[i].startDay <= day) {
+            phase = &SOAK_SCRIPT[i];
+        }
+    }
+    return phase;
+}
+
+static bool soak_outage(uint64_t sec, bool notecard) {
+    uint64_t scriptSec = sec % ((uint64_t)SOAK_SCRIPT_DAYS * SOAK_DAY_SEC);
+    for (uint8_t i = 0; i < SOAK_OUTAGE_COUNT; i++) {
+        const SoakOutage* outage = &SOAK_OUTAGES[i];
+        if (outage->notecard == notecard && scriptSec >= outage->startSec &&
+            scriptSec < outage->startSec + outage->minutes * 60UL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool soak_usb(uint64_t sec) {
+    uint32_t hour = (uint32_t)((sec % SOAK_DAY_SEC) / 3600);
+    uint32_t sinceEight = (hour + 24 - 8) % 24;
+    return sinceEight < soak_phase(sec)->usbHours;
+}
+
+static bool soak_sky(uint64_t sec) {
+    if (soak_usb(sec)) {
+        return true;    // Driving
+    }
+    // Obstruction changes hourly (parked indoors, depots)
+    uint32_t hour = (uint32_t)(sec / 3600);
+    uint32_t hash = hour * 2654435761UL;
+    return (hash >> 16) % 100 >= soak_phase(sec)->obstructedPct;
+}
+
+static bool soak_gps_signal(void) {
+    return s_dev.gpsActive && soak_sky(s_nowSec) &&
+           s_nowSec - s_dev.gpsActiveSinceSec >= SIM_GPS_SIGNAL_SEC;
+}
+
+static float soak_voltage(void) {
+    double soc = s_dev.batteryMah / SIM_BATTERY_MAH;
+    return (float)(3.3 + 0.9 * soc);
+}
+
+static uint32_t soak_epoch(void) {
+    return (uint32_t)(SOAK_START_EPOCH + s_nowSec);
+}
+
+// ============================================================================
+// Stand-in Notecard
+// ============================================================================
+
+// One transaction at a time, as on the bus; static so nothing allocates
+static J s_request;
+static J s_response;
+
+static void bus(uint32_t ms) {
+    s_count.busMs += ms;
+}
+
+static J* notecard_new_request(const char* name) {
+    memset(&s_request, 0, sizeof(s_request));
+    JAddStringToObject(&s_request, "req", name);
+    return &s_request;
+}
+
+static uint32_t notecard_bus_ms(const char* name) {
+    if (strcmp(name, "note.add") == 0) return SIM_BUS_NOTE_ADD_MS;
+    if (strcmp(name, "note.get") == 0) return SIM_BUS_COMMAND_POLL_MS;
+    if (strcmp(name, "card.location") == 0) return SIM_BUS_STATUS_MS;
+    if (strcmp(name, "env.modified") == 0) return SIM_BUS_ENV_CHECK_MS;
+    if (strcmp(name, "env.get") == 0) return SIM_BUS_ENV_VAR_MS;
+    return SIM_BUS_HUB_SET_MS;
+}
+
+// The scenario's env vars on Notehub; NULL when not set
+static const char* notecard_env_value(const char* name) {
+    if (strcmp(name, ENV_MODE) == 0) return s_dev.phase->mode;
+    if (strcmp(name, ENV_SYNC_INTERVAL_MIN) == 0) return s_dev.phase->syncIntervalMin;
+    if (strcmp(name, ENV_GPS_INTERVAL_MIN) == 0) return s_dev.phase->gpsIntervalMin;
+    return NULL;
+}
+
+/**
+ * @brief Send a request and get the response, as requestAndResponse()
+ *
+ * @return Response, or NULL while the Notecard is unresponsive
+ */
+static J* notecard_transaction(J* req) {
+    const char* name = JGetString(req, "req");
+    bus(notecard_bus_ms(name));
+    if (soak_outage(s_nowSec, true)) {
+        metricsIncrement(METRIC_NOTECARD_ERRORS);
+        return NULL;
+    }
+
+    J* rsp = &s_response;
+    memset(rsp, 0, sizeof(J));
+    if (strcmp(name, "note.add") == 0) {
+        s_dev.notecardPending++;
+        if (JGetBool(req, "sync")) {
+            s_dev.syncRequested = true;
+        }
+        JAddNumberToObject(rsp, "total", s_dev.notecardPending);
+    } else if (strcmp(name, "note.get") == 0) {
+        if (s_dev.commandsDelivered > 0) {
+            s_dev.commandsDelivered--;
+            JAddStringToObject(rsp, "cmd", SOAK_COMMANDS[s_count.commands % 4]);
+        } else {
+            JAddStringToObject(rsp, "err", "no note is available {note-noexist}");
+        }
+    } else if (strcmp(name, "card.location") == 0) {
+        const char* status = !s_dev.gpsActive ? "GPS inactive {gps-inactive}" :
+                             soak_gps_signal() ? "GPS search {gps-active} {gps-signal}" :
+                             "GPS search {gps-active}";
+        JAddStringToObject(rsp, "status", status);
+    } else if (strcmp(name, "env.modified") == 0) {
+        JAddNumberToObject(rsp, "time", s_dev.envModified);
+    } else if (strcmp(name, "env.get") == 0) {
+        const char* value = notecard_env_value(JGetString(req, "name"));
+        if (value != NULL) {
+            JAddStringToObject(rsp, "text", value);
+            JAddNumberToObject(rsp, "time", s_dev.envModified);
+        }
+    } else if (strcmp(name, "card.location.mode") == 0) {
+        if (strcmp(JGetString(req, "mode"), "off") == 0) {
+            s_dev.gpsEnabled = false;
+            s_dev.gpsActive = false;
+        } else {
+            s_dev.gpsEnabled = true;
+        }
+        s_dev.gpsNextRunSec = s_nowSec;
+    }
+    return rsp;
+}
+
+// note.add for a note from the queue or the spill
+static bool notecard_add(const NoteQueueItem* item) {
+    static const char* const FILES[4] = { "track.qo", "alert.qo", "command_ack.qo", "health.qo" };
+    J* req = notecard_new_request("note.add");
+    JAddStringToObject(req, "file", FILES[item->type]);
+    if (item->forceSync) {
+        JAddBoolToObject(req, "sync", true);
+    }
+    J* rsp = notecard_transaction(req);
+    return rsp != NULL && !JIsPresent(rsp, "err");
+}
+
+// Apply the cadence (hub.set and card.location.mode) after a change
+static void notecard_configure(void) {
+    NotecardCadence cadence;
+    cadenceCompute(&s_dev.config, &cadence);
+    if (cadenceHubChanged(&cadence, &s_dev.cadence) || cadenceGpsChanged(&cadence, &s_dev.cadence)) {
+        notecard_transaction(notecard_new_request("hub.set"));
+    }
+    s_dev.cadence = cadence;
+    if (cadence.gpsSeconds == 0) {
+        s_dev.gpsActive = false;
+    }
+}
+
+static void notecard_sync_tick(void) {
+    bool continuous = strcmp(s_dev.cadence.hubMode, "continuous") == 0;
+    bool periodic = strcmp(s_dev.cadence.hubMode, "periodic") == 0;
+    bool cellular = !soak_outage(s_nowSec, false);
+    uint64_t since = s_nowSec - s_dev.lastSyncSec;
+
+    bool due = s_dev.syncRequested;
+    if (continuous || periodic) {
+        due = due || (s_dev.notecardPending > 0 && since >= s_dev.cadence.outboundMin * 60UL);
+        due = due || since >= s_dev.cadence.inboundMin * 60UL;
+    }
+    if (!due) {
+        return;
+    }
+
+    s_dev.syncRequested = false;
+    s_dev.lastSyncSec = s_nowSec;
+    if (!continuous) {
+        s_count.energyMah += SIM_SYNC_MAS / 3600.0;
+        if (!soak_usb(s_nowSec)) {
+            s_dev.batteryMah -= SIM_SYNC_MAS / 3600.0;
+        }
+    }
+    if (!cellular) {
+        s_count.syncsFailed++;
+        return;
+    }
+    s_count.syncs++;
+    s_dev.notecardPending = 0;
+
+    // Inbound: commands waiting at Notehub reach the Notecard
+    while (s_dev.commandsWaiting > 0 && s_dev.commandsDelivered < 8) {
+        s_dev.commandsWaiting--;
+        s_dev.commandsDelivered++;
+    }
+
+    // command.qi is armed in the sleep ATTN when cmd_wake_enabled is set
+    if (!s_dev.awake && s_dev.commandsDelivered > 0 && s_dev.config.cmdWakeEnabled) {
+        s_dev.wakeAtSec = s_nowSec;
+    }
+}
+
+static void notecard_gps_tick(void) {
+    bool scheduled = s_dev.cadence.gpsSeconds > 0 && s_dev.gpsEnabled;
+    if (!scheduled) {
+        s_dev.gpsActive = false;
+        s_dev.gpsBlindSec = 0;
+        return;
+    }
+
+    if (!s_dev.gpsActive && s_nowSec >= s_dev.gpsNextRunSec) {
+        s_dev.gpsActive = true;
+        s_dev.gpsActiveSinceSec = s_nowSec;
+    }
+    if (s_dev.gpsActive) {
+        s_count.gpsActiveSec++;
+        // GPS cannot be turned off while the Notecard is unresponsive
+        bool signal = soak_gps_signal();
+        bool managed = !soak_outage(s_nowSec, true);
+        s_dev.gpsBlindSec = (signal || !managed) ? 0 : s_dev.gpsBlindSec + 1;
+        if (s_dev.config.gpsPowerSaveEnabled) {
+            s_count.gpsLongestBlindSec = MAX(s_count.gpsLongestBlindSec, s_dev.gpsBlindSec);
+        }
+        if (signal && s_nowSec - s_dev.gpsActiveSinceSec >= SIM_GPS_FIX_SEC) {
+            // Fix: power down until the next period
+            s_dev.gpsActive = false;
+            s_dev.gpsNextRunSec = s_dev.gpsActiveSinceSec + s_dev.cadence.gpsSeconds;
+        }
+    } else {
+        s_dev.gpsBlindSec = 0;
+    }
+}
+
+// ============================================================================
+// Notes
+// ============================================================================
+
+// Queue a note, or spill what the queue drops, through the same step as
+// syncQueueNote()
+static bool soak_offer_note(const NoteQueueItem* item) {
+    NoteOffer offer;
+    bool kept = noteSpillOffer(&s_dev.queue, &s_dev.spill, item, &offer);
+    if (offer.spilled) {
+        s_count.notesSpilled++;
+    }
+    if (offer.lost) {
+        s_count.notesLost[offer.lostType]++;
+        s_count.notesLostInOutage += soak_outage(s_nowSec, true) ? 1 : 0;
+        metricsIncrement(METRIC_NOTES_LOST);
+    }
+    metricsRecordPeak(METRIC_PEAK_NOTE_QUEUE, noteQueueCount(&s_dev.queue));
+    metricsRecordPeak(METRIC_PEAK_NOTE_SPILL, noteSpillCount(&s_dev.spill));
+    return kept;
+}
+
+static void soak_queue_note(const NoteQueueItem* item) {
+    s_count.notesQueued++;
+    soak_offer_note(item);
+}
+
+// ============================================================================
+// Job Work (SensorTask, CommandTask and EnvTask with JOBS_MODE)
+// ============================================================================
+
+// sensorJobStart(): milliseconds until the conversion is done
+static uint32_t soak_sensor_start(void) {
+    s_dev.sensorIntervalMs = envGetSensorIntervalMs(&s_dev.config);
+    if (s_dev.sensorIntervalMs == 0) {
+        s_dev.sensorDone = true;
+        return JOB_SENSOR_OFF;
+    }
+
+    bus(SIM_BUS_BME280_START_MS);
+    const SensorProfile* profile = envGetSensorProfile(&s_dev.config);
+    return profile->continuous ? 0 : (bme280MeasureTimeUs(profile) + 999) / 1000;
+}
+
+// sensorJobRead(): milliseconds from this reading's start to the next
+static uint32_t soak_sensor_read(void) {
+    bus(SIM_BUS_SENSOR_MS);
+    uint32_t sampleMs = millis();
+
+    // BME280 stand-in: daily swing, weather fronts, a heat event every 9 days
+    double day = (double)s_nowSec / SOAK_DAY_SEC;
+    double hourOfDay = (double)(s_nowSec % SOAK_DAY_SEC) / 3600.0;
+    SensorData data;
+    memset(&data, 0, sizeof(data));
+    data.temperature = (float)(20.0 + 6.0 * sin((hourOfDay - 9.0) * M_PI / 12.0));
+    if ((uint32_t)day % 9 == 4 && hourOfDay >= 13.0 && hourOfDay < 16.0) {
+        data.temperature += 18.0f;
+    }
+    data.temperature += (float)sim_random(0, 100) / 100.0f - 0.5f;
+    data.humidity = (float)(50.0 - 1.5 * (data.temperature - 20.0));
+    data.pressure = (float)(1013.0 + 8.0 * sin(day * 2.0 * M_PI / 5.0));
+    bool usb = soak_usb(s_nowSec);
+    data.voltage = usb ? 4.2f : soak_voltage();
+    data.timestamp = soak_epoch();
+    data.valid = true;
+    s_count.minVoltage = MIN(s_count.minVoltage, data.voltage);
+
+    if (powerPolicyUpdate(&s_dev.config, data.voltage, usb)) {
+        s_count.scaleChanges++;
+        notecard_configure();
+    }
+
+    AlertEvaluation eval;
+    alertEngineUpdate(&s_dev.engine, &data, &s_dev.config, data.timestamp, s_dev.alerts, &eval);
+    if (eval.raised != 0 || eval.cleared != 0) {
+        NoteQueueItem item;
+        memset(&item, 0, sizeof(item));
+        item.type = NOTE_TYPE_ALERT;
+        item.forceSync = (eval.raised != 0);
+        item.createdMs = sampleMs;
+        sensorsBuildAlertNote(eval.raised, eval.cleared, &data, &eval, &s_dev.config, &item.data.alert);
+        soak_queue_note(&item);
+        s_dev.alerts = (uint8_t)((s_dev.alerts | eval.raised) & ~eval.cleared);
+        for (uint8_t flag = 1; flag != 0; flag <<= 1) {
+            s_count.alertsRaised += (eval.raised & flag) ? 1 : 0;
+        }
+    }
+
+    NoteQueueItem item;
+    memset(&item, 0, sizeof(item));
+    item.type = NOTE_TYPE_TRACK;
+    item.createdMs = sampleMs;
+    memcpy(&item.data.track, &data, sizeof(SensorData));
+    soak_queue_note(&item);
+    s_dev.sensorDone = true;
+
+    return powerPolicyScaleInterval(s_dev.sensorIntervalMs);
+}
+
+// commandJobRun(): milliseconds until the next poll
+static uint32_t soak_command_poll(void) {
+    J* rsp = notecard_transaction(notecard_new_request("note.get"));
+    bool hasCommand = rsp != NULL && !JIsPresent(rsp, "err");
+    if (hasCommand) {
+        NoteQueueItem item;
+        memset(&item, 0, sizeof(item));
+        item.type = NOTE_TYPE_CMD_ACK;
+        item.createdMs = millis();
+        item.data.ack.type = commandsParseType(JGetString(rsp, "cmd"));
+        item.data.ack.status = CMD_STATUS_OK;
+        soak_queue_note(&item);
+
+        uint8_t slot = s_count.commands % 8;
+        uint32_t latency = (uint32_t)(s_nowSec - s_dev.commandQueuedSec[slot]);
+        s_count.commandLatencySec += latency;
+        s_count.commandLatencyMaxSec = MAX(s_count.commandLatencyMaxSec, latency);
+        s_count.commandServiceMaxSec = MAX(s_count.commandServiceMaxSec,
+                                           latency - s_dev.commandBlockedSec[slot]);
+        s_count.commands++;
+    }
+    if (hasCommand) {
+        return 0;
+    }
+    s_dev.commandDone = true;
+
+    uint32_t interval = powerPolicyScaleInterval(envGetCommandPollIntervalMs(&s_dev.config));
+    return interval > 0 ? interval : 1000;
+}
+
+// envJobRun(): milliseconds until the next safety poll
+static uint32_t soak_env_check(void) {
+    uint32_t modCount = 0;
+    J* rsp = notecard_transaction(notecard_new_request("env.modified"));
+    if (notecardParseEnvModified(rsp, &modCount) && modCount != s_dev.envModCount) {
+        // envFetchConfig(): every variable, applying those that are set
+        SongbirdConfig next = s_dev.config;
+        OperatingMode previous = next.mode;
+        const char* name;
+        char value[32];
+        for (uint8_t i = 0; (name = envVarName(i)) != NULL; i++) {
+            J* req = notecard_new_request("env.get");
+            JAddStringToObject(req, "name", name);
+            if (notecardParseEnvText(notecard_transaction(req), value, sizeof(value))) {
+                envApplyVar(&next, name, value);
+            }
+        }
+        if (next.mode != previous) {
+            envApplyModePreset(&next, next.mode);
+            envApplyVar(&next, ENV_SYNC_INTERVAL_MIN, s_dev.phase->syncIntervalMin);
+            envApplyVar(&next, ENV_GPS_INTERVAL_MIN, s_dev.phase->gpsIntervalMin);
+        }
+        s_dev.envModCount = modCount;
+
+        // MainTask applies the change
+        if (envConfigChanged(&s_dev.config, &next)) {
+            s_dev.config = next;
+            if (next.mode != MODE_TRANSIT) {
+                memset(&s_dev.gps, 0, sizeof(s_dev.gps));
+                s_dev.gpsEnabled = true;
+            }
+            notecard_configure();
+        }
+    }
+
+    return powerPolicyScaleInterval(envGetEnvPollIntervalMs(&s_dev.config));
+}
+
+// runJob(): do a due job's work and arm its next run
+static void soak_run_job(uint8_t job, uint32_t deadlineMs) {
+    uint32_t result;
+    switch (job) {
+        case JOB_SENSOR_START:
+            result = soak_sensor_start();
+            break;
+        case JOB_SENSOR_READ:
+            result = soak_sensor_read();
+            break;
+        case JOB_COMMAND:
+            result = soak_command_poll();
+            break;
+        case JOB_ENV:
+            result = soak_env_check();
+            break;
+        default:
+            return;
+    }
+    s_count.jobs++;
+    jobsFinished(&s_dev.jobs, job, deadlineMs, result, millis());
+}
+
+// ============================================================================
+// NotecardTask and MainTask Work
+// ============================================================================
+
+// One note per pass: the queue first, then the spill. A note that is not
+// sent is offered back and the task pauses before the next attempt.
+static void soak_send_note(void) {
+    if (s_dev.sendPaused) {
+        if (!MS_REACHED(millis(), s_dev.sendRetryMs)) {
+            return;
+        }
+        s_dev.sendPaused = false;
+    }
+
+    NoteQueueItem item;
+    if (!noteQueuePop(&s_dev.queue, &item) && !noteSpillTake(&s_dev.spill, &item)) {
+        return;
+    }
+    if (notecard_add(&item)) {
+        s_count.notesSent[item.type]++;
+        metricsIncrement(METRIC_NOTES_SENT);
+    } else {
+        s_count.notesFailed++;
+        soak_offer_note(&item);
+        s_dev.sendPaused = true;
+        s_dev.sendRetryMs = millis() + NOTE_SEND_RETRY_MS;
+    }
+}
+
+// Status snapshot and GPS power management; milliseconds until the next poll
+static uint32_t soak_status_poll(void) {
+    NotecardStatus status;
+    memset(&status, 0, sizeof(status));
+    notecardParseLocation(notecard_transaction(notecard_new_request("card.location")), &status);
+
+    if (s_dev.config.mode == MODE_TRANSIT && s_dev.config.gpsPowerSaveEnabled) {
+        GpsPowerInputs inputs;
+        inputs.active = status.gpsActive;
+        inputs.signal = status.gpsSignal;
+        inputs.lock = status.gpsLock;   // Reported after the receiver powers down
+
+        uint32_t now = millis();
+        GpsPowerAction action = gpsPowerUpdate(&s_dev.gps, &s_dev.config, &inputs, now);
+        if (action == GPS_POWER_DISABLE || action == GPS_POWER_RETRY) {
+            J* req = notecard_new_request("card.location.mode");
+            JAddStringToObject(req, "mode", action == GPS_POWER_DISABLE ? "off" : "periodic");
+            if (notecard_transaction(req) != NULL) {
+                gpsPowerApplied(&s_dev.gps, action, now);
+                if (action == GPS_POWER_DISABLE) {
+                    s_count.gpsTimeouts++;
+                } else {
+                    s_count.gpsRetries++;
+                    s_count.gpsRetriesAfterWrap += (s_count.millisWraps > 0);
+                }
+            }
+        }
+    }
+
+    return envGetStatusPollIntervalMs(&s_dev.config);
+}
+
+// Health report check; queues the trigger, built at send time
+static void soak_health_check(void) {
+    MetricsSnapshot metrics;
+    metricsSnapshot(&metrics);
+    uint32_t since = s_dev.lastHealthEpoch ? soak_epoch() - s_dev.lastHealthEpoch : UINT32_MAX;
+    MetricsTrigger trigger = metricsReportDue(&s_dev.reportedMetrics, &metrics, since,
+                                              HOURS_TO_SEC(s_dev.config.heartbeatHours));
+    if (trigger == METRICS_TRIGGER_NONE) {
+        return;
+    }
+
+    NoteQueueItem item;
+    memset(&item, 0, sizeof(item));
+    item.type = NOTE_TYPE_HEALTH;
+    item.createdMs = millis();
+    item.data.health.trigger = trigger;
+    soak_queue_note(&item);
+
+    if (s_dev.lastHealthEpoch != 0) {
+        s_count.healthMaxGapSec = MAX(s_count.healthMaxGapSec, since);
+    }
+    s_count.healthNotes++;
+    s_dev.lastHealthEpoch = soak_epoch();
+    memcpy(&s_dev.reportedMetrics, &metrics, sizeof(MetricsSnapshot));
+}
+
+// ============================================================================
+// Host Power
+// ============================================================================
+
+static uint32_t host_millis(void) {
+    return (uint32_t)(s_nowSec * 1000ULL - s_dev.bootSimMs);
+}
+
+static void host_boot(bool cold) {
+    s_dev.awake = true;
+    s_dev.coldBoot = cold;
+    s_dev.bootSimMs = s_nowSec * 1000ULL;
+    s_dev.lastMillis = 0;
+    mock_set_millis(0);
+
+    // Every job runs at once on startup
+    jobsInit(&s_dev.jobs);
+    jobsArmAll(&s_dev.jobs, 0);
+    timerQueueInit(&s_dev.periods);
+    timerQueueArm(&s_dev.periods, SOAK_TIMER_HEALTH, 0);
+    timerQueueArm(&s_dev.periods, SOAK_TIMER_STATUS, 0);
+    s_dev.sendPaused = false;
+    s_dev.sensorDone = false;
+    s_dev.commandDone = false;
+    s_count.wakes++;
+}
+
+// As sleepCycleReady() in SongbirdTasks.cpp, with the real decisions
+static void host_sleep_check(void) {
+    // The Notecard still needs a moment with the queued reports
+    if (millis() < SIM_WAKE_SETTLE_MS) {
+        return;
+    }
+
+    SleepCycleInputs inputs;
+    inputs.mode = s_dev.config.mode;
+    inputs.warmBoot = !s_dev.coldBoot;
+    inputs.busy = false;
+    inputs.nowMs = millis();
+    inputs.lastAttemptMs = 0;
+    inputs.eventBits = (s_dev.sensorDone ? CYCLE_BIT_SENSOR : 0) |
+                       (s_dev.commandDone ? CYCLE_BIT_COMMAND : 0);
+    inputs.notesPending = noteQueueCount(&s_dev.queue) + noteSpillCount(&s_dev.spill);
+    if (!sleepCycleDue(&inputs)) {
+        return;
+    }
+
+    uint32_t sinceReport = s_dev.lastHealthEpoch ? soak_epoch() - s_dev.lastHealthEpoch : UINT32_MAX;
+    uint32_t seconds = sleepCycleDurationSec(&s_dev.config, sinceReport);
+
+    bus(SIM_BUS_SLEEP_MS);
+    s_dev.awake = false;
+    s_dev.wakeAtSec = s_nowSec + seconds;
+}
+
+// Everything due at the current millis()
+static void host_tick(void) {
+    uint32_t now = millis();
+    uint8_t id;
+    uint32_t deadlineMs;
+
+    // JobsTask
+    while (jobsPopDue(&s_dev.jobs, now, &id, &deadlineMs)) {
+        soak_run_job(id, deadlineMs);
+    }
+
+    // NotecardTask
+    soak_send_note();
+    while (timerQueuePopDue(&s_dev.periods, now, &id, &deadlineMs)) {
+        if (id == SOAK_TIMER_STATUS) {
+            timerQueueArm(&s_dev.periods, id, now + soak_status_poll());
+        } else {
+            // MainTask
+            soak_health_check();
+            timerQueueArm(&s_dev.periods, id, now + HEALTH_CHECK_INTERVAL_MS);
+        }
+    }
+
+    host_sleep_check();
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+static void soak_world_tick(void) {
+    // An env change on Notehub; its ATTN event brings the env job forward
+    const SoakPhase* phase = soak_phase(s_nowSec);
+    if (phase != s_dev.phase) {
+        s_dev.phase = phase;
+        s_dev.envModified = soak_epoch();
+        if (s_dev.awake) {
+            jobsRunNow(&s_dev.jobs, JOB_ENV, millis());
+        }
+    }
+
+    // Commands arrive at Notehub at the phase's daily rate
+    if (phase->commandsPerDay > 0 && sim_random(0, SOAK_DAY_SEC - 1) < phase->commandsPerDay &&
+        s_dev.commandsWaiting + s_dev.commandsDelivered < 8) {
+        uint32_t slot = (s_count.commands + s_dev.commandsDelivered + s_dev.commandsWaiting) % 8;
+        s_dev.commandQueuedSec[slot] = s_nowSec;
+        s_dev.commandBlockedSec[slot] = 0;
+        s_dev.commandsWaiting++;
+    }
+
+    // Commands cannot leave Notehub through a cellular outage, or while the
+    // hub is in minimum mode (sleep mode syncs only when asked)
+    if (soak_outage(s_nowSec, false) || strcmp(s_dev.cadence.hubMode, "minimum") == 0) {
+        for (uint32_t i = 0; i < s_dev.commandsWaiting; i++) {
+            s_dev.commandBlockedSec[(s_count.commands + s_dev.commandsDelivered + i) % 8] +=
+                SOAK_TICK_MS / 1000;
+        }
+    }
+
+    // Current draw this tick
+    bool usb = soak_usb(s_nowSec);
+    double ma = SIM_NOTECARD_IDLE_MA;
+    ma += s_dev.awake ? SIM_HOST_AWAKE_MA : 0.0;
+    ma += s_dev.gpsActive ? SIM_GPS_MA : 0.0;
+    if (strcmp(s_dev.cadence.hubMode, "continuous") == 0 && !soak_outage(s_nowSec, false)) {
+        ma += SIM_RADIO_CONTINUOUS_MA;
+    }
+    double mah = ma * SOAK_TICK_MS / 3600000.0;
+    s_count.energyMah += mah;
+    if (usb) {
+        s_dev.batteryMah = MIN(SIM_BATTERY_MAH, s_dev.batteryMah + SIM_CHARGE_MA * SOAK_TICK_MS / 3600000.0);
+    } else {
+        s_dev.batteryMah = MAX(0.0, s_dev.batteryMah - mah);
+        s_count.batteryMah += mah;
+    }
+}
+
+static void soak_run(uint32_t days) {
+    uint32_t allocsBefore = g_allocCount;
+    uint64_t endSec = (uint64_t)days * SOAK_DAY_SEC;
+
+    for (s_nowSec = 0; s_nowSec < endSec; s_nowSec += SOAK_TICK_MS / 1000) {
+        if (!s_dev.awake && s_nowSec >= s_dev.wakeAtSec) {
+            host_boot(false);
+        }
+
+        if (s_dev.awake) {
+            uint32_t now = host_millis();
+            if (now < s_dev.lastMillis) {
+                s_count.millisWraps++;
+            }
+            s_dev.lastMillis = now;
+            mock_set_millis(now);
+            host_tick();
+        }
+
+        notecard_gps_tick();
+        notecard_sync_tick();
+        soak_world_tick();
+    }
+
+    s_count.allocs = g_allocCount - allocsBefore;
+}
+
+void setUp(void) {
+    memset(&s_dev, 0, sizeof(s_dev));
+    memset(&s_count, 0, sizeof(s_count));
+    s_count.minVoltage = 5.0f;
+    s_nowSec = 0;
+
+    envInitDefaults(&s_dev.config);
+    powerPolicyReset();
+    metricsInit();
+    alertEngineReset(&s_dev.engine);
+    noteQueueInit(&s_dev.queue);
+    noteSpillInit(&s_dev.spill);
+    s_dev.phase = soak_phase(0);
+    s_dev.gpsEnabled = true;
+    s_dev.batteryMah = SIM_BATTERY_MAH;
+    cadenceCompute(&s_dev.config, &s_dev.cadence);
+    host_boot(true);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Bounds
+// ============================================================================
+
+// Longest gap between health reports: the heartbeat, found by the next
+// health check when awake or overshot by the shortest timed sleep
+static uint32_t soak_health_gap_bound_sec(void) {
+    return HOURS_TO_SEC(DEFAULT_HEARTBEAT_HOURS) + HEALTH_CHECK_INTERVAL_MS / 1000 + SLEEP_CYCLE_MIN_SEC;
+}
+
+// Longest a deliverable command may wait: the longest inbound sync interval
+// the script sets, stretched by the power policy, then one command poll
+static uint32_t soak_command_bound_sec(void) {
+    uint32_t syncMin = DEMO_OUTBOUND_MIN;
+    for (uint8_t i = 0; i < SOAK_PHASE_COUNT; i++) {
+        uint32_t phaseMin = (uint32_t)atoi(SOAK_SCRIPT[i].syncIntervalMin);
+        if (strcmp(SOAK_SCRIPT[i].mode, "storage") == 0) {
+            phaseMin = MAX(phaseMin, (uint32_t)STORAGE_SYNC_FLOOR_MIN);
+        }
+        syncMin = MAX(syncMin, phaseMin);
+    }
+    return (syncMin * 60 + COMMAND_POLL_STORAGE_MS / 1000) * DEFAULT_POWER_POLICY_MAX_SCALE +
+           SOAK_TICK_MS / 1000;
+}
+
+// The runs that reach a Notecard outage must exercise the retry and spill
+static uint32_t soak_first_notecard_outage_day(void) {
+    for (uint8_t i = 0; i < SOAK_OUTAGE_COUNT; i++) {
+        if (SOAK_OUTAGES[i].notecard) {
+            return SOAK_OUTAGES[i].startSec / SOAK_DAY_SEC;
+        }
+    }
+    return UINT32_MAX;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+static uint32_t soak_total(const uint32_t* byType) {
+    return byType[NOTE_TYPE_TRACK] + byType[NOTE_TYPE_ALERT] +
+           byType[NOTE_TYPE_CMD_ACK] + byType[NOTE_TYPE_HEALTH];
+}
+
+static void soak_report(uint32_t days) {
+    uint32_t sent = soak_total(s_count.notesSent);
+    uint32_t lost = soak_total(s_count.notesLost);
+    double hours = days * 24.0;
+
+    char line[160];
+    snprintf(line, sizeof(line), "%lu days, %lu wakes, %lu millis() wraps, %lu jobs",
+             (unsigned long)days, (unsigned long)s_count.wakes, (unsigned long)s_count.millisWraps,
+             (unsigned long)s_count.jobs);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line),
+             "notes sent %lu (track %lu, alert %lu, ack %lu, health %lu), failed %lu, lost %lu, spilled %lu",
+             (unsigned long)sent, (unsigned long)s_count.notesSent[NOTE_TYPE_TRACK],
+             (unsigned long)s_count.notesSent[NOTE_TYPE_ALERT],
+             (unsigned long)s_count.notesSent[NOTE_TYPE_CMD_ACK],
+             (unsigned long)s_count.notesSent[NOTE_TYPE_HEALTH],
+             (unsigned long)s_count.notesFailed, (unsigned long)lost,
+             (unsigned long)s_count.notesSpilled);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "syncs %lu (%lu failed), I2C bus %.1f s (%.3f%%)",
+             (unsigned long)s_count.syncs, (unsigned long)s_count.syncsFailed,
+             s_count.busMs / 1000.0, 100.0 * s_count.busMs / (hours * 3600000.0));
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line),
+             "energy %.0f mAh (%.2f mA average), %.0f mAh from battery, lowest %.2f V, %lu scale changes",
+             s_count.energyMah, s_count.energyMah / hours, s_count.batteryMah,
+             s_count.minVoltage, (unsigned long)s_count.scaleChanges);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "GPS on %.1f h, %lu timeouts, %lu retries (%lu after the wrap), longest without signal %lu s",
+             s_count.gpsActiveSec / 3600.0, (unsigned long)s_count.gpsTimeouts,
+             (unsigned long)s_count.gpsRetries, (unsigned long)s_count.gpsRetriesAfterWrap,
+             (unsigned long)s_count.gpsLongestBlindSec);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "alerts raised %lu, commands %lu (max latency %lu s, %lu s once deliverable, bound %lu s)",
+             (unsigned long)s_count.alertsRaised, (unsigned long)s_count.commands,
+             (unsigned long)s_count.commandLatencyMaxSec, (unsigned long)s_count.commandServiceMaxSec,
+             (unsigned long)soak_command_bound_sec());
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "health %lu (max gap %lu s, bound %lu s)",
+             (unsigned long)s_count.healthNotes, (unsigned long)s_count.healthMaxGapSec,
+             (unsigned long)soak_health_gap_bound_sec());
+    TEST_MESSAGE(line);
+
+    printf("SOAK {\"days\":%lu,\"notes_sent\":%lu,\"notes_failed\":%lu,\"notes_lost\":%lu,"
+           "\"notes_spilled\":%lu,\"syncs\":%lu,\"syncs_failed\":%lu,\"bus_s\":%.1f,"
+           "\"energy_mah\":%.1f,\"battery_mah\":%.1f,\"gps_on_h\":%.1f,\"gps_timeouts\":%lu,"
+           "\"wakes\":%lu,\"millis_wraps\":%lu,\"health_max_gap_s\":%lu,\"cmd_latency_max_s\":%lu,"
+           "\"cmd_service_max_s\":%lu,\"allocs\":%lu}\n",
+           (unsigned long)days, (unsigned long)sent, (unsigned long)s_count.notesFailed,
+           (unsigned long)lost, (unsigned long)s_count.notesSpilled, (unsigned long)s_count.syncs,
+           (unsigned long)s_count.syncsFailed, s_count.busMs / 1000.0, s_count.energyMah,
+           s_count.batteryMah, s_count.gpsActiveSec / 3600.0, (unsigned long)s_count.gpsTimeouts,
+           (unsigned long)s_count.wakes, (unsigned long)s_count.millisWraps,
+           (unsigned long)s_count.healthMaxGapSec, (unsigned long)s_count.commandLatencyMaxSec,
+           (unsigned long)s_count.commandServiceMaxSec, (unsigned long)s_count.allocs);
+    fflush(stdout);
+}
+
+// ============================================================================
+// Soak
+// ============================================================================
+
+void test_soak_model(void) {
+    soak_run(SOAK_DAYS);
+    soak_report(SOAK_DAYS);
+
+    // Notecard outages failed sends, and their notes were kept: offered
+    // back, with what the queue could not hold spilled
+    TEST_ASSERT_TRUE(s_count.notesSent[NOTE_TYPE_TRACK] > 0);
+    if (SOAK_DAYS > soak_first_notecard_outage_day()) {
+        TEST_ASSERT_TRUE(s_count.notesFailed > 0);
+        TEST_ASSERT_TRUE(s_count.notesSpilled > 0);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, s_count.notesLost[NOTE_TYPE_TRACK]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_count.notesLost[NOTE_TYPE_ALERT]);
+    TEST_ASSERT_EQUAL_UINT32(0, s_count.notesLost[NOTE_TYPE_CMD_ACK]);
+
+    // Only health requests, which are not spilled (the next report covers
+    // their window), were dropped, and only while the Notecard was down
+    TEST_ASSERT_EQUAL_UINT32(s_count.notesLost[NOTE_TYPE_HEALTH], s_count.notesLostInOutage);
+
+    // Every other note created was sent or is still waiting
+    TEST_ASSERT_EQUAL_UINT32(s_count.notesQueued,
+                             soak_total(s_count.notesSent) + soak_total(s_count.notesLost) +
+                             noteQueueCount(&s_dev.queue) + noteSpillCount(&s_dev.spill));
+    TEST_ASSERT_TRUE(s_count.alertsRaised > 0);
+
+    // Every command is handled within one stretched inbound sync of being
+    // able to leave Notehub, including on a storage mode device asleep
+    TEST_ASSERT_TRUE(s_count.commands > 0);
+    TEST_ASSERT_TRUE(s_count.commandServiceMaxSec <= soak_command_bound_sec());
+
+    // A heartbeat is never missed, through outages and sleep cycles
+    TEST_ASSERT_TRUE(s_count.healthNotes >= SOAK_DAYS);
+    TEST_ASSERT_TRUE(s_count.healthMaxGapSec <= soak_health_gap_bound_sec());
+
+    // GPS power management bounds every search without a signal
+    uint32_t searchLimitSec = DEFAULT_GPS_SIGNAL_TIMEOUT_MIN * 60 + STATUS_POLL_TRANSIT_MS / 1000 +
+                              SOAK_TICK_MS / 1000;
+    TEST_ASSERT_TRUE(s_count.gpsTimeouts > 0);
+    TEST_ASSERT_TRUE(s_count.gpsLongestBlindSec <= searchLimitSec);
+
+    // ... including after millis() wraps
+    if (SOAK_DAYS >= 50) {
+        TEST_ASSERT_TRUE(s_count.millisWraps > 0);
+        TEST_ASSERT_TRUE(s_count.gpsRetriesAfterWrap > 0);
+    }
+
+    // Nothing on these paths may allocate (no heap growth over weeks)
+    TEST_ASSERT_EQUAL_UINT32(0, s_count.allocs);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_soak_model);
+
+    return UNITY_END();
+}
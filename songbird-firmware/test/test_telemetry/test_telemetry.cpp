@@ -0,0 +1,248 @@
+/**
+ * @file test_telemetry.cpp
+ * @brief Unit tests for the device telemetry cache
+ *
+ * Tests cache hits within the caller's maximum age, misses once a sample
+ * is stale or a fresh read is forced, failed reads that must not be cached,
+ * the motion latch and the card.time anchor from SongbirdTelemetry.cpp,
+ * against counting Notecard stand-ins, using PlatformIO Unity on the native
+ * platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The cache only calls the Notecard and state functions below; compile the
+// real module (test_build_src = false)
+#include "SongbirdTelemetry.cpp"
+
+// ============================================================================
+// Notecard and State Stand-ins
+// ============================================================================
+
+static float s_cardVoltage;
+static bool s_cardUsb;
+static bool s_cardMotion;
+static uint32_t s_cardTime;
+static uint32_t s_voltageRequests;
+static uint32_t s_motionRequests;
+static uint32_t s_timeRequests;
+static bool s_motionLatched;
+
+float notecardGetVoltage(bool* usbPowered) {
+    s_voltageRequests++;
+    if (usbPowered) *usbPowered = s_cardUsb;
+    return s_cardVoltage;
+}
+
+bool notecardGetMotion(void) {
+    s_motionRequests++;
+    return s_cardMotion;
+}
+
+uint32_t notecardGetTime(void) {
+    s_timeRequests++;
+    return s_cardTime;
+}
+
+void stateSetMotion(bool motion) {
+    if (motion) s_motionLatched = true;
+}
+
+void setUp(void) {
+    // Empty cache, as at boot
+    s_voltageValid = false;
+    s_motionValid = false;
+    s_epochAnchor = 0;
+    s_epochAnchoredAt = 0;
+    s_epochQueried = false;
+
+    s_cardVoltage = 3.9f;
+    s_cardUsb = false;
+    s_cardMotion = false;
+    s_cardTime = 0;
+    s_voltageRequests = 0;
+    s_motionRequests = 0;
+    s_timeRequests = 0;
+    s_motionLatched = false;
+    mock_set_millis(100000);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Voltage
+// ============================================================================
+
+void test_voltage_miss_then_hit(void) {
+    bool usb = true;
+    TEST_ASSERT_EQUAL_FLOAT(3.9f, telemetryGetVoltage(&usb, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_FALSE(usb);
+    TEST_ASSERT_EQUAL_UINT32(1, s_voltageRequests);
+
+    // Every consumer within the TTL shares the sample
+    s_cardVoltage = 3.5f;
+    mock_set_millis(100000 + TELEMETRY_VOLTAGE_TTL_MS);
+    TEST_ASSERT_EQUAL_FLOAT(3.9f, telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(1, s_voltageRequests);
+}
+
+void test_voltage_stale_sample_is_refreshed(void) {
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    s_cardVoltage = 3.5f;
+    mock_set_millis(100000 + TELEMETRY_VOLTAGE_TTL_MS + 1);
+    TEST_ASSERT_EQUAL_FLOAT(3.5f, telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(2, s_voltageRequests);
+}
+
+void test_voltage_max_age_is_per_caller(void) {
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    mock_set_millis(100000 + 500);
+
+    // A tighter caller misses, and its read serves the looser one
+    s_cardVoltage = 3.7f;
+    TEST_ASSERT_EQUAL_FLOAT(3.7f, telemetryGetVoltage(NULL, 100));
+    TEST_ASSERT_EQUAL_FLOAT(3.7f, telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(2, s_voltageRequests);
+}
+
+void test_voltage_zero_age_forces_read(void) {
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    telemetryGetVoltage(NULL, 0);
+    telemetryGetVoltage(NULL, 0);
+    TEST_ASSERT_EQUAL_UINT32(3, s_voltageRequests);
+}
+
+void test_voltage_failed_read_is_not_cached(void) {
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    mock_set_millis(100000 + TELEMETRY_VOLTAGE_TTL_MS + 1);
+
+    // card.voltage failed: report 0 and leave the cache for a retry
+    s_cardVoltage = 0.0f;
+    bool usb = true;
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, telemetryGetVoltage(&usb, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_FALSE(usb);
+
+    s_cardVoltage = 3.6f;
+    TEST_ASSERT_EQUAL_FLOAT(3.6f, telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(3, s_voltageRequests);
+}
+
+void test_voltage_usb_with_no_battery_is_cached(void) {
+    s_cardVoltage = 0.0f;
+    s_cardUsb = true;
+    bool usb = false;
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, telemetryGetVoltage(&usb, TELEMETRY_VOLTAGE_TTL_MS));
+    TEST_ASSERT_TRUE(usb);
+    telemetryGetVoltage(&usb, TELEMETRY_VOLTAGE_TTL_MS);
+    TEST_ASSERT_TRUE(usb);
+    TEST_ASSERT_EQUAL_UINT32(1, s_voltageRequests);
+}
+
+void test_voltage_hit_across_wrap(void) {
+    mock_set_millis(UINT32_MAX - 1000);
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    mock_set_millis(5000);
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    TEST_ASSERT_EQUAL_UINT32(1, s_voltageRequests);
+    mock_set_millis(TELEMETRY_VOLTAGE_TTL_MS);
+    telemetryGetVoltage(NULL, TELEMETRY_VOLTAGE_TTL_MS);
+    TEST_ASSERT_EQUAL_UINT32(2, s_voltageRequests);
+}
+
+// ============================================================================
+// Motion
+// ============================================================================
+
+void test_motion_hit_keeps_latched_event(void) {
+    s_cardMotion = true;
+    TEST_ASSERT_TRUE(telemetryGetMotion(TELEMETRY_MOTION_TTL_MS));
+    TEST_ASSERT_TRUE(s_motionLatched);
+
+    // card.motion resets on read; the second consumer gets the cached event
+    s_cardMotion = false;
+    TEST_ASSERT_TRUE(telemetryGetMotion(TELEMETRY_MOTION_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(1, s_motionRequests);
+}
+
+void test_motion_stale_sample_is_refreshed(void) {
+    s_cardMotion = true;
+    telemetryGetMotion(TELEMETRY_MOTION_TTL_MS);
+    s_cardMotion = false;
+    mock_set_millis(100000 + TELEMETRY_MOTION_TTL_MS + 1);
+    TEST_ASSERT_FALSE(telemetryGetMotion(TELEMETRY_MOTION_TTL_MS));
+    TEST_ASSERT_EQUAL_UINT32(2, s_motionRequests);
+
+    // The event was latched by the first read, whoever reports next
+    TEST_ASSERT_TRUE(s_motionLatched);
+}
+
+void test_no_motion_is_not_latched(void) {
+    telemetryGetMotion(0);
+    TEST_ASSERT_FALSE(s_motionLatched);
+}
+
+// ============================================================================
+// Wall Clock
+// ============================================================================
+
+void test_epoch_unknown_retries_after_interval(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(0, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(1, s_timeRequests);
+
+    s_cardTime = 1700000000;
+    mock_set_millis(100000 + TELEMETRY_TIME_RETRY_MS + 1);
+    TEST_ASSERT_EQUAL_UINT32(1700000000, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(2, s_timeRequests);
+}
+
+void test_epoch_extrapolates_from_anchor(void) {
+    s_cardTime = 1700000000;
+    telemetryGetEpoch();
+    mock_set_millis(100000 + 90500);
+    TEST_ASSERT_EQUAL_UINT32(1700000090, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(1, s_timeRequests);
+}
+
+void test_epoch_failed_refresh_keeps_extrapolating(void) {
+    s_cardTime = 1700000000;
+    telemetryGetEpoch();
+
+    s_cardTime = 0;
+    mock_set_millis(100000 + TELEMETRY_TIME_TTL_MS + 1500);
+    TEST_ASSERT_EQUAL_UINT32(1700000000 + TELEMETRY_TIME_TTL_MS / 1000 + 1, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(2, s_timeRequests);
+
+    // Moved forward, so it is not asked again until the next TTL
+    mock_set_millis(100000 + TELEMETRY_TIME_TTL_MS + 2500);
+    TEST_ASSERT_EQUAL_UINT32(1700000000 + TELEMETRY_TIME_TTL_MS / 1000 + 2, telemetryGetEpoch());
+    TEST_ASSERT_EQUAL_UINT32(2, s_timeRequests);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_voltage_miss_then_hit);
+    RUN_TEST(test_voltage_stale_sample_is_refreshed);
+    RUN_TEST(test_voltage_max_age_is_per_caller);
+    RUN_TEST(test_voltage_zero_age_forces_read);
+    RUN_TEST(test_voltage_failed_read_is_not_cached);
+    RUN_TEST(test_voltage_usb_with_no_battery_is_cached);
+    RUN_TEST(test_voltage_hit_across_wrap);
+
+    RUN_TEST(test_motion_hit_keeps_latched_event);
+    RUN_TEST(test_motion_stale_sample_is_refreshed);
+    RUN_TEST(test_no_motion_is_not_latched);
+
+    RUN_TEST(test_epoch_unknown_retries_after_interval);
+    RUN_TEST(test_epoch_extrapolates_from_anchor);
+    RUN_TEST(test_epoch_failed_refresh_keeps_extrapolating);
+
+    return UNITY_END();
+}
@@ -0,0 +1,265 @@
+/**
+ * @file test_trace.cpp
+ * @brief Unit tests for the binary trace log
+ *
+ * Tests recording, drop accounting, frame encoding, draining with a
+ * record still being written and the drain wake-up from SongbirdTrace.cpp
+ * using PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+#include "SongbirdConfig.h"
+
+// The ring and encoder are pure; compile the real module (test_build_src = false)
+#include "SongbirdTrace.cpp"
+
+static uint8_t s_buffer[TRACE_FRAME_SIZE * (TRACE_RING_SIZE + 1)];
+
+static uint32_t getU32(const uint8_t* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+void setUp(void) {
+    traceInit();
+    memset(s_buffer, 0, sizeof(s_buffer));
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Frame Encoding
+// ============================================================================
+
+void test_frame_layout(void) {
+    TraceRecord record;
+    memset(&record, 0, sizeof(record));
+    record.event = TRACE_NC_ALERT_SENT;
+    record.task = RUNSTATS_TASK_NOTECARD;
+    record.timeUs = 0x12345678;
+    record.arg0 = 0x05;
+    record.arg1 = 0xA0B0C0D0;
+
+    uint8_t frame[TRACE_FRAME_SIZE];
+    traceEncodeFrame(&record, frame);
+
+    TEST_ASSERT_EQUAL_HEX8(TRACE_FRAME_SYNC0, frame[0]);
+    TEST_ASSERT_EQUAL_HEX8(TRACE_FRAME_SYNC1, frame[1]);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_NC_ALERT_SENT, frame[2]);
+    TEST_ASSERT_EQUAL_UINT8(RUNSTATS_TASK_NOTECARD, frame[3]);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, getU32(&frame[4]));
+    TEST_ASSERT_EQUAL_HEX32(0x05, getU32(&frame[8]));
+    TEST_ASSERT_EQUAL_HEX32(0xA0B0C0D0, getU32(&frame[12]));
+
+    uint8_t sum = 0;
+    for (uint8_t i = 2; i < TRACE_FRAME_SIZE - 1; i++) {
+        sum += frame[i];
+    }
+    TEST_ASSERT_EQUAL_HEX8(sum, frame[TRACE_FRAME_SIZE - 1]);
+}
+
+void test_centi_rounds_and_keeps_sign(void) {
+    TEST_ASSERT_EQUAL_INT32(2157, (int32_t)traceCenti(21.567f));
+    TEST_ASSERT_EQUAL_INT32(-1250, (int32_t)traceCenti(-12.5f));
+    TEST_ASSERT_EQUAL_INT32(0, (int32_t)traceCenti(0.0f));
+}
+
+// ============================================================================
+// Record and Drain
+// ============================================================================
+
+void test_drain_empty(void) {
+    TEST_ASSERT_EQUAL_UINT(0, traceDrain(s_buffer, sizeof(s_buffer)));
+}
+
+void test_record_then_drain_in_order(void) {
+    TEST_ASSERT_TRUE(traceRecordAt(100, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 1, 0, NULL));
+    TEST_ASSERT_TRUE(traceRecordAt(200, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 2, 0, NULL));
+    TEST_ASSERT_TRUE(traceRecordAt(300, RUNSTATS_TASK_ENV, TRACE_ENV_MODE, MODE_DEMO, MODE_TRANSIT, NULL));
+
+    TEST_ASSERT_EQUAL_UINT(3 * TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT32(1, getU32(&s_buffer[8]));
+    TEST_ASSERT_EQUAL_UINT32(2, getU32(&s_buffer[TRACE_FRAME_SIZE + 8]));
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ENV_MODE, s_buffer[2 * TRACE_FRAME_SIZE + 2]);
+    TEST_ASSERT_EQUAL_UINT32(MODE_TRANSIT, getU32(&s_buffer[2 * TRACE_FRAME_SIZE + 12]));
+
+    // Drained records are gone
+    TEST_ASSERT_EQUAL_UINT(0, traceDrain(s_buffer, sizeof(s_buffer)));
+}
+
+void test_drain_stops_at_buffer_size(void) {
+    for (uint32_t i = 0; i < 5; i++) {
+        traceRecordAt(i, RUNSTATS_TASK_SENSOR, TRACE_SENSOR_PRESSURE, i, 0, NULL);
+    }
+
+    // Room for two whole frames and part of a third
+    TEST_ASSERT_EQUAL_UINT(2 * TRACE_FRAME_SIZE, traceDrain(s_buffer, 2 * TRACE_FRAME_SIZE + 10));
+    TEST_ASSERT_EQUAL_UINT(3 * TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT32(2, getU32(&s_buffer[8]));
+}
+
+void test_full_ring_drops_and_reports(void) {
+    for (uint32_t i = 0; i < TRACE_RING_SIZE; i++) {
+        TEST_ASSERT_TRUE(traceRecordAt(i, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, i, 0, NULL));
+    }
+    TEST_ASSERT_FALSE(traceRecordAt(999, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 999, 0, NULL));
+    TEST_ASSERT_FALSE(traceRecordAt(999, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 999, 0, NULL));
+    TEST_ASSERT_EQUAL_UINT32(2, traceGetDropped());
+
+    // The drop count leads the drained records
+    size_t used = traceDrain(s_buffer, sizeof(s_buffer));
+    TEST_ASSERT_EQUAL_UINT((TRACE_RING_SIZE + 1) * TRACE_FRAME_SIZE, used);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_DROPPED, s_buffer[2]);
+    TEST_ASSERT_EQUAL_UINT32(2, getU32(&s_buffer[8]));
+
+    // Space is free again, and the drop is reported only once
+    TEST_ASSERT_TRUE(traceRecordAt(1000, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 1000, 0, NULL));
+    TEST_ASSERT_EQUAL_UINT(TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT8(TRACE_MAIN_CLICKS, s_buffer[2]);
+}
+
+void test_drop_frame_uses_last_drained_time(void) {
+    traceRecordAt(5000, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 0, 0, NULL);
+    traceDrain(s_buffer, sizeof(s_buffer));
+
+    __atomic_store_n(&s_dropped, 3, __ATOMIC_RELAXED);
+    TEST_ASSERT_EQUAL_UINT(TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT8(TRACE_DROPPED, s_buffer[2]);
+    TEST_ASSERT_EQUAL_UINT32(5000, getU32(&s_buffer[4]));
+    TEST_ASSERT_EQUAL_UINT32(3, getU32(&s_buffer[8]));
+}
+
+// ============================================================================
+// Concurrent Recording
+// ============================================================================
+
+void test_drain_waits_for_unfinished_record(void) {
+    traceRecordAt(10, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 1, 0, NULL);
+
+    // A writer reserved the next slot and was preempted before committing
+    __atomic_fetch_add(&s_head, 1, __ATOMIC_RELAXED);
+    traceRecordAt(30, RUNSTATS_TASK_AUDIO, TRACE_AUDIO_VOLUME, 3, 0, NULL);
+
+    TEST_ASSERT_EQUAL_UINT(TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT(0, traceDrain(s_buffer, sizeof(s_buffer)));
+
+    // The writer resumes and commits; both records follow in slot order
+    TraceRecord* slot = &s_ring[1];
+    slot->event = TRACE_MAIN_CLICKS;
+    slot->arg0 = 2;
+    __atomic_store_n(&slot->tag, (uint16_t)2, __ATOMIC_RELEASE);
+
+    TEST_ASSERT_EQUAL_UINT(2 * TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT32(2, getU32(&s_buffer[8]));
+    TEST_ASSERT_EQUAL_UINT8(TRACE_AUDIO_VOLUME, s_buffer[TRACE_FRAME_SIZE + 2]);
+}
+
+void test_stale_slot_from_previous_lap_not_drained(void) {
+    // Fill one lap and drain it, so every slot holds an old tag
+    for (uint32_t i = 0; i < TRACE_RING_SIZE; i++) {
+        traceRecordAt(i, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, i, 0, NULL);
+    }
+    traceDrain(s_buffer, sizeof(s_buffer));
+
+    // Reserved but uncommitted slot in the second lap
+    __atomic_fetch_add(&s_head, 1, __ATOMIC_RELAXED);
+    TEST_ASSERT_EQUAL_UINT(0, traceDrain(s_buffer, sizeof(s_buffer)));
+}
+
+void test_index_wrap(void) {
+    __atomic_store_n(&s_head, UINT32_MAX - 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_tail, UINT32_MAX - 1, __ATOMIC_RELAXED);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(traceRecordAt(i, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, i, 0, NULL));
+    }
+    TEST_ASSERT_EQUAL_UINT(4 * TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+    TEST_ASSERT_EQUAL_UINT32(3, getU32(&s_buffer[3 * TRACE_FRAME_SIZE + 8]));
+}
+
+// ============================================================================
+// Drain Wake-Up
+// ============================================================================
+
+void test_first_record_wakes_drain(void) {
+    bool wake = false;
+    TEST_ASSERT_FALSE(tracePending());
+    TEST_ASSERT_TRUE(traceRecordAt(10, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 1, 0, &wake));
+    TEST_ASSERT_TRUE(wake);
+    TEST_ASSERT_TRUE(tracePending());
+
+    // The drain has not reached the second record: no second notification
+    TEST_ASSERT_TRUE(traceRecordAt(20, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 2, 0, &wake));
+    TEST_ASSERT_FALSE(wake);
+
+    traceDrain(s_buffer, sizeof(s_buffer));
+    TEST_ASSERT_FALSE(tracePending());
+    TEST_ASSERT_TRUE(traceRecordAt(30, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 3, 0, &wake));
+    TEST_ASSERT_TRUE(wake);
+}
+
+void test_drain_stopped_at_slot_is_woken_by_its_writer(void) {
+    traceRecordAt(10, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 1, 0, NULL);
+
+    // A writer reserved the next slot; a later one commits behind it
+    __atomic_fetch_add(&s_head, 1, __ATOMIC_RELAXED);
+    bool wake = true;
+    traceRecordAt(30, RUNSTATS_TASK_AUDIO, TRACE_AUDIO_VOLUME, 3, 0, &wake);
+    TEST_ASSERT_FALSE(wake);
+
+    // The drain stops at the unfinished slot with nothing to write
+    traceDrain(s_buffer, sizeof(s_buffer));
+    TEST_ASSERT_FALSE(tracePending());
+
+    // The stalled writer finishes the way traceRecordAt() does, and sees
+    // the drain waiting at its slot
+    __atomic_store_n(&s_ring[1].tag, (uint16_t)2, __ATOMIC_SEQ_CST);
+    TEST_ASSERT_EQUAL_UINT32(1, __atomic_load_n(&s_tail, __ATOMIC_SEQ_CST));
+    TEST_ASSERT_TRUE(tracePending());
+    TEST_ASSERT_EQUAL_UINT(2 * TRACE_FRAME_SIZE, traceDrain(s_buffer, sizeof(s_buffer)));
+}
+
+void test_dropped_records_are_pending(void) {
+    __atomic_store_n(&s_dropped, 1, __ATOMIC_RELAXED);
+    TEST_ASSERT_TRUE(tracePending());
+    traceDrain(s_buffer, sizeof(s_buffer));
+    TEST_ASSERT_FALSE(tracePending());
+}
+
+void test_dropped_record_does_not_wake(void) {
+    for (uint32_t i = 0; i < TRACE_RING_SIZE; i++) {
+        traceRecordAt(i, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, i, 0, NULL);
+    }
+    bool wake = true;
+    TEST_ASSERT_FALSE(traceRecordAt(999, RUNSTATS_TASK_MAIN, TRACE_MAIN_CLICKS, 999, 0, &wake));
+    TEST_ASSERT_FALSE(wake);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_frame_layout);
+    RUN_TEST(test_centi_rounds_and_keeps_sign);
+
+    RUN_TEST(test_drain_empty);
+    RUN_TEST(test_record_then_drain_in_order);
+    RUN_TEST(test_drain_stops_at_buffer_size);
+    RUN_TEST(test_full_ring_drops_and_reports);
+    RUN_TEST(test_drop_frame_uses_last_drained_time);
+
+    RUN_TEST(test_drain_waits_for_unfinished_record);
+    RUN_TEST(test_stale_slot_from_previous_lap_not_drained);
+    RUN_TEST(test_index_wrap);
+
+    RUN_TEST(test_first_record_wakes_drain);
+    RUN_TEST(test_drain_stopped_at_slot_is_woken_by_its_writer);
+    RUN_TEST(test_dropped_records_are_pending);
+    RUN_TEST(test_dropped_record_does_not_wake);
+
+    return UNITY_END();
+}
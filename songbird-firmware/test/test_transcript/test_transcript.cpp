@@ -0,0 +1,174 @@
+/**
+ * @file test_transcript.cpp
+ * @brief Unit tests for the Notecard transcript ring and line format
+ *
+ * Tests recording, eviction and the NCT line format from
+ * SongbirdTranscript.cpp using PlatformIO Unity on the native platform.
+ */
+
+#include <unity.h>
+#include "native_stubs.h"
+
+// The ring and line format are pure; compile the real module (test_build_src = false)
+#include "SongbirdTranscript.cpp"
+
+static TranscriptEntry s_entry;
+
+void setUp(void) {
+    transcriptInit();
+    memset(&s_entry, 0, sizeof(s_entry));
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void test_record_and_get(void) {
+    transcriptRecord(1234, 5678, "{\"req\":\"hub.status\"}", "{\"connected\":true}");
+
+    TEST_ASSERT_EQUAL_UINT16(1, transcriptCount());
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+    TEST_ASSERT_EQUAL_UINT32(0, s_entry.seq);
+    TEST_ASSERT_EQUAL_UINT32(1234, s_entry.atMs);
+    TEST_ASSERT_EQUAL_UINT32(5678, s_entry.latencyUs);
+    TEST_ASSERT_EQUAL_UINT8(0, s_entry.flags);
+    TEST_ASSERT_EQUAL_STRING("{\"req\":\"hub.status\"}", s_entry.request);
+    TEST_ASSERT_EQUAL_STRING("{\"connected\":true}", s_entry.response);
+
+    TEST_ASSERT_FALSE(transcriptGet(1, &s_entry));
+}
+
+void test_no_response_is_flagged(void) {
+    transcriptRecord(0, 1000000, "{\"req\":\"card.version\"}", NULL);
+
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+    TEST_ASSERT_EQUAL_UINT8(TRANSCRIPT_FLAG_NO_RESPONSE, s_entry.flags);
+    TEST_ASSERT_EQUAL_STRING("", s_entry.response);
+}
+
+void test_long_text_is_truncated(void) {
+    char longText[TRANSCRIPT_TEXT_MAX + 50];
+    memset(longText, 'x', sizeof(longText) - 1);
+    longText[sizeof(longText) - 1] = '\0';
+
+    transcriptRecord(0, 0, longText, longText);
+
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+    TEST_ASSERT_EQUAL_UINT8(TRANSCRIPT_FLAG_REQUEST_TRUNCATED | TRANSCRIPT_FLAG_RESPONSE_TRUNCATED,
+                            s_entry.flags);
+    TEST_ASSERT_EQUAL(TRANSCRIPT_TEXT_MAX, strlen(s_entry.request));
+    TEST_ASSERT_EQUAL(TRANSCRIPT_TEXT_MAX, strlen(s_entry.response));
+}
+
+void test_full_ring_drops_oldest(void) {
+    char request[64];
+    uint32_t recorded = 0;
+
+    // Well past the buffer size, so records also straddle the wrap
+    for (; recorded < 400; recorded++) {
+        snprintf(request, sizeof(request), "{\"req\":\"env.get\",\"name\":\"var_%lu\"}",
+                 (unsigned long)recorded);
+        transcriptRecord(recorded * 10, recorded, request, "{\"text\":\"15\"}");
+    }
+
+    uint16_t count = transcriptCount();
+    TEST_ASSERT_TRUE(count > 0 && count < 400);
+    TEST_ASSERT_EQUAL_UINT32(400 - count, transcriptGetDropped());
+
+    // Oldest held record follows the dropped ones, newest is the last one
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+    TEST_ASSERT_EQUAL_UINT32(transcriptGetDropped(), s_entry.seq);
+
+    for (uint16_t i = 0; i < count; i++) {
+        TEST_ASSERT_TRUE(transcriptGet(i, &s_entry));
+        snprintf(request, sizeof(request), "{\"req\":\"env.get\",\"name\":\"var_%lu\"}",
+                 (unsigned long)s_entry.seq);
+        TEST_ASSERT_EQUAL_STRING(request, s_entry.request);
+        TEST_ASSERT_EQUAL_STRING("{\"text\":\"15\"}", s_entry.response);
+        TEST_ASSERT_EQUAL_UINT32(s_entry.seq * 10, s_entry.atMs);
+    }
+    TEST_ASSERT_EQUAL_UINT32(399, s_entry.seq);
+}
+
+void test_init_clears(void) {
+    transcriptRecord(0, 0, "{}", "{}");
+    transcriptInit();
+    TEST_ASSERT_EQUAL_UINT16(0, transcriptCount());
+    TEST_ASSERT_EQUAL_UINT32(0, transcriptGetDropped());
+    TEST_ASSERT_FALSE(transcriptGet(0, &s_entry));
+}
+
+// ============================================================================
+// Line Format
+// ============================================================================
+
+void test_format_line(void) {
+    transcriptRecord(60000, 8250000, "{\"req\":\"hub.status\"}", "{\"connected\":true}");
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+
+    char line[TRANSCRIPT_LINE_MAX];
+    TEST_ASSERT_TRUE(transcriptFormat(&s_entry, line, sizeof(line)) > 0);
+    TEST_ASSERT_EQUAL_STRING("NCT\t0\t60000\t8250000\t0\t{\"req\":\"hub.status\"}\t{\"connected\":true}",
+                             line);
+
+    // Too small
+    TEST_ASSERT_EQUAL(0, transcriptFormat(&s_entry, line, 10));
+}
+
+void test_format_parse_round_trip(void) {
+    char longText[TRANSCRIPT_TEXT_MAX + 1];
+    memset(longText, 'y', sizeof(longText) - 1);
+    longText[sizeof(longText) - 1] = '\0';
+    transcriptRecord(UINT32_MAX, UINT32_MAX, longText, longText);
+    TEST_ASSERT_TRUE(transcriptGet(0, &s_entry));
+
+    char line[TRANSCRIPT_LINE_MAX];
+    TEST_ASSERT_TRUE(transcriptFormat(&s_entry, line, sizeof(line)) > 0);
+
+    TranscriptEntry parsed;
+    TEST_ASSERT_TRUE(transcriptParse(line, &parsed));
+    TEST_ASSERT_EQUAL_UINT32(s_entry.atMs, parsed.atMs);
+    TEST_ASSERT_EQUAL_UINT32(s_entry.latencyUs, parsed.latencyUs);
+    TEST_ASSERT_EQUAL_STRING(s_entry.request, parsed.request);
+    TEST_ASSERT_EQUAL_STRING(s_entry.response, parsed.response);
+}
+
+void test_parse_accepts_line_endings(void) {
+    TEST_ASSERT_TRUE(transcriptParse("NCT\t7\t100\t2000\t4\t{\"req\":\"card.time\"}\t\r\n", &s_entry));
+    TEST_ASSERT_EQUAL_UINT32(7, s_entry.seq);
+    TEST_ASSERT_EQUAL_UINT8(TRANSCRIPT_FLAG_NO_RESPONSE, s_entry.flags);
+    TEST_ASSERT_EQUAL_STRING("{\"req\":\"card.time\"}", s_entry.request);
+    TEST_ASSERT_EQUAL_STRING("", s_entry.response);
+}
+
+void test_parse_rejects_malformed(void) {
+    TEST_ASSERT_FALSE(transcriptParse("[Profile] sensor 12 us", &s_entry));
+    TEST_ASSERT_FALSE(transcriptParse("NCT\t1\t2\t3\t{}\t{}", &s_entry));          // Missing field
+    TEST_ASSERT_FALSE(transcriptParse("NCT\t1\tx\t3\t0\t{}\t{}", &s_entry));       // Not a number
+    TEST_ASSERT_FALSE(transcriptParse("NCT\t1\t2\t3\t0\t{}", &s_entry));           // No response field
+    TEST_ASSERT_FALSE(transcriptParse("NCT\t1\t2\t3\t0\t{}\t{}\t{}", &s_entry));   // Extra field
+    TEST_ASSERT_FALSE(transcriptParse(NULL, &s_entry));
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_record_and_get);
+    RUN_TEST(test_no_response_is_flagged);
+    RUN_TEST(test_long_text_is_truncated);
+    RUN_TEST(test_full_ring_drops_oldest);
+    RUN_TEST(test_init_clears);
+
+    RUN_TEST(test_format_line);
+    RUN_TEST(test_format_parse_round_trip);
+    RUN_TEST(test_parse_accepts_line_endings);
+    RUN_TEST(test_parse_rejects_malformed);
+
+    return UNITY_END();
+}
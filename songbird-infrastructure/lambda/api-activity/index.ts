@@ -353,6 +353,8 @@ function formatCommandMessage(cmd: any): string {
     play_melody: 'Play melody command',
     test_audio: 'Test audio command',
     set_volume: 'Set volume command',
+    profile: 'Profile command',
+    transcript: 'Transcript command',
   };
 
   const label = cmdLabels[cmd.cmd] || cmd.cmd || 'Command';
@@ -174,6 +174,42 @@ describe('POST /devices/{serial_number}/commands - send command', () => {
     expect(body.params).toEqual({ melody: 'happy_birthday' });
   });
 
+  it('sends the profile command with its reset param', async () => {
+    const event = makeEvent({
+      httpMethod: 'POST',
+      requestContext: {
+        http: { method: 'POST', path: '/devices/sb01/commands' },
+        authorizer: { jwt: { claims: { 'cognito:groups': 'Admin' } } },
+      } as any,
+      body: JSON.stringify({ cmd: 'profile', params: { reset: true } }),
+    });
+
+    const result = await handler(event);
+    expect(result.statusCode).toBe(200);
+
+    const body = JSON.parse(result.body);
+    expect(body.cmd).toBe('profile');
+    expect(body.params).toEqual({ reset: true });
+  });
+
+  it('sends the transcript command with its clear param', async () => {
+    const event = makeEvent({
+      httpMethod: 'POST',
+      requestContext: {
+        http: { method: 'POST', path: '/devices/sb01/commands' },
+        authorizer: { jwt: { claims: { 'cognito:groups': 'Admin' } } },
+      } as any,
+      body: JSON.stringify({ cmd: 'transcript', params: { clear: true } }),
+    });
+
+    const result = await handler(event);
+    expect(result.statusCode).toBe(200);
+
+    const body = JSON.parse(result.body);
+    expect(body.cmd).toBe('transcript');
+    expect(body.params).toEqual({ clear: true });
+  });
+
   it('rejects invalid command', async () => {
     const event = makeEvent({
       httpMethod: 'POST',
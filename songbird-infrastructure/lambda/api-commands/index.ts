@@ -56,7 +56,7 @@ async function getNotehubToken(): Promise<string> {
 }
 
 // Supported commands
-const VALID_COMMANDS = ['ping', 'locate', 'play_melody', 'test_audio', 'set_volume', 'unlock'];
+const VALID_COMMANDS = ['ping', 'locate', 'play_melody', 'test_audio', 'set_volume', 'unlock', 'profile', 'transcript'];
 
 // Commands that require admin or device owner permissions
 const RESTRICTED_COMMANDS = ['unlock'];
@@ -505,6 +505,99 @@ describe('handler - alert.qo events', () => {
   });
 });
 
+describe('handler - coalesced alert.qo events', () => {
+  it('fans out one alert per raised flag', async () => {
+    ddbMock.on(QueryCommand).resolves({ Items: [] });
+
+    const notehubEvent = makeNotehubEvent({
+      file: 'alert.qo',
+      body: {
+        raised: 0x01 | 0x04 | 0x20,   // temp_high, humidity_high, low_battery
+        cleared: 0x10,
+        temp: 36.2,
+        humidity: 84,
+        pressure: 1001.5,
+        voltage: 3.3,
+      },
+    });
+
+    const event = makeEvent(notehubEvent);
+    await handler(event);
+
+    const putCalls = ddbMock.commandCalls(PutCommand);
+    const types = putCalls
+      .filter(c => c.args[0].input.TableName === process.env.ALERTS_TABLE)
+      .map(c => c.args[0].input.Item?.type);
+    expect(types).toEqual(['temp_high', 'humidity_high', 'low_battery']);
+
+    const battery = putCalls.find(c => c.args[0].input.Item?.type === 'low_battery');
+    expect(battery!.args[0].input.Item?.value).toBe(3.3);
+
+    const snsCalls = snsMock.commandCalls(PublishCommand);
+    expect(snsCalls.length).toBe(3);
+  });
+
+  it('uses the 3 hour tendency as the pressure alert value', async () => {
+    ddbMock.on(QueryCommand).resolves({ Items: [] });
+
+    const notehubEvent = makeNotehubEvent({
+      file: 'alert.qo',
+      body: { raised: 0x10, cleared: 0, temp: 20, humidity: 50, pressure: 1001.5, voltage: 4.0, pressure_delta: -11.2 },
+    });
+
+    await handler(makeEvent(notehubEvent));
+
+    const putCalls = ddbMock.commandCalls(PutCommand);
+    const alertRecord = putCalls.find(c => c.args[0].input.Item?.type === 'pressure_change');
+    expect(alertRecord!.args[0].input.Item?.value).toBe(-11.2);
+    expect(alertRecord!.args[0].input.Item?.message).toContain('-11.2 hPa');
+  });
+
+  it('carries the threshold of each raised alert', async () => {
+    ddbMock.on(QueryCommand).resolves({ Items: [] });
+
+    const notehubEvent = makeNotehubEvent({
+      file: 'alert.qo',
+      body: {
+        raised: 0x02 | 0x20,   // temp_low, low_battery
+        cleared: 0,
+        temp: -2.5,
+        humidity: 50,
+        pressure: 1010,
+        voltage: 3.3,
+        temp_th: 0,
+        voltage_th: 3.4,
+      },
+    });
+
+    await handler(makeEvent(notehubEvent));
+
+    const putCalls = ddbMock.commandCalls(PutCommand);
+    const tempLow = putCalls.find(c => c.args[0].input.Item?.type === 'temp_low');
+    expect(tempLow!.args[0].input.Item?.threshold).toBe(0);
+    const battery = putCalls.find(c => c.args[0].input.Item?.type === 'low_battery');
+    expect(battery!.args[0].input.Item?.threshold).toBe(3.4);
+
+    const published = snsMock.commandCalls(PublishCommand)
+      .map(c => JSON.parse(c.args[0].input.Message as string));
+    expect(published.map(m => m.threshold)).toEqual([0, 3.4]);
+  });
+
+  it('stores nothing for a note that only clears alerts', async () => {
+    const notehubEvent = makeNotehubEvent({
+      file: 'alert.qo',
+      body: { raised: 0, cleared: 0x01, temp: 30, humidity: 50, pressure: 1010, voltage: 4.0 },
+    });
+
+    await handler(makeEvent(notehubEvent));
+
+    const putCalls = ddbMock.commandCalls(PutCommand);
+    const alertRecords = putCalls.filter(c => c.args[0].input.TableName === process.env.ALERTS_TABLE);
+    expect(alertRecords.length).toBe(0);
+    expect(snsMock.commandCalls(PublishCommand).length).toBe(0);
+  });
+});
+
 describe('handler - command_ack.qo events', () => {
   it('updates command status on acknowledgment', async () => {
     const notehubEvent = makeNotehubEvent({
@@ -615,6 +708,19 @@ describe('handler - location extraction', () => {
 });
 
 describe('handler - session info extraction', () => {
+  it('stores the boot time from the first track.qo of a boot', async () => {
+    const notehubEvent = makeNotehubEvent();
+    notehubEvent.body = { ...notehubEvent.body, boot_flags: 3, boot_total_ms: 4210 } as any;
+
+    await handler(makeEvent(notehubEvent));
+
+    const deviceUpdate = ddbMock.commandCalls(UpdateCommand).find(
+      c => c.args[0].input.TableName === process.env.DEVICES_TABLE
+    );
+    const values = deviceUpdate!.args[0].input.ExpressionAttributeValues!;
+    expect(values[':last_boot']).toEqual({ flags: 3, total_ms: 4210, timestamp: 1700000000 });
+  });
+
   it('extracts firmware versions from _session.qo events', async () => {
     const notehubEvent = makeNotehubEvent({
       file: 'track.qo',
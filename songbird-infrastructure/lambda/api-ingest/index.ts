@@ -58,11 +58,26 @@ interface NotehubEvent {
     transit_locked?: boolean;
     demo_locked?: boolean;
     gps_power_saving?: boolean;
+    // Compact boot profile (first track.qo of each boot)
+    boot_flags?: number;
+    boot_total_ms?: number;
     // Alert-specific fields
     type?: string;
     value?: number;
     threshold?: number;
     message?: string;
+    // Coalesced alert fields (one alert.qo note per sensor cycle)
+    raised?: number;
+    cleared?: number;
+    voltage?: number;
+    temp_rate?: number;
+    pressure_delta?: number;
+    // Threshold of each raised alert (absent when not raised)
+    temp_th?: number;
+    humidity_th?: number;
+    pressure_delta_th?: number;
+    voltage_th?: number;
+    temp_rate_th?: number;
     // Command ack fields
     cmd?: string;
     status?: string;
@@ -248,10 +263,12 @@ export const handler = async (event: APIGatewayProxyEvent): Promise<APIGatewayPr
       await completeActiveJourneysOnModeChange(songbirdEvent.device_uid, songbirdEvent.body.mode);
     }
 
-    // Store and publish alert if this is an alert event
+    // Store and publish alerts if this is an alert event
     if (songbirdEvent.event_type === 'alert.qo') {
-      await storeAlert(songbirdEvent);
-      await publishAlert(songbirdEvent);
+      for (const alertEvent of expandAlertNote(songbirdEvent)) {
+        await storeAlert(alertEvent);
+        await publishAlert(alertEvent);
+      }
     }
 
     // Check for GPS power save state change (track.qo only)
@@ -407,10 +424,21 @@ interface SongbirdEvent {
     transit_locked?: boolean;
     demo_locked?: boolean;
     gps_power_saving?: boolean;
+    boot_flags?: number;
+    boot_total_ms?: number;
     type?: string;
     value?: number;
     threshold?: number;
     message?: string;
+    raised?: number;
+    cleared?: number;
+    temp_rate?: number;
+    pressure_delta?: number;
+    temp_th?: number;
+    humidity_th?: number;
+    pressure_delta_th?: number;
+    voltage_th?: number;
+    temp_rate_th?: number;
     cmd?: string;
     cmd_id?: string;
     status?: string;
@@ -982,6 +1010,17 @@ async function updateDeviceMetadata(event: SongbirdEvent): Promise<void> {
       motion: event.body.motion,
       timestamp: event.timestamp,
     };
+
+    // The first track.qo of each boot says how long the boot took
+    if (event.body.boot_total_ms !== undefined) {
+      updateExpressions.push('#last_boot = :last_boot');
+      expressionAttributeNames['#last_boot'] = 'last_boot';
+      expressionAttributeValues[':last_boot'] = {
+        flags: event.body.boot_flags,
+        total_ms: event.body.boot_total_ms,
+        timestamp: event.timestamp,
+      };
+    }
   }
 
   if (event.event_type === '_log.qo') {
@@ -1111,6 +1150,58 @@ async function processCommandAck(event: SongbirdEvent): Promise<void> {
   console.log(`Updated command ${cmdId} with status: ${event.body.status}`);
 }
 
+// Alert flag bits packed into coalesced alert.qo notes
+// (ALERT_FLAG_* in songbird-firmware/src/core/SongbirdConfig.h)
+const ALERT_FLAGS: {
+  bit: number;
+  type: string;
+  field: 'temp' | 'humidity' | 'pressure_delta' | 'voltage' | 'temp_rate';
+  thresholdField: 'temp_th' | 'humidity_th' | 'pressure_delta_th' | 'voltage_th' | 'temp_rate_th';
+  message: (value: string) => string;
+}[] = [
+  { bit: 1 << 0, type: 'temp_high', field: 'temp', thresholdField: 'temp_th', message: v => `Temperature ${v}C above threshold` },
+  { bit: 1 << 1, type: 'temp_low', field: 'temp', thresholdField: 'temp_th', message: v => `Temperature ${v}C below threshold` },
+  { bit: 1 << 2, type: 'humidity_high', field: 'humidity', thresholdField: 'humidity_th', message: v => `Humidity ${v}% above threshold` },
+  { bit: 1 << 3, type: 'humidity_low', field: 'humidity', thresholdField: 'humidity_th', message: v => `Humidity ${v}% below threshold` },
+  { bit: 1 << 4, type: 'pressure_change', field: 'pressure_delta', thresholdField: 'pressure_delta_th', message: v => `Pressure changed ${v} hPa in 3 hours` },
+  { bit: 1 << 5, type: 'low_battery', field: 'voltage', thresholdField: 'voltage_th', message: () => 'Battery voltage low. Charge now.' },
+  { bit: 1 << 7, type: 'temp_rate', field: 'temp_rate', thresholdField: 'temp_rate_th', message: v => `Temperature changing ${v}C per hour` },
+];
+
+/**
+ * Expand an alert.qo note into one event per alert.
+ * Current firmware sends every alert raised in a sensor cycle as one note
+ * (raised/cleared bitmasks, values and the threshold of each raised alert);
+ * older firmware sends one note per alert with type/value/threshold/message,
+ * which passes through unchanged.
+ */
+function expandAlertNote(event: SongbirdEvent): SongbirdEvent[] {
+  const raised = event.body.raised;
+  if (raised === undefined) {
+    return [event];
+  }
+
+  if (event.body.cleared) {
+    console.log(`Alerts cleared on ${event.device_uid}: 0x${event.body.cleared.toString(16)}`);
+  }
+
+  return ALERT_FLAGS
+    .filter(flag => (raised & flag.bit) !== 0)
+    .map(flag => {
+      const value = event.body[flag.field];
+      return {
+        ...event,
+        body: {
+          ...event.body,
+          type: flag.type,
+          value,
+          threshold: event.body[flag.thresholdField],
+          message: flag.message(value !== undefined ? value.toFixed(1) : '?'),
+        },
+      };
+    });
+}
+
 async function storeAlert(event: SongbirdEvent): Promise<void> {
   const alertType = event.body.type || 'unknown';
 